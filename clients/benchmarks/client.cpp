@@ -13,23 +13,48 @@
 #include "testing_iamin.hpp"
 #include "testing_asum.hpp"
 #include "testing_axpy.hpp"
+#include "testing_blas1_batched.hpp"
+#include "testing_blas1_fused.hpp"
 #include "testing_copy.hpp"
 #include "testing_dot.hpp"
+#include "testing_mdot.hpp"
+#include "testing_maxpy.hpp"
 #include "testing_swap.hpp"
 #include "testing_gemv.hpp"
+#include "testing_gemv_sweep.hpp"
 #include "testing_ger.hpp"
 #include "testing_syr.hpp"
+#include "testing_symv.hpp"
+#include "testing_tbsv.hpp"
+#include "testing_band_mv.hpp"
+#include "testing_packed.hpp"
+#include "testing_rank_update.hpp"
 #include "testing_nrm2.hpp"
+#include "testing_reduction_sweep.hpp"
+#include "testing_reduction_mode.hpp"
+#include "testing_accumulation_mode.hpp"
+#include "testing_host_result_mode.hpp"
+#include "testing_half_blas1.hpp"
+#include "testing_rot.hpp"
+#include "testing_rotg.hpp"
 #include "testing_scal.hpp"
 #include "testing_trtri.hpp"
 #include "testing_trtri_batched.hpp"
 #include "testing_geam.hpp"
+#include "testing_transpose_inplace.hpp"
+#include "testing_order.hpp"
+#include "testing_convert.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_matrix.hpp"
 #if BUILD_WITH_TENSILE
 #include "testing_gemm.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_trsm.hpp"
+#include "testing_trsm_small.hpp"
+#include "testing_syrk.hpp"
+#include "testing_syr2k.hpp"
+#include "testing_symm.hpp"
+#include "testing_trsv.hpp"
 #endif
 
 namespace po = boost::program_options;
@@ -74,6 +99,14 @@ int main(int argc, char* argv[])
          "Specific matrix size testing:sizek is only applicable to BLAS-3: the number of columns in "
          "A & C  and rows in B.")
 
+        ("kl",
+         po::value<rocblas_int>(&argus.KL)->default_value(128),
+         "Number of sub-diagonals of the band matrix A, only applicable to gbmv.")
+
+        ("ku",
+         po::value<rocblas_int>(&argus.KU)->default_value(128),
+         "Number of super-diagonals of the band matrix A, only applicable to gbmv.")
+
         ("lda",
          po::value<rocblas_int>(&argus.lda)->default_value(128),
          "Specific leading dimension of matrix A, is only applicable to "
@@ -120,7 +153,16 @@ int main(int argc, char* argv[])
               
         ("function,f",
          po::value<std::string>(&function)->default_value("gemv"),
-         "BLAS function to test. Options: gemv, ger, syr, trsm, trmm, symv, syrk, syr2k")
+         "BLAS function to test. Options: gemv, gemv_sweep, ger, syr, trsv, tbsv, trsm, trmm, "
+         "symv, hemv, syrk, syr2k, symm, trsm_small_sweep, reduction_sweep, scal_batched, "
+         "copy_batched, swap_batched, axpy_batched, dot_batched, asum_batched, nrm2_batched, "
+         "iamax_batched, mdot, maxpy, axpy_dot, dot_nrm2, scal_copy, reduction_mode, "
+         "accumulation_mode, host_result_mode, rot, rot_strided_batched, rot_batched, "
+         "rot_sequence, rotm, rotm_strided_batched, rotg, rotmg, transpose_inplace, "
+         "transpose_inplace_batched, gemm_order, gemv_order, ger_order, geam_order, trsm_order, "
+         "copy_ex, convert, convert_matrix, gbmv, gbmv_strided_batched, gbmv_batched, sbmv, "
+         "sbmv_strided_batched, sbmv_batched, spmv, spr, spr2, tpmv, tpsv, tpttr, syr2, her, "
+         "her2, ger_strided_batched, syr_strided_batched, syr2_strided_batched")
         
         ("precision,r", 
          po::value<char>(&precision)->default_value('s'), "Options: h,s,d,c,z")
@@ -145,6 +187,22 @@ int main(int argc, char* argv[])
          po::value<char>(&argus.diag_option)->default_value('N'),
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm
                                                                                           // xtrmm
+        ("order",
+         po::value<char>(&argus.order_option)->default_value('C'),
+         "C = column major, R = row major. Only applicable to the _order routines")
+
+        ("y_precision",
+         po::value<char>(&argus.y_precision_option)->default_value('s'),
+         "Precision of y (B), h,s,d. Only applicable to copy_ex and convert")
+
+        ("rounding",
+         po::value<char>(&argus.rounding_option)->default_value('N'),
+         "N = to the nearest, S = stochastic. Only applicable to convert")
+
+        ("seed",
+         po::value<rocblas_int>(&argus.seed)->default_value(0),
+         "Seed of the stochastic rounding. Only applicable to convert")
+
         ("batch",
          po::value<rocblas_int>(&argus.batch_count)->default_value(10),
          "Number of matrices. Only applicable to batched routines") // xtrsm xtrmm
@@ -200,7 +258,9 @@ int main(int argc, char* argv[])
 
     if(function == "asum")
     {
-        if(precision == 's')
+        if(precision == 'h')
+            testing_half_blas1<rocblas_half>(argus, function);
+        else if(precision == 's')
             testing_asum<float, float>(argus);
         else if(precision == 'd')
             testing_asum<double, double>(argus);
@@ -223,7 +283,9 @@ int main(int argc, char* argv[])
     }
     else if(function == "dot")
     {
-        if(precision == 's')
+        if(precision == 'h')
+            testing_half_blas1<rocblas_half>(argus, function);
+        else if(precision == 's')
             testing_dot<float>(argus);
         else if(precision == 'd')
             testing_dot<double>(argus);
@@ -237,7 +299,9 @@ int main(int argc, char* argv[])
     }
     else if(function == "iamax")
     {
-        if(precision == 's')
+        if(precision == 'h')
+            testing_half_blas1<rocblas_half>(argus, function);
+        else if(precision == 's')
             testing_iamax<float>(argus);
         else if(precision == 'd')
             testing_iamax<double>(argus);
@@ -251,14 +315,109 @@ int main(int argc, char* argv[])
     }
     else if(function == "nrm2")
     {
-        if(precision == 's')
+        if(precision == 'h')
+            testing_half_blas1<rocblas_half>(argus, function);
+        else if(precision == 's')
             testing_nrm2<float, float>(argus);
         else if(precision == 'd')
             testing_nrm2<double, double>(argus);
     }
-    else if(function == "scal")
+    else if(function == "mdot")
+    {
+        if(precision == 's')
+            testing_mdot<float>(argus);
+        else if(precision == 'd')
+            testing_mdot<double>(argus);
+    }
+    else if(function == "maxpy")
+    {
+        if(precision == 's')
+            testing_maxpy<float>(argus);
+        else if(precision == 'd')
+            testing_maxpy<double>(argus);
+    }
+    else if(function == "axpy_dot" || function == "dot_nrm2" || function == "scal_copy")
+    {
+        // times the fused routine and the sequence of unfused routines it replaces
+        if(precision == 's')
+            testing_blas1_fused<float>(argus, function);
+        else if(precision == 'd')
+            testing_blas1_fused<double>(argus, function);
+    }
+    else if(function == "rot" || function == "rot_strided_batched" || function == "rot_batched" ||
+            function == "rot_sequence" || function == "rotm" || function == "rotm_strided_batched")
+    {
+        // rot_sequence also times the k unfused rot calls it replaces
+        if(precision == 's')
+            testing_rot<float>(argus, function);
+        else if(precision == 'd')
+            testing_rot<double>(argus, function);
+    }
+    else if(function == "rotg" || function == "rotmg")
+    {
+        if(precision == 's')
+            testing_rotg<float>(argus, function);
+        else if(precision == 'd')
+            testing_rotg<double>(argus, function);
+    }
+    else if(function == "scal_batched" || function == "copy_batched" ||
+            function == "swap_batched" || function == "axpy_batched" || function == "dot_batched" ||
+            function == "asum_batched" || function == "nrm2_batched" || function == "iamax_batched")
+    {
+        // times _strided_batched, _batched and a loop of single calls of the routine
+        std::string routine = function.substr(0, function.size() - std::string("_batched").size());
+
+        if(precision == 's')
+            testing_blas1_batched<float>(argus, routine);
+        else if(precision == 'd')
+            testing_blas1_batched<double>(argus, routine);
+    }
+    else if(function == "reduction_mode")
+    {
+        // times default against deterministic reductions for each reduction routine
+        const char* routines[] = {"dot", "asum", "nrm2", "dot_nrm2", "mdot"};
+
+        for(const char* routine : routines)
+        {
+            if(precision == 's')
+                testing_reduction_mode<float>(argus, routine);
+            else if(precision == 'd')
+                testing_reduction_mode<double>(argus, routine);
+        }
+    }
+    else if(function == "accumulation_mode")
+    {
+        // error and time of each accumulation mode and of cblas for each reduction routine
+        const char* routines[] = {"dot", "asum", "nrm2", "mdot", "axpy_dot", "dot_nrm2"};
+
+        for(const char* routine : routines)
+        {
+            if(precision == 's')
+                testing_accumulation_mode<float>(argus, routine);
+            else if(precision == 'd')
+                testing_accumulation_mode<double>(argus, routine);
+        }
+    }
+    else if(function == "host_result_mode")
     {
+        // --batch reductions per mode
         if(precision == 's')
+            testing_host_result_mode<float>(argus);
+        else if(precision == 'd')
+            testing_host_result_mode<double>(argus);
+    }
+    else if(function == "reduction_sweep")
+    {
+        if(precision == 's')
+            testing_reduction_sweep<float>(argus);
+        else if(precision == 'd')
+            testing_reduction_sweep<double>(argus);
+    }
+    else if(function == "scal")
+    {
+        if(precision == 'h')
+            testing_half_blas1<rocblas_half>(argus, function);
+        else if(precision == 's')
             testing_scal<float>(argus);
         else if(precision == 'd')
             testing_scal<double>(argus);
@@ -270,6 +429,14 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_gemv<double>(argus);
     }
+    else if(function == "gemv_sweep")
+    {
+        // -m largest short dimension, -n long dimension
+        if(precision == 's')
+            testing_gemv_sweep<float>(argus);
+        else if(precision == 'd')
+            testing_gemv_sweep<double>(argus);
+    }
     else if(function == "ger")
     {
         if(precision == 's')
@@ -284,6 +451,66 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_syr<double>(argus);
     }
+    else if(function == "syr2" || function == "ger_strided_batched" ||
+            function == "syr_strided_batched" || function == "syr2_strided_batched")
+    {
+        if(precision == 's')
+            testing_rank_update<float>(argus, function);
+        else if(precision == 'd')
+            testing_rank_update<double>(argus, function);
+    }
+    else if(function == "her" || function == "her2")
+    {
+        if(precision == 'c')
+            testing_hermitian_rank_update<rocblas_float_complex, float>(argus, function);
+        else if(precision == 'z')
+            testing_hermitian_rank_update<rocblas_double_complex, double>(argus, function);
+    }
+    else if(function == "symv")
+    {
+        if(precision == 's')
+            testing_symv<float>(argus);
+        else if(precision == 'd')
+            testing_symv<double>(argus);
+    }
+    else if(function == "hemv")
+    {
+        if(precision == 'c')
+            testing_hemv<rocblas_float_complex, float>(argus);
+        else if(precision == 'z')
+            testing_hemv<rocblas_double_complex, double>(argus);
+    }
+    else if(function == "tbsv")
+    {
+        if(precision == 's')
+            testing_tbsv<float>(argus);
+        else if(precision == 'd')
+            testing_tbsv<double>(argus);
+    }
+    else if(function == "gbmv" || function == "gbmv_strided_batched" ||
+            function == "gbmv_batched" || function == "sbmv" ||
+            function == "sbmv_strided_batched" || function == "sbmv_batched")
+    {
+        if(precision == 's')
+            testing_band_mv<float>(argus, function);
+        else if(precision == 'd')
+            testing_band_mv<double>(argus, function);
+    }
+    else if(function == "spmv" || function == "spr" || function == "spr2" ||
+            function == "tpmv" || function == "tpsv" || function == "tpttr")
+    {
+        // tpttr unpacks into full storage
+        if(function == "tpttr" && argus.lda < argus.N)
+        {
+            std::cout << "rocblas-bench INFO: lda < N, set lda = " << argus.N << std::endl;
+            argus.lda = argus.N;
+        }
+
+        if(precision == 's')
+            testing_packed<float>(argus, function);
+        else if(precision == 'd')
+            testing_packed<double>(argus, function);
+    }
     else if(function == "trtri")
     {
         if(precision == 's')
@@ -305,6 +532,30 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_geam<double>(argus);
     }
+    else if(function == "transpose_inplace" || function == "transpose_inplace_batched")
+    {
+        if(precision == 's')
+            testing_transpose_inplace<float>(argus, function);
+        else if(precision == 'd')
+            testing_transpose_inplace<double>(argus, function);
+    }
+    else if(function == "gemm_order" || function == "gemv_order" || function == "ger_order" ||
+            function == "geam_order" || function == "trsm_order")
+    {
+        if(precision == 's')
+            testing_order<float>(argus, function);
+        else if(precision == 'd')
+            testing_order<double>(argus, function);
+    }
+    else if(function == "copy_ex" || function == "convert" || function == "convert_matrix")
+    {
+        if(precision == 'h')
+            testing_convert<rocblas_half>(argus, function);
+        else if(precision == 's')
+            testing_convert<float>(argus, function);
+        else if(precision == 'd')
+            testing_convert<double>(argus, function);
+    }
     else if(function == "set_get_vector")
     {
         if(precision == 's')
@@ -404,6 +655,55 @@ int main(int argc, char* argv[])
         else if(precision == 'd')
             testing_trsm<double>(argus);
     }
+    else if(function == "trsm_small_sweep")
+    {
+        if(precision == 's')
+            testing_trsm_small<float>(argus);
+        else if(precision == 'd')
+            testing_trsm_small<double>(argus);
+    }
+    else if(function == "syrk")
+    {
+        if(precision == 's')
+            testing_syrk<float>(argus);
+        else if(precision == 'd')
+            testing_syrk<double>(argus);
+    }
+    else if(function == "syrk_strided_batched")
+    {
+        if(precision == 's')
+            testing_syrk_strided_batched<float>(argus);
+        else if(precision == 'd')
+            testing_syrk_strided_batched<double>(argus);
+    }
+    else if(function == "syr2k")
+    {
+        if(precision == 's')
+            testing_syr2k<float>(argus);
+        else if(precision == 'd')
+            testing_syr2k<double>(argus);
+    }
+    else if(function == "syr2k_strided_batched")
+    {
+        if(precision == 's')
+            testing_syr2k_strided_batched<float>(argus);
+        else if(precision == 'd')
+            testing_syr2k_strided_batched<double>(argus);
+    }
+    else if(function == "symm")
+    {
+        if(precision == 's')
+            testing_symm<float>(argus);
+        else if(precision == 'd')
+            testing_symm<double>(argus);
+    }
+    else if(function == "trsv")
+    {
+        if(precision == 's')
+            testing_trsv<float>(argus);
+        else if(precision == 'd')
+            testing_trsv<double>(argus);
+    }
 #endif
     else
     {
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdio.h>
+#include <boost/program_options.hpp>
+
+#include "rocblas.h"
+#include "tune.h"
+
+namespace po = boost::program_options;
+
+/*
+    rocblas-tune -p problems.txt -l library/src/blas3/Tensile/Logic/asm_full -s mi25
+                 -o library/src/blas3/Tensile/Logic/other -c "<benchmark command>"
+
+    writes every Logic file of the schedule to the output directory, those of the problem types
+    in the problem set with the tuned sizes in their exact logic, so that the directory is a
+    complete library for Tensile_LOGIC=other.
+*/
+int main(int argc, char* argv[])
+{
+    std::string problems_file;
+    std::string logic_dir;
+    std::string schedule;
+    std::string output_dir;
+    std::string command;
+    rocblas_int iters;
+    bool simulate = false;
+
+    po::options_description desc("rocblas-tune command line options");
+    desc.add_options()("help,h", "produces this help message")
+        // clang-format off
+        ("problems,p",
+         po::value<std::string>(&problems_file),
+         "File of the gemm problems to tune, one rocblas-bench command line each: the output of "
+         "ROCBLAS_LAYER=2, or lines of rocblas-bench arguments like "
+         "-f gemm -r s --transposeA N --transposeB T -m 4096 -n 7000 -k 4096")
+
+        ("logic,l",
+         po::value<std::string>(&logic_dir),
+         "Directory of the base Logic files, e.g. library/src/blas3/Tensile/Logic/asm_full")
+
+        ("schedule,s",
+         po::value<std::string>(&schedule)->default_value("mi25"),
+         "Schedule of the base Logic files, the prefix of their names: mi25, vega10, r9nano, hip")
+
+        ("output,o",
+         po::value<std::string>(&output_dir)->default_value("."),
+         "Directory the tuned Logic files are written to, library/src/blas3/Tensile/Logic/other "
+         "to build rocBLAS with them")
+
+        ("command,c",
+         po::value<std::string>(&command),
+         "Command that times one solution of the base library on one problem and prints the "
+         "time in microseconds last. {precision}, {transA}, {transB}, {m}, {n}, {k}, {batch} "
+         "and {solution} are replaced by those of the run")
+
+        ("simulate",
+         po::bool_switch(&simulate),
+         "Time with a simulated device instead of the command, to try the problem set and the "
+         "Logic files out without a GPU")
+
+        ("iters,i",
+         po::value<rocblas_int>(&iters)->default_value(3),
+         "Timings of each solution, the best one is kept");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help") || problems_file.empty() || logic_dir.empty())
+    {
+        std::cout << desc << std::endl;
+        return vm.count("help") ? 0 : -1;
+    }
+
+    std::unique_ptr<tune_timer> timer;
+    if(simulate)
+        timer.reset(new tune_simulated_timer());
+    else if(!command.empty())
+        timer.reset(new tune_command_timer(command));
+    else
+    {
+        std::cerr << "Either --command or --simulate is needed to time the solutions" << std::endl;
+        return -1;
+    }
+
+    std::ifstream problems_is(problems_file);
+    if(!problems_is)
+    {
+        std::cerr << "Cannot open " << problems_file << std::endl;
+        return -1;
+    }
+
+    // the problems that run on Tensile by problem type
+    std::map<std::string, std::vector<tune_problem>> problems;
+    rocblas_int skipped = 0;
+    for(std::string line; std::getline(problems_is, line);)
+    {
+        tune_problem p;
+        if(!tune_parse_problem(line, p))
+            continue;
+
+        if(tune_uses_tensile(p))
+            problems[tune_logic_name(p)].push_back(p);
+        else
+            skipped++;
+    }
+
+    if(skipped > 0)
+        std::cout << skipped << " problems do not run on Tensile and are not tuned" << std::endl;
+
+    rocblas_int written = 0;
+    for(char precision : {'h', 's', 'd'})
+        for(char transA_option : {'N', 'T'})
+            for(char transB_option : {'N', 'T'})
+            {
+                tune_problem type = {precision, transA_option, transB_option, 1, 1, 1, 1, false};
+                std::string name  = tune_logic_name(type);
+                std::string file  = schedule + "_" + name + ".yaml";
+
+                std::ifstream logic_is(logic_dir + "/" + file);
+                if(!logic_is)
+                {
+                    if(!problems[name].empty())
+                        std::cerr << "No " << file << " in " << logic_dir << ", "
+                                  << problems[name].size() << " problems are not tuned"
+                                  << std::endl;
+                    continue;
+                }
+
+                std::stringstream logic;
+                logic << logic_is.rdbuf();
+
+                rocblas_int solutions = tune_solution_count(logic.str());
+                std::vector<tune_result> results =
+                    tune_search(problems[name], solutions, *timer, iters);
+
+                for(const tune_result& r : results)
+                    printf("%s  M %6d  N %6d  K %6d  batch %6d  solution %4d  %10.2f Gflops\n",
+                           name.c_str(),
+                           r.problem.M,
+                           r.problem.N,
+                           r.problem.K,
+                           r.problem.batch_count,
+                           r.solution,
+                           r.gflops);
+
+                std::string tuned = tune_write_logic(logic.str(), results);
+                if(tuned.empty())
+                {
+                    std::cerr << file << " is not a Logic file" << std::endl;
+                    return -1;
+                }
+
+                std::ofstream os(output_dir + "/" + file);
+                os << tuned;
+                if(!os)
+                {
+                    std::cerr << "Cannot write " << output_dir << "/" << file << std::endl;
+                    return -1;
+                }
+                written++;
+            }
+
+    std::cout << written << " Logic files written to " << output_dir << std::endl;
+
+    return written > 0 ? 0 : -1;
+}
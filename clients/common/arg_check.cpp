@@ -182,6 +182,50 @@ void gemm_strided_batched_arg_check(rocblas_status status,
 #endif
 }
 
+void syrk_arg_check(rocblas_status status,
+                    rocblas_int N,
+                    rocblas_int K,
+                    rocblas_int lda,
+                    rocblas_int ldc,
+                    rocblas_int batch_count)
+{
+#ifdef GOOGLE_TEST
+    if(N == 0 || batch_count == 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, K, lda, ldc, batch_count: ";
+    std::cerr << N << ',' << K << ',' << lda << ',' << ldc << ',' << batch_count << std::endl;
+#endif
+}
+
+void symm_arg_check(rocblas_status status,
+                    rocblas_int M,
+                    rocblas_int N,
+                    rocblas_int lda,
+                    rocblas_int ldb,
+                    rocblas_int ldc)
+{
+#ifdef GOOGLE_TEST
+    if(M == 0 || N == 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments M, N, lda, ldb, ldc: ";
+    std::cerr << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << std::endl;
+#endif
+}
+
 void geam_arg_check(rocblas_status status,
                     rocblas_int M,
                     rocblas_int N,
@@ -219,13 +263,181 @@ void symv_arg_check(
     rocblas_status status, rocblas_int N, rocblas_int lda, rocblas_int incx, rocblas_int incy)
 {
 #ifdef GOOGLE_TEST
-    ASSERT_EQ(status, rocblas_status_invalid_size);
+    if(N == 0 && incx != 0 && incy != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, lda, incx, incy: ";
+    std::cerr << N << ',' << lda << ',' << incx << ',' << incy << std::endl;
+#endif
+}
+
+void trsv_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda, rocblas_int incx)
+{
+#ifdef GOOGLE_TEST
+    if(N == 0 && lda >= 1 && incx != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, lda, incx: ";
+    std::cerr << N << ',' << lda << ',' << incx << std::endl;
+#endif
+}
+
+void tbsv_arg_check(
+    rocblas_status status, rocblas_int N, rocblas_int K, rocblas_int lda, rocblas_int incx)
+{
+#ifdef GOOGLE_TEST
+    if(N == 0 && K >= 0 && lda >= K + 1 && incx != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, K, lda, incx: ";
+    std::cerr << N << ',' << K << ',' << lda << ',' << incx << std::endl;
+#endif
+}
+
+void gbmv_arg_check(rocblas_status status,
+                    rocblas_int M,
+                    rocblas_int N,
+                    rocblas_int KL,
+                    rocblas_int KU,
+                    rocblas_int lda,
+                    rocblas_int incx,
+                    rocblas_int incy)
+{
+#ifdef GOOGLE_TEST
+    if(M >= 0 && N >= 0 && KL >= 0 && KU >= 0 && lda >= KL + KU + 1 && incx != 0 && incy != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments M, N, KL, KU, lda, incx, incy: ";
+    std::cerr << M << ',' << N << ',' << KL << ',' << KU << ',' << lda << ',' << incx << ','
+              << incy << std::endl;
+#endif
+}
+
+void sbmv_arg_check(rocblas_status status,
+                    rocblas_int N,
+                    rocblas_int K,
+                    rocblas_int lda,
+                    rocblas_int incx,
+                    rocblas_int incy)
+{
+#ifdef GOOGLE_TEST
+    if(N >= 0 && K >= 0 && lda >= K + 1 && incx != 0 && incy != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, K, lda, incx, incy: ";
+    std::cerr << N << ',' << K << ',' << lda << ',' << incx << ',' << incy << std::endl;
+#endif
+}
+
+void packed_arg_check(rocblas_status status,
+                      rocblas_int N,
+                      rocblas_int lda,
+                      rocblas_int incx,
+                      rocblas_int incy)
+{
+#ifdef GOOGLE_TEST
+    if(N == 0 && lda >= 1 && incx != 0 && incy != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
 #else
     std::cerr << "rocBLAS TEST ERROR in arguments N, lda, incx, incy: ";
     std::cerr << N << ',' << lda << ',' << incx << ',' << incy << std::endl;
 #endif
 }
 
+void rank_update_arg_check(rocblas_status status,
+                           rocblas_int M,
+                           rocblas_int N,
+                           rocblas_int lda,
+                           rocblas_int incx,
+                           rocblas_int incy,
+                           rocblas_int batch_count)
+{
+#ifdef GOOGLE_TEST
+    if(M < 0 || N < 0 || lda < M || lda < 1 || 0 == incx || 0 == incy || batch_count < 0)
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments M, N, lda, incx, incy, batch_count: ";
+    std::cerr << M << ',' << N << ',' << lda << ',' << incx << ',' << incy << ',' << batch_count
+              << std::endl;
+#endif
+}
+
+void blas1_batched_arg_check(rocblas_status status, rocblas_int batch_count)
+{
+#ifdef GOOGLE_TEST
+    if(batch_count >= 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments batch_count: " << batch_count << std::endl;
+#endif
+}
+
+void mdot_maxpy_arg_check(
+    rocblas_status status, rocblas_int N, rocblas_int K, rocblas_int lda, rocblas_int inc)
+{
+#ifdef GOOGLE_TEST
+    if(N >= 0 && K >= 0 && lda >= N && lda >= 1 && inc != 0)
+    {
+        ASSERT_EQ(status, rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(status, rocblas_status_invalid_size);
+    }
+#else
+    std::cerr << "rocBLAS TEST ERROR in arguments N, K, lda, inc: ";
+    std::cerr << N << ',' << K << ',' << lda << ',' << inc << std::endl;
+#endif
+}
+
 void iamax_iamin_arg_check(rocblas_status status, rocblas_int* d_rocblas_result)
 {
     rocblas_int h_rocblas_result;
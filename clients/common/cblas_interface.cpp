@@ -43,6 +43,24 @@ void zpotrf_(char* uplo, int* m, rocblas_double_complex* A, int* lda, int* info)
  * ===========================================================================
  */
 // scal
+// cblas does not support rocblas_half, the references of the half routines convert to float
+template <>
+void cblas_scal<rocblas_half>(rocblas_int n,
+                              const rocblas_half alpha,
+                              rocblas_half* x,
+                              rocblas_int incx)
+{
+    float alpha_float = half_to_float(alpha);
+    std::unique_ptr<float[]> x_float(new float[n * incx]());
+    for(int i = 0; i < n; i++)
+        x_float[i * incx] = half_to_float(x[i * incx]);
+
+    cblas_sscal(n, alpha_float, x_float.get(), incx);
+
+    for(int i = 0; i < n; i++)
+        x[i * incx] = float_to_half(x_float[i * incx]);
+}
+
 template <>
 void cblas_scal<float>(rocblas_int n, const float alpha, float* x, rocblas_int incx)
 {
@@ -205,6 +223,27 @@ void cblas_swap<rocblas_double_complex>(rocblas_int n,
 }
 
 // dot
+template <>
+void cblas_dot<rocblas_half>(rocblas_int n,
+                             const rocblas_half* x,
+                             rocblas_int incx,
+                             const rocblas_half* y,
+                             rocblas_int incy,
+                             rocblas_half* result)
+{
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+    std::unique_ptr<float[]> x_float(new float[n * abs_incx]());
+    std::unique_ptr<float[]> y_float(new float[n * abs_incy]());
+    for(int i = 0; i < n; i++)
+    {
+        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
+        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
+    }
+
+    *result = float_to_half(cblas_sdot(n, x_float.get(), incx, y_float.get(), incy));
+}
+
 template <>
 void cblas_dot<float>(rocblas_int n,
                       const float* x,
@@ -250,6 +289,19 @@ void cblas_dot<rocblas_double_complex>(rocblas_int n,
 }
 
 // nrm2
+template <>
+void cblas_nrm2<rocblas_half, rocblas_half>(rocblas_int n,
+                                            const rocblas_half* x,
+                                            rocblas_int incx,
+                                            rocblas_half* result)
+{
+    std::unique_ptr<float[]> x_float(new float[n * incx]());
+    for(int i = 0; i < n; i++)
+        x_float[i * incx] = half_to_float(x[i * incx]);
+
+    *result = float_to_half(cblas_snrm2(n, x_float.get(), incx));
+}
+
 template <>
 void cblas_nrm2<float, float>(rocblas_int n, const float* x, rocblas_int incx, float* result)
 {
@@ -281,6 +333,19 @@ void cblas_nrm2<rocblas_double_complex, double>(rocblas_int n,
 }
 
 // asum
+template <>
+void cblas_asum<rocblas_half, rocblas_half>(rocblas_int n,
+                                            const rocblas_half* x,
+                                            rocblas_int incx,
+                                            rocblas_half* result)
+{
+    std::unique_ptr<float[]> x_float(new float[n * incx]());
+    for(int i = 0; i < n; i++)
+        x_float[i * incx] = half_to_float(x[i * incx]);
+
+    *result = float_to_half(cblas_sasum(n, x_float.get(), incx));
+}
+
 template <>
 void cblas_asum<float, float>(rocblas_int n, const float* x, rocblas_int incx, float* result)
 {
@@ -312,6 +377,19 @@ void cblas_asum<rocblas_double_complex, double>(rocblas_int n,
 }
 
 // amax
+template <>
+void cblas_iamax<rocblas_half>(rocblas_int n,
+                               const rocblas_half* x,
+                               rocblas_int incx,
+                               rocblas_int* result)
+{
+    std::unique_ptr<float[]> x_float(new float[n * incx]());
+    for(int i = 0; i < n; i++)
+        x_float[i * incx] = half_to_float(x[i * incx]);
+
+    *result = (rocblas_int)cblas_isamax(n, x_float.get(), incx);
+}
+
 template <>
 void cblas_iamax<float>(rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result)
 {
@@ -341,6 +419,63 @@ void cblas_iamax<rocblas_double_complex>(rocblas_int n,
 {
     *result = (rocblas_int)cblas_izamax(n, x, incx);
 }
+
+// rot
+template <>
+void cblas_rot<float>(
+    rocblas_int n, float* x, rocblas_int incx, float* y, rocblas_int incy, float c, float s)
+{
+    cblas_srot(n, x, incx, y, incy, c, s);
+}
+
+template <>
+void cblas_rot<double>(
+    rocblas_int n, double* x, rocblas_int incx, double* y, rocblas_int incy, double c, double s)
+{
+    cblas_drot(n, x, incx, y, incy, c, s);
+}
+
+// rotg
+template <>
+void cblas_rotg<float>(float* a, float* b, float* c, float* s)
+{
+    cblas_srotg(a, b, c, s);
+}
+
+template <>
+void cblas_rotg<double>(double* a, double* b, double* c, double* s)
+{
+    cblas_drotg(a, b, c, s);
+}
+
+// rotm
+template <>
+void cblas_rotm<float>(
+    rocblas_int n, float* x, rocblas_int incx, float* y, rocblas_int incy, const float* param)
+{
+    cblas_srotm(n, x, incx, y, incy, param);
+}
+
+template <>
+void cblas_rotm<double>(
+    rocblas_int n, double* x, rocblas_int incx, double* y, rocblas_int incy, const double* param)
+{
+    cblas_drotm(n, x, incx, y, incy, param);
+}
+
+// rotmg
+template <>
+void cblas_rotmg<float>(float* d1, float* d2, float* x1, float y1, float* param)
+{
+    cblas_srotmg(d1, d2, x1, y1, param);
+}
+
+template <>
+void cblas_rotmg<double>(double* d1, double* d2, double* x1, double y1, double* param)
+{
+    cblas_drotmg(d1, d2, x1, y1, param);
+}
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -445,6 +580,340 @@ void cblas_symv<double>(rocblas_fill uplo,
     cblas_dsymv(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+void cblas_trsv<float>(rocblas_fill uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal diag,
+                       rocblas_int n,
+                       const float* A,
+                       rocblas_int lda,
+                       float* x,
+                       rocblas_int incx)
+{
+    cblas_strsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+template <>
+void cblas_trsv<double>(rocblas_fill uplo,
+                        rocblas_operation transA,
+                        rocblas_diagonal diag,
+                        rocblas_int n,
+                        const double* A,
+                        rocblas_int lda,
+                        double* x,
+                        rocblas_int incx)
+{
+    cblas_dtrsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+template <>
+void cblas_tbsv<float>(rocblas_fill uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal diag,
+                       rocblas_int n,
+                       rocblas_int k,
+                       const float* A,
+                       rocblas_int lda,
+                       float* x,
+                       rocblas_int incx)
+{
+    cblas_stbsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                k,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+template <>
+void cblas_tbsv<double>(rocblas_fill uplo,
+                        rocblas_operation transA,
+                        rocblas_diagonal diag,
+                        rocblas_int n,
+                        rocblas_int k,
+                        const double* A,
+                        rocblas_int lda,
+                        double* x,
+                        rocblas_int incx)
+{
+    cblas_dtbsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                k,
+                A,
+                lda,
+                x,
+                incx);
+}
+
+template <>
+void cblas_gbmv<float>(rocblas_operation transA,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int kl,
+                       rocblas_int ku,
+                       float alpha,
+                       const float* A,
+                       rocblas_int lda,
+                       const float* x,
+                       rocblas_int incx,
+                       float beta,
+                       float* y,
+                       rocblas_int incy)
+{
+    cblas_sgbmv(CblasColMajor,
+                (CBLAS_TRANSPOSE)transA,
+                m,
+                n,
+                kl,
+                ku,
+                alpha,
+                A,
+                lda,
+                x,
+                incx,
+                beta,
+                y,
+                incy);
+}
+
+template <>
+void cblas_gbmv<double>(rocblas_operation transA,
+                        rocblas_int m,
+                        rocblas_int n,
+                        rocblas_int kl,
+                        rocblas_int ku,
+                        double alpha,
+                        const double* A,
+                        rocblas_int lda,
+                        const double* x,
+                        rocblas_int incx,
+                        double beta,
+                        double* y,
+                        rocblas_int incy)
+{
+    cblas_dgbmv(CblasColMajor,
+                (CBLAS_TRANSPOSE)transA,
+                m,
+                n,
+                kl,
+                ku,
+                alpha,
+                A,
+                lda,
+                x,
+                incx,
+                beta,
+                y,
+                incy);
+}
+
+template <>
+void cblas_sbmv<float>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int k,
+                       float alpha,
+                       const float* A,
+                       rocblas_int lda,
+                       const float* x,
+                       rocblas_int incx,
+                       float beta,
+                       float* y,
+                       rocblas_int incy)
+{
+    cblas_ssbmv(CblasColMajor, (CBLAS_UPLO)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void cblas_sbmv<double>(rocblas_fill uplo,
+                        rocblas_int n,
+                        rocblas_int k,
+                        double alpha,
+                        const double* A,
+                        rocblas_int lda,
+                        const double* x,
+                        rocblas_int incx,
+                        double beta,
+                        double* y,
+                        rocblas_int incy)
+{
+    cblas_dsbmv(CblasColMajor, (CBLAS_UPLO)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+void cblas_spmv<float>(rocblas_fill uplo,
+                       rocblas_int n,
+                       float alpha,
+                       const float* AP,
+                       const float* x,
+                       rocblas_int incx,
+                       float beta,
+                       float* y,
+                       rocblas_int incy)
+{
+    cblas_sspmv(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+void cblas_spmv<double>(rocblas_fill uplo,
+                        rocblas_int n,
+                        double alpha,
+                        const double* AP,
+                        const double* x,
+                        rocblas_int incx,
+                        double beta,
+                        double* y,
+                        rocblas_int incy)
+{
+    cblas_dspmv(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+void cblas_spr<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      float alpha,
+                      const float* x,
+                      rocblas_int incx,
+                      float* AP)
+{
+    cblas_sspr(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+void cblas_spr<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       double alpha,
+                       const double* x,
+                       rocblas_int incx,
+                       double* AP)
+{
+    cblas_dspr(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+void cblas_spr2<float>(rocblas_fill uplo,
+                       rocblas_int n,
+                       float alpha,
+                       const float* x,
+                       rocblas_int incx,
+                       const float* y,
+                       rocblas_int incy,
+                       float* AP)
+{
+    cblas_sspr2(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+template <>
+void cblas_spr2<double>(rocblas_fill uplo,
+                        rocblas_int n,
+                        double alpha,
+                        const double* x,
+                        rocblas_int incx,
+                        const double* y,
+                        rocblas_int incy,
+                        double* AP)
+{
+    cblas_dspr2(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+template <>
+void cblas_tpmv<float>(rocblas_fill uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal diag,
+                       rocblas_int n,
+                       const float* AP,
+                       float* x,
+                       rocblas_int incx)
+{
+    cblas_stpmv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                AP,
+                x,
+                incx);
+}
+
+template <>
+void cblas_tpmv<double>(rocblas_fill uplo,
+                        rocblas_operation transA,
+                        rocblas_diagonal diag,
+                        rocblas_int n,
+                        const double* AP,
+                        double* x,
+                        rocblas_int incx)
+{
+    cblas_dtpmv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                AP,
+                x,
+                incx);
+}
+
+template <>
+void cblas_tpsv<float>(rocblas_fill uplo,
+                       rocblas_operation transA,
+                       rocblas_diagonal diag,
+                       rocblas_int n,
+                       const float* AP,
+                       float* x,
+                       rocblas_int incx)
+{
+    cblas_stpsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                AP,
+                x,
+                incx);
+}
+
+template <>
+void cblas_tpsv<double>(rocblas_fill uplo,
+                        rocblas_operation transA,
+                        rocblas_diagonal diag,
+                        rocblas_int n,
+                        const double* AP,
+                        double* x,
+                        rocblas_int incx)
+{
+    cblas_dtpsv(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_DIAG)diag,
+                n,
+                AP,
+                x,
+                incx);
+}
+
 template <>
 void cblas_hemv<rocblas_float_complex>(rocblas_fill uplo,
                                        rocblas_int n,
@@ -527,6 +996,86 @@ void cblas_syr<double>(rocblas_fill uplo,
     cblas_dsyr(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, A, lda);
 }
 
+template <>
+void cblas_syr2<float>(rocblas_fill uplo,
+                       rocblas_int n,
+                       float alpha,
+                       const float* x,
+                       rocblas_int incx,
+                       const float* y,
+                       rocblas_int incy,
+                       float* A,
+                       rocblas_int lda)
+{
+    cblas_ssyr2(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+void cblas_syr2<double>(rocblas_fill uplo,
+                        rocblas_int n,
+                        double alpha,
+                        const double* x,
+                        rocblas_int incx,
+                        const double* y,
+                        rocblas_int incy,
+                        double* A,
+                        rocblas_int lda)
+{
+    cblas_dsyr2(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+void cblas_her<rocblas_float_complex, float>(rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int incx,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda)
+{
+    cblas_cher(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+void cblas_her<rocblas_double_complex, double>(rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double alpha,
+                                               const rocblas_double_complex* x,
+                                               rocblas_int incx,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda)
+{
+    cblas_zher(CblasColMajor, (CBLAS_UPLO)uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+void cblas_her2<rocblas_float_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_float_complex alpha,
+                                       const rocblas_float_complex* x,
+                                       rocblas_int incx,
+                                       const rocblas_float_complex* y,
+                                       rocblas_int incy,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda)
+{
+    cblas_cher2(CblasColMajor, (CBLAS_UPLO)uplo, n, &alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+void cblas_her2<rocblas_double_complex>(rocblas_fill uplo,
+                                        rocblas_int n,
+                                        rocblas_double_complex alpha,
+                                        const rocblas_double_complex* x,
+                                        rocblas_int incx,
+                                        const rocblas_double_complex* y,
+                                        rocblas_int incy,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda)
+{
+    cblas_zher2(CblasColMajor, (CBLAS_UPLO)uplo, n, &alpha, x, incx, y, incy, A, lda);
+}
+
 /*
  * ===========================================================================
  *    level 3 BLAS
@@ -724,6 +1273,175 @@ void cblas_gemm<rocblas_double_complex>(rocblas_operation transA,
                 ldc);
 }
 
+// syrk
+template <>
+void cblas_syrk<float>(rocblas_fill uplo,
+                       rocblas_operation trans,
+                       rocblas_int n,
+                       rocblas_int k,
+                       float alpha,
+                       const float* A,
+                       rocblas_int lda,
+                       float beta,
+                       float* C,
+                       rocblas_int ldc)
+{
+    cblas_ssyrk(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)trans,
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_syrk<double>(rocblas_fill uplo,
+                        rocblas_operation trans,
+                        rocblas_int n,
+                        rocblas_int k,
+                        double alpha,
+                        const double* A,
+                        rocblas_int lda,
+                        double beta,
+                        double* C,
+                        rocblas_int ldc)
+{
+    cblas_dsyrk(CblasColMajor,
+                (CBLAS_UPLO)uplo,
+                (CBLAS_TRANSPOSE)trans,
+                n,
+                k,
+                alpha,
+                A,
+                lda,
+                beta,
+                C,
+                ldc);
+}
+
+// syr2k
+template <>
+void cblas_syr2k<float>(rocblas_fill uplo,
+                        rocblas_operation trans,
+                        rocblas_int n,
+                        rocblas_int k,
+                        float alpha,
+                        const float* A,
+                        rocblas_int lda,
+                        const float* B,
+                        rocblas_int ldb,
+                        float beta,
+                        float* C,
+                        rocblas_int ldc)
+{
+    cblas_ssyr2k(CblasColMajor,
+                 (CBLAS_UPLO)uplo,
+                 (CBLAS_TRANSPOSE)trans,
+                 n,
+                 k,
+                 alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+template <>
+void cblas_syr2k<double>(rocblas_fill uplo,
+                         rocblas_operation trans,
+                         rocblas_int n,
+                         rocblas_int k,
+                         double alpha,
+                         const double* A,
+                         rocblas_int lda,
+                         const double* B,
+                         rocblas_int ldb,
+                         double beta,
+                         double* C,
+                         rocblas_int ldc)
+{
+    cblas_dsyr2k(CblasColMajor,
+                 (CBLAS_UPLO)uplo,
+                 (CBLAS_TRANSPOSE)trans,
+                 n,
+                 k,
+                 alpha,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
+
+// symm
+template <>
+void cblas_symm<float>(rocblas_side side,
+                       rocblas_fill uplo,
+                       rocblas_int m,
+                       rocblas_int n,
+                       float alpha,
+                       const float* A,
+                       rocblas_int lda,
+                       const float* B,
+                       rocblas_int ldb,
+                       float beta,
+                       float* C,
+                       rocblas_int ldc)
+{
+    cblas_ssymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_symm<double>(rocblas_side side,
+                        rocblas_fill uplo,
+                        rocblas_int m,
+                        rocblas_int n,
+                        double alpha,
+                        const double* A,
+                        rocblas_int lda,
+                        const double* B,
+                        rocblas_int ldb,
+                        double beta,
+                        double* C,
+                        rocblas_int ldc)
+{
+    cblas_dsymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
 // trsm
 template <>
 void cblas_trsm<float>(rocblas_side side,
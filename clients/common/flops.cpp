@@ -30,6 +30,32 @@ double gemv_gflop_count<rocblas_double_complex>(rocblas_int m, rocblas_int n)
     return (double)(8.0 * m * n) / 1e9;
 }
 
+/* \brief floating point counts of HER */
+template <>
+double syr_gflop_count<rocblas_float_complex>(rocblas_int n)
+{
+    return (4.0 * n * (n + 1)) / 1e9;
+}
+
+template <>
+double syr_gflop_count<rocblas_double_complex>(rocblas_int n)
+{
+    return (4.0 * n * (n + 1)) / 1e9;
+}
+
+/* \brief floating point counts of HER2 */
+template <>
+double syr2_gflop_count<rocblas_float_complex>(rocblas_int n)
+{
+    return (8.0 * n * (n + 1)) / 1e9;
+}
+
+template <>
+double syr2_gflop_count<rocblas_double_complex>(rocblas_int n)
+{
+    return (8.0 * n * (n + 1)) / 1e9;
+}
+
 /* \brief floating point counts of SY(HE)MV */
 
 /*
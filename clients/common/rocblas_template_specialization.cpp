@@ -17,6 +17,16 @@
  * ===========================================================================
  */
 // scal
+template <>
+rocblas_status rocblas_scal<rocblas_half>(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const rocblas_half* alpha,
+                                          rocblas_half* x,
+                                          rocblas_int incx)
+{
+    return rocblas_hscal(handle, n, alpha, x, incx);
+}
+
 template <>
 rocblas_status rocblas_scal<float>(
     rocblas_handle handle, rocblas_int n, const float* alpha, float* x, rocblas_int incx)
@@ -193,6 +203,18 @@ rocblas_status rocblas_copy<double>(rocblas_handle handle,
 */
 
 // dot
+template <>
+rocblas_status rocblas_dot<rocblas_half>(rocblas_handle handle,
+                                         rocblas_int n,
+                                         const rocblas_half* x,
+                                         rocblas_int incx,
+                                         const rocblas_half* y,
+                                         rocblas_int incy,
+                                         rocblas_half* result)
+{
+    return rocblas_hdot(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 rocblas_status rocblas_dot<float>(rocblas_handle handle,
                                   rocblas_int n,
@@ -240,6 +262,16 @@ rocblas_status rocblas_dot<double>(rocblas_handle handle,
 */
 
 // asum
+template <>
+rocblas_status rocblas_asum<rocblas_half, rocblas_half>(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const rocblas_half* x,
+                                                        rocblas_int incx,
+                                                        rocblas_half* result)
+{
+    return rocblas_hasum(handle, n, x, incx, result);
+}
+
 template <>
 rocblas_status rocblas_asum<float, float>(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result)
@@ -269,6 +301,16 @@ rocblas_status rocblas_asum<double, double>(
 */
 
 // nrm2
+template <>
+rocblas_status rocblas_nrm2<rocblas_half, rocblas_half>(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const rocblas_half* x,
+                                                        rocblas_int incx,
+                                                        rocblas_half* result)
+{
+    return rocblas_hnrm2(handle, n, x, incx, result);
+}
+
 template <>
 rocblas_status rocblas_nrm2<float, float>(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result)
@@ -347,6 +389,16 @@ rocblas_status rocblas_iamin<double>(
 */
 
 // iamax
+template <>
+rocblas_status rocblas_iamax<rocblas_half>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const rocblas_half* x,
+                                           rocblas_int incx,
+                                           rocblas_int* result)
+{
+    return rocblas_ihamax(handle, n, x, incx, result);
+}
+
 template <>
 rocblas_status rocblas_iamax<float>(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result)
@@ -387,281 +439,1954 @@ rocblas_status rocblas_iamax<double>(
 
 /*
  * ===========================================================================
- *    level 2 BLAS
+ *    level 1 BLAS, batched
  * ===========================================================================
  */
-
 template <>
-rocblas_status rocblas_gemv<float>(rocblas_handle handle,
-                                   rocblas_operation transA,
-                                   rocblas_int m,
-                                   rocblas_int n,
-                                   const float* alpha,
-                                   const float* A,
-                                   rocblas_int lda,
-                                   const float* x,
-                                   rocblas_int incx,
-                                   const float* beta,
-                                   float* y,
-                                   rocblas_int incy)
+rocblas_status rocblas_scal_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* alpha,
+                                                   float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   rocblas_int batch_count)
 {
-    return rocblas_sgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return rocblas_fscal_strided_batched(handle, n, alpha, x, incx, bsx, batch_count);
 }
 
 template <>
-rocblas_status rocblas_gemv<double>(rocblas_handle handle,
-                                    rocblas_operation transA,
-                                    rocblas_int m,
-                                    rocblas_int n,
-                                    const double* alpha,
-                                    const double* A,
-                                    rocblas_int lda,
-                                    const double* x,
-                                    rocblas_int incx,
-                                    const double* beta,
-                                    double* y,
-                                    rocblas_int incy)
+rocblas_status rocblas_scal_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* alpha,
+                                                    double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    rocblas_int batch_count)
 {
-    return rocblas_dgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return rocblas_dscal_strided_batched(handle, n, alpha, x, incx, bsx, batch_count);
 }
 
-/* not implemented
-    template<>
-    rocblas_status
-    rocblas_symv<float>(    rocblas_handle handle,
-                            rocblas_fill uplo, rocblas_int n,
-                            const float *alpha,
-                            const float *A, rocblas_int lda,
-                            const float *x, rocblas_int incx,
-                            const float *beta, float *y, rocblas_int incy)
-    {
-        return rocblas_ssymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
-    }
-
-    template<>
-    rocblas_status
-    rocblas_symv<double>(   rocblas_handle handle,
-                            rocblas_fill uplo, rocblas_int n,
-                            const double *alpha,
-                            const double *A, rocblas_int lda,
-                            const double *x, rocblas_int incx,
-                            const double *beta, double *y, rocblas_int incy)
-    {
-        return rocblas_dsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
-    }
-*/
-
 template <>
-rocblas_status rocblas_ger<float>(rocblas_handle handle,
-                                  rocblas_int m,
-                                  rocblas_int n,
-                                  const float* alpha,
-                                  const float* x,
-                                  rocblas_int incx,
-                                  const float* y,
-                                  rocblas_int incy,
-                                  float* A,
-                                  rocblas_int lda)
+rocblas_status rocblas_scal_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           float* const x[],
+                                           rocblas_int incx,
+                                           rocblas_int batch_count)
 {
-
-    return rocblas_sger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return rocblas_fscal_batched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-rocblas_status rocblas_ger<double>(rocblas_handle handle,
-                                   rocblas_int m,
-                                   rocblas_int n,
-                                   const double* alpha,
-                                   const double* x,
-                                   rocblas_int incx,
-                                   const double* y,
-                                   rocblas_int incy,
-                                   double* A,
-                                   rocblas_int lda)
+rocblas_status rocblas_scal_batched<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            double* const x[],
+                                            rocblas_int incx,
+                                            rocblas_int batch_count)
 {
-
-    return rocblas_dger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return rocblas_dscal_batched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-rocblas_status rocblas_syr<float>(rocblas_handle handle,
-                                  rocblas_fill uplo,
-                                  rocblas_int n,
-                                  const float* alpha,
-                                  const float* x,
-                                  rocblas_int incx,
-                                  float* A,
-                                  rocblas_int lda)
+rocblas_status rocblas_copy_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   rocblas_int batch_count)
 {
-
-    return rocblas_ssyr(handle, uplo, n, alpha, x, incx, A, lda);
+    return rocblas_fcopy_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, batch_count);
 }
 
 template <>
-rocblas_status rocblas_syr<double>(rocblas_handle handle,
-                                   rocblas_fill uplo,
-                                   rocblas_int n,
-                                   const double* alpha,
-                                   const double* x,
-                                   rocblas_int incx,
-                                   double* A,
-                                   rocblas_int lda)
+rocblas_status rocblas_copy_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    rocblas_int batch_count)
 {
+    return rocblas_dcopy_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, batch_count);
+}
 
-    return rocblas_dsyr(handle, uplo, n, alpha, x, incx, A, lda);
+template <>
+rocblas_status rocblas_copy_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           float* const y[],
+                                           rocblas_int incy,
+                                           rocblas_int batch_count)
+{
+    return rocblas_fcopy_batched(handle, n, x, incx, y, incy, batch_count);
 }
 
-/*
- * ===========================================================================
- *    level 3 BLAS
- * ===========================================================================
- */
+template <>
+rocblas_status rocblas_copy_batched<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            double* const y[],
+                                            rocblas_int incy,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dcopy_batched(handle, n, x, incx, y, incy, batch_count);
+}
 
-//
+template <>
+rocblas_status rocblas_swap_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_fswap_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, batch_count);
+}
 
 template <>
-rocblas_status rocblas_trtri<float>(rocblas_handle handle,
-                                    rocblas_fill uplo,
-                                    rocblas_diagonal diag,
-                                    rocblas_int n,
-                                    float* A,
-                                    rocblas_int lda,
-                                    float* invA,
-                                    rocblas_int ldinvA)
+rocblas_status rocblas_swap_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    rocblas_int batch_count)
 {
-    return rocblas_strtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return rocblas_dswap_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, batch_count);
 }
 
 template <>
-rocblas_status rocblas_trtri<double>(rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_diagonal diag,
-                                     rocblas_int n,
-                                     double* A,
-                                     rocblas_int lda,
-                                     double* invA,
-                                     rocblas_int ldinvA)
+rocblas_status rocblas_swap_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* const x[],
+                                           rocblas_int incx,
+                                           float* const y[],
+                                           rocblas_int incy,
+                                           rocblas_int batch_count)
 {
-    return rocblas_dtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return rocblas_fswap_batched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-rocblas_status rocblas_trtri_batched<float>(rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_diagonal diag,
+rocblas_status rocblas_swap_batched<double>(rocblas_handle handle,
                                             rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_int bsa,
-                                            float* invA,
-                                            rocblas_int ldinvA,
-                                            rocblas_int bsinvA,
+                                            double* const x[],
+                                            rocblas_int incx,
+                                            double* const y[],
+                                            rocblas_int incy,
                                             rocblas_int batch_count)
 {
-    return rocblas_strtri_batched(
-        handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA, batch_count);
+    return rocblas_dswap_batched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-rocblas_status rocblas_trtri_batched<double>(rocblas_handle handle,
-                                             rocblas_fill uplo,
-                                             rocblas_diagonal diag,
-                                             rocblas_int n,
-                                             double* A,
-                                             rocblas_int lda,
-                                             rocblas_int bsa,
-                                             double* invA,
-                                             rocblas_int ldinvA,
-                                             rocblas_int bsinvA,
-                                             rocblas_int batch_count)
+rocblas_status rocblas_dot_strided_batched<float>(rocblas_handle handle,
+                                                  rocblas_int n,
+                                                  const float* x,
+                                                  rocblas_int incx,
+                                                  rocblas_int bsx,
+                                                  const float* y,
+                                                  rocblas_int incy,
+                                                  rocblas_int bsy,
+                                                  float* result,
+                                                  rocblas_int batch_count)
 {
-    return rocblas_dtrtri_batched(
-        handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA, batch_count);
+    return rocblas_fdot_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, result, batch_count);
 }
 
 template <>
-rocblas_status rocblas_geam<float>(rocblas_handle handle,
-                                   rocblas_operation transA,
-                                   rocblas_operation transB,
-                                   rocblas_int m,
-                                   rocblas_int n,
-                                   const float* alpha,
-                                   const float* A,
-                                   rocblas_int lda,
-                                   const float* beta,
-                                   const float* B,
-                                   rocblas_int ldb,
-                                   float* C,
-                                   rocblas_int ldc)
+rocblas_status rocblas_dot_strided_batched<double>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const double* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   const double* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   double* result,
+                                                   rocblas_int batch_count)
 {
-    return rocblas_sgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    return rocblas_ddot_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, result, batch_count);
 }
 
 template <>
-rocblas_status rocblas_geam<double>(rocblas_handle handle,
-                                    rocblas_operation transA,
-                                    rocblas_operation transB,
-                                    rocblas_int m,
-                                    rocblas_int n,
-                                    const double* alpha,
-                                    const double* A,
-                                    rocblas_int lda,
-                                    const double* beta,
-                                    const double* B,
-                                    rocblas_int ldb,
-                                    double* C,
-                                    rocblas_int ldc)
+rocblas_status rocblas_dot_batched<float>(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const float* const x[],
+                                          rocblas_int incx,
+                                          const float* const y[],
+                                          rocblas_int incy,
+                                          float* result,
+                                          rocblas_int batch_count)
 {
-    return rocblas_dgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    return rocblas_fdot_batched(handle, n, x, incx, y, incy, result, batch_count);
 }
 
-#if BUILD_WITH_TENSILE
+template <>
+rocblas_status rocblas_dot_batched<double>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const double* const x[],
+                                           rocblas_int incx,
+                                           const double* const y[],
+                                           rocblas_int incy,
+                                           double* result,
+                                           rocblas_int batch_count)
+{
+    return rocblas_ddot_batched(handle, n, x, incx, y, incy, result, batch_count);
+}
 
 template <>
-rocblas_status rocblas_gemm<rocblas_half>(rocblas_handle handle,
-                                          rocblas_operation transA,
-                                          rocblas_operation transB,
-                                          rocblas_int m,
-                                          rocblas_int n,
-                                          rocblas_int k,
-                                          const rocblas_half* alpha,
-                                          const rocblas_half* A,
-                                          rocblas_int lda,
-                                          const rocblas_half* B,
-                                          rocblas_int ldb,
-                                          const rocblas_half* beta,
-                                          rocblas_half* C,
-                                          rocblas_int ldc)
+rocblas_status rocblas_asum_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* result,
+                                                   rocblas_int batch_count)
 {
-    return rocblas_hgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return rocblas_fasum_strided_batched(handle, n, x, incx, bsx, result, batch_count);
 }
 
 template <>
-rocblas_status rocblas_gemm<float>(rocblas_handle handle,
-                                   rocblas_operation transA,
-                                   rocblas_operation transB,
-                                   rocblas_int m,
-                                   rocblas_int n,
-                                   rocblas_int k,
-                                   const float* alpha,
-                                   const float* A,
-                                   rocblas_int lda,
-                                   const float* B,
-                                   rocblas_int ldb,
-                                   const float* beta,
-                                   float* C,
-                                   rocblas_int ldc)
+rocblas_status rocblas_asum_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* result,
+                                                    rocblas_int batch_count)
 {
-    return rocblas_sgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return rocblas_dasum_strided_batched(handle, n, x, incx, bsx, result, batch_count);
 }
 
 template <>
-rocblas_status rocblas_gemm<double>(rocblas_handle handle,
-                                    rocblas_operation transA,
-                                    rocblas_operation transB,
-                                    rocblas_int m,
-                                    rocblas_int n,
-                                    rocblas_int k,
+rocblas_status rocblas_asum_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           float* result,
+                                           rocblas_int batch_count)
+{
+    return rocblas_fasum_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_asum_batched<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            double* result,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dasum_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_nrm2_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* result,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_fnrm2_strided_batched(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_nrm2_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* result,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_dnrm2_strided_batched(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_nrm2_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           float* result,
+                                           rocblas_int batch_count)
+{
+    return rocblas_fnrm2_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_nrm2_batched<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            double* result,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dnrm2_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_iamax_strided_batched<float>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    rocblas_int* result,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_ifamax_strided_batched(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_iamax_strided_batched<double>(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const double* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     rocblas_int* result,
+                                                     rocblas_int batch_count)
+{
+    return rocblas_idamax_strided_batched(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_iamax_batched<float>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const float* const x[],
+                                            rocblas_int incx,
+                                            rocblas_int* result,
+                                            rocblas_int batch_count)
+{
+    return rocblas_ifamax_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_iamax_batched<double>(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const double* const x[],
+                                             rocblas_int incx,
+                                             rocblas_int* result,
+                                             rocblas_int batch_count)
+{
+    return rocblas_idamax_batched(handle, n, x, incx, result, batch_count);
+}
+
+template <>
+rocblas_status rocblas_axpy_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* alpha,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_saxpy_strided_batched(handle, n, alpha, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_axpy_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* alpha,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_daxpy_strided_batched(handle, n, alpha, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_axpy_batched<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           float* const y[],
+                                           rocblas_int incy,
+                                           rocblas_int batch_count)
+{
+    return rocblas_saxpy_batched(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_axpy_batched<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            double* const y[],
+                                            rocblas_int incy,
+                                            rocblas_int batch_count)
+{
+    return rocblas_daxpy_batched(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_mdot<float>(rocblas_handle handle,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const float* V,
+                                   rocblas_int ldv,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   float* result)
+{
+    return rocblas_fmdot(handle, n, k, V, ldv, x, incx, result);
+}
+
+template <>
+rocblas_status rocblas_mdot<double>(rocblas_handle handle,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const double* V,
+                                    rocblas_int ldv,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    double* result)
+{
+    return rocblas_dmdot(handle, n, k, V, ldv, x, incx, result);
+}
+
+template <>
+rocblas_status rocblas_maxpy<float>(rocblas_handle handle,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const float* alpha,
+                                    const float* V,
+                                    rocblas_int ldv,
+                                    float* y,
+                                    rocblas_int incy)
+{
+    return rocblas_fmaxpy(handle, n, k, alpha, V, ldv, y, incy);
+}
+
+template <>
+rocblas_status rocblas_maxpy<double>(rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const double* alpha,
+                                     const double* V,
+                                     rocblas_int ldv,
+                                     double* y,
+                                     rocblas_int incy)
+{
+    return rocblas_dmaxpy(handle, n, k, alpha, V, ldv, y, incy);
+}
+
+template <>
+rocblas_status rocblas_axpy_dot<float>(rocblas_handle handle,
+                                       rocblas_int n,
+                                       const float* alpha,
+                                       const float* x,
+                                       rocblas_int incx,
+                                       float* y,
+                                       rocblas_int incy,
+                                       const float* z,
+                                       rocblas_int incz,
+                                       float* result)
+{
+    return rocblas_saxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+template <>
+rocblas_status rocblas_axpy_dot<double>(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        double* y,
+                                        rocblas_int incy,
+                                        const double* z,
+                                        rocblas_int incz,
+                                        double* result)
+{
+    return rocblas_daxpy_dot(handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+template <>
+rocblas_status rocblas_dot_nrm2<float>(rocblas_handle handle,
+                                       rocblas_int n,
+                                       const float* x,
+                                       rocblas_int incx,
+                                       const float* y,
+                                       rocblas_int incy,
+                                       float* dot_result,
+                                       float* nrm2_result)
+{
+    return rocblas_sdot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
+
+template <>
+rocblas_status rocblas_dot_nrm2<double>(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* y,
+                                        rocblas_int incy,
+                                        double* dot_result,
+                                        double* nrm2_result)
+{
+    return rocblas_ddot_nrm2(handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
+
+template <>
+rocblas_status rocblas_scal_copy<float>(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        float* y,
+                                        rocblas_int incy)
+{
+    return rocblas_sscal_copy(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+rocblas_status rocblas_scal_copy<double>(rocblas_handle handle,
+                                         rocblas_int n,
+                                         const double* alpha,
+                                         const double* x,
+                                         rocblas_int incx,
+                                         double* y,
+                                         rocblas_int incy)
+{
+    return rocblas_dscal_copy(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+rocblas_status rocblas_rot<float>(rocblas_handle handle,
+                                  rocblas_int n,
+                                  float* x,
+                                  rocblas_int incx,
+                                  float* y,
+                                  rocblas_int incy,
+                                  const float* c,
+                                  const float* s)
+{
+    return rocblas_srot(handle, n, x, incx, y, incy, c, s);
+}
+
+template <>
+rocblas_status rocblas_rot_strided_batched<float>(rocblas_handle handle,
+                                                  rocblas_int n,
+                                                  float* x,
+                                                  rocblas_int incx,
+                                                  rocblas_int bsx,
+                                                  float* y,
+                                                  rocblas_int incy,
+                                                  rocblas_int bsy,
+                                                  const float* c,
+                                                  const float* s,
+                                                  rocblas_int batch_count)
+{
+    return rocblas_srot_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, c, s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rot_batched<float>(rocblas_handle handle,
+                                          rocblas_int n,
+                                          float* const x[],
+                                          rocblas_int incx,
+                                          float* const y[],
+                                          rocblas_int incy,
+                                          const float* c,
+                                          const float* s,
+                                          rocblas_int batch_count)
+{
+    return rocblas_srot_batched(handle, n, x, incx, y, incy, c, s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rot_sequence<float>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_int k,
+                                           float* x,
+                                           rocblas_int incx,
+                                           float* y,
+                                           rocblas_int incy,
+                                           const float* c,
+                                           const float* s)
+{
+    return rocblas_srot_sequence(handle, n, k, x, incx, y, incy, c, s);
+}
+
+template <>
+rocblas_status rocblas_rotg<float>(rocblas_handle handle, float* a, float* b, float* c, float* s)
+{
+    return rocblas_srotg(handle, a, b, c, s);
+}
+
+template <>
+rocblas_status rocblas_rotg_strided_batched<float>(rocblas_handle handle,
+                                                   float* a,
+                                                   rocblas_int stride_a,
+                                                   float* b,
+                                                   rocblas_int stride_b,
+                                                   float* c,
+                                                   rocblas_int stride_c,
+                                                   float* s,
+                                                   rocblas_int stride_s,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_srotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rotm<float>(rocblas_handle handle,
+                                   rocblas_int n,
+                                   float* x,
+                                   rocblas_int incx,
+                                   float* y,
+                                   rocblas_int incy,
+                                   const float* param)
+{
+    return rocblas_srotm(handle, n, x, incx, y, incy, param);
+}
+
+template <>
+rocblas_status rocblas_rotm_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   const float* param,
+                                                   rocblas_int stride_param,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_srotm_strided_batched(
+        handle, n, x, incx, bsx, y, incy, bsy, param, stride_param, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rotmg<float>(
+    rocblas_handle handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+{
+    return rocblas_srotmg(handle, d1, d2, x1, y1, param);
+}
+
+template <>
+rocblas_status rocblas_rotmg_strided_batched<float>(rocblas_handle handle,
+                                                    float* d1,
+                                                    rocblas_int stride_d1,
+                                                    float* d2,
+                                                    rocblas_int stride_d2,
+                                                    float* x1,
+                                                    rocblas_int stride_x1,
+                                                    const float* y1,
+                                                    rocblas_int stride_y1,
+                                                    float* param,
+                                                    rocblas_int stride_param,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_srotmg_strided_batched(handle,
+                                          d1,
+                                          stride_d1,
+                                          d2,
+                                          stride_d2,
+                                          x1,
+                                          stride_x1,
+                                          y1,
+                                          stride_y1,
+                                          param,
+                                          stride_param,
+                                          batch_count);
+}
+
+template <>
+rocblas_status rocblas_rot<double>(rocblas_handle handle,
+                                   rocblas_int n,
+                                   double* x,
+                                   rocblas_int incx,
+                                   double* y,
+                                   rocblas_int incy,
+                                   const double* c,
+                                   const double* s)
+{
+    return rocblas_drot(handle, n, x, incx, y, incy, c, s);
+}
+
+template <>
+rocblas_status rocblas_rot_strided_batched<double>(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   double* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   double* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   const double* c,
+                                                   const double* s,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_drot_strided_batched(handle, n, x, incx, bsx, y, incy, bsy, c, s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rot_batched<double>(rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* const x[],
+                                           rocblas_int incx,
+                                           double* const y[],
+                                           rocblas_int incy,
+                                           const double* c,
+                                           const double* s,
+                                           rocblas_int batch_count)
+{
+    return rocblas_drot_batched(handle, n, x, incx, y, incy, c, s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rot_sequence<double>(rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            double* x,
+                                            rocblas_int incx,
+                                            double* y,
+                                            rocblas_int incy,
+                                            const double* c,
+                                            const double* s)
+{
+    return rocblas_drot_sequence(handle, n, k, x, incx, y, incy, c, s);
+}
+
+template <>
+rocblas_status rocblas_rotg<double>(rocblas_handle handle,
+                                    double* a,
+                                    double* b,
+                                    double* c,
+                                    double* s)
+{
+    return rocblas_drotg(handle, a, b, c, s);
+}
+
+template <>
+rocblas_status rocblas_rotg_strided_batched<double>(rocblas_handle handle,
+                                                    double* a,
+                                                    rocblas_int stride_a,
+                                                    double* b,
+                                                    rocblas_int stride_b,
+                                                    double* c,
+                                                    rocblas_int stride_c,
+                                                    double* s,
+                                                    rocblas_int stride_s,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_drotg_strided_batched(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rotm<double>(rocblas_handle handle,
+                                    rocblas_int n,
+                                    double* x,
+                                    rocblas_int incx,
+                                    double* y,
+                                    rocblas_int incy,
+                                    const double* param)
+{
+    return rocblas_drotm(handle, n, x, incx, y, incy, param);
+}
+
+template <>
+rocblas_status rocblas_rotm_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    const double* param,
+                                                    rocblas_int stride_param,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_drotm_strided_batched(
+        handle, n, x, incx, bsx, y, incy, bsy, param, stride_param, batch_count);
+}
+
+template <>
+rocblas_status rocblas_rotmg<double>(
+    rocblas_handle handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+{
+    return rocblas_drotmg(handle, d1, d2, x1, y1, param);
+}
+
+template <>
+rocblas_status rocblas_rotmg_strided_batched<double>(rocblas_handle handle,
+                                                     double* d1,
+                                                     rocblas_int stride_d1,
+                                                     double* d2,
+                                                     rocblas_int stride_d2,
+                                                     double* x1,
+                                                     rocblas_int stride_x1,
+                                                     const double* y1,
+                                                     rocblas_int stride_y1,
+                                                     double* param,
+                                                     rocblas_int stride_param,
+                                                     rocblas_int batch_count)
+{
+    return rocblas_drotmg_strided_batched(handle,
+                                          d1,
+                                          stride_d1,
+                                          d2,
+                                          stride_d2,
+                                          x1,
+                                          stride_x1,
+                                          y1,
+                                          stride_y1,
+                                          param,
+                                          stride_param,
+                                          batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    level 2 BLAS
+ * ===========================================================================
+ */
+
+template <>
+rocblas_status rocblas_gemv<float>(rocblas_handle handle,
+                                   rocblas_operation transA,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* beta,
+                                   float* y,
+                                   rocblas_int incy)
+{
+    return rocblas_sgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_gemv<double>(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* beta,
+                                    double* y,
+                                    rocblas_int incy)
+{
+    return rocblas_dgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_gemv_order<float>(rocblas_handle handle,
+                                         rocblas_order order,
+                                         rocblas_operation transA,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         const float* alpha,
+                                         const float* A,
+                                         rocblas_int lda,
+                                         const float* x,
+                                         rocblas_int incx,
+                                         const float* beta,
+                                         float* y,
+                                         rocblas_int incy)
+{
+    return rocblas_sgemv_order(handle, order, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_gemv_order<double>(rocblas_handle handle,
+                                          rocblas_order order,
+                                          rocblas_operation transA,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          const double* alpha,
+                                          const double* A,
+                                          rocblas_int lda,
+                                          const double* x,
+                                          rocblas_int incx,
+                                          const double* beta,
+                                          double* y,
+                                          rocblas_int incy)
+{
+    return rocblas_dgemv_order(handle, order, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_symv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* beta,
+                                   float* y,
+                                   rocblas_int incy)
+{
+    return rocblas_ssymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_symv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* beta,
+                                    double* y,
+                                    rocblas_int incy)
+{
+    return rocblas_dsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_hemv<rocblas_float_complex>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   const rocblas_float_complex* alpha,
+                                                   const rocblas_float_complex* A,
+                                                   rocblas_int lda,
+                                                   const rocblas_float_complex* x,
+                                                   rocblas_int incx,
+                                                   const rocblas_float_complex* beta,
+                                                   rocblas_float_complex* y,
+                                                   rocblas_int incy)
+{
+    return rocblas_chemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_hemv<rocblas_double_complex>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* A,
+                                                    rocblas_int lda,
+                                                    const rocblas_double_complex* x,
+                                                    rocblas_int incx,
+                                                    const rocblas_double_complex* beta,
+                                                    rocblas_double_complex* y,
+                                                    rocblas_int incy)
+{
+    return rocblas_zhemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_tbsv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   float* x,
+                                   rocblas_int incx)
+{
+    return rocblas_stbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+template <>
+rocblas_status rocblas_tbsv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal diag,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    double* x,
+                                    rocblas_int incx)
+{
+    return rocblas_dtbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+template <>
+rocblas_status rocblas_gbmv<float>(rocblas_handle handle,
+                                   rocblas_operation transA,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int kl,
+                                   rocblas_int ku,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* beta,
+                                   float* y,
+                                   rocblas_int incy)
+{
+    return rocblas_sgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_gbmv<double>(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    rocblas_int kl,
+                                    rocblas_int ku,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* beta,
+                                    double* y,
+                                    rocblas_int incy)
+{
+    return rocblas_dgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_gbmv_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_operation transA,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   rocblas_int kl,
+                                                   rocblas_int ku,
+                                                   const float* alpha,
+                                                   const float* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   const float* beta,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_sgbmv_strided_batched(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         x,
+                                         incx,
+                                         bsx,
+                                         beta,
+                                         y,
+                                         incy,
+                                         bsy,
+                                         batch_count);
+}
+
+template <>
+rocblas_status rocblas_gbmv_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int kl,
+                                                    rocblas_int ku,
+                                                    const double* alpha,
+                                                    const double* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    const double* beta,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_dgbmv_strided_batched(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         x,
+                                         incx,
+                                         bsx,
+                                         beta,
+                                         y,
+                                         incy,
+                                         bsy,
+                                         batch_count);
+}
+
+template <>
+rocblas_status rocblas_gbmv_batched<float>(rocblas_handle handle,
+                                           rocblas_operation transA,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int kl,
+                                           rocblas_int ku,
+                                           const float* alpha,
+                                           const float* const A[],
+                                           rocblas_int lda,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           const float* beta,
+                                           float* const y[],
+                                           rocblas_int incy,
+                                           rocblas_int batch_count)
+{
+    return rocblas_sgbmv_batched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_gbmv_batched<double>(rocblas_handle handle,
+                                            rocblas_operation transA,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int kl,
+                                            rocblas_int ku,
+                                            const double* alpha,
+                                            const double* const A[],
+                                            rocblas_int lda,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* const y[],
+                                            rocblas_int incy,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dgbmv_batched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_sbmv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* beta,
+                                   float* y,
+                                   rocblas_int incy)
+{
+    return rocblas_ssbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_sbmv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* beta,
+                                    double* y,
+                                    rocblas_int incy)
+{
+    return rocblas_dsbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_sbmv_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   rocblas_int k,
+                                                   const float* alpha,
+                                                   const float* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   const float* beta,
+                                                   float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_ssbmv_strided_batched(
+        handle, uplo, n, k, alpha, A, lda, bsa, x, incx, bsx, beta, y, incy, bsy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_sbmv_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const double* alpha,
+                                                    const double* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    const double* beta,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_dsbmv_strided_batched(
+        handle, uplo, n, k, alpha, A, lda, bsa, x, incx, bsx, beta, y, incy, bsy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_sbmv_batched<float>(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_int k,
+                                           const float* alpha,
+                                           const float* const A[],
+                                           rocblas_int lda,
+                                           const float* const x[],
+                                           rocblas_int incx,
+                                           const float* beta,
+                                           float* const y[],
+                                           rocblas_int incy,
+                                           rocblas_int batch_count)
+{
+    return rocblas_ssbmv_batched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_sbmv_batched<double>(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* alpha,
+                                            const double* const A[],
+                                            rocblas_int lda,
+                                            const double* const x[],
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* const y[],
+                                            rocblas_int incy,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dsbmv_batched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+rocblas_status rocblas_spmv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* AP,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* beta,
+                                   float* y,
+                                   rocblas_int incy)
+{
+    return rocblas_sspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_spmv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* AP,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* beta,
+                                    double* y,
+                                    rocblas_int incy)
+{
+    return rocblas_dspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+rocblas_status rocblas_spr<float>(rocblas_handle handle,
+                                  rocblas_fill uplo,
+                                  rocblas_int n,
+                                  const float* alpha,
+                                  const float* x,
+                                  rocblas_int incx,
+                                  float* AP)
+{
+    return rocblas_sspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+rocblas_status rocblas_spr<double>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const double* alpha,
+                                   const double* x,
+                                   rocblas_int incx,
+                                   double* AP)
+{
+    return rocblas_dspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+rocblas_status rocblas_spr2<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* y,
+                                   rocblas_int incy,
+                                   float* AP)
+{
+    return rocblas_sspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+template <>
+rocblas_status rocblas_spr2<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* y,
+                                    rocblas_int incy,
+                                    double* AP)
+{
+    return rocblas_dspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+template <>
+rocblas_status rocblas_tpmv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   const float* AP,
+                                   float* x,
+                                   rocblas_int incx)
+{
+    return rocblas_stpmv(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+template <>
+rocblas_status rocblas_tpmv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal diag,
+                                    rocblas_int n,
+                                    const double* AP,
+                                    double* x,
+                                    rocblas_int incx)
+{
+    return rocblas_dtpmv(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+template <>
+rocblas_status rocblas_tpsv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   const float* AP,
+                                   float* x,
+                                   rocblas_int incx)
+{
+    return rocblas_stpsv(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+template <>
+rocblas_status rocblas_tpsv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal diag,
+                                    rocblas_int n,
+                                    const double* AP,
+                                    double* x,
+                                    rocblas_int incx)
+{
+    return rocblas_dtpsv(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+template <>
+rocblas_status rocblas_tpttr<float>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const float* AP,
+                                    float* A,
+                                    rocblas_int lda)
+{
+    return rocblas_stpttr(handle, uplo, n, AP, A, lda);
+}
+
+template <>
+rocblas_status rocblas_tpttr<double>(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     const double* AP,
+                                     double* A,
+                                     rocblas_int lda)
+{
+    return rocblas_dtpttr(handle, uplo, n, AP, A, lda);
+}
+
+template <>
+rocblas_status rocblas_ger<float>(rocblas_handle handle,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const float* alpha,
+                                  const float* x,
+                                  rocblas_int incx,
+                                  const float* y,
+                                  rocblas_int incy,
+                                  float* A,
+                                  rocblas_int lda)
+{
+
+    return rocblas_sger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_ger<double>(rocblas_handle handle,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   const double* alpha,
+                                   const double* x,
+                                   rocblas_int incx,
+                                   const double* y,
+                                   rocblas_int incy,
+                                   double* A,
+                                   rocblas_int lda)
+{
+
+    return rocblas_dger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_ger_strided_batched<float>(rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const float* alpha,
+                                                  const float* x,
+                                                  rocblas_int incx,
+                                                  rocblas_int bsx,
+                                                  const float* y,
+                                                  rocblas_int incy,
+                                                  rocblas_int bsy,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_int bsa,
+                                                  rocblas_int batch_count)
+{
+    return rocblas_sger_strided_batched(
+        handle, m, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_ger_strided_batched<double>(rocblas_handle handle,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   const double* alpha,
+                                                   const double* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   const double* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   double* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_dger_strided_batched(
+        handle, m, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_ger_order<float>(rocblas_handle handle,
+                                        rocblas_order order,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* y,
+                                        rocblas_int incy,
+                                        float* A,
+                                        rocblas_int lda)
+{
+    return rocblas_sger_order(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_ger_order<double>(rocblas_handle handle,
+                                         rocblas_order order,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         const double* alpha,
+                                         const double* x,
+                                         rocblas_int incx,
+                                         const double* y,
+                                         rocblas_int incy,
+                                         double* A,
+                                         rocblas_int lda)
+{
+    return rocblas_dger_order(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_syr<float>(rocblas_handle handle,
+                                  rocblas_fill uplo,
+                                  rocblas_int n,
+                                  const float* alpha,
+                                  const float* x,
+                                  rocblas_int incx,
+                                  float* A,
+                                  rocblas_int lda)
+{
+
+    return rocblas_ssyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+rocblas_status rocblas_syr<double>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const double* alpha,
+                                   const double* x,
+                                   rocblas_int incx,
+                                   double* A,
+                                   rocblas_int lda)
+{
+
+    return rocblas_dsyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+rocblas_status rocblas_syr_strided_batched<float>(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  const float* alpha,
+                                                  const float* x,
+                                                  rocblas_int incx,
+                                                  rocblas_int bsx,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  rocblas_int bsa,
+                                                  rocblas_int batch_count)
+{
+    return rocblas_ssyr_strided_batched(
+        handle, uplo, n, alpha, x, incx, bsx, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syr_strided_batched<double>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   const double* alpha,
+                                                   const double* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   double* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_dsyr_strided_batched(
+        handle, uplo, n, alpha, x, incx, bsx, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syr2<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* x,
+                                   rocblas_int incx,
+                                   const float* y,
+                                   rocblas_int incy,
+                                   float* A,
+                                   rocblas_int lda)
+{
+    return rocblas_ssyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_syr2<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* x,
+                                    rocblas_int incx,
+                                    const double* y,
+                                    rocblas_int incy,
+                                    double* A,
+                                    rocblas_int lda)
+{
+    return rocblas_dsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_syr2_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   const float* alpha,
+                                                   const float* x,
+                                                   rocblas_int incx,
+                                                   rocblas_int bsx,
+                                                   const float* y,
+                                                   rocblas_int incy,
+                                                   rocblas_int bsy,
+                                                   float* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_ssyr2_strided_batched(
+        handle, uplo, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syr2_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    const double* alpha,
+                                                    const double* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    const double* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    double* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_dsyr2_strided_batched(
+        handle, uplo, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+template <>
+rocblas_status rocblas_her<rocblas_float_complex, float>(rocblas_handle handle,
+                                                         rocblas_fill uplo,
+                                                         rocblas_int n,
+                                                         const float* alpha,
+                                                         const rocblas_float_complex* x,
+                                                         rocblas_int incx,
+                                                         rocblas_float_complex* A,
+                                                         rocblas_int lda)
+{
+    return rocblas_cher(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+rocblas_status rocblas_her<rocblas_double_complex, double>(rocblas_handle handle,
+                                                           rocblas_fill uplo,
+                                                           rocblas_int n,
+                                                           const double* alpha,
+                                                           const rocblas_double_complex* x,
+                                                           rocblas_int incx,
+                                                           rocblas_double_complex* A,
+                                                           rocblas_int lda)
+{
+    return rocblas_zher(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+rocblas_status rocblas_her2<rocblas_float_complex>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   const rocblas_float_complex* alpha,
+                                                   const rocblas_float_complex* x,
+                                                   rocblas_int incx,
+                                                   const rocblas_float_complex* y,
+                                                   rocblas_int incy,
+                                                   rocblas_float_complex* A,
+                                                   rocblas_int lda)
+{
+    return rocblas_cher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_her2<rocblas_double_complex>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    const rocblas_double_complex* alpha,
+                                                    const rocblas_double_complex* x,
+                                                    rocblas_int incx,
+                                                    const rocblas_double_complex* y,
+                                                    rocblas_int incy,
+                                                    rocblas_double_complex* A,
+                                                    rocblas_int lda)
+{
+    return rocblas_zher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+
+//
+
+template <>
+rocblas_status rocblas_trtri<float>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_diagonal diag,
+                                    rocblas_int n,
+                                    float* A,
+                                    rocblas_int lda,
+                                    float* invA,
+                                    rocblas_int ldinvA)
+{
+    return rocblas_strtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri<double>(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_diagonal diag,
+                                     rocblas_int n,
+                                     double* A,
+                                     rocblas_int lda,
+                                     double* invA,
+                                     rocblas_int ldinvA)
+{
+    return rocblas_dtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched<float>(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            float* invA,
+                                            rocblas_int ldinvA,
+                                            rocblas_int bsinvA,
+                                            rocblas_int batch_count)
+{
+    return rocblas_strtri_batched(
+        handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA, batch_count);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched<double>(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_diagonal diag,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_int bsa,
+                                             double* invA,
+                                             rocblas_int ldinvA,
+                                             rocblas_int bsinvA,
+                                             rocblas_int batch_count)
+{
+    return rocblas_dtrtri_batched(
+        handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA, batch_count);
+}
+
+template <>
+rocblas_status rocblas_geam<float>(rocblas_handle handle,
+                                   rocblas_operation transA,
+                                   rocblas_operation transB,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* beta,
+                                   const float* B,
+                                   rocblas_int ldb,
+                                   float* C,
+                                   rocblas_int ldc)
+{
+    return rocblas_sgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_geam<double>(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* beta,
+                                    const double* B,
+                                    rocblas_int ldb,
+                                    double* C,
+                                    rocblas_int ldc)
+{
+    return rocblas_dgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_geam_order<float>(rocblas_handle handle,
+                                         rocblas_order order,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         const float* alpha,
+                                         const float* A,
+                                         rocblas_int lda,
+                                         const float* beta,
+                                         const float* B,
+                                         rocblas_int ldb,
+                                         float* C,
+                                         rocblas_int ldc)
+{
+    return rocblas_sgeam_order(
+        handle, order, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_geam_order<double>(rocblas_handle handle,
+                                          rocblas_order order,
+                                          rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          const double* alpha,
+                                          const double* A,
+                                          rocblas_int lda,
+                                          const double* beta,
+                                          const double* B,
+                                          rocblas_int ldb,
+                                          double* C,
+                                          rocblas_int ldc)
+{
+    return rocblas_dgeam_order(
+        handle, order, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_transpose_inplace<float>(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda)
+{
+    return rocblas_stranspose_inplace(handle, m, n, A, lda);
+}
+
+template <>
+rocblas_status rocblas_transpose_inplace<double>(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda)
+{
+    return rocblas_dtranspose_inplace(handle, m, n, A, lda);
+}
+
+template <>
+rocblas_status rocblas_transpose_inplace_strided_batched<float>(rocblas_handle handle,
+                                                                rocblas_int m,
+                                                                rocblas_int n,
+                                                                float* A,
+                                                                rocblas_int lda,
+                                                                rocblas_int stride_a,
+                                                                rocblas_int batch_count)
+{
+    return rocblas_stranspose_inplace_strided_batched(handle, m, n, A, lda, stride_a, batch_count);
+}
+
+template <>
+rocblas_status rocblas_transpose_inplace_strided_batched<double>(rocblas_handle handle,
+                                                                 rocblas_int m,
+                                                                 rocblas_int n,
+                                                                 double* A,
+                                                                 rocblas_int lda,
+                                                                 rocblas_int stride_a,
+                                                                 rocblas_int batch_count)
+{
+    return rocblas_dtranspose_inplace_strided_batched(handle, m, n, A, lda, stride_a, batch_count);
+}
+
+#if BUILD_WITH_TENSILE
+
+template <>
+rocblas_status rocblas_gemm<rocblas_half>(rocblas_handle handle,
+                                          rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          const rocblas_half* alpha,
+                                          const rocblas_half* A,
+                                          rocblas_int lda,
+                                          const rocblas_half* B,
+                                          rocblas_int ldb,
+                                          const rocblas_half* beta,
+                                          rocblas_half* C,
+                                          rocblas_int ldc)
+{
+    return rocblas_hgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_gemm<float>(rocblas_handle handle,
+                                   rocblas_operation transA,
+                                   rocblas_operation transB,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* B,
+                                   rocblas_int ldb,
+                                   const float* beta,
+                                   float* C,
+                                   rocblas_int ldc)
+{
+    return rocblas_sgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_gemm<double>(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    rocblas_int k,
                                     const double* alpha,
                                     const double* A,
                                     rocblas_int lda,
@@ -674,6 +2399,48 @@ rocblas_status rocblas_gemm<double>(rocblas_handle handle,
     return rocblas_dgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+template <>
+rocblas_status rocblas_gemm_order<float>(rocblas_handle handle,
+                                         rocblas_order order,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const float* alpha,
+                                         const float* A,
+                                         rocblas_int lda,
+                                         const float* B,
+                                         rocblas_int ldb,
+                                         const float* beta,
+                                         float* C,
+                                         rocblas_int ldc)
+{
+    return rocblas_sgemm_order(
+        handle, order, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_gemm_order<double>(rocblas_handle handle,
+                                          rocblas_order order,
+                                          rocblas_operation transA,
+                                          rocblas_operation transB,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          const double* alpha,
+                                          const double* A,
+                                          rocblas_int lda,
+                                          const double* B,
+                                          rocblas_int ldb,
+                                          const double* beta,
+                                          double* C,
+                                          rocblas_int ldc)
+{
+    return rocblas_dgemm_order(
+        handle, order, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 rocblas_status rocblas_gemm_strided_batched<rocblas_half>(rocblas_handle handle,
                                                           rocblas_operation transA,
@@ -797,6 +2564,196 @@ rocblas_status rocblas_gemm_strided_batched<double>(rocblas_handle handle,
                                          batch_count);
 }
 
+template <>
+rocblas_status rocblas_syrk<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation trans,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* beta,
+                                   float* C,
+                                   rocblas_int ldc)
+{
+    return rocblas_ssyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_syrk<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation trans,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* beta,
+                                    double* C,
+                                    rocblas_int ldc)
+{
+    return rocblas_dsyrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_syrk_strided_batched<float>(rocblas_handle handle,
+                                                   rocblas_fill uplo,
+                                                   rocblas_operation trans,
+                                                   rocblas_int n,
+                                                   rocblas_int k,
+                                                   const float* alpha,
+                                                   const float* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   const float* beta,
+                                                   float* C,
+                                                   rocblas_int ldc,
+                                                   rocblas_int bsc,
+                                                   rocblas_int batch_count)
+{
+    return rocblas_ssyrk_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, beta, C, ldc, bsc, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syrk_strided_batched<double>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_operation trans,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const double* alpha,
+                                                    const double* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    const double* beta,
+                                                    double* C,
+                                                    rocblas_int ldc,
+                                                    rocblas_int bsc,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_dsyrk_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, beta, C, ldc, bsc, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syr2k<float>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation trans,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const float* alpha,
+                                    const float* A,
+                                    rocblas_int lda,
+                                    const float* B,
+                                    rocblas_int ldb,
+                                    const float* beta,
+                                    float* C,
+                                    rocblas_int ldc)
+{
+    return rocblas_ssyr2k(handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_syr2k<double>(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation trans,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const double* alpha,
+                                     const double* A,
+                                     rocblas_int lda,
+                                     const double* B,
+                                     rocblas_int ldb,
+                                     const double* beta,
+                                     double* C,
+                                     rocblas_int ldc)
+{
+    return rocblas_dsyr2k(handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_syr2k_strided_batched<float>(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_operation trans,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const float* alpha,
+                                                    const float* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    const float* B,
+                                                    rocblas_int ldb,
+                                                    rocblas_int bsb,
+                                                    const float* beta,
+                                                    float* C,
+                                                    rocblas_int ldc,
+                                                    rocblas_int bsc,
+                                                    rocblas_int batch_count)
+{
+    return rocblas_ssyr2k_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+template <>
+rocblas_status rocblas_syr2k_strided_batched<double>(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_operation trans,
+                                                     rocblas_int n,
+                                                     rocblas_int k,
+                                                     const double* alpha,
+                                                     const double* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     const double* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_int bsb,
+                                                     const double* beta,
+                                                     double* C,
+                                                     rocblas_int ldc,
+                                                     rocblas_int bsc,
+                                                     rocblas_int batch_count)
+{
+    return rocblas_dsyr2k_strided_batched(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+template <>
+rocblas_status rocblas_symm<float>(rocblas_handle handle,
+                                   rocblas_side side,
+                                   rocblas_fill uplo,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   const float* alpha,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   const float* B,
+                                   rocblas_int ldb,
+                                   const float* beta,
+                                   float* C,
+                                   rocblas_int ldc)
+{
+    return rocblas_ssymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_symm<double>(rocblas_handle handle,
+                                    rocblas_side side,
+                                    rocblas_fill uplo,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    const double* alpha,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    const double* B,
+                                    rocblas_int ldb,
+                                    const double* beta,
+                                    double* C,
+                                    rocblas_int ldc)
+{
+    return rocblas_dsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 rocblas_status rocblas_trsm<float>(rocblas_handle handle,
                                    rocblas_side side,
@@ -831,6 +2788,72 @@ rocblas_status rocblas_trsm<double>(rocblas_handle handle,
     return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
+template <>
+rocblas_status rocblas_trsm_order<float>(rocblas_handle handle,
+                                         rocblas_order order,
+                                         rocblas_side side,
+                                         rocblas_fill uplo,
+                                         rocblas_operation transA,
+                                         rocblas_diagonal diag,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         const float* alpha,
+                                         float* A,
+                                         rocblas_int lda,
+                                         float* B,
+                                         rocblas_int ldb)
+{
+    return rocblas_strsm_order(
+        handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+rocblas_status rocblas_trsm_order<double>(rocblas_handle handle,
+                                          rocblas_order order,
+                                          rocblas_side side,
+                                          rocblas_fill uplo,
+                                          rocblas_operation transA,
+                                          rocblas_diagonal diag,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          const double* alpha,
+                                          double* A,
+                                          rocblas_int lda,
+                                          double* B,
+                                          rocblas_int ldb)
+{
+    return rocblas_dtrsm_order(
+        handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+rocblas_status rocblas_trsv<float>(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   const float* A,
+                                   rocblas_int lda,
+                                   float* x,
+                                   rocblas_int incx)
+{
+    return rocblas_strsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+}
+
+template <>
+rocblas_status rocblas_trsv<double>(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal diag,
+                                    rocblas_int n,
+                                    const double* A,
+                                    rocblas_int lda,
+                                    double* x,
+                                    rocblas_int incx)
+{
+    return rocblas_dtrsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+}
+
 #endif
 
 //
@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <string>
+#include "rocblas.h"
+#include "gemm_degenerate.h"
+#include "gemm_small_batched.h"
+#include "tune.h"
+
+/* ============================================================================================ */
+/*  timers */
+
+// FNV-1a step
+static unsigned long long tune_hash(unsigned long long h, long long x)
+{
+    return (h ^ (unsigned long long)x) * 1099511628211ull;
+}
+
+double tune_simulated_timer::time_us(const tune_problem& problem, rocblas_int solution)
+{
+    // a hash of the problem and the solution gives the fraction of peak, between 0.05 and 1
+    unsigned long long h = 14695981039346656037ull;
+
+    h = tune_hash(h, problem.precision);
+    h = tune_hash(h, problem.transA_option);
+    h = tune_hash(h, problem.transB_option);
+    h = tune_hash(h, problem.M);
+    h = tune_hash(h, problem.N);
+    h = tune_hash(h, problem.K);
+    h = tune_hash(h, problem.batch_count);
+    h = tune_hash(h, solution);
+
+    double efficiency = 0.05 + 0.95 * (double)(h % 1000) / 999.0;
+
+    return tune_gflops(problem, 1.0) / (peak_gflops * efficiency);
+}
+
+static void replace_all(std::string& s, const std::string& token, const std::string& value)
+{
+    for(size_t i = s.find(token); i != std::string::npos; i = s.find(token, i + value.size()))
+        s.replace(i, token.size(), value);
+}
+
+std::string tune_command_timer::expand(const tune_problem& problem, rocblas_int solution) const
+{
+    std::string s = command;
+
+    replace_all(s, "{precision}", std::string(1, problem.precision));
+    replace_all(s, "{transA}", std::string(1, problem.transA_option));
+    replace_all(s, "{transB}", std::string(1, problem.transB_option));
+    replace_all(s, "{m}", std::to_string(problem.M));
+    replace_all(s, "{n}", std::to_string(problem.N));
+    replace_all(s, "{k}", std::to_string(problem.K));
+    replace_all(s, "{batch}", std::to_string(problem.batch_count));
+    replace_all(s, "{solution}", std::to_string(solution));
+
+    return s;
+}
+
+double tune_command_timer::time_us(const tune_problem& problem, rocblas_int solution)
+{
+    FILE* pipe = popen(expand(problem, solution).c_str(), "r");
+    if(pipe == nullptr)
+        return -1.0;
+
+    std::string output;
+    char buffer[256];
+    while(fgets(buffer, sizeof(buffer), pipe) != nullptr)
+        output += buffer;
+
+    if(pclose(pipe) != 0)
+        return -1.0;
+
+    // the last number of the output
+    double time = -1.0;
+    for(const char* p = output.c_str(); *p != '\0';)
+    {
+        char* end;
+        double x = strtod(p, &end);
+        if(end != p)
+        {
+            time = x;
+            p    = end;
+        }
+        else
+            p++;
+    }
+
+    return time;
+}
+
+/* ============================================================================================ */
+/*  problems */
+
+bool tune_parse_problem(const std::string& line, tune_problem& problem)
+{
+    std::istringstream tokens(line);
+    std::vector<std::string> args;
+    for(std::string t; tokens >> t;)
+        args.push_back(t);
+
+    if(args.empty() || args[0][0] == '#')
+        return false;
+
+    // the defaults of rocblas-bench
+    std::string function;
+    problem.precision       = 's';
+    problem.transA_option   = 'N';
+    problem.transB_option   = 'N';
+    problem.M               = 128;
+    problem.N               = 128;
+    problem.K               = 128;
+    problem.batch_count     = 10;
+    problem.strided_batched = false;
+
+    for(size_t i = 0; i + 1 < args.size(); i++)
+    {
+        const std::string& a = args[i];
+        const std::string& v = args[i + 1];
+
+        if(a == "-f" || a == "--function")
+            function = v;
+        else if(a == "-r" || a == "--precision")
+            problem.precision = v[0];
+        else if(a == "--transposeA")
+            problem.transA_option = v[0];
+        else if(a == "--transposeB")
+            problem.transB_option = v[0];
+        else if(a == "-m" || a == "--sizem")
+            problem.M = atoi(v.c_str());
+        else if(a == "-n" || a == "--sizen")
+            problem.N = atoi(v.c_str());
+        else if(a == "-k" || a == "--sizek")
+            problem.K = atoi(v.c_str());
+        else if(a == "--batch")
+            problem.batch_count = atoi(v.c_str());
+    }
+
+    if(function == "gemm")
+        problem.batch_count = 1;
+    else if(function == "gemm_strided_batched")
+        problem.strided_batched = true;
+    else
+        return false;
+
+    // the real types have no conjugate, 'C' runs as 'T'
+    if(problem.transA_option == 'C')
+        problem.transA_option = 'T';
+    if(problem.transB_option == 'C')
+        problem.transB_option = 'T';
+
+    return (problem.precision == 'h' || problem.precision == 's' || problem.precision == 'd') &&
+           (problem.transA_option == 'N' || problem.transA_option == 'T') &&
+           (problem.transB_option == 'N' || problem.transB_option == 'T');
+}
+
+bool tune_uses_tensile(const tune_problem& problem)
+{
+    if(problem.M < 1 || problem.N < 1 || problem.K < 1 || problem.batch_count < 1)
+        return false;
+
+    // half precision always runs on Tensile
+    if(problem.precision == 'h')
+        return true;
+
+    if(rocblas_gemm_classify(problem.M, problem.N, problem.K, problem.batch_count, false) !=
+       rocblas_gemm_shape_general)
+        return false;
+
+    // only gemm_strided_batched is dispatched to the small batched kernels, whatever its batch
+    return !problem.strided_batched ||
+           rocblas_gemm_small_batched_select(
+               problem.M, problem.N, problem.K, problem.batch_count) < 0;
+}
+
+std::string tune_logic_name(const tune_problem& problem)
+{
+    std::string name = "Cijk_";
+
+    name += problem.transA_option == 'N' ? "Ailk" : "Alik";
+    name += problem.transB_option == 'N' ? "_Bljk_" : "_Bjlk_";
+    name += (char)toupper(problem.precision);
+    name += "B";
+
+    return name;
+}
+
+double tune_gflops(const tune_problem& problem, double time_us)
+{
+    return 2.0 * problem.M * problem.N * problem.K * problem.batch_count / (time_us * 1e3);
+}
+
+/* ============================================================================================ */
+/*  Logic files */
+
+// the lines of a Logic file, and where its top level items start
+static bool split_logic(const std::string& logic,
+                        std::vector<std::string>& lines,
+                        std::vector<size_t>& items)
+{
+    std::istringstream is(logic);
+    for(std::string line; std::getline(is, line);)
+    {
+        if(!line.empty() && line[0] == '-')
+            items.push_back(lines.size());
+        lines.push_back(line);
+    }
+    items.push_back(lines.size());
+
+    // nine items and an end
+    return items.size() >= 10 && items[0] == 0;
+}
+
+rocblas_int tune_solution_count(const std::string& logic)
+{
+    std::vector<std::string> lines;
+    std::vector<size_t> items;
+    if(!split_logic(logic, lines, items))
+        return 0;
+
+    // every solution starts a list element, the first one with the item itself
+    rocblas_int count = 0;
+    for(size_t i = items[5]; i < items[6]; i++)
+        if(lines[i].compare(0, 4, "- - ") == 0 || lines[i].compare(0, 4, "  - ") == 0)
+            count++;
+
+    return count;
+}
+
+std::vector<tune_result> tune_search(const std::vector<tune_problem>& problems,
+                                     rocblas_int solution_count,
+                                     tune_timer& timer,
+                                     rocblas_int iters)
+{
+    std::vector<tune_result> results;
+    std::set<std::string> searched;
+
+    for(const tune_problem& p : problems)
+    {
+        // a log of an application repeats its calls
+        std::ostringstream key;
+        key << p.precision << p.transA_option << p.transB_option << ' ' << p.M << ' ' << p.N
+            << ' ' << p.K << ' ' << p.batch_count;
+        if(!searched.insert(key.str()).second)
+            continue;
+
+        tune_result best = {p, -1, 0.0};
+        double best_us   = 0.0;
+
+        for(rocblas_int s = 0; s < solution_count; s++)
+        {
+            double us = -1.0;
+            for(rocblas_int i = 0; i < iters; i++)
+            {
+                double t = timer.time_us(p, s);
+                if(t <= 0.0)
+                {
+                    us = -1.0;
+                    break;
+                }
+                if(us < 0.0 || t < us)
+                    us = t;
+            }
+
+            if(us > 0.0 && (best.solution < 0 || us < best_us))
+            {
+                best.solution = s;
+                best_us       = us;
+            }
+        }
+
+        if(best.solution >= 0)
+        {
+            best.gflops = tune_gflops(p, best_us);
+            results.push_back(best);
+        }
+    }
+
+    return results;
+}
+
+// the [m, n, batch_count, k] of an exact logic entry, the order of the sizes of Tensile
+static std::string logic_sizes(const tune_problem& p)
+{
+    std::ostringstream s;
+    s << "[" << p.M << ", " << p.N << ", " << p.batch_count << ", " << p.K << "]";
+    return s.str();
+}
+
+std::string tune_write_logic(const std::string& logic, const std::vector<tune_result>& results)
+{
+    std::vector<std::string> lines;
+    std::vector<size_t> items;
+    if(!split_logic(logic, lines, items))
+        return "";
+
+    // the entries of the exact logic, as their sizes and the lines after them
+    std::vector<std::string> sizes;
+    std::vector<std::vector<std::string>> bodies;
+    for(size_t i = items[7]; i < items[8]; i++)
+    {
+        const std::string& line = lines[i];
+        if(line.compare(0, 6, "- - - ") == 0 || line.compare(0, 6, "  - - ") == 0)
+        {
+            sizes.push_back(line.substr(6));
+            bodies.push_back(std::vector<std::string>());
+        }
+        else if(!bodies.empty())
+            bodies.back().push_back(line);
+    }
+
+    for(const tune_result& r : results)
+    {
+        std::ostringstream pick;
+        pick << "    - [" << r.solution << ", " << r.gflops << "]";
+
+        std::string s = logic_sizes(r.problem);
+        size_t e      = 0;
+        while(e < sizes.size() && sizes[e] != s)
+            e++;
+
+        if(e == sizes.size())
+        {
+            sizes.push_back(s);
+            bodies.push_back(std::vector<std::string>());
+        }
+        bodies[e] = std::vector<std::string>(1, pick.str());
+    }
+
+    std::ostringstream os;
+    for(size_t i = 0; i < items[7]; i++)
+        os << lines[i] << "\n";
+
+    if(sizes.empty())
+        os << "- []\n";
+    for(size_t e = 0; e < sizes.size(); e++)
+    {
+        os << (e == 0 ? "- - - " : "  - - ") << sizes[e] << "\n";
+        for(const std::string& line : bodies[e])
+            os << line << "\n";
+    }
+
+    for(size_t i = items[8]; i < lines.size(); i++)
+        os << lines[i] << "\n";
+
+    return os.str();
+}
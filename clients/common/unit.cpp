@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include <iostream>
+#include <string.h>
 #include "rocblas.h"
 #include "unit.h"
 
@@ -138,6 +139,58 @@ void unit_check_general(
     }
 }
 
+/* ========================================Gtest Bitwise Check
+ * ==================================================== */
+
+/*! \brief Template: gtest compare the bit patterns of two matrices, so that -0.0 differs from 0.0
+ * and no ulp of difference is allowed */
+
+template <>
+void bitwise_check_general(
+    rocblas_int M, rocblas_int N, rocblas_int lda, rocblas_half* hCPU, rocblas_half* hGPU)
+{
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
+template <>
+void bitwise_check_general(rocblas_int M, rocblas_int N, rocblas_int lda, float* hCPU, float* hGPU)
+{
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(0, memcmp(&hCPU[i + j * lda], &hGPU[i + j * lda], sizeof(float)))
+                << hCPU[i + j * lda] << " " << hGPU[i + j * lda];
+#endif
+        }
+    }
+}
+
+template <>
+void bitwise_check_general(
+    rocblas_int M, rocblas_int N, rocblas_int lda, double* hCPU, double* hGPU)
+{
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_EQ(0, memcmp(&hCPU[i + j * lda], &hGPU[i + j * lda], sizeof(double)))
+                << hCPU[i + j * lda] << " " << hGPU[i + j * lda];
+#endif
+        }
+    }
+}
+
 /* ========================================Gtest Unit Check TRSM
  * ==================================================== */
 
@@ -213,6 +213,18 @@ rocblas_side char2rocblas_side(char value)
     return rocblas_side_left;
 }
 
+rocblas_order char2rocblas_order(char value)
+{
+    switch(value)
+    {
+    case 'C': return rocblas_order_column_major;
+    case 'R': return rocblas_order_row_major;
+    case 'c': return rocblas_order_column_major;
+    case 'r': return rocblas_order_row_major;
+    }
+    return rocblas_order_column_major;
+}
+
 #ifdef __cplusplus
 }
 #endif
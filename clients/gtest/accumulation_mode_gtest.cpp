@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_accumulation_mode.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, vector<int>, string> accumulation_mode_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     BLAS set-get_accumulation_mode:
+=================================================================== */
+
+TEST(checkin_auxilliary, set_accumulation_mode_get_accumulation_mode)
+{
+    rocblas_status status          = rocblas_status_success;
+    rocblas_accumulation_mode mode = rocblas_accumulation_mode_native;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    const rocblas_accumulation_mode modes[] = {rocblas_accumulation_mode_compensated,
+                                               rocblas_accumulation_mode_double,
+                                               rocblas_accumulation_mode_native};
+
+    for(rocblas_accumulation_mode set_mode : modes)
+    {
+        status = rocblas_set_accumulation_mode(handle, set_mode);
+        EXPECT_EQ(status, rocblas_status_success);
+
+        status = rocblas_get_accumulation_mode(handle, &mode);
+        EXPECT_EQ(status, rocblas_status_success);
+
+        EXPECT_EQ(set_mode, mode);
+    }
+}
+
+const vector<int> N_range = {1, 1000, 1025, 100000};
+
+const vector<int> large_N_range = {1048577, 10000000};
+
+// vector of vector, each vector is a {incx, incy};
+const vector<vector<int>> inc_range = {
+    {1, 1}, {2, 3},
+};
+
+const vector<string> routine_range = {
+    "dot", "asum", "nrm2",
+};
+
+// the fused routines that take the dot product x * y, the column of mdot is x with incx = 1
+const vector<vector<int>> fused_inc_range = {
+    {1, 1}, {1, 3},
+};
+
+const vector<string> fused_routine_range = {
+    "mdot", "axpy_dot", "dot_nrm2",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 reductions in every accumulation mode
+=================================================================== */
+
+Arguments setup_accumulation_mode_arguments(accumulation_mode_tuple tup)
+{
+    int N           = std::get<0>(tup);
+    vector<int> inc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N    = N;
+    arg.incx = inc[0];
+    arg.incy = inc[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class accumulation_mode_gtest : public ::TestWithParam<accumulation_mode_tuple>
+{
+    protected:
+    accumulation_mode_gtest() {}
+    virtual ~accumulation_mode_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(accumulation_mode_gtest, accumulation_float)
+{
+    Arguments arg  = setup_accumulation_mode_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_accumulation_mode<float>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(accumulation_mode_gtest, accumulation_double)
+{
+    Arguments arg  = setup_accumulation_mode_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_accumulation_mode<double>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, {incx, incy}, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        accumulation_mode_gtest,
+                        Combine(ValuesIn(N_range), ValuesIn(inc_range), ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        accumulation_mode_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1_fused,
+                        accumulation_mode_gtest,
+                        Combine(ValuesIn(N_range),
+                                ValuesIn(fused_inc_range),
+                                ValuesIn(fused_routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1_fused,
+                        accumulation_mode_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(fused_routine_range)));
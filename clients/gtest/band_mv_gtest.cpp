@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_band_mv.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, vector<double>, string, string> band_mv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, KL, KU, lda}; sbmv ignores M and KL and uses KU as K.
+// kl + ku + 1 <= 4 takes the narrow tile, KL or KU >= M or N covers bands wider than the matrix
+const vector<vector<int>> matrix_size_range = {
+    {-1, 5, 1, 1, 3},
+    {5, 5, 2, 1, 3},
+    {0, 4, 1, 1, 3},
+    {1, 1, 0, 0, 1},
+    {10, 7, 2, 3, 6},
+    {64, 64, 1, 1, 3},
+    {33, 40, 0, 5, 6},
+    {130, 100, 3, 1, 7},
+    {300, 257, 20, 17, 40},
+    {50, 60, 100, 100, 201},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {4000, 4000, 2, 2, 5}, {2000, 3000, 64, 64, 129},
+};
+
+// vector of vector, each vector is a {incx, incy}
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 3}, {-1, 2}, {1, 0},
+};
+
+// vector of vector, each vector is a {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0}, {2.0, -3.0}, {0.0, 2.0},
+};
+
+// each string is the option characters transA and uplo;
+// for single/double precision, 'C'(conjTranspose) is the same as 'T' (transpose)
+const vector<string> gbmv_op_range = {"NL", "TL", "CL"};
+
+const vector<string> sbmv_op_range = {"NU", "NL"};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 gbmv and sbmv and their batched forms
+=================================================================== */
+
+Arguments setup_band_mv_arguments(band_mv_tuple tup)
+{
+    vector<int> matrix_size   = std::get<0>(tup);
+    vector<int> incx_incy     = std::get<1>(tup);
+    vector<double> alpha_beta = std::get<2>(tup);
+    string op                 = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.KL  = matrix_size[2];
+    arg.KU  = matrix_size[3];
+    arg.K   = matrix_size[3];
+    arg.lda = matrix_size[4];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.transA_option = op[0];
+    arg.uplo_option   = op[1];
+
+    arg.batch_count = 3;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class band_mv_gtest : public ::TestWithParam<band_mv_tuple>
+{
+    protected:
+    band_mv_gtest() {}
+    virtual ~band_mv_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the status a rejected argument has to give
+void band_mv_expect_status(const Arguments& arg, const string& routine, rocblas_status status)
+{
+    bool sym       = routine.compare(0, 4, "sbmv") == 0;
+    rocblas_int M  = sym ? arg.N : arg.M;
+    rocblas_int KL = sym ? 0 : arg.KL;
+
+    if(M < 0 || arg.N < 0 || KL < 0 || arg.KU < 0)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(arg.lda < KL + arg.KU + 1)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(arg.incx == 0 || arg.incy == 0)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else
+    {
+        EXPECT_EQ(rocblas_status_success, status);
+    }
+}
+
+TEST_P(band_mv_gtest, band_mv_float)
+{
+    Arguments arg  = setup_band_mv_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_band_mv<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        band_mv_expect_status(arg, routine, status);
+    }
+}
+
+TEST_P(band_mv_gtest, band_mv_double)
+{
+    Arguments arg  = setup_band_mv_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_band_mv<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        band_mv_expect_status(arg, routine, status);
+    }
+}
+
+// The combinations are  { {M, N, KL, KU, lda}, {incx, incy}, {alpha, beta}, op, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_gbmv,
+                        band_mv_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(gbmv_op_range),
+                                Values(string("gbmv"),
+                                       string("gbmv_strided_batched"),
+                                       string("gbmv_batched"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_sbmv,
+                        band_mv_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(sbmv_op_range),
+                                Values(string("sbmv"),
+                                       string("sbmv_strided_batched"),
+                                       string("sbmv_batched"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2_band_mv,
+                        band_mv_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                Values(vector<double>{2.0, -3.0}),
+                                Values(string("NL"), string("TU")),
+                                Values(string("gbmv"),
+                                       string("gbmv_strided_batched"),
+                                       string("sbmv"),
+                                       string("sbmv_batched"))));
+
+// more problems than a grid dimension holds, launched in several chunks
+TEST(daily_blas2_band_mv, huge_batch)
+{
+    for(string routine : {"gbmv_strided_batched", "gbmv_batched", "sbmv_strided_batched"})
+    {
+        band_mv_tuple tup(
+            vector<int>{4, 4, 1, 1, 3}, vector<int>{1, 1}, vector<double>{2.0, -3.0}, "NL", routine);
+
+        Arguments arg   = setup_band_mv_arguments(tup);
+        arg.batch_count = 70000;
+
+        EXPECT_EQ(rocblas_status_success, testing_band_mv<float>(arg, routine));
+    }
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_blas1_batched.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, int, vector<int>, string> blas1_batched_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+const vector<int> N_range = {-1, 0, 5, 1000, 1025, 10000};
+
+const vector<int> large_N_range = {1048576, 4000000};
+
+// batch_count < 0 is an invalid size, 0 is a quick return
+const vector<int> batch_count_range = {-1, 0, 1, 3, 17};
+
+const vector<int> large_batch_count_range = {2, 10};
+
+// more vectors than a grid dimension holds, launched in several chunks
+const vector<int> huge_batch_count_range = {70000};
+
+// vector of vector, each pair is a {incx, incy};
+// the reductions quick return for incx <= 0, only positive increments are compared to cblas
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 1}, {1, 3},
+};
+
+const vector<string> routine_range = {
+    "scal", "copy", "swap", "axpy", "dot", "asum", "nrm2", "iamax",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 batched: every routine as _strided_batched and _batched
+=================================================================== */
+
+Arguments setup_blas1_batched_arguments(blas1_batched_tuple tup)
+{
+    int N                 = std::get<0>(tup);
+    int batch_count       = std::get<1>(tup);
+    vector<int> incx_incy = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N           = N;
+    arg.batch_count = batch_count;
+    arg.incx        = incx_incy[0];
+    arg.incy        = incx_incy[1];
+    arg.alpha       = 2.0;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class blas1_batched_gtest : public ::TestWithParam<blas1_batched_tuple>
+{
+    protected:
+    blas1_batched_gtest() {}
+    virtual ~blas1_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(blas1_batched_gtest, blas1_batched_float)
+{
+    Arguments arg  = setup_blas1_batched_arguments(GetParam());
+    string routine = std::get<3>(GetParam());
+
+    rocblas_status status = testing_blas1_batched<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+        EXPECT_LT(arg.batch_count, 0);
+    }
+}
+
+TEST_P(blas1_batched_gtest, blas1_batched_double)
+{
+    Arguments arg  = setup_blas1_batched_arguments(GetParam());
+    string routine = std::get<3>(GetParam());
+
+    rocblas_status status = testing_blas1_batched<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+        EXPECT_LT(arg.batch_count, 0);
+    }
+}
+
+// The combinations are  { N, batch_count, {incx, incy}, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        blas1_batched_gtest,
+                        Combine(ValuesIn(N_range),
+                                ValuesIn(batch_count_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        blas1_batched_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                ValuesIn(large_batch_count_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1_huge_batch,
+                        blas1_batched_gtest,
+                        Combine(Values(5),
+                                ValuesIn(huge_batch_count_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(routine_range)));
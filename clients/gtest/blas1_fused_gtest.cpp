@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_blas1_fused.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, vector<int>, double, string> blas1_fused_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+const vector<int> N_range = {-1, 0, 1, 5, 1000, 1025, 10000};
+
+const vector<int> large_N_range = {1048576, 4000000};
+
+// vector of vector, each pair is a {incx, incy};
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 1}, {1, 3}, {-1, 2}, {-2, -1},
+};
+
+const vector<double> alpha_range = {2.0, -1.0};
+
+const vector<string> routine_range = {
+    "axpy_dot", "dot_nrm2", "scal_copy",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 fused: axpy_dot, dot_nrm2 and scal_copy
+=================================================================== */
+
+Arguments setup_blas1_fused_arguments(blas1_fused_tuple tup)
+{
+    int N                 = std::get<0>(tup);
+    vector<int> incx_incy = std::get<1>(tup);
+    double alpha          = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N     = N;
+    arg.incx  = incx_incy[0];
+    arg.incy  = incx_incy[1];
+    arg.alpha = alpha;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class blas1_fused_gtest : public ::TestWithParam<blas1_fused_tuple>
+{
+    protected:
+    blas1_fused_gtest() {}
+    virtual ~blas1_fused_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(blas1_fused_gtest, blas1_fused_float)
+{
+    Arguments arg  = setup_blas1_fused_arguments(GetParam());
+    string routine = std::get<3>(GetParam());
+
+    rocblas_status status = testing_blas1_fused<float>(arg, routine);
+
+    // the fused routines have no invalid sizes, N <= 0 is a quick return
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(blas1_fused_gtest, blas1_fused_double)
+{
+    Arguments arg  = setup_blas1_fused_arguments(GetParam());
+    string routine = std::get<3>(GetParam());
+
+    rocblas_status status = testing_blas1_fused<double>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, {incx, incy}, alpha, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        blas1_fused_gtest,
+                        Combine(ValuesIn(N_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        blas1_fused_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1}),
+                                Values(2.0),
+                                ValuesIn(routine_range)));
@@ -12,6 +12,7 @@
 #include "testing_copy.hpp"
 #include "testing_dot.hpp"
 #include "testing_iamax.hpp"
+#include "testing_iamin.hpp"
 #include "testing_nrm2.hpp"
 #include "testing_scal.hpp"
 #include "testing_swap.hpp"
@@ -71,7 +72,7 @@ vector<vector<int>> incx_incy_range = {
 /* ===============Google Unit Test==================================================== */
 
 /* =====================================================================
-     BLAS-1:  iamax, asum, axpy, copy, dot, nrm2, scal, swap
+     BLAS-1:  iamax, iamin, asum, axpy, copy, dot, nrm2, scal, swap
 =================================================================== */
 
 class parameterized : public ::TestWithParam<blas1_tuple>
@@ -110,6 +111,7 @@ Arguments setup_blas1_arguments(blas1_tuple tup)
 }
 
 TEST(checkin_blas1_bad_arg, iamax_float) { testing_iamax_bad_arg<float>(); }
+TEST(checkin_blas1_bad_arg, iamin_float) { testing_iamin_bad_arg<float>(); }
 TEST(checkin_blas1_bad_arg, asum_float) { testing_asum_bad_arg<float, float>(); }
 TEST(checkin_blas1_bad_arg, axpy_float) { testing_axpy_bad_arg<float>(); }
 TEST(checkin_blas1_bad_arg, copy_float) { testing_copy_bad_arg<float>(); }
@@ -154,6 +156,19 @@ TEST_P(parameterized, iamax_double)
     EXPECT_EQ(rocblas_status_success, status);
 }
 
+TEST_P(parameterized, iamin_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+    Arguments arg = setup_blas1_arguments(GetParam());
+
+    rocblas_status status = testing_iamin<float>(arg);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
 TEST_P(parameterized, asum_double)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
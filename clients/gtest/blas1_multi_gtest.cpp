@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_mdot.hpp"
+#include "testing_maxpy.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, double> blas1_multi_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda};
+// K > 32 is computed in chunks of 32 columns, lda < N is an invalid size
+const vector<vector<int>> NK_range = {
+    {-1, 4, 1},
+    {10, -1, 10},
+    {10, 4, 5},
+    {0, 4, 1},
+    {10, 0, 10},
+    {1, 1, 1},
+    {100, 3, 100},
+    {1000, 8, 1000},
+    {1025, 16, 1030},
+    {10000, 32, 10000},
+    {1000, 40, 1001},
+    {3000, 70, 3000},
+};
+
+const vector<vector<int>> large_NK_range = {
+    {1048576, 8, 1048576}, {1048576, 32, 1048576}, {4000000, 5, 4000000},
+};
+
+// the increment of x for mdot, of y for maxpy; 0 is an invalid size
+const vector<int> inc_range = {-2, 0, 1, 3};
+
+const vector<double> alpha_range = {1.0, 2.0};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 fused multi-vector: mdot and maxpy
+=================================================================== */
+
+Arguments setup_blas1_multi_arguments(blas1_multi_tuple tup)
+{
+    vector<int> NK = std::get<0>(tup);
+    int inc        = std::get<1>(tup);
+    double alpha   = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N     = NK[0];
+    arg.K     = NK[1];
+    arg.lda   = NK[2];
+    arg.incx  = inc;
+    arg.incy  = inc;
+    arg.alpha = alpha;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class blas1_multi_gtest : public ::TestWithParam<blas1_multi_tuple>
+{
+    protected:
+    blas1_multi_gtest() {}
+    virtual ~blas1_multi_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// if not success, then the input argument is problematic, so detect the error message
+static void expect_multi_invalid_size(rocblas_status status, const Arguments& arg)
+{
+    if(status != rocblas_status_success)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+        EXPECT_TRUE(arg.N < 0 || arg.K < 0 || arg.lda < arg.N || arg.lda < 1 || 0 == arg.incx);
+    }
+}
+
+TEST_P(blas1_multi_gtest, mdot_float)
+{
+    Arguments arg = setup_blas1_multi_arguments(GetParam());
+
+    rocblas_status status = testing_mdot<float>(arg);
+
+    expect_multi_invalid_size(status, arg);
+}
+
+TEST_P(blas1_multi_gtest, mdot_double)
+{
+    Arguments arg = setup_blas1_multi_arguments(GetParam());
+
+    rocblas_status status = testing_mdot<double>(arg);
+
+    expect_multi_invalid_size(status, arg);
+}
+
+TEST_P(blas1_multi_gtest, maxpy_float)
+{
+    Arguments arg = setup_blas1_multi_arguments(GetParam());
+
+    rocblas_status status = testing_maxpy<float>(arg);
+
+    expect_multi_invalid_size(status, arg);
+}
+
+TEST_P(blas1_multi_gtest, maxpy_double)
+{
+    Arguments arg = setup_blas1_multi_arguments(GetParam());
+
+    rocblas_status status = testing_maxpy<double>(arg);
+
+    expect_multi_invalid_size(status, arg);
+}
+
+// The combinations are  { {N, K, lda}, inc, alpha }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        blas1_multi_gtest,
+                        Combine(ValuesIn(NK_range), ValuesIn(inc_range), ValuesIn(alpha_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        blas1_multi_gtest,
+                        Combine(ValuesIn(large_NK_range), Values(1), Values(1.0)));
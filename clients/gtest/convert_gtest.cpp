@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_convert.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, double, char, string, string> convert_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb}; the vector routines convert N elements
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 1, 1},
+    {0, 0, 1, 1},
+    {5, 3, 4, 5},
+    {1, 1, 1, 1},
+    {7, 13, 9, 7},
+    {100, 37, 128, 100},
+    {1000, 3, 1000, 1024},
+};
+
+// the million columns of convert_matrix take more than one launch of the grid
+const vector<vector<int>> large_matrix_size_range = {
+    {1, 1000000, 1, 1}, {4000, 300, 4001, 4000},
+};
+
+// vector of vector, each vector is a {incx, incy}
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 3}, {-1, 2}, {3, -2},
+};
+
+// 1 is passed as no scaling
+const vector<double> alpha_range = {1.0, 0.5, -3.0};
+
+// N = to the nearest, S = stochastic
+const vector<char> rounding_range = {'N', 'S'};
+
+// the precisions of x and y
+const vector<string> precision_range = {
+    "hh", "hs", "hd", "sh", "ss", "sd", "dh", "ds", "dd",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 precision conversion: copy_ex, convert and convert_matrix
+=================================================================== */
+
+Arguments setup_convert_arguments(convert_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> incx_incy   = std::get<1>(tup);
+    double alpha            = std::get<2>(tup);
+    char rounding           = std::get<3>(tup);
+    string precision        = std::get<4>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha = alpha;
+
+    arg.rounding_option    = rounding;
+    arg.y_precision_option = precision[1];
+    arg.seed               = 7;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class convert_gtest : public ::TestWithParam<convert_tuple>
+{
+    protected:
+    convert_gtest() {}
+    virtual ~convert_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(convert_gtest, convert)
+{
+    Arguments arg    = setup_convert_arguments(GetParam());
+    string precision = std::get<4>(GetParam());
+    string routine   = std::get<5>(GetParam());
+
+    rocblas_status status;
+    if(precision[0] == 'h')
+        status = testing_convert<rocblas_half>(arg, routine);
+    else if(precision[0] == 's')
+        status = testing_convert<float>(arg, routine);
+    else
+        status = testing_convert<double>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(routine == "convert_matrix" && (arg.M < 0 || arg.lda < arg.M || arg.ldb < arg.M))
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else
+        {
+            EXPECT_EQ(rocblas_status_success, status);
+        }
+    }
+}
+
+// The combinations are  { {M, N, lda, ldb}, {incx, incy}, alpha, rounding, precisions, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1_copy_ex,
+                        convert_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                Values(1.0),
+                                Values('N'),
+                                ValuesIn(precision_range),
+                                Values(string("copy_ex"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1_convert,
+                        convert_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(rounding_range),
+                                ValuesIn(precision_range),
+                                Values(string("convert"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1_convert_matrix,
+                        convert_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(alpha_range),
+                                ValuesIn(rounding_range),
+                                ValuesIn(precision_range),
+                                Values(string("convert_matrix"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1_convert,
+                        convert_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                Values(0.5),
+                                ValuesIn(rounding_range),
+                                Values(string("sh"), string("dh"), string("ds")),
+                                Values(string("convert"), string("convert_matrix"))));
+
+// complex precisions and unknown rounding modes are not implemented
+TEST(checkin_blas1, convert_not_implemented)
+{
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(double) * 8),
+                                         rocblas_test::device_free};
+    void* dx = dx_managed.get();
+    ASSERT_NE(nullptr, dx);
+
+    rocblas_precision s = rocblas_precision_single;
+    rocblas_precision c = rocblas_precision_complex_single;
+
+    EXPECT_EQ(rocblas_status_not_implemented, rocblas_copy_ex(handle, 4, dx, c, 1, dx, s, 1));
+    EXPECT_EQ(rocblas_status_not_implemented, rocblas_copy_ex(handle, 4, dx, s, 1, dx, c, 1));
+    EXPECT_EQ(rocblas_status_not_implemented,
+              rocblas_convert(handle, (rocblas_rounding_mode)2, 0, 4, nullptr, dx, s, 1, dx, s, 1));
+    EXPECT_EQ(rocblas_status_not_implemented,
+              rocblas_convert_matrix(
+                  handle, rocblas_rounding_mode_nearest, 0, 2, 2, nullptr, dx, s, 2, dx, c, 2));
+}
@@ -65,9 +65,7 @@ const vector<vector<double>> huge_alpha_beta_range = {
 // for single/double precision, 'C'(conjTranspose) will downgraded to 'T' (transpose) internally in
 // sgeam/dgeam,
 const vector<vector<char>> transA_transB_range = {
-    {'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'},
-    //     {'C', 'N'},
-    //     {'T', 'C'}
+    {'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}, {'C', 'N'}, {'T', 'C'},
 };
 
 /* ===============Google Unit Test==================================================== */
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <vector>
 #include "testing_gemm.hpp"
+#include "gemm_degenerate.h"
 #include "utility.h"
 
 using ::testing::TestWithParam;
@@ -83,6 +84,19 @@ const vector<vector<int>> large_matrix_size_range = {
     {4011, 4012, 103, 4014, 4015, 4016},
 };
 
+// shapes that do not run on Tensile, see rocblas_gemm_classify: m == n == 1, n == 1, m == 1
+// and k == 1, with the sum along the columns or across them depending on the transposes
+const vector<vector<int>> degenerate_matrix_size_range = {
+    {1, 1, 300, 300, 300, 1},
+    {1, 1, 1000, 1001, 1002, 3},
+    {600, 1, 33, 600, 40, 601},
+    {2, 1, 300, 300, 300, 2},
+    {1, 300, 257, 257, 300, 1},
+    {1, 2, 3, 3, 3, 2},
+    {70, 130, 1, 71, 131, 72},
+    {2, 2, 1, 2, 2, 2},
+};
+
 const vector<vector<int>> NaN_matrix_size_range = {
     {5, 6, 7, 8, 9, 10}, {4011, 4012, 111, 4013, 4014, 4015},
 };
@@ -287,6 +301,55 @@ TEST_P(parameterized_gemm, double)
     }
 }
 
+// every shape is checked against its definition in gemm_degenerate.h, sizes past 1 behave as 2
+TEST(checkin_blas3_gemm_degenerate, classify)
+{
+    for(rocblas_int m = -1; m <= 3; m++)
+        for(rocblas_int n = -1; n <= 3; n++)
+            for(rocblas_int k = -1; k <= 3; k++)
+                for(rocblas_int batch_count = -1; batch_count <= 2; batch_count++)
+                    for(int alpha_zero = 0; alpha_zero < 2; alpha_zero++)
+                    {
+                        rocblas_gemm_shape shape =
+                            rocblas_gemm_classify(m, n, k, batch_count, alpha_zero);
+
+                        if(m < 1 || n < 1 || k < 0 || batch_count < 1)
+                        {
+                            EXPECT_EQ(rocblas_gemm_shape_general, shape);
+                            continue;
+                        }
+
+                        bool scale = k == 0 || alpha_zero;
+                        switch(shape)
+                        {
+                        case rocblas_gemm_shape_scale: EXPECT_TRUE(scale); break;
+                        case rocblas_gemm_shape_dot:
+                            EXPECT_TRUE(!scale && m == 1 && n == 1);
+                            break;
+                        case rocblas_gemm_shape_gemv_n:
+                            EXPECT_TRUE(!scale && m > 1 && n == 1);
+                            break;
+                        case rocblas_gemm_shape_gemv_m:
+                            EXPECT_TRUE(!scale && m == 1 && n > 1);
+                            break;
+                        case rocblas_gemm_shape_ger:
+                            EXPECT_TRUE(!scale && m > 1 && n > 1 && k == 1);
+                            break;
+                        case rocblas_gemm_shape_general:
+                            EXPECT_TRUE(!scale && m > 1 && n > 1 && k > 1);
+                            break;
+                        }
+                    }
+
+    EXPECT_EQ(rocblas_gemm_shape_general, rocblas_gemm_classify(4011, 4012, 103, 1, false));
+    EXPECT_EQ(rocblas_gemm_shape_scale, rocblas_gemm_classify(4011, 4012, 103, 1, true));
+    EXPECT_EQ(rocblas_gemm_shape_scale, rocblas_gemm_classify(1, 1, 0, 7, false));
+    EXPECT_EQ(rocblas_gemm_shape_dot, rocblas_gemm_classify(1, 1, 100000, 7, false));
+    EXPECT_EQ(rocblas_gemm_shape_gemv_n, rocblas_gemm_classify(4011, 1, 1, 1, false));
+    EXPECT_EQ(rocblas_gemm_shape_gemv_m, rocblas_gemm_classify(1, 4011, 1, 1, false));
+    EXPECT_EQ(rocblas_gemm_shape_ger, rocblas_gemm_classify(4011, 4012, 1, 1, false));
+}
+
 TEST(checkin_blas3_bad_arg, gemm_half) { testing_gemm_bad_arg<rocblas_half>(); }
 
 TEST(checkin_blas3_bad_arg, gemm_float) { testing_gemm_bad_arg<float>(); }
@@ -305,6 +368,12 @@ INSTANTIATE_TEST_CASE_P(checkin_blas3_NaN,
                                 ValuesIn(NaN_alpha_beta_range),
                                 ValuesIn(transA_transB_range)));
 
+INSTANTIATE_TEST_CASE_P(checkin_blas3_degenerate_NaN,
+                        parameterized_gemm_NaN,
+                        Combine(ValuesIn(degenerate_matrix_size_range),
+                                ValuesIn(NaN_alpha_beta_range),
+                                ValuesIn(transA_transB_range)));
+
 // THis function mainly test the scope of matrix_size. the scope of alpha_beta, transA_transB is
 // small
 INSTANTIATE_TEST_CASE_P(daily_blas3_large,
@@ -327,3 +396,9 @@ INSTANTIATE_TEST_CASE_P(checkin_blas3_tiny,
                         Combine(ValuesIn(tiny_matrix_size_range),
                                 ValuesIn(full_alpha_beta_range),
                                 ValuesIn(transA_transB_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3_degenerate,
+                        parameterized_gemm,
+                        Combine(ValuesIn(degenerate_matrix_size_range),
+                                ValuesIn(full_alpha_beta_range),
+                                ValuesIn(transA_transB_range)));
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <vector>
 #include "testing_gemm_strided_batched.hpp"
+#include "gemm_small_batched.h"
 #include "utility.h"
 
 using ::testing::TestWithParam;
@@ -45,6 +46,30 @@ const vector<vector<int>> matrix_size_range = {
     {501, 502, 103, 504, 605, 506},
 };
 
+// sizes of the small matrix kernels, around the bounds of their size classes and with
+// lda, ldb, ldc past the matrices
+const vector<vector<int>> small_matrix_size_range = {
+    {1, 1, 1, 1, 1, 1},
+    {4, 3, 2, 4, 4, 4},
+    {5, 8, 7, 9, 10, 11},
+    {13, 16, 11, 16, 17, 18},
+    {17, 9, 32, 32, 33, 34},
+    {32, 32, 32, 32, 32, 32},
+};
+
+// shapes of rocblas_gemm_classify that do not run on Tensile
+const vector<vector<int>> degenerate_matrix_size_range = {
+    {1, 1, 300, 300, 300, 1},
+    {600, 1, 33, 600, 40, 601},
+    {1, 300, 257, 257, 300, 1},
+    {70, 130, 1, 71, 131, 72},
+};
+
+// degenerate shapes in more problems than one launch can hold in its grid
+const vector<vector<int>> degenerate_huge_batch_matrix_size_range = {
+    {1, 1, 8, 8, 8, 1}, {8, 1, 8, 8, 8, 8}, {1, 8, 8, 8, 8, 1}, {8, 8, 1, 8, 8, 8},
+};
+
 // vector of vector, each pair is a {alpha, beta};
 // add/delete this list in pairs, like {2.0, 4.0}
 const vector<vector<double>> alpha_beta_range = {
@@ -62,12 +87,81 @@ const vector<int> batch_count_range = {
     -1, 0, 1, 3,
 };
 
+// batch counts on both sides of the crossovers of the small matrix size classes
+const vector<int> small_batch_count_range = {
+    100, 600, 3000,
+};
+
+const vector<int> huge_batch_count_range = {70000};
+
 /* ===============Google Unit Test==================================================== */
 
 /* =====================================================================
      BLAS-3 gemm_strided_batched:
 =================================================================== */
 
+/* ==================Small matrix dispatch=========================================== */
+
+// the size classes are only selected for problems their kernels can compute, and fit the
+// workgroup and shared memory limits
+TEST(checkin_blas3_gemm_small_batched, select)
+{
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(0, 4, 4, 1000));
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(4, 4, -1, 1000));
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(33, 4, 4, 1000000));
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(4, 4, 33, 1000000));
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(4, 4, 4, 0));
+
+    // a single or a few small gemms stay on Tensile
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(4, 4, 4, 1));
+    EXPECT_EQ(-1, rocblas_gemm_small_batched_select(8, 8, 8, 16));
+
+    for(rocblas_int m = 1; m <= 33; m++)
+        for(rocblas_int n = 1; n <= 33; n++)
+            for(rocblas_int k = 1; k <= 33; k++)
+            {
+                rocblas_int c = rocblas_gemm_small_batched_select(m, n, k, 1000000);
+                if(m > 32 || n > 32 || k > 32)
+                {
+                    EXPECT_EQ(-1, c);
+                    continue;
+                }
+
+                ASSERT_GE(c, 0);
+                ASSERT_LT(c, GEMM_SMALL_BATCHED_CLASSES);
+                EXPECT_GE(rocblas_gemm_small_batched_classes[c].dim, max(m, max(n, k)));
+
+                // a smaller class would have taken it
+                if(c > 0)
+                    EXPECT_LT(rocblas_gemm_small_batched_classes[c - 1].dim, max(m, max(n, k)));
+
+                // below the crossover of its class the problem stays on Tensile
+                rocblas_int min_batch_count = rocblas_gemm_small_batched_classes[c].min_batch_count;
+                EXPECT_EQ(c, rocblas_gemm_small_batched_select(m, n, k, min_batch_count));
+                EXPECT_EQ(-1, rocblas_gemm_small_batched_select(m, n, k, min_batch_count - 1));
+            }
+}
+
+TEST(checkin_blas3_gemm_small_batched, classes)
+{
+    for(rocblas_int c = 0; c < GEMM_SMALL_BATCHED_CLASSES; c++)
+    {
+        const rocblas_gemm_small_batched_class& sbc = rocblas_gemm_small_batched_classes[c];
+
+        EXPECT_EQ(0, sbc.dim % sbc.dim_y);
+        EXPECT_LE(sbc.dim * sbc.dim_y * sbc.batches, 1024);
+        EXPECT_LE(2 * sbc.batches * sbc.dim * (sbc.dim + 1) * sizeof(double), 65536u);
+
+        // the classes are in increasing order of size and crossover
+        if(c > 0)
+        {
+            EXPECT_GT(sbc.dim, rocblas_gemm_small_batched_classes[c - 1].dim);
+            EXPECT_GE(
+                sbc.min_batch_count, rocblas_gemm_small_batched_classes[c - 1].min_batch_count);
+        }
+    }
+}
+
 /* ============================Setup Arguments======================================= */
 
 // Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
@@ -208,3 +302,24 @@ INSTANTIATE_TEST_CASE_P(checkin_blas3,
                                 ValuesIn(alpha_beta_range),
                                 ValuesIn(transA_transB_range),
                                 ValuesIn(batch_count_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3_small,
+                        gemm_strided_batched,
+                        Combine(ValuesIn(small_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(small_batch_count_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3_degenerate,
+                        gemm_strided_batched,
+                        Combine(ValuesIn(degenerate_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(batch_count_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas3_degenerate_huge_batch,
+                        gemm_strided_batched,
+                        Combine(ValuesIn(degenerate_huge_batch_matrix_size_range),
+                                Values(vector<double>{1.0, 0.0}, vector<double>{0.0, 3.0}),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(huge_batch_count_range)));
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <vector>
 #include "testing_gemv.hpp"
+#include "gemv_select.h"
 #include "utility.h"
 
 using ::testing::TestWithParam;
@@ -56,6 +57,11 @@ const vector<vector<int>> large_matrix_size_range = {
     {1000, 1000, 1000}, {2000, 2000, 2000}, {4011, 4011, 4011}, {8000, 8000, 8000},
 };
 
+// short-wide and tall-skinny A, for the split and the thread per column kernels
+const vector<vector<int>> skinny_matrix_size_range = {
+    {8, 100000, 8}, {40, 5000, 40}, {100000, 8, 100000}, {20000, 20, 20000},
+};
+
 // vector of vector, each pair is a {incx, incy};
 // add/delete this list in pairs, like {1, 1}
 const vector<vector<int>> small_incx_incy_range = {
@@ -205,6 +211,29 @@ TEST_P(parameterized_gemv, double)
 
 TEST(checkin_blas2_bad_arg, gemv_bad_arg_float) { testing_gemv_bad_arg<float>(); }
 
+// the kernel selected from the shape, see gemv_select.h
+TEST(checkin_blas2, gemv_select)
+{
+    EXPECT_EQ(rocblas_gemv_kernel_tiled, rocblas_gemv_select(rocblas_operation_none, 1000000, 8));
+    EXPECT_EQ(rocblas_gemv_kernel_split_n, rocblas_gemv_select(rocblas_operation_none, 8, 1000000));
+    EXPECT_EQ(rocblas_gemv_kernel_tiled, rocblas_gemv_select(rocblas_operation_none, 600, 500));
+
+    EXPECT_EQ(rocblas_gemv_kernel_split_m,
+              rocblas_gemv_select(rocblas_operation_transpose, 1000000, 8));
+    EXPECT_EQ(rocblas_gemv_kernel_column,
+              rocblas_gemv_select(rocblas_operation_conjugate_transpose, 4000, 4000));
+
+    // a thread per column only while the columns are few, its loads of A are not coalesced
+    EXPECT_EQ(rocblas_gemv_kernel_thread_column,
+              rocblas_gemv_select(rocblas_operation_transpose, 8, 1000));
+    EXPECT_EQ(rocblas_gemv_kernel_thread_column,
+              rocblas_gemv_select(rocblas_operation_transpose, GEMVT_THREAD_COLUMN_M, 1));
+    EXPECT_EQ(rocblas_gemv_kernel_column,
+              rocblas_gemv_select(rocblas_operation_transpose, 8, 1000000));
+    EXPECT_EQ(rocblas_gemv_kernel_column,
+              rocblas_gemv_select(rocblas_operation_transpose, GEMVT_THREAD_COLUMN_M + 1, 1000));
+}
+
 INSTANTIATE_TEST_CASE_P(checkin_blas2,
                         parameterized_gemv,
                         Combine(ValuesIn(small_matrix_size_range),
@@ -212,6 +241,13 @@ INSTANTIATE_TEST_CASE_P(checkin_blas2,
                                 ValuesIn(alpha_beta_range),
                                 ValuesIn(transA_range)));
 
+INSTANTIATE_TEST_CASE_P(checkin_blas2_skinny,
+                        parameterized_gemv,
+                        Combine(ValuesIn(skinny_matrix_size_range),
+                                ValuesIn(large_incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_range)));
+
 INSTANTIATE_TEST_CASE_P(daily_blas2,
                         parameterized_gemv,
                         Combine(ValuesIn(large_matrix_size_range),
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_half_blas1.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, vector<int>, string> half_blas1_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// N below, at and above multiples of the half8 loads and of the blocks
+const vector<int> N_range = {1, 7, 8, 9, 1000, 8191, 8192, 8193, 100000};
+
+const vector<int> large_N_range = {1048577, 10000000};
+
+// vector of vector, each vector is a {incx, incy};
+const vector<vector<int>> inc_range = {
+    {1, 1}, {1, 2}, {2, 3},
+};
+
+const vector<string> routine_range = {
+    "dot", "asum", "nrm2", "iamax", "scal",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 rocblas_half routines
+=================================================================== */
+
+Arguments setup_half_blas1_arguments(half_blas1_tuple tup)
+{
+    int N           = std::get<0>(tup);
+    vector<int> inc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N     = N;
+    arg.incx  = inc[0];
+    arg.incy  = inc[1];
+    arg.alpha = -1.5;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class half_blas1_gtest : public ::TestWithParam<half_blas1_tuple>
+{
+    protected:
+    half_blas1_gtest() {}
+    virtual ~half_blas1_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(half_blas1_gtest, half)
+{
+    Arguments arg  = setup_half_blas1_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_half_blas1<rocblas_half>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, {incx, incy}, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        half_blas1_gtest,
+                        Combine(ValuesIn(N_range), ValuesIn(inc_range), ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        half_blas1_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(routine_range)));
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_host_result_mode.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, int> host_result_mode_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     BLAS set-get_host_result_mode:
+=================================================================== */
+
+TEST(checkin_auxilliary, set_host_result_mode_get_host_result_mode)
+{
+    rocblas_status status         = rocblas_status_success;
+    rocblas_host_result_mode mode = rocblas_host_result_mode_blocking;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    status = rocblas_set_host_result_mode(handle, rocblas_host_result_mode_async);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    status = rocblas_get_host_result_mode(handle, &mode);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    EXPECT_EQ(rocblas_host_result_mode_async, mode);
+
+    // nothing in flight
+    rocblas_int pending = -1;
+    status              = rocblas_query_host_results(handle, &pending);
+    EXPECT_EQ(status, rocblas_status_success);
+    EXPECT_EQ(0, pending);
+
+    status = rocblas_set_host_result_mode(handle, rocblas_host_result_mode_blocking);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    status = rocblas_get_host_result_mode(handle, &mode);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    EXPECT_EQ(rocblas_host_result_mode_blocking, mode);
+}
+
+const vector<int> N_range = {1, 100, 5000};
+
+// more calls than the first ring of result slots holds makes the calls wait for the oldest
+const vector<int> calls_range = {1, 2, 100, 5000};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 reductions with asynchronous host results
+=================================================================== */
+
+Arguments setup_host_result_mode_arguments(host_result_mode_tuple tup)
+{
+    Arguments arg;
+
+    arg.N           = std::get<0>(tup);
+    arg.batch_count = std::get<1>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class host_result_mode_gtest : public ::TestWithParam<host_result_mode_tuple>
+{
+    protected:
+    host_result_mode_gtest() {}
+    virtual ~host_result_mode_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(host_result_mode_gtest, async_float)
+{
+    Arguments arg = setup_host_result_mode_arguments(GetParam());
+
+    rocblas_status status = testing_host_result_mode<float>(arg);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(host_result_mode_gtest, async_double)
+{
+    Arguments arg = setup_host_result_mode_arguments(GetParam());
+
+    rocblas_status status = testing_host_result_mode<double>(arg);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, calls }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        host_result_mode_gtest,
+                        Combine(ValuesIn(N_range), ValuesIn(calls_range)));
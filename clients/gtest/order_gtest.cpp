@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_order.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, vector<double>, string, char, string> order_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, ld}, ld is lda, ldb and ldc and holds the
+// largest dimension
+const vector<vector<int>> matrix_size_range = {
+    {-1, 5, 3, 8}, {1, 9, 4, 9}, {5, 7, 3, 8}, {6, 6, 6, 6}, {33, 17, 20, 40},
+};
+
+// vector of vector, each vector is a {incx, incy}
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 3},
+};
+
+// vector of vector, each vector is a {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0}, {2.0, -3.0},
+};
+
+// each string is the option characters transA, transB, side, uplo and diag
+const vector<string> gemm_op_range = {
+    "NNLUN", "NTLUN", "NCLUN", "TNLUN", "TTLUN", "TCLUN", "CNLUN", "CTLUN", "CCLUN",
+};
+
+const vector<string> gemv_op_range = {
+    "NNLUN", "TNLUN", "CNLUN",
+};
+
+const vector<string> trsm_op_range = {
+    "NNLUN", "NNLUU", "NNLLN", "NNLLU", "NNRUN", "NNRUU", "NNRLN", "NNRLU",
+    "TNLUN", "TNLUU", "TNLLN", "TNLLU", "TNRUN", "TNRUU", "TNRLN", "TNRLU",
+    "CNLUN", "CNLUU", "CNLLN", "CNLLU", "CNRUN", "CNRUU", "CNRLN", "CNRLU",
+};
+
+// R = row major, C = column major
+const vector<char> order_range = {'R', 'C'};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     the rocblas_order routines gemm, gemv, ger, geam and trsm
+=================================================================== */
+
+Arguments setup_order_arguments(order_tuple tup)
+{
+    vector<int> matrix_size   = std::get<0>(tup);
+    vector<int> incx_incy     = std::get<1>(tup);
+    vector<double> alpha_beta = std::get<2>(tup);
+    string op                 = std::get<3>(tup);
+    char order                = std::get<4>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[3];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.transA_option = op[0];
+    arg.transB_option = op[1];
+    arg.side_option   = op[2];
+    arg.uplo_option   = op[3];
+    arg.diag_option   = op[4];
+    arg.order_option  = order;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class order_gtest : public ::TestWithParam<order_tuple>
+{
+    protected:
+    order_gtest() {}
+    virtual ~order_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(order_gtest, order_float)
+{
+    Arguments arg  = setup_order_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status = testing_order<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else
+        {
+            EXPECT_EQ(rocblas_status_success, status);
+        }
+    }
+}
+
+TEST_P(order_gtest, order_double)
+{
+    Arguments arg  = setup_order_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status = testing_order<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else
+        {
+            EXPECT_EQ(rocblas_status_success, status);
+        }
+    }
+}
+
+// The combinations are  { {M, N, K, ld}, {incx, incy}, {alpha, beta}, op, order, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_gemv,
+                        order_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(gemv_op_range),
+                                ValuesIn(order_range),
+                                Values(string("gemv_order"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_ger,
+                        order_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                Values(string("NNLUN")),
+                                ValuesIn(order_range),
+                                Values(string("ger_order"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3_geam,
+                        order_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(gemm_op_range),
+                                ValuesIn(order_range),
+                                Values(string("geam_order"))));
+
+#if BUILD_WITH_TENSILE
+INSTANTIATE_TEST_CASE_P(checkin_blas3_gemm,
+                        order_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(gemm_op_range),
+                                ValuesIn(order_range),
+                                Values(string("gemm_order"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3_trsm,
+                        order_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(trsm_op_range),
+                                ValuesIn(order_range),
+                                Values(string("trsm_order"))));
+#endif
+
+// an order that is neither row nor column major is not implemented, whatever the other arguments
+TEST(checkin_blas2, order_invalid)
+{
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_order order = (rocblas_order)0;
+    rocblas_operation N = rocblas_operation_none;
+
+    float alpha = 1.0, beta = 0.0;
+
+    EXPECT_EQ(rocblas_status_not_implemented,
+              rocblas_gemv_order<float>(
+                  handle, order, N, 4, 4, &alpha, nullptr, 4, nullptr, 1, &beta, nullptr, 1));
+    EXPECT_EQ(rocblas_status_not_implemented,
+              rocblas_ger_order<float>(
+                  handle, order, 4, 4, &alpha, nullptr, 1, nullptr, 1, nullptr, 4));
+    EXPECT_EQ(rocblas_status_not_implemented,
+              rocblas_geam_order<float>(
+                  handle, order, N, N, 4, 4, &alpha, nullptr, 4, &beta, nullptr, 4, nullptr, 4));
+}
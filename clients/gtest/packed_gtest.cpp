@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_packed.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, vector<double>, string, string> packed_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, lda}; lda is only used by tpttr.
+// N around the 64 row tile of the kernels covers partial and multiple tiles
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1}, {0, 1}, {10, 5}, {1, 1}, {10, 10}, {63, 64}, {64, 70}, {65, 65}, {200, 210},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000}, {4011, 4011},
+};
+
+// vector of vector, each vector is a {incx, incy}
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 3}, {-1, -2}, {0, 1},
+};
+
+// vector of vector, each vector is a {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0}, {2.0, -3.0}, {0.0, 2.0},
+};
+
+// each string is the option characters uplo, transA and diag
+const vector<string> symmetric_op_range = {"UNN", "LNN"};
+
+const vector<string> triangular_op_range = {"UNN", "LNN", "UTN", "LTN", "UNU", "LTU"};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 spmv, spr, spr2, tpmv and tpsv on packed storage and the tpttr unpack
+=================================================================== */
+
+Arguments setup_packed_arguments(packed_tuple tup)
+{
+    vector<int> matrix_size   = std::get<0>(tup);
+    vector<int> incx_incy     = std::get<1>(tup);
+    vector<double> alpha_beta = std::get<2>(tup);
+    string op                 = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.uplo_option   = op[0];
+    arg.transA_option = op[1];
+    arg.diag_option   = op[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class packed_gtest : public ::TestWithParam<packed_tuple>
+{
+    protected:
+    packed_gtest() {}
+    virtual ~packed_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the status a rejected argument has to give
+void packed_expect_status(const Arguments& arg, const string& routine, rocblas_status status)
+{
+    bool unpack = routine == "tpttr";
+    bool uses_y = routine == "spmv" || routine == "spr2";
+
+    if(arg.N < 0)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(unpack && (arg.lda < arg.N || arg.lda < 1))
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(!unpack && (arg.incx == 0 || (uses_y && arg.incy == 0)))
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else
+    {
+        EXPECT_EQ(rocblas_status_success, status);
+    }
+}
+
+TEST_P(packed_gtest, packed_float)
+{
+    Arguments arg  = setup_packed_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_packed<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        packed_expect_status(arg, routine, status);
+    }
+}
+
+TEST_P(packed_gtest, packed_double)
+{
+    Arguments arg  = setup_packed_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_packed<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        packed_expect_status(arg, routine, status);
+    }
+}
+
+// The combinations are  { {N, lda}, {incx, incy}, {alpha, beta}, op, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_packed_symmetric,
+                        packed_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(symmetric_op_range),
+                                Values(string("spmv"),
+                                       string("spr"),
+                                       string("spr2"),
+                                       string("tpttr"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_packed_triangular,
+                        packed_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                Values(vector<double>{1.0, 0.0}),
+                                ValuesIn(triangular_op_range),
+                                Values(string("tpmv"), string("tpsv"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2_packed,
+                        packed_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                Values(vector<double>{2.0, -3.0}),
+                                Values(string("UNN"), string("LTN")),
+                                Values(string("spmv"),
+                                       string("spr2"),
+                                       string("tpmv"),
+                                       string("tpsv"),
+                                       string("tpttr"))));
@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_rank_update.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, double, char, int, string> rank_update_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda}; M is only used by ger.
+// N around the 64 x 64 tiles of the symmetric updates covers partial tiles, the diagonal tiles
+// and more than one row of tiles
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 1},
+    {0, 0, 1},
+    {10, 10, 5},
+    {1, 1, 1},
+    {10, 10, 10},
+    {63, 63, 64},
+    {70, 64, 70},
+    {65, 65, 65},
+    {129, 130, 140},
+    {200, 200, 210},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000, 1000}, {2011, 2011, 2011},
+};
+
+// vector of vector, each vector is a {incx, incy}
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 3}, {-1, -2}, {0, 1}, {1, 0},
+};
+
+const vector<double> alpha_range = {1.0, -2.0, 0.0};
+
+const vector<char> uplo_range = {'U', 'L'};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+// more problems than one launch can hold in its grid
+const vector<int> huge_batch_count_range = {70000};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 rank updates: syr2, her, her2 and ger, syr, syr2 strided batched
+=================================================================== */
+
+Arguments setup_rank_update_arguments(rank_update_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> incx_incy   = std::get<1>(tup);
+    double alpha            = std::get<2>(tup);
+    char uplo               = std::get<3>(tup);
+    int batch_count         = std::get<4>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha = alpha;
+
+    arg.uplo_option = uplo;
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class rank_update_gtest : public ::TestWithParam<rank_update_tuple>
+{
+    protected:
+    rank_update_gtest() {}
+    virtual ~rank_update_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the status a rejected argument has to give
+void rank_update_expect_status(const Arguments& arg, const string& routine, rocblas_status status)
+{
+    bool ger     = routine == "ger_strided_batched";
+    bool batched = routine.find("batched") != string::npos;
+    bool uses_y  = ger || routine == "syr2" || routine == "syr2_strided_batched" ||
+                   routine == "her2";
+
+    rocblas_int M = ger ? arg.M : arg.N;
+
+    if(M < 0 || arg.N < 0 || arg.lda < M || arg.lda < 1)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(arg.incx == 0 || (uses_y && arg.incy == 0) || (batched && arg.batch_count < 0))
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else
+    {
+        EXPECT_EQ(rocblas_status_success, status);
+    }
+}
+
+TEST_P(rank_update_gtest, rank_update_float)
+{
+    Arguments arg  = setup_rank_update_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status = testing_rank_update<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        rank_update_expect_status(arg, routine, status);
+    }
+}
+
+TEST_P(rank_update_gtest, rank_update_double)
+{
+    Arguments arg  = setup_rank_update_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status = testing_rank_update<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        rank_update_expect_status(arg, routine, status);
+    }
+}
+
+class hermitian_rank_update_gtest : public ::TestWithParam<rank_update_tuple>
+{
+    protected:
+    hermitian_rank_update_gtest() {}
+    virtual ~hermitian_rank_update_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(hermitian_rank_update_gtest, hermitian_rank_update_float_complex)
+{
+    Arguments arg  = setup_rank_update_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status =
+        testing_hermitian_rank_update<rocblas_float_complex, float>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        rank_update_expect_status(arg, routine, status);
+    }
+}
+
+TEST_P(hermitian_rank_update_gtest, hermitian_rank_update_double_complex)
+{
+    Arguments arg  = setup_rank_update_arguments(GetParam());
+    string routine = std::get<5>(GetParam());
+
+    rocblas_status status =
+        testing_hermitian_rank_update<rocblas_double_complex, double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        rank_update_expect_status(arg, routine, status);
+    }
+}
+
+// The combinations are  { {M, N, lda}, {incx, incy}, alpha, uplo, batch_count, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_rank_update,
+                        rank_update_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(uplo_range),
+                                Values(1),
+                                Values(string("syr2"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_rank_update_strided_batched,
+                        rank_update_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                Values(2.0),
+                                ValuesIn(uplo_range),
+                                ValuesIn(batch_count_range),
+                                Values(string("ger_strided_batched"),
+                                       string("syr_strided_batched"),
+                                       string("syr2_strided_batched"))));
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2_hermitian_rank_update,
+                        hermitian_rank_update_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(uplo_range),
+                                Values(1),
+                                Values(string("her"), string("her2"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2_rank_update,
+                        rank_update_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                Values(2.0),
+                                ValuesIn(uplo_range),
+                                Values(1, 4),
+                                Values(string("ger_strided_batched"),
+                                       string("syr2_strided_batched"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2_rank_update_huge_batch,
+                        rank_update_gtest,
+                        Combine(Values(vector<int>{5, 5, 5}),
+                                Values(vector<int>{1, 1}),
+                                Values(2.0),
+                                ValuesIn(uplo_range),
+                                ValuesIn(huge_batch_count_range),
+                                Values(string("ger_strided_batched"),
+                                       string("syr_strided_batched"),
+                                       string("syr2_strided_batched"))));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2_hermitian_rank_update,
+                        hermitian_rank_update_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(vector<int>{1, 1}),
+                                Values(2.0),
+                                ValuesIn(uplo_range),
+                                Values(1),
+                                Values(string("her"), string("her2"))));
@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_reduction_mode.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, vector<int>, string> reduction_mode_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     BLAS set-get_reduction_mode:
+=================================================================== */
+
+TEST(checkin_auxilliary, set_reduction_mode_get_reduction_mode)
+{
+    rocblas_status status       = rocblas_status_success;
+    rocblas_reduction_mode mode = rocblas_reduction_mode_deterministic;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    status = rocblas_set_reduction_mode(handle, rocblas_reduction_mode_deterministic);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    status = rocblas_get_reduction_mode(handle, &mode);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    EXPECT_EQ(rocblas_reduction_mode_deterministic, mode);
+
+    status = rocblas_set_reduction_mode(handle, rocblas_reduction_mode_default);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    status = rocblas_get_reduction_mode(handle, &mode);
+    EXPECT_EQ(status, rocblas_status_success);
+
+    EXPECT_EQ(rocblas_reduction_mode_default, mode);
+}
+
+// around one block of ROCBLAS_DETERMINISTIC_NB elements, and more blocks than lanes
+const vector<int> N_range = {1, 7, 1000, 1024, 1025, 10000, 65537};
+
+const vector<int> large_N_range = {1048577, 4000000};
+
+// vector of vector, each vector is a {incx, incy, K}; K is the number of columns of mdot
+const vector<vector<int>> inc_K_range = {
+    {1, 1, 3}, {2, 3, 33},
+};
+
+const vector<string> routine_range = {
+    "dot", "asum", "nrm2", "dot_nrm2", "mdot",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 deterministic reductions: bitwise equal to the host order
+=================================================================== */
+
+Arguments setup_reduction_mode_arguments(reduction_mode_tuple tup)
+{
+    int N             = std::get<0>(tup);
+    vector<int> inc_K = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N    = N;
+    arg.incx = inc_K[0];
+    arg.incy = inc_K[1];
+    arg.K    = inc_K[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class reduction_mode_gtest : public ::TestWithParam<reduction_mode_tuple>
+{
+    protected:
+    reduction_mode_gtest() {}
+    virtual ~reduction_mode_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(reduction_mode_gtest, deterministic_float)
+{
+    Arguments arg  = setup_reduction_mode_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_reduction_mode<float>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(reduction_mode_gtest, deterministic_double)
+{
+    Arguments arg  = setup_reduction_mode_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_reduction_mode<double>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, {incx, incy, K}, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        reduction_mode_gtest,
+                        Combine(ValuesIn(N_range), ValuesIn(inc_K_range), ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        reduction_mode_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1, 3}),
+                                ValuesIn(routine_range)));
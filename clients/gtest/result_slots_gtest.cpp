@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "result_slots.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     rocblas_result_slots: the state machine of the asynchronous host
+     results on a model of the stream on the host
+=================================================================== */
+
+// the stream is a count of launches, completed of them have run. An event completes once the
+// launches before its record have; synchronize runs them. The host memory is also the device
+// memory, so the test writes the results of a launch into the slots itself.
+class host_result_events : public rocblas_result_events
+{
+    public:
+    size_t launched  = 0;
+    size_t completed = 0;
+
+    rocblas_int allocs       = 0;
+    rocblas_int frees        = 0;
+    rocblas_int creates      = 0;
+    rocblas_int destroys     = 0;
+    rocblas_int queries      = 0;
+    rocblas_int synchronizes = 0;
+    size_t last_alloc_size   = 0;
+
+    vector<size_t> recorded; // launches before the record of each event
+
+    virtual rocblas_status host_alloc(size_t size, void** host, void** device)
+    {
+        allocs++;
+        last_alloc_size = size;
+        *host           = malloc(size);
+        *device         = *host;
+        return *host ? rocblas_status_success : rocblas_status_memory_error;
+    }
+
+    virtual rocblas_status host_free(void* host)
+    {
+        frees++;
+        free(host);
+        return rocblas_status_success;
+    }
+
+    virtual rocblas_status create(rocblas_result_event* event)
+    {
+        creates++;
+        recorded.push_back(0);
+        *event = (rocblas_result_event)recorded.size();
+        return rocblas_status_success;
+    }
+
+    virtual rocblas_status destroy(rocblas_result_event event)
+    {
+        destroys++;
+        return rocblas_status_success;
+    }
+
+    virtual rocblas_status record(rocblas_result_event event, hipStream_t stream)
+    {
+        recorded[(size_t)event - 1] = launched;
+        return rocblas_status_success;
+    }
+
+    virtual rocblas_status query(rocblas_result_event event, bool* complete)
+    {
+        queries++;
+        *complete = recorded[(size_t)event - 1] <= completed;
+        return rocblas_status_success;
+    }
+
+    virtual rocblas_status synchronize(rocblas_result_event event)
+    {
+        synchronizes++;
+        if(completed < recorded[(size_t)event - 1])
+            completed = recorded[(size_t)event - 1];
+        return rocblas_status_success;
+    }
+};
+
+// a launch of size bytes of results that start with value, delivered to result
+static void launch(host_result_events& events,
+                   rocblas_result_slots& slots,
+                   double value,
+                   void* result,
+                   size_t size = sizeof(double))
+{
+    void* d_slots;
+    ASSERT_EQ(rocblas_status_success, slots.acquire(size, &d_slots));
+
+    events.launched++;
+    memset(d_slots, 0, size);
+    *(double*)d_slots = value;
+
+    ASSERT_EQ(rocblas_status_success, slots.commit(result, d_slots, size, 0));
+}
+
+TEST(checkin_result_slots, query_delivers_completed_in_order)
+{
+    host_result_events events;
+    rocblas_result_slots slots(events);
+
+    double results[3] = {0, 0, 0};
+    for(int i = 0; i < 3; i++)
+        launch(events, slots, i + 1.0, &results[i]);
+
+    // nothing has run, query does not wait
+    rocblas_int pending = -1;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(3, pending);
+    EXPECT_EQ(0.0, results[0]);
+    EXPECT_EQ(1, events.queries);
+    EXPECT_EQ(0, events.synchronizes);
+
+    // the first two launches have run
+    events.completed = 2;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(1, pending);
+    EXPECT_EQ(1.0, results[0]);
+    EXPECT_EQ(2.0, results[1]);
+    EXPECT_EQ(0.0, results[2]);
+    EXPECT_EQ(0, events.synchronizes);
+
+    events.completed = 3;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(0, pending);
+    EXPECT_EQ(3.0, results[2]);
+}
+
+TEST(checkin_result_slots, deliver_oldest_keeps_the_order_of_the_commits)
+{
+    host_result_events events;
+    rocblas_result_slots slots(events);
+
+    double results[2] = {0, 0};
+    launch(events, slots, 1.0, &results[0]);
+    launch(events, slots, 2.0, &results[1]);
+
+    // only the event of the second commit reports complete: a later result is not delivered
+    // before an earlier one
+    events.recorded[0] = events.launched + 1;
+    events.completed   = events.launched;
+
+    rocblas_int pending = -1;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(2, pending);
+    EXPECT_EQ(0.0, results[0]);
+    EXPECT_EQ(0.0, results[1]);
+}
+
+TEST(checkin_result_slots, synchronize_delivers_all)
+{
+    host_result_events events;
+    rocblas_result_slots slots(events);
+
+    double results[4] = {0, 0, 0, 0};
+    for(int i = 0; i < 4; i++)
+        launch(events, slots, i + 1.0, &results[i]);
+
+    EXPECT_EQ(rocblas_status_success, slots.synchronize());
+
+    for(int i = 0; i < 4; i++)
+        EXPECT_EQ(i + 1.0, results[i]);
+
+    rocblas_int pending = -1;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(0, pending);
+
+    // the events are reused once their results are delivered
+    launch(events, slots, 5.0, &results[0]);
+    EXPECT_EQ(rocblas_status_success, slots.synchronize());
+    EXPECT_EQ(5.0, results[0]);
+    EXPECT_EQ(4, events.creates);
+}
+
+TEST(checkin_result_slots, wait_delivers_up_to_the_last_overlapping_result)
+{
+    host_result_events events;
+    rocblas_result_slots slots(events);
+
+    double a = 0, b = 0, c = 0;
+    launch(events, slots, 1.0, &a);
+    launch(events, slots, 2.0, &b);
+    launch(events, slots, 3.0, &c);
+
+    // b is written by the host next: a is older and goes first, c stays in flight
+    EXPECT_EQ(rocblas_status_success, slots.wait(&b, sizeof(double)));
+    EXPECT_EQ(1.0, a);
+    EXPECT_EQ(2.0, b);
+    EXPECT_EQ(0.0, c);
+
+    rocblas_int pending = -1;
+    EXPECT_EQ(rocblas_status_success, slots.query(&pending));
+    EXPECT_EQ(1, pending);
+
+    // memory no result goes to waits for nothing
+    double d           = 0;
+    rocblas_int before = events.synchronizes;
+    EXPECT_EQ(rocblas_status_success, slots.wait(&d, sizeof(double)));
+    EXPECT_EQ(before, events.synchronizes);
+    EXPECT_EQ(0.0, c);
+}
+
+TEST(checkin_result_slots, wrap_around_waits_for_the_slots_in_flight)
+{
+    host_result_events events;
+    rocblas_result_slots slots(events);
+
+    // the first ring, each launch takes a third of it
+    void* d_slots;
+    ASSERT_EQ(rocblas_status_success, slots.acquire(16, &d_slots));
+    size_t capacity = events.last_alloc_size;
+    size_t size     = capacity / 3 / 16 * 16;
+    char* base      = (char*)d_slots;
+
+    vector<double> results[4];
+    for(int i = 0; i < 4; i++)
+        results[i].assign(size / sizeof(double), 0);
+
+    for(int i = 0; i < 3; i++)
+        launch(events, slots, i + 1.0, results[i].data(), size);
+
+    // the fourth launch does not fit behind the third, it wraps to the start of the ring where
+    // the first one is still in flight: the first is waited for and delivered, the others not
+    ASSERT_EQ(rocblas_status_success, slots.acquire(size, &d_slots));
+    EXPECT_EQ(base, (char*)d_slots);
+    EXPECT_EQ(1, events.synchronizes);
+    EXPECT_EQ(1.0, results[0][0]);
+    EXPECT_EQ(0.0, results[1][0]);
+
+    launch(events, slots, 4.0, results[3].data(), size);
+    EXPECT_EQ(1, events.synchronizes);
+
+    // the second and the third results were not overwritten by the fourth
+    EXPECT_EQ(rocblas_status_success, slots.synchronize());
+    for(int i = 0; i < 4; i++)
+        EXPECT_EQ(i + 1.0, results[i][0]);
+
+    EXPECT_EQ(1, events.allocs);
+}
+
+TEST(checkin_result_slots, grow_delivers_and_destructor_frees)
+{
+    host_result_events events;
+    {
+        rocblas_result_slots slots(events);
+
+        double result = 0;
+        launch(events, slots, 1.0, &result);
+        size_t capacity = events.last_alloc_size;
+
+        // more than the ring holds: the results in flight are delivered before it is replaced
+        void* d_slots;
+        ASSERT_EQ(rocblas_status_success, slots.acquire(capacity + 1, &d_slots));
+        EXPECT_EQ(1.0, result);
+        EXPECT_EQ(2, events.allocs);
+        EXPECT_EQ(1, events.frees);
+        EXPECT_LE(capacity + 1, events.last_alloc_size);
+
+        // left in flight for the destructor
+        launch(events, slots, 2.0, &result);
+    }
+
+    EXPECT_EQ(2, events.frees);
+    EXPECT_EQ(events.creates, events.destroys);
+}
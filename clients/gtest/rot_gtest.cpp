@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_rot.hpp"
+#include "testing_rotg.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<int, vector<int>, int, int, string> rot_tuple;
+typedef std::tuple<int, string> rotg_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+const vector<int> N_range = {-1, 0, 1, 7, 1000, 10000};
+
+const vector<int> large_N_range = {1048576, 4000000};
+
+// vector of vector, each pair is a {incx, incy};
+const vector<vector<int>> incx_incy_range = {
+    {1, 1}, {2, 1}, {-1, 2}, {-2, -1},
+};
+
+// the number of rotations of rot_sequence, ignored by the other routines
+const vector<int> K_range = {1, 5, 40};
+
+// the batch_count of the batched routines, ignored by the other routines
+const vector<int> batch_count_range = {1, 3};
+
+const vector<string> routine_range = {
+    "rot", "rot_strided_batched", "rot_batched", "rot_sequence", "rotm", "rotm_strided_batched",
+};
+
+const vector<int> rotg_batch_count_range = {1, 5, 37};
+
+const vector<string> rotg_routine_range = {
+    "rotg", "rotmg",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 rotations: rot, rot_sequence and rotm with their batched forms
+=================================================================== */
+
+Arguments setup_rot_arguments(rot_tuple tup)
+{
+    int N                 = std::get<0>(tup);
+    vector<int> incx_incy = std::get<1>(tup);
+    int K                 = std::get<2>(tup);
+    int batch_count       = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.N           = N;
+    arg.incx        = incx_incy[0];
+    arg.incy        = incx_incy[1];
+    arg.K           = K;
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class rot_gtest : public ::TestWithParam<rot_tuple>
+{
+    protected:
+    rot_gtest() {}
+    virtual ~rot_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(rot_gtest, rot_float)
+{
+    Arguments arg  = setup_rot_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_rot<float>(arg, routine);
+
+    // the rotations have no invalid sizes, N <= 0 is a quick return
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(rot_gtest, rot_double)
+{
+    Arguments arg  = setup_rot_arguments(GetParam());
+    string routine = std::get<4>(GetParam());
+
+    rocblas_status status = testing_rot<double>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { N, {incx, incy}, K, batch_count, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        rot_gtest,
+                        Combine(ValuesIn(N_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(K_range),
+                                ValuesIn(batch_count_range),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas1,
+                        rot_gtest,
+                        Combine(ValuesIn(large_N_range),
+                                Values(vector<int>{1, 1}),
+                                Values(40),
+                                Values(3),
+                                ValuesIn(routine_range)));
+
+// more pairs than a grid dimension holds, launched in several chunks
+INSTANTIATE_TEST_CASE_P(daily_blas1_huge_batch,
+                        rot_gtest,
+                        Combine(Values(5),
+                                Values(vector<int>{1, 1}),
+                                Values(1),
+                                Values(70000),
+                                Values(string("rot_strided_batched"),
+                                       string("rot_batched"),
+                                       string("rotm_strided_batched"))));
+
+/* =====================================================================
+     BLAS-1 construction of rotations: rotg and rotmg
+=================================================================== */
+
+class rotg_gtest : public ::TestWithParam<rotg_tuple>
+{
+    protected:
+    rotg_gtest() {}
+    virtual ~rotg_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(rotg_gtest, rotg_float)
+{
+    Arguments arg;
+    arg.batch_count = std::get<0>(GetParam());
+    arg.timing      = 0;
+    string routine  = std::get<1>(GetParam());
+
+    rocblas_status status = testing_rotg<float>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(rotg_gtest, rotg_double)
+{
+    Arguments arg;
+    arg.batch_count = std::get<0>(GetParam());
+    arg.timing      = 0;
+    string routine  = std::get<1>(GetParam());
+
+    rocblas_status status = testing_rotg<double>(arg, routine);
+
+    EXPECT_EQ(rocblas_status_success, status);
+}
+
+// The combinations are  { batch_count, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas1,
+                        rotg_gtest,
+                        Combine(ValuesIn(rotg_batch_count_range), ValuesIn(rotg_routine_range)));
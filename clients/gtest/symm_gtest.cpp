@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_symm.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> symm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one which invalidates the
+matrix.
+like lda pairs with M, and "lda must >= M". case "lda < M" will be guarded by argument-checkers
+inside API of course.
+Yet, the goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb, ldc};
+// lda has to cover A on either side, so it is kept >= max(M, N) for the valid cases.
+// sizes above the 64 diagonal block size exercise the recursive GEMM split of the stored triangle
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1},
+    {0, 1, 1, 1, 1},
+    {10, 10, 10, 9, 10},
+    {1, 1, 1, 1, 1},
+    {17, 33, 33, 17, 18},
+    {64, 64, 64, 64, 64},
+    {65, 130, 131, 66, 67},
+    {200, 63, 201, 202, 203},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000, 1000, 1000, 1000}, {2011, 257, 2011, 2011, 2011},
+};
+
+// vector of vector, each pair is a {alpha, beta};
+// add/delete this list in pairs, like {2.0, 4.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0}, {-1.0, 2.0}, {0.0, 3.0},
+};
+
+// vector of vector, each pair is a {side, uplo};
+const vector<vector<char>> side_uplo_range = {
+    {'L', 'L'}, {'L', 'U'}, {'R', 'L'}, {'R', 'U'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 symm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "argus".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_symm_arguments(symm_tuple tup)
+{
+    vector<int> matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta = std::get<1>(tup);
+    vector<char> side_uplo    = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    // the first element of alpha_beta_range is always alpha, and the second is always beta
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.side_option = side_uplo[0];
+    arg.uplo_option = side_uplo[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class symm_gtest : public ::TestWithParam<symm_tuple>
+{
+    protected:
+    symm_gtest() {}
+    virtual ~symm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(symm_gtest, symm_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_symm_arguments(GetParam());
+
+    rocblas_status status = testing_symm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        rocblas_int K = arg.side_option == 'L' ? arg.M : arg.N;
+
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < K)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.ldb < arg.M || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(symm_gtest, symm_double)
+{
+    Arguments arg = setup_symm_arguments(GetParam());
+
+    rocblas_status status = testing_symm<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        rocblas_int K = arg.side_option == 'L' ? arg.M : arg.N;
+
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < K)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.ldb < arg.M || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a avector,
+// ValuesIn take each element (a vector) and combine them and feed them to test_p
+// The combinations are  { {M, N, lda, ldb, ldc}, {alpha, beta}, {side, uplo} }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3,
+                        symm_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(side_uplo_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas3,
+                        symm_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(side_uplo_range)));
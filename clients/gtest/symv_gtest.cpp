@@ -40,20 +40,21 @@ Representative sampling is sufficient, endless brute-force sampling is not neces
 
 // vector of vector, each vector is a {N, lda};
 // add/delete as a group
+// N around the 64 block size checks the diagonal and partial blocks of the kernel
 const vector<vector<int>> matrix_size_range = {
-    {-1, -1},
-    /*  {10, 2},       */
-    /*  {500, 500},    */
-    {1000, 1000},
-    {2000, 2000},
-    {4011, 4011},
-    {8000, 8000},
+    {-1, -1}, {0, 1}, {10, 2}, {1, 1}, {33, 33}, {64, 64}, {65, 70}, {200, 200}, {500, 600},
+};
+
+// N over SYMV_PASS_BLOCKS column blocks (8192 for float and double, 4096 for double complex)
+// sums the partials of y in more than one pass
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000}, {2000, 2000}, {4011, 4011}, {8000, 8000}, {10000, 10000},
 };
 
 // vector of vector, each pair is a {incx, incy};
 // add/delete this list in pairs, like {1, 1}
 const vector<vector<int>> incx_incy_range = {
-    {1, 1}, {0, -1}, {2, 1}, {10, 100},
+    {1, 1}, {0, -1}, {2, 1}, {-1, 3}, {10, 100},
 };
 
 // vector of vector, each pair is a {alpha, beta};
@@ -69,7 +70,7 @@ const vector<char> uplo_range = {
 /* ===============Google Unit Test==================================================== */
 
 /* =====================================================================
-     BLAS-3 symv:
+     BLAS-2 symv:
 =================================================================== */
 
 /* ============================Setup Arguments======================================= */
@@ -139,15 +140,84 @@ TEST_P(symv_gtest, symv_gtest_float)
         {
             EXPECT_EQ(rocblas_status_invalid_size, status);
         }
-        else if(arg.lda < arg.M)
+        else if(arg.lda < arg.N)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incy == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(symv_gtest, symv_gtest_double)
+{
+    Arguments arg = setup_symv_arguments(GetParam());
+
+    rocblas_status status = testing_symv<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.N)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0 || arg.incy == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(symv_gtest, hemv_gtest_float_complex)
+{
+    Arguments arg = setup_symv_arguments(GetParam());
+
+    rocblas_status status = testing_hemv<rocblas_float_complex, float>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.N)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0 || arg.incy == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(symv_gtest, hemv_gtest_double_complex)
+{
+    Arguments arg = setup_symv_arguments(GetParam());
+
+    rocblas_status status = testing_hemv<rocblas_double_complex, double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
         {
             EXPECT_EQ(rocblas_status_invalid_size, status);
         }
-        else if(arg.incx <= 0)
+        else if(arg.lda < arg.N)
         {
             EXPECT_EQ(rocblas_status_invalid_size, status);
         }
-        else if(arg.incy <= 0)
+        else if(arg.incx == 0 || arg.incy == 0)
         {
             EXPECT_EQ(rocblas_status_invalid_size, status);
         }
@@ -157,11 +227,18 @@ TEST_P(symv_gtest, symv_gtest_float)
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
-// The combinations are  { {M, N, lda}, {incx,incy} {alpha, beta}, {uplo} }
+// The combinations are  { {N, lda}, {incx,incy} {alpha, beta}, {uplo} }
 
-INSTANTIATE_TEST_CASE_P(rocblas_symv,
+INSTANTIATE_TEST_CASE_P(checkin_blas2,
                         symv_gtest,
                         Combine(ValuesIn(matrix_size_range),
                                 ValuesIn(incx_incy_range),
                                 ValuesIn(alpha_beta_range),
                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2,
+                        symv_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(uplo_range)));
@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_syrk.hpp"
+#include "testing_syr2k.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int> syrk_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one which invalidates the
+matrix.
+like lda pairs with N, and "lda must >= N". case "lda < N" will be guarded by argument-checkers
+inside API of course.
+Yet, the goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not necessary
+=================================================================== */
+
+// vector of vector, each vector is a {N, K, lda, ldb, ldc};
+// add/delete as a group.
+// N around the 64 diagonal block size and its multiples exercise both the diagonal kernel and
+// the recursive GEMM split of the off-diagonal part
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1},
+    {0, 1, 1, 1, 1},
+    {10, 10, 9, 10, 10},
+    {1, 1, 1, 1, 1},
+    {15, 17, 33, 33, 16},
+    {64, 64, 64, 64, 64},
+    {65, 33, 66, 67, 68},
+    {129, 63, 129, 130, 131},
+    {300, 199, 301, 302, 303},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000, 1000, 1000, 1000}, {2011, 511, 2011, 2011, 2011},
+};
+
+// vector of vector, each pair is a {alpha, beta};
+// add/delete this list in pairs, like {2.0, 4.0}
+// alpha == 0 and beta == 1 hit the quick paths
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0}, {-1.0, 2.0}, {0.0, 3.0}, {2.0, 1.0},
+};
+
+// vector of vector, each pair is a {uplo, trans};
+// for single/double precision, 'C'(conjTranspose) is treated as 'T' (transpose)
+const vector<vector<char>> uplo_trans_range = {
+    {'L', 'N'}, {'L', 'T'}, {'U', 'N'}, {'U', 'C'},
+};
+
+// number of syrk's in strided batched syrk, it is ignored by the non batched tests
+const vector<int> batch_count_range = {
+    -1, 0, 1, 3,
+};
+
+// more syrk's than one launch can hold in its grid
+const vector<int> huge_batch_count_range = {70000};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 syrk, syr2k and their strided_batched forms:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "argus".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_syrk_arguments(syrk_tuple tup)
+{
+    vector<int> matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta = std::get<1>(tup);
+    vector<char> uplo_trans   = std::get<2>(tup);
+    int batch_count           = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    // the first element of alpha_beta_range is always alpha, and the second is always beta
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.uplo_option   = uplo_trans[0];
+    arg.transA_option = uplo_trans[1];
+
+    arg.batch_count = batch_count;
+    arg.timing      = 0;
+
+    return arg;
+}
+
+// the status expected from syrk / syr2k for arguments the testers could not run
+void check_syrk_status(Arguments arg, rocblas_status status, bool batched)
+{
+    rocblas_int A_row = arg.transA_option == 'N' ? arg.N : arg.K;
+
+    if(arg.N < 0 || arg.K < 0)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(arg.lda < A_row || arg.ldb < A_row)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(arg.ldc < arg.N)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else if(batched && arg.batch_count < 0)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+    else
+    {
+        EXPECT_EQ(rocblas_status_success, status);
+    }
+}
+
+class syrk_gtest : public ::TestWithParam<syrk_tuple>
+{
+    protected:
+    syrk_gtest() {}
+    virtual ~syrk_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(syrk_gtest, syrk_float)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+
+    // syrk has no B, keep ldb out of the size check
+    arg.ldb = arg.lda;
+
+    rocblas_status status = testing_syrk<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, false);
+    }
+}
+
+TEST_P(syrk_gtest, syrk_double)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+    arg.ldb       = arg.lda;
+
+    rocblas_status status = testing_syrk<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, false);
+    }
+}
+
+TEST_P(syrk_gtest, syrk_strided_batched_float)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+    arg.ldb       = arg.lda;
+
+    rocblas_status status = testing_syrk_strided_batched<float>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, true);
+    }
+}
+
+TEST_P(syrk_gtest, syr2k_float)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+
+    rocblas_status status = testing_syr2k<float>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, false);
+    }
+}
+
+TEST_P(syrk_gtest, syr2k_double)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+
+    rocblas_status status = testing_syr2k<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, false);
+    }
+}
+
+TEST_P(syrk_gtest, syr2k_strided_batched_double)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+
+    rocblas_status status = testing_syr2k_strided_batched<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        check_syrk_status(arg, status, true);
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a avector,
+// ValuesIn take each element (a vector) and combine them and feed them to test_p
+// The combinations are  { {N, K, lda, ldb, ldc}, {alpha, beta}, {uplo, trans}, {batch_count} }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3,
+                        syrk_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(uplo_trans_range),
+                                ValuesIn(batch_count_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas3,
+                        syrk_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(uplo_trans_range),
+                                Values(1)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas3_huge_batch,
+                        syrk_gtest,
+                        Combine(Values(vector<int>{10, 10, 10, 10, 10}),
+                                ValuesIn(alpha_beta_range),
+                                Values(vector<char>{'L', 'N'}),
+                                ValuesIn(huge_batch_count_range)));
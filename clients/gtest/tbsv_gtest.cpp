@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_tbsv.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, vector<char>> tbsv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda};
+// K = 0 is a diagonal solve, K >= N covers the full triangle, N over the 64 diagonal block
+// with K around 64 couples a block to the one next to it or to the two after it
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 2},
+    {10, -1, 1},
+    {10, 3, 3},
+    {0, 2, 3},
+    {1, 0, 1},
+    {33, 0, 1},
+    {100, 5, 8},
+    {100, 120, 121},
+    {500, 70, 71},
+    {129, 64, 65},
+    {200, 1, 2},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {4000, 2, 3}, {4000, 32, 33}, {8000, 200, 201},
+};
+
+const vector<int> incx_range = {
+    1, -1, 0, 3,
+};
+
+// vector of vector, each is a {uplo, transA, diag};
+// for single/double precision, 'C'(conjTranspose) is the same as 'T' (transpose)
+const vector<vector<char>> uplo_transA_diag_range = {
+    {'L', 'N', 'N'},
+    {'U', 'N', 'N'},
+    {'L', 'T', 'N'},
+    {'U', 'T', 'N'},
+    {'L', 'N', 'U'},
+    {'U', 'N', 'U'},
+    {'L', 'T', 'U'},
+    {'U', 'T', 'U'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 tbsv:
+=================================================================== */
+
+Arguments setup_tbsv_arguments(tbsv_tuple tup)
+{
+
+    vector<int> matrix_size       = std::get<0>(tup);
+    int incx                      = std::get<1>(tup);
+    vector<char> uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.incx = incx;
+
+    arg.uplo_option   = uplo_transA_diag[0];
+    arg.transA_option = uplo_transA_diag[1];
+    arg.diag_option   = uplo_transA_diag[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class tbsv_gtest : public ::TestWithParam<tbsv_tuple>
+{
+    protected:
+    tbsv_gtest() {}
+    virtual ~tbsv_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(tbsv_gtest, tbsv_gtest_float)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    rocblas_status status = testing_tbsv<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.K + 1)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(tbsv_gtest, tbsv_gtest_double)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    rocblas_status status = testing_tbsv<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.K + 1)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+// The combinations are  { {N, K, lda}, incx, {uplo, transA, diag} }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2,
+                        tbsv_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(uplo_transA_diag_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2,
+                        tbsv_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(uplo_transA_diag_range)));
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "testing_transpose_inplace.hpp"
+#include "transpose_segments.h"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, string> transpose_inplace_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda}, lda is ignored unless M == N
+const vector<vector<int>> matrix_size_range = {
+    {-1, 5, 5},
+    {0, 3, 3},
+    {4, 4, 3},
+    {1, 1, 1},
+    {33, 33, 40},
+    {500, 500, 500},
+    {2, 3, 2},
+    {7, 13, 7},
+    {100, 37, 100},
+    {1000, 3, 1000},
+    {1, 50, 1},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {4000, 4000, 4001}, {3000, 1999, 3000}, {1, 1000000, 1},
+};
+
+// the batch_count of transpose_inplace_batched, ignored by transpose_inplace
+const vector<int> batch_count_range = {1, 3};
+
+const vector<string> routine_range = {
+    "transpose_inplace", "transpose_inplace_batched",
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 in-place transpose
+=================================================================== */
+
+Arguments setup_transpose_inplace_arguments(transpose_inplace_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int batch_count         = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M           = matrix_size[0];
+    arg.N           = matrix_size[1];
+    arg.lda         = matrix_size[2];
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class transpose_inplace_gtest : public ::TestWithParam<transpose_inplace_tuple>
+{
+    protected:
+    transpose_inplace_gtest() {}
+    virtual ~transpose_inplace_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(transpose_inplace_gtest, transpose_inplace_float)
+{
+    Arguments arg  = setup_transpose_inplace_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_transpose_inplace<float>(arg, routine);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.M == arg.N && arg.lda < arg.M)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else
+        {
+            EXPECT_EQ(rocblas_status_success, status);
+        }
+    }
+}
+
+TEST_P(transpose_inplace_gtest, transpose_inplace_double)
+{
+    Arguments arg  = setup_transpose_inplace_arguments(GetParam());
+    string routine = std::get<2>(GetParam());
+
+    rocblas_status status = testing_transpose_inplace<double>(arg, routine);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.M == arg.N && arg.lda < arg.M)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else
+        {
+            EXPECT_EQ(rocblas_status_success, status);
+        }
+    }
+}
+
+// The combinations are  { {M, N, lda}, batch_count, routine }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3,
+                        transpose_inplace_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(batch_count_range),
+                                ValuesIn(routine_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas3,
+                        transpose_inplace_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                Values(2),
+                                Values(string("transpose_inplace_batched"))));
+
+// more matrices than a grid dimension holds, launched in several chunks
+INSTANTIATE_TEST_CASE_P(daily_blas3_large_batch,
+                        transpose_inplace_gtest,
+                        Combine(Values(vector<int>{2, 3, 2}, vector<int>{4, 4, 4}),
+                                Values(70000),
+                                Values(string("transpose_inplace_batched"))));
+
+/*
+    the segments of the cycle plan: the moves of all segments visit every position that is not a
+    fixed point exactly once, and replaying them on the host transposes the matrix. A segment
+    makes at most TRANSPOSE_SEGMENT moves and a cycle starts at most one shorter segment.
+*/
+TEST(checkin_blas3, transpose_inplace_segments)
+{
+    const vector<vector<int>> shapes = {
+        {2, 3}, {7, 13}, {100, 37}, {1000, 3}, {1, 50}, {300, 700}, {1, 1}, {2, 1},
+    };
+
+    for(const vector<int>& shape : shapes)
+    {
+        rocblas_int m    = shape[0];
+        rocblas_int n    = shape[1];
+        size_t size      = (size_t)m * n;
+        rocblas_int last = m * n - 1;
+
+        vector<rocblas_int> starts, lengths;
+        rocblas_transpose_segments(m, n, starts, lengths);
+        ASSERT_EQ(starts.size(), lengths.size());
+
+        rocblas_int segments = starts.size();
+        rocblas_int partial  = 0;
+
+        vector<int> hA(size), hA_moved(size), visits(size, 0);
+        for(size_t k = 0; k < size; k++)
+            hA[k] = hA_moved[k] = k;
+
+        // the element at k moves to P(k) = k * n mod (m * n - 1), the first and last stay
+        for(rocblas_int s = 0; s < segments; s++)
+        {
+            EXPECT_GT(lengths[s], 0);
+            EXPECT_LE(lengths[s], TRANSPOSE_SEGMENT);
+            partial += lengths[s] < TRANSPOSE_SEGMENT;
+
+            size_t k = starts[s];
+            for(rocblas_int move = 0; move < lengths[s]; move++)
+            {
+                size_t next = k * n % last;
+                visits[k]++;
+                hA_moved[next] = hA[k];
+                k              = next;
+            }
+        }
+
+        for(size_t k = 1; k + 1 < size; k++)
+        {
+            EXPECT_EQ(k * n % last == k ? 0 : 1, visits[k]);
+        }
+
+        // the cycles of P longer than one move
+        rocblas_int cycles = 0;
+        vector<bool> seen(size, false);
+        for(size_t k = 1; k + 1 < size; k++)
+        {
+            if(seen[k] || k * n % last == k)
+                continue;
+            cycles++;
+            for(size_t next = k; !seen[next]; next = next * n % last)
+                seen[next] = true;
+        }
+        EXPECT_LE(partial, cycles);
+        EXPECT_LE((size_t)segments, size / TRANSPOSE_SEGMENT + cycles);
+
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                EXPECT_EQ(hA[i + j * m], hA_moved[j + i * n]);
+            }
+        }
+    }
+}
@@ -54,6 +54,13 @@ const vector<vector<int>> large_matrix_size_range = {
 
 const vector<double> alpha_range = {1.0, -5.0};
 
+// triangles of the single kernel path, k <= TRSM_SMALL_MAX_K on either side
+const vector<vector<int>> alpha_zero_matrix_size_range = {
+    {10, 10, 20, 100}, {64, 33, 64, 64}, {33, 64, 64, 64},
+};
+
+const vector<double> alpha_zero_range = {0.0};
+
 // vector of vector, each pair is a {side, uplo, transA, diag};
 // side has two option "Lefe (L), Right (R)"
 // uplo has two "Lower (L), Upper (U)"
@@ -225,3 +232,33 @@ INSTANTIATE_TEST_CASE_P(checkin_blas3,
                         Combine(ValuesIn(matrix_size_range),
                                 ValuesIn(alpha_range),
                                 ValuesIn(full_side_uplo_transA_diag_range)));
+
+class trsm_alpha_zero : public ::TestWithParam<trsm_tuple>
+{
+    protected:
+    trsm_alpha_zero() {}
+    virtual ~trsm_alpha_zero() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_alpha_zero, float)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    testing_trsm_alpha_zero<float>(arg);
+}
+
+TEST_P(trsm_alpha_zero, double)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    testing_trsm_alpha_zero<double>(arg);
+}
+
+// B holds NaN on entry, alpha == 0 must not read it
+INSTANTIATE_TEST_CASE_P(checkin_blas3_alpha_zero,
+                        trsm_alpha_zero,
+                        Combine(ValuesIn(alpha_zero_matrix_size_range),
+                                ValuesIn(alpha_zero_range),
+                                ValuesIn(full_side_uplo_transA_diag_range)));
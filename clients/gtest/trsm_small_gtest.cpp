@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_trsm_small.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, double, vector<char>> trsm_small_tuple;
+
+/* =====================================================================
+README: the small trsm path (single kernel, k <= 64) is checked against the
+        blocked trtri + gemm path on the same input, each handle pinned to
+        one path through ROCBLAS_TRSM_SMALL_K
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb};
+// covers every DIM_K instantiation (16, 32, 64), ragged k and a partial last block of vectors
+const vector<vector<int>> small_matrix_size_range = {
+    {1, 1, 1, 1},
+    {7, 3, 7, 7},
+    {16, 16, 16, 16},
+    {17, 40, 20, 20},
+    {32, 33, 32, 32},
+    {45, 45, 50, 60},
+    {64, 64, 64, 64},
+    {64, 300, 64, 64},
+};
+
+const vector<double> alpha_range = {1.0, -5.0};
+
+// has all the 16 options, see trsm_gtest.cpp
+const vector<vector<char>> full_side_uplo_transA_diag_range = {
+    {'L', 'L', 'N', 'N'},
+    {'R', 'L', 'N', 'N'},
+    {'L', 'U', 'N', 'N'},
+    {'R', 'U', 'N', 'N'},
+    {'L', 'L', 'C', 'N'},
+    {'R', 'L', 'C', 'N'},
+    {'L', 'U', 'C', 'N'},
+    {'R', 'U', 'C', 'N'},
+    {'L', 'L', 'N', 'U'},
+    {'R', 'L', 'N', 'U'},
+    {'L', 'U', 'N', 'U'},
+    {'R', 'U', 'N', 'U'},
+    {'L', 'L', 'C', 'U'},
+    {'R', 'L', 'C', 'U'},
+    {'L', 'U', 'C', 'U'},
+    {'R', 'U', 'C', 'U'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 trsm small path:
+=================================================================== */
+
+Arguments setup_trsm_small_arguments(trsm_small_tuple tup)
+{
+
+    vector<int> matrix_size            = std::get<0>(tup);
+    double alpha                       = std::get<1>(tup);
+    vector<char> side_uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about small_matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha = alpha;
+
+    arg.side_option   = side_uplo_transA_diag[0];
+    arg.uplo_option   = side_uplo_transA_diag[1];
+    arg.transA_option = side_uplo_transA_diag[2];
+    arg.diag_option   = side_uplo_transA_diag[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class trsm_small_gtest : public ::TestWithParam<trsm_small_tuple>
+{
+    protected:
+    trsm_small_gtest() {}
+    virtual ~trsm_small_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_small_gtest, trsm_small_gtest_float)
+{
+    Arguments arg = setup_trsm_small_arguments(GetParam());
+
+    rocblas_status status = testing_trsm_small<float>(arg);
+
+    // right side sizes with lda < N or N above the small path limit are skipped by the tester
+    if(status != rocblas_status_success)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+}
+
+TEST_P(trsm_small_gtest, trsm_small_gtest_double)
+{
+    Arguments arg = setup_trsm_small_arguments(GetParam());
+
+    rocblas_status status = testing_trsm_small<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+}
+
+// The combinations are  { {M, N, lda, ldb}, alpha, {side, uplo, transA, diag} }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas3,
+                        trsm_small_gtest,
+                        Combine(ValuesIn(small_matrix_size_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(full_side_uplo_transA_diag_range)));
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+#include "testing_trsv.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using ::testing::Combine;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, vector<char>> trsv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, lda};
+// N around the 64 diagonal block size checks the full, partial and single block solves
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1}, {0, 1}, {10, 2}, {1, 1}, {33, 40}, {64, 64}, {65, 65}, {128, 128}, {129, 130},
+    {300, 300}, {600, 700},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 1000}, {2000, 2000}, {4011, 4011},
+};
+
+const vector<int> incx_range = {
+    1, -1, 0, 3,
+};
+
+// vector of vector, each is a {uplo, transA, diag};
+// for single/double precision, 'C'(conjTranspose) is the same as 'T' (transpose)
+const vector<vector<char>> uplo_transA_diag_range = {
+    {'L', 'N', 'N'},
+    {'U', 'N', 'N'},
+    {'L', 'T', 'N'},
+    {'U', 'T', 'N'},
+    {'L', 'N', 'U'},
+    {'U', 'N', 'U'},
+    {'L', 'T', 'U'},
+    {'U', 'T', 'U'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 trsv:
+=================================================================== */
+
+Arguments setup_trsv_arguments(trsv_tuple tup)
+{
+
+    vector<int> matrix_size       = std::get<0>(tup);
+    int incx                      = std::get<1>(tup);
+    vector<char> uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.incx = incx;
+
+    arg.uplo_option   = uplo_transA_diag[0];
+    arg.transA_option = uplo_transA_diag[1];
+    arg.diag_option   = uplo_transA_diag[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class trsv_gtest : public ::TestWithParam<trsv_tuple>
+{
+    protected:
+    trsv_gtest() {}
+    virtual ~trsv_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsv_gtest, trsv_gtest_float)
+{
+    Arguments arg = setup_trsv_arguments(GetParam());
+
+    rocblas_status status = testing_trsv<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.N || arg.lda < 1)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+TEST_P(trsv_gtest, trsv_gtest_double)
+{
+    Arguments arg = setup_trsv_arguments(GetParam());
+
+    rocblas_status status = testing_trsv<double>(arg);
+
+    if(status != rocblas_status_success)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.lda < arg.N || arg.lda < 1)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+        else if(arg.incx == 0)
+        {
+            EXPECT_EQ(rocblas_status_invalid_size, status);
+        }
+    }
+}
+
+// The combinations are  { {N, lda}, incx, {uplo, transA, diag} }
+
+INSTANTIATE_TEST_CASE_P(checkin_blas2,
+                        trsv_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(uplo_transA_diag_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_blas2,
+                        trsv_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(uplo_transA_diag_range)));
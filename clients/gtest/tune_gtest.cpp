@@ -0,0 +1,228 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "gemm_small_batched.h"
+#include "tune.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     rocblas-tune: the search and the Logic files on timers of the host
+=================================================================== */
+
+// a Logic file of three solutions with an empty exact logic
+const string tune_logic = "- {MinimumRequiredVersion: 3.3.5}\n"
+                          "- mi25\n"
+                          "- gfx900\n"
+                          "- [Device 6860]\n"
+                          "- AssignedDerivedParameters: true\n"
+                          "  Batched: true\n"
+                          "- - AssignedDerivedParameters: true\n"
+                          "    MacroTile0: 32\n"
+                          "    ProblemType:\n"
+                          "      Batched: true\n"
+                          "  - AssignedDerivedParameters: true\n"
+                          "    MacroTile0: 64\n"
+                          "  - AssignedDerivedParameters: true\n"
+                          "    MacroTile0: 128\n"
+                          "- [2, 3, 0, 1]\n"
+                          "- []\n"
+                          "- - - -1\n"
+                          "    - - - -1\n"
+                          "        - - [-1, 2]\n";
+
+// solution (M + K) % 3 is the fastest, solution 1 does not run on odd N
+class tune_known_timer : public tune_timer
+{
+    public:
+    rocblas_int calls = 0;
+
+    virtual double time_us(const tune_problem& problem, rocblas_int solution)
+    {
+        calls++;
+        if(solution == 1 && problem.N % 2 == 1)
+            return -1.0;
+        return solution == (problem.M + problem.K) % 3 ? 10.0 : 20.0 + solution;
+    }
+};
+
+TEST(checkin_tune, parse_problem)
+{
+    tune_problem p;
+
+    ASSERT_TRUE(tune_parse_problem("./rocblas-bench -f gemm -r d --transposeA N --transposeB T "
+                                   "-m 4096 -n 7000 -k 1024 --alpha 1 --lda 4096 --ldb 7000 "
+                                   "--beta 0 --ldc 4096",
+                                   p));
+    EXPECT_EQ('d', p.precision);
+    EXPECT_EQ('N', p.transA_option);
+    EXPECT_EQ('T', p.transB_option);
+    EXPECT_EQ(4096, p.M);
+    EXPECT_EQ(7000, p.N);
+    EXPECT_EQ(1024, p.K);
+    EXPECT_EQ(1, p.batch_count);
+    EXPECT_FALSE(p.strided_batched);
+
+    ASSERT_TRUE(tune_parse_problem(
+        "-f gemm_strided_batched --transposeA C -m 64 -n 32 -k 16 --batch 100", p));
+    EXPECT_EQ('s', p.precision);
+    EXPECT_EQ('T', p.transA_option);
+    EXPECT_EQ('N', p.transB_option);
+    EXPECT_EQ(64, p.M);
+    EXPECT_EQ(32, p.N);
+    EXPECT_EQ(16, p.K);
+    EXPECT_EQ(100, p.batch_count);
+    EXPECT_TRUE(p.strided_batched);
+
+    EXPECT_FALSE(tune_parse_problem("", p));
+    EXPECT_FALSE(tune_parse_problem("# -f gemm -m 64", p));
+    EXPECT_FALSE(tune_parse_problem("./rocblas-bench -f gemv -r s -m 64 -n 64", p));
+    EXPECT_FALSE(tune_parse_problem("./rocblas-bench -f gemm -r z -m 64 -n 64 -k 64", p));
+}
+
+TEST(checkin_tune, uses_tensile)
+{
+    EXPECT_TRUE(tune_uses_tensile({'s', 'N', 'N', 64, 64, 64, 1, false}));
+    EXPECT_TRUE(tune_uses_tensile({'d', 'T', 'N', 64, 64, 64, 100, true}));
+
+    // degenerate shapes
+    EXPECT_FALSE(tune_uses_tensile({'s', 'N', 'N', 1, 64, 64, 1, false}));
+    EXPECT_FALSE(tune_uses_tensile({'d', 'N', 'T', 64, 64, 1, 1, false}));
+    EXPECT_TRUE(tune_uses_tensile({'h', 'N', 'N', 1, 64, 64, 1, false}));
+
+    // small matrices in a large strided batch, gemm always runs on Tensile
+    EXPECT_FALSE(tune_uses_tensile({'s', 'N', 'N', 8, 8, 8, 1000, true}));
+    EXPECT_TRUE(tune_uses_tensile({'s', 'N', 'N', 8, 8, 8, 1000, false}));
+    EXPECT_TRUE(tune_uses_tensile({'s', 'N', 'N', 8, 8, 8, 1, false}));
+
+    // a strided batch of one follows the small batched selection like any other batch
+    EXPECT_EQ(rocblas_gemm_small_batched_select(8, 8, 8, 1) < 0,
+              tune_uses_tensile({'s', 'N', 'N', 8, 8, 8, 1, true}));
+    EXPECT_EQ(rocblas_gemm_small_batched_select(16, 16, 16, 600) < 0,
+              tune_uses_tensile({'d', 'N', 'T', 16, 16, 16, 600, true}));
+
+    EXPECT_FALSE(tune_uses_tensile({'s', 'N', 'N', 0, 64, 64, 1, false}));
+    EXPECT_FALSE(tune_uses_tensile({'s', 'N', 'N', 64, 64, 64, 0, false}));
+}
+
+TEST(checkin_tune, logic_name)
+{
+    EXPECT_EQ("Cijk_Ailk_Bljk_SB", tune_logic_name({'s', 'N', 'N', 1, 1, 1, 1, false}));
+    EXPECT_EQ("Cijk_Ailk_Bjlk_DB", tune_logic_name({'d', 'N', 'T', 1, 1, 1, 1, false}));
+    EXPECT_EQ("Cijk_Alik_Bljk_HB", tune_logic_name({'h', 'T', 'N', 1, 1, 1, 1, false}));
+    EXPECT_EQ("Cijk_Alik_Bjlk_SB", tune_logic_name({'s', 'T', 'T', 1, 1, 1, 1, false}));
+}
+
+TEST(checkin_tune, search)
+{
+    vector<tune_problem> problems = {
+        {'s', 'N', 'N', 100, 200, 300, 1, false},
+        {'s', 'N', 'N', 101, 200, 300, 1, false},
+        {'s', 'N', 'N', 100, 200, 300, 1, false},
+        {'s', 'N', 'N', 102, 201, 300, 1, false},
+        {'s', 'N', 'N', 101, 201, 300, 1, false},
+    };
+
+    tune_known_timer timer;
+    vector<tune_result> results = tune_search(problems, 3, timer, 2);
+
+    // the repeated problem is timed once
+    ASSERT_EQ(4u, results.size());
+    for(const tune_result& r : results)
+    {
+        EXPECT_EQ((r.problem.M + r.problem.K) % 3, r.solution);
+        EXPECT_DOUBLE_EQ(tune_gflops(r.problem, 10.0), r.gflops);
+    }
+
+    // two timings of the solutions that run, one of solution 1 on odd N
+    EXPECT_EQ(2 * 3 + 2 * 3 + (2 + 1 + 2) + (2 + 1 + 2), timer.calls);
+
+    // on odd N the fastest solution does not run
+    tune_known_timer failing;
+    results = tune_search({{'s', 'N', 'N', 101, 201, 302, 1, false}}, 3, failing, 1);
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(0, results[0].solution);
+    EXPECT_DOUBLE_EQ(tune_gflops(results[0].problem, 20.0), results[0].gflops);
+
+    // no solution to run
+    EXPECT_TRUE(tune_search(problems, 0, timer, 1).empty());
+}
+
+TEST(checkin_tune, simulated_search)
+{
+    tune_simulated_timer timer;
+    tune_problem p = {'d', 'T', 'N', 1000, 2000, 3000, 1, false};
+
+    EXPECT_GT(timer.time_us(p, 0), 0.0);
+    EXPECT_EQ(timer.time_us(p, 7), timer.time_us(p, 7));
+
+    rocblas_int best = 0;
+    for(rocblas_int s = 1; s < 50; s++)
+        if(timer.time_us(p, s) < timer.time_us(p, best))
+            best = s;
+
+    vector<tune_result> results = tune_search({p}, 50, timer, 1);
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(best, results[0].solution);
+}
+
+TEST(checkin_tune, command_timer)
+{
+    tune_command_timer timer("bench -r {precision} {transA}{transB} {m} {n} {k} {batch} {m} "
+                             "-i {solution}");
+
+    EXPECT_EQ("bench -r d TN 10 20 30 4 10 -i 5",
+              timer.expand({'d', 'T', 'N', 10, 20, 30, 4, true}, 5));
+}
+
+TEST(checkin_tune, write_logic)
+{
+    EXPECT_EQ(3, tune_solution_count(tune_logic));
+    EXPECT_EQ(0, tune_solution_count("- mi25\n- gfx900\n"));
+    EXPECT_EQ("", tune_write_logic("- mi25\n- gfx900\n", {}));
+
+    // no results leave the file as it is
+    EXPECT_EQ(tune_logic, tune_write_logic(tune_logic, {}));
+
+    vector<tune_result> results = {
+        {{'s', 'N', 'N', 4096, 7000, 4096, 1, false}, 2, 9905.5},
+        {{'s', 'N', 'N', 35, 1500, 2048, 8, true}, 0, 1841.25},
+    };
+
+    string tuned = tune_write_logic(tune_logic, results);
+    string range = tune_logic.substr(tune_logic.find("- - - -1"));
+
+    string exact = "- [2, 3, 0, 1]\n"
+                   "- - - [4096, 7000, 1, 4096]\n"
+                   "    - [2, 9905.5]\n"
+                   "  - - [35, 1500, 8, 2048]\n"
+                   "    - [0, 1841.25]\n"
+                   "- - - -1\n";
+    EXPECT_NE(string::npos, tuned.find(exact));
+    EXPECT_EQ(0u, tuned.find(tune_logic.substr(0, tune_logic.find("- []"))));
+    EXPECT_EQ(tuned.size() - range.size(), tuned.find(range));
+    EXPECT_EQ(3, tune_solution_count(tuned));
+
+    // a size tuned again is replaced, the others stay
+    tuned = tune_write_logic(tuned, {{{'s', 'N', 'N', 35, 1500, 2048, 8, true}, 1, 2000.0}});
+
+    exact = "- - - [4096, 7000, 1, 4096]\n"
+            "    - [2, 9905.5]\n"
+            "  - - [35, 1500, 8, 2048]\n"
+            "    - [1, 2000]\n"
+            "- - - -1\n";
+    EXPECT_NE(string::npos, tuned.find(exact));
+}
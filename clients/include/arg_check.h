@@ -64,6 +64,20 @@ void gemm_strided_batched_arg_check(rocblas_status status,
                                     rocblas_int ldc,
                                     rocblas_int batch_count);
 
+void syrk_arg_check(rocblas_status status,
+                    rocblas_int N,
+                    rocblas_int K,
+                    rocblas_int lda,
+                    rocblas_int ldc,
+                    rocblas_int batch_count);
+
+void symm_arg_check(rocblas_status status,
+                    rocblas_int M,
+                    rocblas_int N,
+                    rocblas_int lda,
+                    rocblas_int ldb,
+                    rocblas_int ldc);
+
 void geam_arg_check(rocblas_status status,
                     rocblas_int M,
                     rocblas_int N,
@@ -77,6 +91,46 @@ void trsm_arg_check(
 void symv_arg_check(
     rocblas_status status, rocblas_int N, rocblas_int lda, rocblas_int incx, rocblas_int incy);
 
+void trsv_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda, rocblas_int incx);
+
+void tbsv_arg_check(
+    rocblas_status status, rocblas_int N, rocblas_int K, rocblas_int lda, rocblas_int incx);
+
+void gbmv_arg_check(rocblas_status status,
+                    rocblas_int M,
+                    rocblas_int N,
+                    rocblas_int KL,
+                    rocblas_int KU,
+                    rocblas_int lda,
+                    rocblas_int incx,
+                    rocblas_int incy);
+
+void sbmv_arg_check(rocblas_status status,
+                    rocblas_int N,
+                    rocblas_int K,
+                    rocblas_int lda,
+                    rocblas_int incx,
+                    rocblas_int incy);
+
+void packed_arg_check(rocblas_status status,
+                      rocblas_int N,
+                      rocblas_int lda,
+                      rocblas_int incx,
+                      rocblas_int incy);
+
+void rank_update_arg_check(rocblas_status status,
+                           rocblas_int M,
+                           rocblas_int N,
+                           rocblas_int lda,
+                           rocblas_int incx,
+                           rocblas_int incy,
+                           rocblas_int batch_count);
+
+void blas1_batched_arg_check(rocblas_status status, rocblas_int batch_count);
+
+void mdot_maxpy_arg_check(
+    rocblas_status status, rocblas_int N, rocblas_int K, rocblas_int lda, rocblas_int inc);
+
 void iamax_iamin_arg_check(rocblas_status status, rocblas_int* d_rocblas_result);
 
 template <typename T2>
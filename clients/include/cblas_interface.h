@@ -47,6 +47,18 @@ void cblas_scal(rocblas_int n, const T alpha, T* x, rocblas_int incx);
 template <typename T>
 void cblas_swap(rocblas_int n, T* x, rocblas_int incx, T* y, rocblas_int incy);
 
+template <typename T>
+void cblas_rot(rocblas_int n, T* x, rocblas_int incx, T* y, rocblas_int incy, T c, T s);
+
+template <typename T>
+void cblas_rotg(T* a, T* b, T* c, T* s);
+
+template <typename T>
+void cblas_rotm(rocblas_int n, T* x, rocblas_int incx, T* y, rocblas_int incy, const T* param);
+
+template <typename T>
+void cblas_rotmg(T* d1, T* d2, T* x1, T y1, T* param);
+
 template <typename T>
 void cblas_gemv(rocblas_operation transA,
                 rocblas_int m,
@@ -87,6 +99,128 @@ template <typename T>
 void cblas_syr(
     rocblas_fill uplo, rocblas_int n, T alpha, T* x, rocblas_int incx, T* A, rocblas_int lda);
 
+template <typename T>
+void cblas_syr2(rocblas_fill uplo,
+                rocblas_int n,
+                T alpha,
+                const T* x,
+                rocblas_int incx,
+                const T* y,
+                rocblas_int incy,
+                T* A,
+                rocblas_int lda);
+
+template <typename T1, typename T2>
+void cblas_her(rocblas_fill uplo,
+               rocblas_int n,
+               T2 alpha,
+               const T1* x,
+               rocblas_int incx,
+               T1* A,
+               rocblas_int lda);
+
+template <typename T>
+void cblas_her2(rocblas_fill uplo,
+                rocblas_int n,
+                T alpha,
+                const T* x,
+                rocblas_int incx,
+                const T* y,
+                rocblas_int incy,
+                T* A,
+                rocblas_int lda);
+
+template <typename T>
+void cblas_trsv(rocblas_fill uplo,
+                rocblas_operation transA,
+                rocblas_diagonal diag,
+                rocblas_int n,
+                const T* A,
+                rocblas_int lda,
+                T* x,
+                rocblas_int incx);
+
+template <typename T>
+void cblas_tbsv(rocblas_fill uplo,
+                rocblas_operation transA,
+                rocblas_diagonal diag,
+                rocblas_int n,
+                rocblas_int k,
+                const T* A,
+                rocblas_int lda,
+                T* x,
+                rocblas_int incx);
+
+template <typename T>
+void cblas_gbmv(rocblas_operation transA,
+                rocblas_int m,
+                rocblas_int n,
+                rocblas_int kl,
+                rocblas_int ku,
+                T alpha,
+                const T* A,
+                rocblas_int lda,
+                const T* x,
+                rocblas_int incx,
+                T beta,
+                T* y,
+                rocblas_int incy);
+
+template <typename T>
+void cblas_sbmv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int k,
+                T alpha,
+                const T* A,
+                rocblas_int lda,
+                const T* x,
+                rocblas_int incx,
+                T beta,
+                T* y,
+                rocblas_int incy);
+
+template <typename T>
+void cblas_spmv(rocblas_fill uplo,
+                rocblas_int n,
+                T alpha,
+                const T* AP,
+                const T* x,
+                rocblas_int incx,
+                T beta,
+                T* y,
+                rocblas_int incy);
+
+template <typename T>
+void cblas_spr(rocblas_fill uplo, rocblas_int n, T alpha, const T* x, rocblas_int incx, T* AP);
+
+template <typename T>
+void cblas_spr2(rocblas_fill uplo,
+                rocblas_int n,
+                T alpha,
+                const T* x,
+                rocblas_int incx,
+                const T* y,
+                rocblas_int incy,
+                T* AP);
+
+template <typename T>
+void cblas_tpmv(rocblas_fill uplo,
+                rocblas_operation transA,
+                rocblas_diagonal diag,
+                rocblas_int n,
+                const T* AP,
+                T* x,
+                rocblas_int incx);
+
+template <typename T>
+void cblas_tpsv(rocblas_fill uplo,
+                rocblas_operation transA,
+                rocblas_diagonal diag,
+                rocblas_int n,
+                const T* AP,
+                T* x,
+                rocblas_int incx);
+
 template <typename T>
 void cblas_hemv(rocblas_fill uplo,
                 rocblas_int n,
@@ -114,6 +248,46 @@ void cblas_gemm(rocblas_operation transA,
                 T* C,
                 rocblas_int ldc);
 
+template <typename T>
+void cblas_syrk(rocblas_fill uplo,
+                rocblas_operation trans,
+                rocblas_int n,
+                rocblas_int k,
+                T alpha,
+                const T* A,
+                rocblas_int lda,
+                T beta,
+                T* C,
+                rocblas_int ldc);
+
+template <typename T>
+void cblas_syr2k(rocblas_fill uplo,
+                 rocblas_operation trans,
+                 rocblas_int n,
+                 rocblas_int k,
+                 T alpha,
+                 const T* A,
+                 rocblas_int lda,
+                 const T* B,
+                 rocblas_int ldb,
+                 T beta,
+                 T* C,
+                 rocblas_int ldc);
+
+template <typename T>
+void cblas_symm(rocblas_side side,
+                rocblas_fill uplo,
+                rocblas_int m,
+                rocblas_int n,
+                T alpha,
+                const T* A,
+                rocblas_int lda,
+                const T* B,
+                rocblas_int ldb,
+                T beta,
+                T* C,
+                rocblas_int ldc);
+
 template <typename T>
 void cblas_trsm(rocblas_side side,
                 rocblas_fill uplo,
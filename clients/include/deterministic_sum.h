@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DETERMINISTIC_SUM_H
+#define _DETERMINISTIC_SUM_H
+
+#include <vector>
+#include "rocblas.h"
+
+/*!\file
+ * \brief host implementation of the summation order of rocblas_reduction_mode_deterministic.
+ *  It needs no GPU, so the expected bits of a reduction can be computed on any machine.
+ */
+
+/*! \brief sums x[0, ROCBLAS_DETERMINISTIC_NB) in place by the binary tree of the deterministic
+ *  order, the sum is in x[0] */
+template <typename T>
+void deterministic_tree(std::vector<T>& x)
+{
+    for(rocblas_int s = ROCBLAS_DETERMINISTIC_NB / 2; s > 0; s /= 2)
+    {
+        for(rocblas_int l = 0; l < s; l++)
+            x[l] += x[l + s];
+    }
+}
+
+/*! \brief sum of the n terms in the order of rocblas_reduction_mode_deterministic: a tree over
+ *  each block of ROCBLAS_DETERMINISTIC_NB terms, the block sums gathered into lane b % NB in
+ *  order of b, then a tree over the lanes. The terms are the rounded products, absolute values or
+ *  squares of the routine, e.g. x[i] * y[i] for dot. */
+template <typename T>
+T deterministic_sum(rocblas_int n, const T* terms)
+{
+    const rocblas_int nb = ROCBLAS_DETERMINISTIC_NB;
+
+    if(n <= 0)
+        return 0.0;
+
+    rocblas_int blocks = (n - 1) / nb + 1;
+
+    std::vector<T> lane(nb);
+    std::vector<T> partial(blocks);
+
+    for(rocblas_int b = 0; b < blocks; b++)
+    {
+        for(rocblas_int l = 0; l < nb; l++)
+        {
+            rocblas_int i = b * nb + l;
+            lane[l]       = i < n ? terms[i] : 0.0;
+        }
+
+        deterministic_tree(lane);
+        partial[b] = lane[0];
+    }
+
+    for(rocblas_int l = 0; l < nb; l++)
+    {
+        lane[l] = 0.0;
+        for(rocblas_int b = l; b < blocks; b += nb)
+            lane[l] += partial[b];
+    }
+
+    deterministic_tree(lane);
+
+    return lane[0];
+}
+
+#endif
@@ -56,6 +56,64 @@ double symv_gflop_count(rocblas_int n)
     return (2.0 * n * n) / 1e9;
 }
 
+/* \brief floating point counts of TRSV */
+template <typename T>
+double trsv_gflop_count(rocblas_int n)
+{
+    return (1.0 * n * n) / 1e9;
+}
+
+/* \brief floating point counts of TBSV */
+template <typename T>
+double tbsv_gflop_count(rocblas_int n, rocblas_int k)
+{
+    rocblas_int k1 = k < n ? k : n - 1;
+    return (2.0 * n * k1 - 1.0 * k1 * (k1 + 1) + n) / 1e9;
+}
+
+/* \brief floating point counts of GBMV, the band of an m by n matrix, kl and ku clamped to it */
+template <typename T>
+double gbmv_gflop_count(rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku)
+{
+    double entries = 0;
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        rocblas_int first = j - ku > 0 ? j - ku : 0;
+        rocblas_int last  = j + kl < m - 1 ? j + kl : m - 1;
+        entries += last >= first ? last - first + 1 : 0;
+    }
+    return (2.0 * entries) / 1e9;
+}
+
+/* \brief floating point counts of SBMV */
+template <typename T>
+double sbmv_gflop_count(rocblas_int n, rocblas_int k)
+{
+    rocblas_int k1 = k < n ? k : n - 1;
+    return (2.0 * (2.0 * n * k1 - 1.0 * k1 * (k1 + 1) + n)) / 1e9;
+}
+
+/* \brief floating point counts of SPR */
+template <typename T>
+double spr_gflop_count(rocblas_int n)
+{
+    return (1.0 * n * (n + 1)) / 1e9;
+}
+
+/* \brief floating point counts of SPR2 */
+template <typename T>
+double spr2_gflop_count(rocblas_int n)
+{
+    return (2.0 * n * (n + 1)) / 1e9;
+}
+
+/* \brief floating point counts of TPMV */
+template <typename T>
+double tpmv_gflop_count(rocblas_int n)
+{
+    return (1.0 * n * n) / 1e9;
+}
+
 /* \brief floating point counts of GER */
 template <typename T>
 double ger_gflop_count(rocblas_int m, rocblas_int n)
@@ -70,6 +128,13 @@ double syr_gflop_count(rocblas_int n)
     return ((2.0 * n * (n + 1)) / 2) / 1e9;
 }
 
+/* \brief floating point counts of SYR2 */
+template <typename T>
+double syr2_gflop_count(rocblas_int n)
+{
+    return (2.0 * n * (n + 1)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 3 BLAS
@@ -83,6 +148,28 @@ double gemm_gflop_count(rocblas_int m, rocblas_int n, rocblas_int k)
     return (2.0 * m * n * k) / 1e9;
 }
 
+/* \brief floating point counts of SYRK, only the referenced triangle of C is computed */
+template <typename T>
+double syrk_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return (1.0 * n * (n + 1) * k) / 1e9;
+}
+
+/* \brief floating point counts of SYR2K */
+template <typename T>
+double syr2k_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return (2.0 * n * (n + 1) * k) / 1e9;
+}
+
+/* \brief floating point counts of SYMM, A is m by m on the left and n by n on the right */
+template <typename T>
+double symm_gflop_count(rocblas_side side, rocblas_int m, rocblas_int n)
+{
+    rocblas_int k = side == rocblas_side_left ? m : n;
+    return (2.0 * m * n * k) / 1e9;
+}
+
 /* \brief floating point counts of GEAM */
 template <typename T>
 double geam_gflop_count(rocblas_int m, rocblas_int n)
@@ -70,6 +70,313 @@ rocblas_status rocblas_axpy(rocblas_handle handle,
                             T* y,
                             rocblas_int incy);
 
+/*
+ * ===========================================================================
+ *    level 1 BLAS, batched
+ * ===========================================================================
+ */
+template <typename T>
+rocblas_status rocblas_scal_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* alpha,
+                                            T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_scal_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* alpha,
+                                    T* const x[],
+                                    rocblas_int incx,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_copy_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_copy_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    T* const y[],
+                                    rocblas_int incy,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_swap_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_swap_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    T* const x[],
+                                    rocblas_int incx,
+                                    T* const y[],
+                                    rocblas_int incy,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_dot_strided_batched(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           rocblas_int bsx,
+                                           const T* y,
+                                           rocblas_int incy,
+                                           rocblas_int bsy,
+                                           T* result,
+                                           rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_dot_batched(rocblas_handle handle,
+                                   rocblas_int n,
+                                   const T* const x[],
+                                   rocblas_int incx,
+                                   const T* const y[],
+                                   rocblas_int incy,
+                                   T* result,
+                                   rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_asum_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* result,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_asum_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    T* result,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_nrm2_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* result,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_nrm2_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    T* result,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_iamax_strided_batched(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const T* x,
+                                             rocblas_int incx,
+                                             rocblas_int bsx,
+                                             rocblas_int* result,
+                                             rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_iamax_batched(rocblas_handle handle,
+                                     rocblas_int n,
+                                     const T* const x[],
+                                     rocblas_int incx,
+                                     rocblas_int* result,
+                                     rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_axpy_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* alpha,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_axpy_batched(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* alpha,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    T* const y[],
+                                    rocblas_int incy,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_mdot(rocblas_handle handle,
+                            rocblas_int n,
+                            rocblas_int k,
+                            const T* V,
+                            rocblas_int ldv,
+                            const T* x,
+                            rocblas_int incx,
+                            T* result);
+
+template <typename T>
+rocblas_status rocblas_maxpy(rocblas_handle handle,
+                             rocblas_int n,
+                             rocblas_int k,
+                             const T* alpha,
+                             const T* V,
+                             rocblas_int ldv,
+                             T* y,
+                             rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_axpy_dot(rocblas_handle handle,
+                                rocblas_int n,
+                                const T* alpha,
+                                const T* x,
+                                rocblas_int incx,
+                                T* y,
+                                rocblas_int incy,
+                                const T* z,
+                                rocblas_int incz,
+                                T* result);
+
+template <typename T>
+rocblas_status rocblas_dot_nrm2(rocblas_handle handle,
+                                rocblas_int n,
+                                const T* x,
+                                rocblas_int incx,
+                                const T* y,
+                                rocblas_int incy,
+                                T* dot_result,
+                                T* nrm2_result);
+
+template <typename T>
+rocblas_status rocblas_scal_copy(rocblas_handle handle,
+                                 rocblas_int n,
+                                 const T* alpha,
+                                 const T* x,
+                                 rocblas_int incx,
+                                 T* y,
+                                 rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_rot(rocblas_handle handle,
+                           rocblas_int n,
+                           T* x,
+                           rocblas_int incx,
+                           T* y,
+                           rocblas_int incy,
+                           const T* c,
+                           const T* s);
+
+template <typename T>
+rocblas_status rocblas_rot_strided_batched(rocblas_handle handle,
+                                           rocblas_int n,
+                                           T* x,
+                                           rocblas_int incx,
+                                           rocblas_int bsx,
+                                           T* y,
+                                           rocblas_int incy,
+                                           rocblas_int bsy,
+                                           const T* c,
+                                           const T* s,
+                                           rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_rot_batched(rocblas_handle handle,
+                                   rocblas_int n,
+                                   T* const x[],
+                                   rocblas_int incx,
+                                   T* const y[],
+                                   rocblas_int incy,
+                                   const T* c,
+                                   const T* s,
+                                   rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_rot_sequence(rocblas_handle handle,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    T* x,
+                                    rocblas_int incx,
+                                    T* y,
+                                    rocblas_int incy,
+                                    const T* c,
+                                    const T* s);
+
+template <typename T>
+rocblas_status rocblas_rotg(rocblas_handle handle, T* a, T* b, T* c, T* s);
+
+template <typename T>
+rocblas_status rocblas_rotg_strided_batched(rocblas_handle handle,
+                                            T* a,
+                                            rocblas_int stride_a,
+                                            T* b,
+                                            rocblas_int stride_b,
+                                            T* c,
+                                            rocblas_int stride_c,
+                                            T* s,
+                                            rocblas_int stride_s,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_rotm(rocblas_handle handle,
+                            rocblas_int n,
+                            T* x,
+                            rocblas_int incx,
+                            T* y,
+                            rocblas_int incy,
+                            const T* param);
+
+template <typename T>
+rocblas_status rocblas_rotm_strided_batched(rocblas_handle handle,
+                                            rocblas_int n,
+                                            T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            const T* param,
+                                            rocblas_int stride_param,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_rotmg(rocblas_handle handle, T* d1, T* d2, T* x1, const T* y1, T* param);
+
+template <typename T>
+rocblas_status rocblas_rotmg_strided_batched(rocblas_handle handle,
+                                             T* d1,
+                                             rocblas_int stride_d1,
+                                             T* d2,
+                                             rocblas_int stride_d2,
+                                             T* x1,
+                                             rocblas_int stride_x1,
+                                             const T* y1,
+                                             rocblas_int stride_y1,
+                                             T* param,
+                                             rocblas_int stride_param,
+                                             rocblas_int batch_count);
+
 template <typename T>
 rocblas_status rocblas_ger(rocblas_handle handle,
                            rocblas_int m,
@@ -82,6 +389,35 @@ rocblas_status rocblas_ger(rocblas_handle handle,
                            T* A,
                            rocblas_int lda);
 
+template <typename T>
+rocblas_status rocblas_ger_strided_batched(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           rocblas_int bsx,
+                                           const T* y,
+                                           rocblas_int incy,
+                                           rocblas_int bsy,
+                                           T* A,
+                                           rocblas_int lda,
+                                           rocblas_int bsa,
+                                           rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_ger_order(rocblas_handle handle,
+                                 rocblas_order order,
+                                 rocblas_int m,
+                                 rocblas_int n,
+                                 const T* alpha,
+                                 const T* x,
+                                 rocblas_int incx,
+                                 const T* y,
+                                 rocblas_int incy,
+                                 T* A,
+                                 rocblas_int lda);
+
 template <typename T>
 rocblas_status rocblas_syr(rocblas_handle handle,
                            rocblas_fill uplo,
@@ -92,6 +428,69 @@ rocblas_status rocblas_syr(rocblas_handle handle,
                            T* A,
                            rocblas_int lda);
 
+template <typename T>
+rocblas_status rocblas_syr_strided_batched(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           rocblas_int bsx,
+                                           T* A,
+                                           rocblas_int lda,
+                                           rocblas_int bsa,
+                                           rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_syr2(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* y,
+                            rocblas_int incy,
+                            T* A,
+                            rocblas_int lda);
+
+template <typename T>
+rocblas_status rocblas_syr2_strided_batched(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const T* alpha,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            const T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            T* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            rocblas_int batch_count);
+
+template <typename T1, typename T2>
+rocblas_status rocblas_her(rocblas_handle handle,
+                           rocblas_fill uplo,
+                           rocblas_int n,
+                           const T2* alpha,
+                           const T1* x,
+                           rocblas_int incx,
+                           T1* A,
+                           rocblas_int lda);
+
+template <typename T>
+rocblas_status rocblas_her2(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* y,
+                            rocblas_int incy,
+                            T* A,
+                            rocblas_int lda);
+
 template <typename T>
 rocblas_status rocblas_gemv(rocblas_handle handle,
                             rocblas_operation transA,
@@ -106,6 +505,21 @@ rocblas_status rocblas_gemv(rocblas_handle handle,
                             T* y,
                             rocblas_int incy);
 
+template <typename T>
+rocblas_status rocblas_gemv_order(rocblas_handle handle,
+                                  rocblas_order order,
+                                  rocblas_operation transA,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  const T* beta,
+                                  T* y,
+                                  rocblas_int incy);
+
 template <typename T>
 rocblas_status rocblas_symv(rocblas_handle handle,
                             rocblas_fill uplo,
@@ -119,6 +533,198 @@ rocblas_status rocblas_symv(rocblas_handle handle,
                             T* y,
                             rocblas_int incy);
 
+template <typename T>
+rocblas_status rocblas_hemv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* A,
+                            rocblas_int lda,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* beta,
+                            T* y,
+                            rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_trsv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal diag,
+                            rocblas_int n,
+                            const T* A,
+                            rocblas_int lda,
+                            T* x,
+                            rocblas_int incx);
+
+template <typename T>
+rocblas_status rocblas_tbsv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal diag,
+                            rocblas_int n,
+                            rocblas_int k,
+                            const T* A,
+                            rocblas_int lda,
+                            T* x,
+                            rocblas_int incx);
+
+template <typename T>
+rocblas_status rocblas_gbmv(rocblas_handle handle,
+                            rocblas_operation transA,
+                            rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int kl,
+                            rocblas_int ku,
+                            const T* alpha,
+                            const T* A,
+                            rocblas_int lda,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* beta,
+                            T* y,
+                            rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_gbmv_strided_batched(rocblas_handle handle,
+                                            rocblas_operation transA,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int kl,
+                                            rocblas_int ku,
+                                            const T* alpha,
+                                            const T* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            const T* beta,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_gbmv_batched(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    rocblas_int kl,
+                                    rocblas_int ku,
+                                    const T* alpha,
+                                    const T* const A[],
+                                    rocblas_int lda,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    const T* beta,
+                                    T* const y[],
+                                    rocblas_int incy,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_sbmv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            rocblas_int k,
+                            const T* alpha,
+                            const T* A,
+                            rocblas_int lda,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* beta,
+                            T* y,
+                            rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_sbmv_strided_batched(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const T* alpha,
+                                            const T* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            const T* x,
+                                            rocblas_int incx,
+                                            rocblas_int bsx,
+                                            const T* beta,
+                                            T* y,
+                                            rocblas_int incy,
+                                            rocblas_int bsy,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_sbmv_batched(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const T* alpha,
+                                    const T* const A[],
+                                    rocblas_int lda,
+                                    const T* const x[],
+                                    rocblas_int incx,
+                                    const T* beta,
+                                    T* const y[],
+                                    rocblas_int incy,
+                                    rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_spmv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* AP,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* beta,
+                            T* y,
+                            rocblas_int incy);
+
+template <typename T>
+rocblas_status rocblas_spr(rocblas_handle handle,
+                           rocblas_fill uplo,
+                           rocblas_int n,
+                           const T* alpha,
+                           const T* x,
+                           rocblas_int incx,
+                           T* AP);
+
+template <typename T>
+rocblas_status rocblas_spr2(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* x,
+                            rocblas_int incx,
+                            const T* y,
+                            rocblas_int incy,
+                            T* AP);
+
+template <typename T>
+rocblas_status rocblas_tpmv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal diag,
+                            rocblas_int n,
+                            const T* AP,
+                            T* x,
+                            rocblas_int incx);
+
+template <typename T>
+rocblas_status rocblas_tpsv(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal diag,
+                            rocblas_int n,
+                            const T* AP,
+                            T* x,
+                            rocblas_int incx);
+
+template <typename T>
+rocblas_status rocblas_tpttr(
+    rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* AP, T* A, rocblas_int lda);
+
 template <typename T>
 rocblas_status rocblas_geam(rocblas_handle handle,
                             rocblas_operation transA,
@@ -134,6 +740,35 @@ rocblas_status rocblas_geam(rocblas_handle handle,
                             T* C,
                             rocblas_int ldc);
 
+template <typename T>
+rocblas_status rocblas_geam_order(rocblas_handle handle,
+                                  rocblas_order order,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  const T* beta,
+                                  const T* B,
+                                  rocblas_int ldb,
+                                  T* C,
+                                  rocblas_int ldc);
+
+template <typename T>
+rocblas_status rocblas_transpose_inplace(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda);
+
+template <typename T>
+rocblas_status rocblas_transpose_inplace_strided_batched(rocblas_handle handle,
+                                                         rocblas_int m,
+                                                         rocblas_int n,
+                                                         T* A,
+                                                         rocblas_int lda,
+                                                         rocblas_int stride_a,
+                                                         rocblas_int batch_count);
+
 template <typename T>
 rocblas_status rocblas_gemm(rocblas_handle handle,
                             rocblas_operation transA,
@@ -150,6 +785,23 @@ rocblas_status rocblas_gemm(rocblas_handle handle,
                             T* C,
                             rocblas_int ldc);
 
+template <typename T>
+rocblas_status rocblas_gemm_order(rocblas_handle handle,
+                                  rocblas_order order,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  rocblas_int k,
+                                  const T* alpha,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  const T* B,
+                                  rocblas_int ldb,
+                                  const T* beta,
+                                  T* C,
+                                  rocblas_int ldc);
+
 template <typename T>
 rocblas_status rocblas_gemm_strided_batched(rocblas_handle handle,
                                             rocblas_operation transA,
@@ -170,6 +822,84 @@ rocblas_status rocblas_gemm_strided_batched(rocblas_handle handle,
                                             rocblas_int bsc,
                                             rocblas_int batch_count);
 
+template <typename T>
+rocblas_status rocblas_syrk(rocblas_handle handle,
+                            rocblas_fill uplo,
+                            rocblas_operation trans,
+                            rocblas_int n,
+                            rocblas_int k,
+                            const T* alpha,
+                            const T* A,
+                            rocblas_int lda,
+                            const T* beta,
+                            T* C,
+                            rocblas_int ldc);
+
+template <typename T>
+rocblas_status rocblas_syrk_strided_batched(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const T* alpha,
+                                            const T* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            const T* beta,
+                                            T* C,
+                                            rocblas_int ldc,
+                                            rocblas_int bsc,
+                                            rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_syr2k(rocblas_handle handle,
+                             rocblas_fill uplo,
+                             rocblas_operation trans,
+                             rocblas_int n,
+                             rocblas_int k,
+                             const T* alpha,
+                             const T* A,
+                             rocblas_int lda,
+                             const T* B,
+                             rocblas_int ldb,
+                             const T* beta,
+                             T* C,
+                             rocblas_int ldc);
+
+template <typename T>
+rocblas_status rocblas_syr2k_strided_batched(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const T* alpha,
+                                             const T* A,
+                                             rocblas_int lda,
+                                             rocblas_int bsa,
+                                             const T* B,
+                                             rocblas_int ldb,
+                                             rocblas_int bsb,
+                                             const T* beta,
+                                             T* C,
+                                             rocblas_int ldc,
+                                             rocblas_int bsc,
+                                             rocblas_int batch_count);
+
+template <typename T>
+rocblas_status rocblas_symm(rocblas_handle handle,
+                            rocblas_side side,
+                            rocblas_fill uplo,
+                            rocblas_int m,
+                            rocblas_int n,
+                            const T* alpha,
+                            const T* A,
+                            rocblas_int lda,
+                            const T* B,
+                            rocblas_int ldb,
+                            const T* beta,
+                            T* C,
+                            rocblas_int ldc);
+
 template <typename T>
 rocblas_status rocblas_trsm(rocblas_handle handle,
                             rocblas_side side,
@@ -184,6 +914,21 @@ rocblas_status rocblas_trsm(rocblas_handle handle,
                             T* B,
                             rocblas_int ldb);
 
+template <typename T>
+rocblas_status rocblas_trsm_order(rocblas_handle handle,
+                                  rocblas_order order,
+                                  rocblas_side side,
+                                  rocblas_fill uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal diag,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  T* A,
+                                  rocblas_int lda,
+                                  T* B,
+                                  rocblas_int ldb);
+
 template <typename T>
 rocblas_status rocblas_trtri(rocblas_handle handle,
                              rocblas_fill uplo,
@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "near.h"
+#include "unit.h"
+
+using namespace std;
+
+/*
+    one call of the reduction routine, dot, asum, nrm2 or one of the fused routines that take
+    the dot product x * y: mdot with V = x (incx = 1), axpy_dot with alpha = 0, z = x, which
+    leaves y as it is, and dot_nrm2, whose nrm2 goes to result[1]. zero and result are in the
+    memory of the pointer mode of the handle.
+*/
+template <typename T>
+rocblas_status accumulation_mode_call(const string& routine,
+                                      rocblas_handle handle,
+                                      rocblas_int N,
+                                      const T* dx,
+                                      rocblas_int incx,
+                                      T* dy,
+                                      rocblas_int incy,
+                                      const T* zero,
+                                      T* result)
+{
+    if(routine == "dot")
+        return rocblas_dot<T>(handle, N, dx, incx, dy, incy, result);
+    else if(routine == "asum")
+        return rocblas_asum<T, T>(handle, N, dx, incx, result);
+    else if(routine == "nrm2")
+        return rocblas_nrm2<T, T>(handle, N, dx, incx, result);
+    else if(routine == "mdot")
+        return rocblas_mdot<T>(handle, N, 1, dx, N, dy, incy, result);
+    else if(routine == "axpy_dot")
+        return rocblas_axpy_dot<T>(handle, N, zero, dx, incx, dy, incy, dx, incx, result);
+    else if(routine == "dot_nrm2")
+        return rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, result, result + 1);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    the reduction in long double, to about the last bit: TwoProd splits every product into
+    its rounded value and its rounding error, TwoSum carries the rounding error of every sum.
+*/
+template <typename T>
+long double accurate_reduction(const string& routine,
+                               rocblas_int N,
+                               const T* x,
+                               rocblas_int incx,
+                               const T* y,
+                               rocblas_int incy)
+{
+    long double sum = 0.0;
+    long double err = 0.0;
+
+    for(rocblas_int i = 0; i < N; i++)
+    {
+        long double a = x[i * incx];
+        long double b = routine == "asum" ? 1.0 : routine == "nrm2" ? x[i * incx] : y[i * incy];
+        if(routine == "asum")
+            a = fabsl(a);
+
+        long double terms[2];
+        terms[0] = a * b;
+        terms[1] = fmal(a, b, -terms[0]);
+
+        for(int k = 0; k < 2; k++)
+        {
+            long double s  = sum + terms[k];
+            long double bp = s - sum;
+            err += (sum - (s - bp)) + (terms[k] - bp);
+            sum = s;
+        }
+    }
+
+    return routine == "nrm2" ? sqrtl(sum + err) : sum + err;
+}
+
+/*
+    every rocblas_accumulation_mode against the accurate reduction and cblas. The data are
+    positive, so that the sums are well conditioned and the errors are those of the
+    accumulation. The compensated mode and the double mode of float must be accurate to a few
+    units of the last place, the native mode within the bound of recursive summation. The
+    timing gives the error and the cost of each mode and of cblas.
+*/
+template <typename T>
+rocblas_status testing_accumulation_mode(Arguments argus, const string& routine)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    // asum and nrm2 quick return for incx <= 0, the column of mdot is contiguous
+    if(N <= 0 || incx <= 0 || incy <= 0 || (routine == "mdot" && incx != 1))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_int size_x = N * incx;
+    rocblas_int size_y = N * incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto d_result_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * 2), rocblas_test::device_free};
+    auto d_zero_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dx       = (T*)dx_managed.get();
+    T* dy       = (T*)dy_managed.get();
+    T* d_result = (T*)d_result_managed.get();
+    T* d_zero   = (T*)d_zero_managed.get();
+    if(!dx || !dy || !d_result || !d_zero)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU, positive and not integers
+    srand(1);
+    for(rocblas_int i = 0; i < size_x; i++)
+        hx[i] = (T)rand() / RAND_MAX + 0.1;
+    for(rocblas_int i = 0; i < size_y; i++)
+        hy[i] = (T)rand() / RAND_MAX + 0.1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    const T h_zero = 0;
+    CHECK_HIP_ERROR(hipMemcpy(d_zero, &h_zero, sizeof(T), hipMemcpyHostToDevice));
+
+    long double exact = accurate_reduction<T>(routine, N, hx.data(), incx, hy.data(), incy);
+    T h_exact         = exact;
+    T eps             = std::numeric_limits<T>::epsilon();
+
+    const rocblas_accumulation_mode modes[] = {rocblas_accumulation_mode_native,
+                                               rocblas_accumulation_mode_compensated,
+                                               rocblas_accumulation_mode_double};
+    const char* mode_names[] = {"native", "compensated", "double"};
+
+    // the second column holds the nrm2 of dot_nrm2
+    T h_result[3][2];
+    double error_eps[3];
+
+    for(int m = 0; m < 3; m++)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_accumulation_mode(handle, modes[m]));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(accumulation_mode_call<T>(
+            routine, handle, N, dx, incx, dy, incy, &h_zero, h_result[m]));
+
+        error_eps[m] = fabsl((h_result[m][0] - exact) / exact) / eps;
+
+        if(argus.unit_check)
+        {
+            // double accumulation of double is the native accumulation
+            bool accurate = modes[m] == rocblas_accumulation_mode_compensated ||
+                            (modes[m] == rocblas_accumulation_mode_double && sizeof(T) < 8);
+            T abs_error = (accurate ? 2 : N) * eps * h_exact;
+
+            near_check_general<T, T>(1, 1, 1, &h_exact, &h_result[m][0], abs_error);
+
+            // the same bits from the device pointer mode
+            T h_result_2;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(accumulation_mode_call<T>(
+                routine, handle, N, dx, incx, dy, incy, d_zero, d_result));
+            CHECK_HIP_ERROR(hipMemcpy(&h_result_2, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+            bitwise_check_general<T>(1, 1, 1, &h_result[m][0], &h_result_2);
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        // the dot products read two vectors, axpy_dot writes y as well
+        bool dot_like = routine != "asum" && routine != "nrm2";
+        double bytes  = (double)(routine == "axpy_dot" ? 3 : dot_like ? 2 : 1) * N * sizeof(T);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        cout << "routine,N,incx,incy,accumulation,us,GB/s,error-eps" << endl;
+
+        for(int m = 0; m < 3; m++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_accumulation_mode(handle, modes[m]));
+
+            double gpu_time_used;
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    gpu_time_used = get_time_us(); // in microseconds
+                }
+
+                accumulation_mode_call<T>(
+                    routine, handle, N, dx, incx, dy, incy, d_zero, d_result);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+            cout << routine << ',' << N << ',' << incx << ',' << incy << ',' << mode_names[m]
+                 << ',' << gpu_time_used << ',' << bytes / gpu_time_used / 1e3 << ','
+                 << error_eps[m] << endl;
+        }
+
+        // CPU BLAS
+        T cpu_result;
+        double cpu_time_used = get_time_us();
+
+        if(dot_like)
+            cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &cpu_result);
+        else if(routine == "asum")
+            cblas_asum<T, T>(N, hx.data(), incx, &cpu_result);
+        else
+            cblas_nrm2<T, T>(N, hx.data(), incx, &cpu_result);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        cout << routine << ',' << N << ',' << incx << ',' << incy << ",cblas," << cpu_time_used
+             << ',' << bytes / cpu_time_used / 1e3 << ','
+             << fabsl((cpu_result - exact) / exact) / eps << endl;
+    }
+
+    return rocblas_status_success;
+}
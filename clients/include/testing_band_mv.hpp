@@ -0,0 +1,507 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "flops.h"
+
+using namespace std;
+
+/*
+    one call of the band routine (gbmv or sbmv) over the whole batch. routine is the plain
+    routine for a batch of one, the _strided_batched routine on the strided batch dA, dx, dy or
+    the _batched routine on the arrays of pointers to the same matrices and vectors.
+*/
+template <typename T>
+rocblas_status band_mv_call(const string& routine,
+                            rocblas_handle handle,
+                            rocblas_operation transA,
+                            rocblas_fill uplo,
+                            rocblas_int M,
+                            rocblas_int N,
+                            rocblas_int KL,
+                            rocblas_int KU,
+                            rocblas_int K,
+                            const T* alpha,
+                            const T* dA,
+                            const T* const* dA_array,
+                            rocblas_int lda,
+                            rocblas_int bsa,
+                            const T* dx,
+                            const T* const* dx_array,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            const T* beta,
+                            T* dy,
+                            T* const* dy_array,
+                            rocblas_int incy,
+                            rocblas_int bsy,
+                            rocblas_int batch_count)
+{
+    if(routine == "gbmv")
+        return rocblas_gbmv<T>(
+            handle, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, beta, dy, incy);
+    else if(routine == "gbmv_strided_batched")
+        return rocblas_gbmv_strided_batched<T>(handle,
+                                               transA,
+                                               M,
+                                               N,
+                                               KL,
+                                               KU,
+                                               alpha,
+                                               dA,
+                                               lda,
+                                               bsa,
+                                               dx,
+                                               incx,
+                                               bsx,
+                                               beta,
+                                               dy,
+                                               incy,
+                                               bsy,
+                                               batch_count);
+    else if(routine == "gbmv_batched")
+        return rocblas_gbmv_batched<T>(handle,
+                                       transA,
+                                       M,
+                                       N,
+                                       KL,
+                                       KU,
+                                       alpha,
+                                       dA_array,
+                                       lda,
+                                       dx_array,
+                                       incx,
+                                       beta,
+                                       dy_array,
+                                       incy,
+                                       batch_count);
+    else if(routine == "sbmv")
+        return rocblas_sbmv<T>(handle, uplo, N, K, alpha, dA, lda, dx, incx, beta, dy, incy);
+    else if(routine == "sbmv_strided_batched")
+        return rocblas_sbmv_strided_batched<T>(handle,
+                                               uplo,
+                                               N,
+                                               K,
+                                               alpha,
+                                               dA,
+                                               lda,
+                                               bsa,
+                                               dx,
+                                               incx,
+                                               bsx,
+                                               beta,
+                                               dy,
+                                               incy,
+                                               bsy,
+                                               batch_count);
+    else if(routine == "sbmv_batched")
+        return rocblas_sbmv_batched<T>(handle,
+                                       uplo,
+                                       N,
+                                       K,
+                                       alpha,
+                                       dA_array,
+                                       lda,
+                                       dx_array,
+                                       incx,
+                                       beta,
+                                       dy_array,
+                                       incy,
+                                       batch_count);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    gbmv and sbmv and their batched forms against cblas_gbmv and cblas_sbmv, once with the
+    scalars on the host and once on the device.
+
+    For sbmv M = N and the stored triangle is the band (KL, KU) = (0, K) (upper) or (K, 0)
+    (lower). Every element of the band array that is not part of the stored band of the M by N
+    matrix is NaN, so reading one of them shows up in the result.
+*/
+template <typename T>
+rocblas_status testing_band_mv(Arguments argus, const string& routine)
+{
+    bool sym     = routine.compare(0, 4, "sbmv") == 0;
+    bool batched = routine.find("batched") != string::npos;
+
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_fill uplo        = char2rocblas_fill(argus.uplo_option);
+
+    rocblas_int N           = argus.N;
+    rocblas_int M           = sym ? N : argus.M;
+    rocblas_int K           = argus.K;
+    rocblas_int KL          = sym ? (uplo == rocblas_fill_upper ? 0 : K) : argus.KL;
+    rocblas_int KU          = sym ? (uplo == rocblas_fill_upper ? K : 0) : argus.KU;
+    rocblas_int lda         = argus.lda;
+    rocblas_int incx        = argus.incx;
+    rocblas_int incy        = argus.incy;
+    rocblas_int batch_count = batched ? argus.batch_count : 1;
+
+    T h_alpha = (T)argus.alpha;
+    T h_beta  = (T)argus.beta;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check and quick return before allocating invalid memory
+    if(M <= 0 || N <= 0 || KL < 0 || KU < 0 || lda < KL + KU + 1 || 0 == incx || 0 == incy ||
+       batch_count <= 0)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dA || !dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        // the arrays of pointers are not dereferenced, any device memory will do
+        status = band_mv_call<T>(routine,
+                                 handle,
+                                 transA,
+                                 uplo,
+                                 M,
+                                 N,
+                                 KL,
+                                 KU,
+                                 K,
+                                 &h_alpha,
+                                 dA,
+                                 (T**)dA,
+                                 lda,
+                                 0,
+                                 dx,
+                                 (T**)dx,
+                                 incx,
+                                 0,
+                                 &h_beta,
+                                 dy,
+                                 (T**)dy,
+                                 incy,
+                                 0,
+                                 batch_count);
+
+        if(batch_count < 0)
+            blas1_batched_arg_check(status, batch_count);
+        else if(sym)
+            sbmv_arg_check(status, N, K, lda, incx, incy);
+        else
+            gbmv_arg_check(status, M, N, KL, KU, lda, incx, incy);
+
+        return status;
+    }
+
+    bool trans        = !sym && transA != rocblas_operation_none;
+    rocblas_int dim_x = trans ? M : N;
+    rocblas_int dim_y = trans ? N : M;
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // the problems of the batch are stored back to back
+    rocblas_int bsa = lda * N;
+    rocblas_int bsx = dim_x * abs_incx;
+    rocblas_int bsy = dim_y * abs_incy;
+
+    rocblas_int size_A = bsa * batch_count;
+    rocblas_int size_x = bsx * batch_count;
+    rocblas_int size_y = bsy * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hx(size_x);
+    vector<T> hy_1(size_y);
+    vector<T> hy_2(size_y);
+    vector<T> hy_gold(size_y);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_1_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                           rocblas_test::device_free};
+    auto dy_2_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                           rocblas_test::device_free};
+    auto dA_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto dx_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto dy_1_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto dy_2_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA          = (T*)dA_managed.get();
+    T* dx          = (T*)dx_managed.get();
+    T* dy_1        = (T*)dy_1_managed.get();
+    T* dy_2        = (T*)dy_2_managed.get();
+    T** dA_array   = (T**)dA_array_managed.get();
+    T** dx_array   = (T**)dx_array_managed.get();
+    T** dy_1_array = (T**)dy_1_array_managed.get();
+    T** dy_2_array = (T**)dy_2_array_managed.get();
+    T* d_alpha     = (T*)d_alpha_managed.get();
+    T* d_beta      = (T*)d_beta_managed.get();
+    if(!dA || !dx || !dy_1 || !dy_2 || !dA_array || !dx_array || !dy_1_array || !dy_2_array ||
+       !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hA, lda, N * batch_count, lda);
+    rocblas_init<T>(hx, 1, dim_x * batch_count, abs_incx);
+    rocblas_init<T>(hy_1, 1, dim_y * batch_count, abs_incy);
+
+    // band row d of column j holds A(j + d - KU, j)
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int d = 0; d < lda; d++)
+            {
+                rocblas_int i = j + d - KU;
+                if(d > KL + KU || i < 0 || i >= M)
+                    hA[b * bsa + d + j * lda] = std::numeric_limits<T>::quiet_NaN();
+            }
+        }
+    }
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // the array of pointers of _batched points at the problems of the strided batch
+    vector<T*> hA_array(batch_count), hx_array(batch_count);
+    vector<T*> hy_1_array(batch_count), hy_2_array(batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hA_array[b]   = dA + b * bsa;
+        hx_array[b]   = dx + b * bsx;
+        hy_1_array[b] = dy_1 + b * bsy;
+        hy_2_array[b] = dy_2 + b * bsy;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_1_array, hy_1_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_2_array, hy_2_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(band_mv_call<T>(routine,
+                                            handle,
+                                            transA,
+                                            uplo,
+                                            M,
+                                            N,
+                                            KL,
+                                            KU,
+                                            K,
+                                            &h_alpha,
+                                            dA,
+                                            dA_array,
+                                            lda,
+                                            bsa,
+                                            dx,
+                                            dx_array,
+                                            incx,
+                                            bsx,
+                                            &h_beta,
+                                            dy_1,
+                                            dy_1_array,
+                                            incy,
+                                            bsy,
+                                            batch_count));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(band_mv_call<T>(routine,
+                                            handle,
+                                            transA,
+                                            uplo,
+                                            M,
+                                            N,
+                                            KL,
+                                            KU,
+                                            K,
+                                            d_alpha,
+                                            dA,
+                                            dA_array,
+                                            lda,
+                                            bsa,
+                                            dx,
+                                            dx_array,
+                                            incx,
+                                            bsx,
+                                            d_beta,
+                                            dy_2,
+                                            dy_2_array,
+                                            incy,
+                                            bsy,
+                                            batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            if(sym)
+                cblas_sbmv<T>(uplo,
+                              N,
+                              K,
+                              h_alpha,
+                              hA.data() + b * bsa,
+                              lda,
+                              hx.data() + b * bsx,
+                              incx,
+                              h_beta,
+                              hy_gold.data() + b * bsy,
+                              incy);
+            else
+                cblas_gbmv<T>(transA,
+                              M,
+                              N,
+                              KL,
+                              KU,
+                              h_alpha,
+                              hA.data() + b * bsa,
+                              lda,
+                              hx.data() + b * bsx,
+                              incx,
+                              h_beta,
+                              hy_gold.data() + b * bsy,
+                              incy);
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = (sym ? sbmv_gflop_count<T>(N, K) : gbmv_gflop_count<T>(M, N, KL, KU)) *
+                       batch_count / cpu_time_used * 1e6;
+
+        // the inputs are small integers, the sums are exact in any order
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, dim_y * batch_count, abs_incy, hy_gold.data(), hy_1.data());
+            unit_check_general<T>(1, dim_y * batch_count, abs_incy, hy_gold.data(), hy_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', 1, dim_y * batch_count, abs_incy, hy_gold.data(), hy_1.data());
+            rocblas_error_2 = norm_check_general<T>(
+                'F', 1, dim_y * batch_count, abs_incy, hy_gold.data(), hy_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us(); // in microseconds
+
+            band_mv_call<T>(routine,
+                            handle,
+                            transA,
+                            uplo,
+                            M,
+                            N,
+                            KL,
+                            KU,
+                            K,
+                            &h_alpha,
+                            dA,
+                            dA_array,
+                            lda,
+                            bsa,
+                            dx,
+                            dx_array,
+                            incx,
+                            bsx,
+                            &h_beta,
+                            dy_1,
+                            dy_1_array,
+                            incy,
+                            bsy,
+                            batch_count);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = (sym ? sbmv_gflop_count<T>(N, K) : gbmv_gflop_count<T>(M, N, KL, KU)) *
+                         batch_count / gpu_time_used * 1e6;
+
+        cout << "routine,transA,uplo,M,N,KL,KU,lda,incx,incy,batch,rocblas-Gflops,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_device_ptr";
+
+        cout << endl;
+
+        cout << routine << ',' << argus.transA_option << ',' << argus.uplo_option << ',' << M
+             << ',' << N << ',' << KL << ',' << KU << ',' << lda << ',' << incx << ',' << incy
+             << ',' << batch_count << ',' << rocblas_gflops << ',' << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << cblas_gflops << ',' << cpu_time_used << ',' << rocblas_error_1 << ','
+                 << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,433 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "near.h"
+
+using namespace std;
+
+/*
+    one call of routine (scal, copy, swap, axpy, dot, asum, nrm2 or iamax) over the whole batch.
+    variant 0 is the _strided_batched routine, variant 1 the _batched routine on the array of
+    pointers to the same vectors, variant 2 a loop of batch_count calls of the single routine.
+*/
+template <typename T>
+rocblas_status blas1_batched_call(const string& routine,
+                                  int variant,
+                                  rocblas_handle handle,
+                                  rocblas_int N,
+                                  const T* alpha,
+                                  T* dx,
+                                  T* const* dx_array,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  T* dy,
+                                  T* const* dy_array,
+                                  rocblas_int incy,
+                                  rocblas_int bsy,
+                                  T* result,
+                                  rocblas_int* index,
+                                  rocblas_int batch_count)
+{
+    if(variant == 0)
+    {
+        if(routine == "scal")
+            return rocblas_scal_strided_batched<T>(handle, N, alpha, dx, incx, bsx, batch_count);
+        else if(routine == "copy")
+            return rocblas_copy_strided_batched<T>(
+                handle, N, dx, incx, bsx, dy, incy, bsy, batch_count);
+        else if(routine == "swap")
+            return rocblas_swap_strided_batched<T>(
+                handle, N, dx, incx, bsx, dy, incy, bsy, batch_count);
+        else if(routine == "axpy")
+            return rocblas_axpy_strided_batched<T>(
+                handle, N, alpha, dx, incx, bsx, dy, incy, bsy, batch_count);
+        else if(routine == "dot")
+            return rocblas_dot_strided_batched<T>(
+                handle, N, dx, incx, bsx, dy, incy, bsy, result, batch_count);
+        else if(routine == "asum")
+            return rocblas_asum_strided_batched<T>(handle, N, dx, incx, bsx, result, batch_count);
+        else if(routine == "nrm2")
+            return rocblas_nrm2_strided_batched<T>(handle, N, dx, incx, bsx, result, batch_count);
+        else if(routine == "iamax")
+            return rocblas_iamax_strided_batched<T>(handle, N, dx, incx, bsx, index, batch_count);
+    }
+    else if(variant == 1)
+    {
+        if(routine == "scal")
+            return rocblas_scal_batched<T>(handle, N, alpha, dx_array, incx, batch_count);
+        else if(routine == "copy")
+            return rocblas_copy_batched<T>(handle, N, dx_array, incx, dy_array, incy, batch_count);
+        else if(routine == "swap")
+            return rocblas_swap_batched<T>(handle, N, dx_array, incx, dy_array, incy, batch_count);
+        else if(routine == "axpy")
+            return rocblas_axpy_batched<T>(
+                handle, N, alpha, dx_array, incx, dy_array, incy, batch_count);
+        else if(routine == "dot")
+            return rocblas_dot_batched<T>(
+                handle, N, dx_array, incx, dy_array, incy, result, batch_count);
+        else if(routine == "asum")
+            return rocblas_asum_batched<T>(handle, N, dx_array, incx, result, batch_count);
+        else if(routine == "nrm2")
+            return rocblas_nrm2_batched<T>(handle, N, dx_array, incx, result, batch_count);
+        else if(routine == "iamax")
+            return rocblas_iamax_batched<T>(handle, N, dx_array, incx, index, batch_count);
+    }
+    else
+    {
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            T* x = dx + (size_t)b * bsx;
+            T* y = dy + (size_t)b * bsy;
+
+            rocblas_status status = rocblas_status_not_implemented;
+
+            if(routine == "scal")
+                status = rocblas_scal<T>(handle, N, alpha, x, incx);
+            else if(routine == "copy")
+                status = rocblas_copy<T>(handle, N, x, incx, y, incy);
+            else if(routine == "swap")
+                status = rocblas_swap<T>(handle, N, x, incx, y, incy);
+            else if(routine == "axpy")
+                status = rocblas_axpy<T>(handle, N, alpha, x, incx, y, incy);
+            else if(routine == "dot")
+                status = rocblas_dot<T>(handle, N, x, incx, y, incy, result + b);
+            else if(routine == "asum")
+                status = rocblas_asum<T, T>(handle, N, x, incx, result + b);
+            else if(routine == "nrm2")
+                status = rocblas_nrm2<T, T>(handle, N, x, incx, result + b);
+            else if(routine == "iamax")
+                status = rocblas_iamax<T>(handle, N, x, incx, index + b);
+
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    return rocblas_status_not_implemented;
+}
+
+template <typename T>
+rocblas_status testing_blas1_batched(Arguments argus, const string& routine)
+{
+    rocblas_int N           = argus.N;
+    rocblas_int incx        = argus.incx;
+    rocblas_int incy        = argus.incy;
+    rocblas_int batch_count = argus.batch_count;
+    T alpha                 = argus.alpha;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory, batch_count == 0 and N <= 0 are
+    // quick returns, batch_count < 0 is an invalid size
+    if(N <= 0 || batch_count <= 0)
+    {
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        vector<T> h_result(batch_count > 0 ? batch_count : 1);
+        vector<rocblas_int> h_index(batch_count > 0 ? batch_count : 1);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        status = blas1_batched_call<T>(routine,
+                                       0,
+                                       handle,
+                                       N,
+                                       &alpha,
+                                       dx,
+                                       nullptr,
+                                       incx,
+                                       0,
+                                       dy,
+                                       nullptr,
+                                       incy,
+                                       0,
+                                       h_result.data(),
+                                       h_index.data(),
+                                       batch_count);
+
+        blas1_batched_arg_check(status, batch_count);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // the vectors of the batch are packed, each one starts right after the previous one
+    rocblas_int bsx    = N * abs_incx;
+    rocblas_int bsy    = N * abs_incy;
+    rocblas_int size_x = bsx * batch_count;
+    rocblas_int size_y = bsy * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hx_1(size_x);
+    vector<T> hy_1(size_y);
+    vector<T> hx_gold(size_x);
+    vector<T> hy_gold(size_y);
+    vector<T> h_result(batch_count);
+    vector<T> h_result_gold(batch_count);
+    vector<rocblas_int> h_index(batch_count);
+    vector<rocblas_int> h_index_gold(batch_count);
+    vector<T*> hx_array(batch_count);
+    vector<T*> hy_array(batch_count);
+
+    double rocblas_error = 0.0;
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto dx_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto dy_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto d_result_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T) * batch_count), rocblas_test::device_free};
+    auto d_index_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * batch_count), rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dx                = (T*)dx_managed.get();
+    T* dy                = (T*)dy_managed.get();
+    T** dx_array         = (T**)dx_array_managed.get();
+    T** dy_array         = (T**)dy_array_managed.get();
+    T* d_result          = (T*)d_result_managed.get();
+    rocblas_int* d_index = (rocblas_int*)d_index_managed.get();
+    T* d_alpha           = (T*)d_alpha_managed.get();
+    if(!dx || !dy || !dx_array || !dy_array || !d_result || !d_index || !d_alpha)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hx, 1, size_x, 1);
+    rocblas_init<T>(hy, 1, size_y, 1);
+
+    // the array of pointers of _batched points at the vectors of the strided batch
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hx_array[b] = dx + (size_t)b * bsx;
+        hy_array[b] = dy + (size_t)b * bsy;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    bool writes_x      = routine == "scal" || routine == "swap";
+    bool writes_y      = routine == "copy" || routine == "swap" || routine == "axpy";
+    bool writes_result = routine == "dot" || routine == "asum" || routine == "nrm2";
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // CPU BLAS, one call per vector of the batch
+        hx_gold = hx;
+        hy_gold = hy;
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            T* x = hx_gold.data() + (size_t)b * bsx;
+            T* y = hy_gold.data() + (size_t)b * bsy;
+
+            if(routine == "scal")
+                cblas_scal<T>(N, alpha, x, incx);
+            else if(routine == "copy")
+                cblas_copy<T>(N, x, incx, y, incy);
+            else if(routine == "swap")
+                cblas_swap<T>(N, x, incx, y, incy);
+            else if(routine == "axpy")
+                cblas_axpy<T>(N, alpha, x, incx, y, incy);
+            else if(routine == "dot")
+                cblas_dot<T>(N, x, incx, y, incy, &h_result_gold[b]);
+            else if(routine == "asum")
+                cblas_asum<T, T>(N, x, incx, &h_result_gold[b]);
+            else if(routine == "nrm2")
+                cblas_nrm2<T, T>(N, x, incx, &h_result_gold[b]);
+            else if(routine == "iamax")
+                cblas_iamax<T>(N, x, incx, &h_index_gold[b]);
+        }
+
+        // _strided_batched in rocblas_pointer_mode_host, _batched in rocblas_pointer_mode_device
+        for(int variant = 0; variant < 2; variant++)
+        {
+            bool host = variant == 0;
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, host ? rocblas_pointer_mode_host : rocblas_pointer_mode_device));
+
+            CHECK_ROCBLAS_ERROR(blas1_batched_call<T>(routine,
+                                                      variant,
+                                                      handle,
+                                                      N,
+                                                      host ? &alpha : d_alpha,
+                                                      dx,
+                                                      dx_array,
+                                                      incx,
+                                                      bsx,
+                                                      dy,
+                                                      dy_array,
+                                                      incy,
+                                                      bsy,
+                                                      host ? h_result.data() : d_result,
+                                                      host ? h_index.data() : d_index,
+                                                      batch_count));
+
+            if(!host)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(
+                    h_result.data(), d_result, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(h_index.data(),
+                                          d_index,
+                                          sizeof(rocblas_int) * batch_count,
+                                          hipMemcpyDeviceToHost));
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+            if(argus.unit_check)
+            {
+                if(writes_x)
+                    unit_check_general<T>(1, size_x, 1, hx_gold.data(), hx_1.data());
+                if(writes_y)
+                    unit_check_general<T>(1, size_y, 1, hy_gold.data(), hy_1.data());
+
+                if(routine == "dot" || routine == "asum")
+                {
+                    unit_check_general<T>(1, batch_count, 1, h_result_gold.data(), h_result.data());
+                }
+                else if(routine == "nrm2")
+                {
+                    // nrm2 is accurate to about the square root of the precision, see testing_nrm2
+                    T max_norm = 0.0;
+                    for(rocblas_int b = 0; b < batch_count; b++)
+                        max_norm = max_norm > h_result_gold[b] ? max_norm : h_result_gold[b];
+
+                    T abs_error =
+                        2.0 * pow(10.0, -(std::numeric_limits<T>::digits10 / 2.0)) * max_norm;
+
+                    near_check_general<T, T>(
+                        1, batch_count, 1, h_result_gold.data(), h_result.data(), abs_error);
+                }
+                else if(routine == "iamax")
+                {
+                    unit_check_general<rocblas_int>(
+                        1, batch_count, 1, h_index_gold.data(), h_index.data());
+                }
+            }
+
+            if(argus.norm_check)
+            {
+                double error = 0.0;
+                if(writes_x)
+                    error = norm_check_general<T>('F', 1, size_x, 1, hx_gold.data(), hx_1.data());
+                if(writes_y)
+                    error = norm_check_general<T>('F', 1, size_y, 1, hy_gold.data(), hy_1.data());
+                if(writes_result)
+                    error = norm_check_general<T>(
+                        'F', 1, batch_count, 1, h_result_gold.data(), h_result.data());
+
+                rocblas_error = rocblas_error > error ? rocblas_error : error;
+            }
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        double time_used[3];
+
+        for(int variant = 0; variant < 3; variant++)
+        {
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[variant] = get_time_us(); // in microseconds
+                }
+
+                blas1_batched_call<T>(routine,
+                                      variant,
+                                      handle,
+                                      N,
+                                      d_alpha,
+                                      dx,
+                                      dx_array,
+                                      incx,
+                                      bsx,
+                                      dy,
+                                      dy_array,
+                                      incy,
+                                      bsy,
+                                      d_result,
+                                      d_index,
+                                      batch_count);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[variant] = (get_time_us() - time_used[variant]) / number_hot_calls;
+        }
+
+        cout << "routine,N,incx,incy,batch_count,strided_batched-us,batched-us,loop-us";
+
+        if(argus.norm_check)
+            cout << ",norm_error";
+
+        cout << endl;
+
+        cout << routine << ',' << N << ',' << incx << ',' << incy << ',' << batch_count << ','
+             << time_used[0] << ',' << time_used[1] << ',' << time_used[2];
+
+        if(argus.norm_check)
+            cout << ',' << rocblas_error;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,334 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "near.h"
+
+// the reductions sum in a different order than cblas, allow this many eps per element
+#define FUSED_EPS_MULTIPLIER 2
+
+using namespace std;
+
+/*
+    one call of the fused routine (axpy_dot, dot_nrm2 or scal_copy), or of the sequence of
+    unfused routines it replaces when fused is false. axpy_dot is called with z = y, the
+    residual update of conjugate gradients. result holds two values, the dot product and the
+    norm for dot_nrm2.
+*/
+template <typename T>
+rocblas_status blas1_fused_call(const string& routine,
+                                bool fused,
+                                rocblas_handle handle,
+                                rocblas_int N,
+                                const T* alpha,
+                                T* dx,
+                                rocblas_int incx,
+                                T* dy,
+                                rocblas_int incy,
+                                T* result)
+{
+    if(routine == "axpy_dot")
+    {
+        if(fused)
+            return rocblas_axpy_dot<T>(handle, N, alpha, dx, incx, dy, incy, dy, incy, result);
+
+        rocblas_status status = rocblas_axpy<T>(handle, N, alpha, dx, incx, dy, incy);
+        if(status != rocblas_status_success)
+            return status;
+        return rocblas_dot<T>(handle, N, dy, incy, dy, incy, result);
+    }
+    else if(routine == "dot_nrm2")
+    {
+        if(fused)
+            return rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, result, result + 1);
+
+        rocblas_status status = rocblas_dot<T>(handle, N, dx, incx, dy, incy, result);
+        if(status != rocblas_status_success)
+            return status;
+        return rocblas_nrm2<T, T>(handle, N, dx, incx, result + 1);
+    }
+    else if(routine == "scal_copy")
+    {
+        if(fused)
+            return rocblas_scal_copy<T>(handle, N, alpha, dx, incx, dy, incy);
+
+        rocblas_status status = rocblas_copy<T>(handle, N, dx, incx, dy, incy);
+        if(status != rocblas_status_success)
+            return status;
+        return rocblas_scal<T>(handle, N, alpha, dy, incy);
+    }
+
+    return rocblas_status_not_implemented;
+}
+
+template <typename T>
+rocblas_status testing_blas1_fused(Arguments argus, const string& routine)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+    T alpha          = argus.alpha;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory, N <= 0 is a quick return
+    if(N <= 0)
+    {
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        T h_result[2] = {1.0, 1.0};
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        status = blas1_fused_call<T>(
+            routine, true, handle, N, &alpha, dx, incx, dy, incy, h_result);
+
+        // the reductions return zero for an empty vector
+        if(status == rocblas_status_success && routine != "scal_copy")
+        {
+            T zero[2] = {0.0, 0.0};
+            unit_check_general<T>(1, routine == "dot_nrm2" ? 2 : 1, 1, zero, h_result);
+        }
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    rocblas_int size_x = N * abs_incx;
+    rocblas_int size_y = N * abs_incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hy_1(size_y);
+    vector<T> hy_gold(size_y);
+    T h_result[2];
+    T h_result_gold[2];
+
+    double gpu_time_used, unfused_time_used;
+    double rocblas_error = 0.0;
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto d_result_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * 2), rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dx       = (T*)dx_managed.get();
+    T* dy       = (T*)dy_managed.get();
+    T* d_result = (T*)d_result_managed.get();
+    T* d_alpha  = (T*)d_alpha_managed.get();
+    if(!dx || !dy || !d_result || !d_alpha)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    rocblas_init<T>(hy, 1, N, abs_incy);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    bool writes_y       = routine != "dot_nrm2";
+    rocblas_int results = routine == "dot_nrm2" ? 2 : routine == "axpy_dot" ? 1 : 0;
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // CPU BLAS, the unfused sequence
+        hy_gold = hy;
+
+        if(routine == "axpy_dot")
+        {
+            cblas_axpy<T>(N, alpha, hx.data(), incx, hy_gold.data(), incy);
+            cblas_dot<T>(N, hy_gold.data(), incy, hy_gold.data(), incy, &h_result_gold[0]);
+        }
+        else if(routine == "dot_nrm2")
+        {
+            // x * x rather than cblas_nrm2, which is zero for incx < 0
+            T sum_squares;
+            cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &h_result_gold[0]);
+            cblas_dot<T>(N, hx.data(), incx, hx.data(), incx, &sum_squares);
+            h_result_gold[1] = sqrt(sum_squares);
+        }
+        else if(routine == "scal_copy")
+        {
+            cblas_copy<T>(N, hx.data(), incx, hy_gold.data(), incy);
+            cblas_scal<T>(N, alpha, hy_gold.data(), incy);
+        }
+
+        // GPU BLAS in rocblas_pointer_mode_host, then in rocblas_pointer_mode_device
+        for(int mode = 0; mode < 2; mode++)
+        {
+            bool host = mode == 0;
+
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, host ? rocblas_pointer_mode_host : rocblas_pointer_mode_device));
+
+            CHECK_ROCBLAS_ERROR(blas1_fused_call<T>(routine,
+                                                    true,
+                                                    handle,
+                                                    N,
+                                                    host ? &alpha : d_alpha,
+                                                    dx,
+                                                    incx,
+                                                    dy,
+                                                    incy,
+                                                    host ? h_result : d_result));
+
+            if(!host && results > 0)
+            {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(h_result, d_result, sizeof(T) * results, hipMemcpyDeviceToHost));
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+            if(argus.unit_check)
+            {
+                if(writes_y)
+                    unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_1.data());
+
+                if(results > 0)
+                {
+                    // the data is positive, the dot product bounds the magnitude of the sums
+                    T abs_error = FUSED_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * N *
+                                  h_result_gold[0];
+
+                    near_check_general<T, T>(1, 1, 1, h_result_gold, h_result, abs_error);
+                }
+
+                if(results > 1)
+                {
+                    // nrm2 is accurate to about the square root of the precision, see testing_nrm2
+                    T abs_error = 2.0 * pow(10.0, -(std::numeric_limits<T>::digits10 / 2.0)) *
+                                  h_result_gold[1];
+
+                    near_check_general<T, T>(1, 1, 1, h_result_gold + 1, h_result + 1, abs_error);
+                }
+            }
+
+            if(argus.norm_check)
+            {
+                double error = 0.0;
+                if(writes_y)
+                    error = norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_1.data());
+                if(results > 0)
+                {
+                    double result_error =
+                        norm_check_general<T>('F', 1, results, 1, h_result_gold, h_result);
+                    error = error > result_error ? error : result_error;
+                }
+
+                rocblas_error = rocblas_error > error ? rocblas_error : error;
+            }
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+        double time_used[2];
+
+        // the fused routine, then the unfused sequence
+        for(int variant = 0; variant < 2; variant++)
+        {
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[variant] = get_time_us(); // in microseconds
+                }
+
+                blas1_fused_call<T>(
+                    routine, variant == 0, handle, N, d_alpha, dx, incx, dy, incy, d_result);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[variant] = (get_time_us() - time_used[variant]) / number_hot_calls;
+        }
+
+        gpu_time_used     = time_used[0];
+        unfused_time_used = time_used[1];
+
+        // vector elements moved by the fused routine and by the unfused sequence
+        double fused_elements, unfused_elements;
+        if(routine == "axpy_dot")
+        {
+            fused_elements   = 3.0 * N; // read x and y, write y
+            unfused_elements = 5.0 * N; // axpy, then dot reads y twice
+        }
+        else if(routine == "dot_nrm2")
+        {
+            fused_elements   = 2.0 * N; // read x and y
+            unfused_elements = 3.0 * N; // dot, then nrm2 reads x again
+        }
+        else
+        {
+            fused_elements   = 2.0 * N; // read x, write y
+            unfused_elements = 4.0 * N; // copy, then scal reads and writes y
+        }
+
+        double fused_bandwidth   = fused_elements * sizeof(T) / gpu_time_used / 1e3;
+        double unfused_bandwidth = unfused_elements * sizeof(T) / unfused_time_used / 1e3;
+
+        cout << "routine,N,incx,incy,fused-GB/s,fused-us,unfused-GB/s,unfused-us";
+
+        if(argus.norm_check)
+            cout << ",norm_error";
+
+        cout << endl;
+
+        cout << routine << ',' << N << ',' << incx << ',' << incy << ',' << fused_bandwidth << ','
+             << gpu_time_used << ',' << unfused_bandwidth << ',' << unfused_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << rocblas_error;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "unit.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+/*  host conversion, following the definition documented with rocblas_convert */
+
+template <typename T>
+rocblas_precision convert_precision();
+
+template <>
+inline rocblas_precision convert_precision<rocblas_half>()
+{
+    return rocblas_precision_half;
+}
+
+template <>
+inline rocblas_precision convert_precision<float>()
+{
+    return rocblas_precision_single;
+}
+
+template <>
+inline rocblas_precision convert_precision<double>()
+{
+    return rocblas_precision_double;
+}
+
+// the digits and the exponent of the smallest normal value of a precision
+template <typename T>
+struct convert_traits;
+
+template <>
+struct convert_traits<rocblas_half>
+{
+    static constexpr int digits  = 11;
+    static constexpr int min_exp = -14;
+};
+
+template <>
+struct convert_traits<float>
+{
+    static constexpr int digits  = 24;
+    static constexpr int min_exp = -126;
+};
+
+template <>
+struct convert_traits<double>
+{
+    static constexpr int digits  = 53;
+    static constexpr int min_exp = -1022;
+};
+
+inline uint32_t convert_random_bits(uint32_t seed, uint32_t k)
+{
+    uint32_t h = seed * 0x9E3779B9u + k;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h;
+}
+
+// a rounded to the values of To, returned in T
+template <typename To, typename T>
+T convert_round(T a, rocblas_rounding_mode rounding, uint32_t r)
+{
+    T m = std::abs(a);
+    if(!(m > 0) || std::isinf(m))
+        return a;
+
+    int e = std::ilogb(m);
+    if(e < convert_traits<To>::min_exp)
+        e = convert_traits<To>::min_exp;
+    e += 1 - convert_traits<To>::digits;
+
+    T q     = std::ldexp(m, -e);
+    T lower = std::floor(q);
+    T frac  = q - lower;
+
+    bool up;
+    if(rounding == rocblas_rounding_mode_stochastic)
+        up = std::ldexp((double)frac, 32) > (double)r;
+    else
+        up = frac > T(0.5) || (frac == T(0.5) && std::fmod(lower, T(2)) != 0);
+
+    return std::copysign(std::ldexp(lower + (up ? 1 : 0), e), a);
+}
+
+// y = v, exactly when v is a value of To
+template <typename T, typename To>
+void convert_store(T v, To& y)
+{
+    y = To(v);
+}
+
+template <typename T>
+void convert_store(T v, rocblas_half& y)
+{
+    y = float_to_half(float(v));
+}
+
+// the elements of x in the compute type Tc, halves eight at a time
+template <typename T, typename Tc>
+void convert_widen(const vector<T>& x, vector<Tc>& v)
+{
+    for(size_t k = 0; k < x.size(); k++)
+        v[k] = Tc(x[k]);
+}
+
+template <typename Tc>
+void convert_widen(const vector<rocblas_half>& x, vector<Tc>& v)
+{
+    vector<float> x_float(x.size());
+    half_to_float(x.size(), x.data(), x_float.data());
+    for(size_t k = 0; k < x.size(); k++)
+        v[k] = Tc(x_float[k]);
+}
+
+// the products v rounded to To, element k with the random bits of k
+template <typename Tc, typename To>
+void convert_narrow(const vector<Tc>& v,
+                    vector<To>& y,
+                    rocblas_rounding_mode rounding,
+                    uint32_t seed)
+{
+    for(size_t k = 0; k < v.size(); k++)
+    {
+        Tc value = v[k];
+        if(sizeof(To) < sizeof(Tc))
+        {
+            uint32_t r = rounding == rocblas_rounding_mode_stochastic
+                             ? convert_random_bits(seed, k)
+                             : 0;
+            value = convert_round<To>(value, rounding, r);
+        }
+        convert_store(value, y[k]);
+    }
+}
+
+/* ============================================================================================ */
+
+/*
+    the conversion of x of precision Ti into y of precision To by copy_ex, convert and
+    convert_matrix, checked bit for bit against the host. The data include values that round
+    to a tie, halves that underflow to subnormals and overflow to infinity, and the padding of
+    y must keep its values.
+*/
+template <typename Ti, typename To>
+rocblas_status testing_convert(Arguments argus, const string& routine)
+{
+    typedef typename std::conditional<std::is_same<Ti, double>::value ||
+                                          std::is_same<To, double>::value ||
+                                          std::is_same<To, rocblas_half>::value,
+                                      double,
+                                      float>::type Tc;
+
+    bool matrix = routine == "convert_matrix";
+    bool ex     = routine == "copy_ex";
+
+    rocblas_int M    = matrix ? argus.M : argus.N;
+    rocblas_int N    = matrix ? argus.N : 1;
+    rocblas_int incx = matrix ? 1 : argus.incx;
+    rocblas_int incy = matrix ? 1 : argus.incy;
+    rocblas_int lda  = matrix ? argus.lda : 0;
+    rocblas_int ldb  = matrix ? argus.ldb : 0;
+
+    rocblas_rounding_mode rounding = argus.rounding_option == 'S' && !ex
+                                         ? rocblas_rounding_mode_stochastic
+                                         : rocblas_rounding_mode_nearest;
+    uint32_t seed = argus.seed;
+
+    // alpha = 1 is passed as nullptr, no scaling
+    double h_alpha       = ex ? 1.0 : argus.alpha;
+    const double* alpha  = h_alpha == 1.0 ? nullptr : &h_alpha;
+    rocblas_precision xt = convert_precision<Ti>();
+    rocblas_precision yt = convert_precision<To>();
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    auto call = [&](const void* dx, void* dy) {
+        if(ex)
+            return rocblas_copy_ex(handle, M, dx, xt, incx, dy, yt, incy);
+        else if(!matrix)
+            return rocblas_convert(handle, rounding, seed, M, alpha, dx, xt, incx, dy, yt, incy);
+        return rocblas_convert_matrix(
+            handle, rounding, seed, M, N, alpha, dx, xt, lda, dy, yt, ldb);
+    };
+
+    // argument sanity check, quick return if input parameters are invalid before allocating
+    // invalid memory
+    if(M <= 0 || N <= 0 || (matrix && (lda < M || ldb < M)))
+    {
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(Ti) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(To) * safe_size),
+                                             rocblas_test::device_free};
+        Ti* dx = (Ti*)dx_managed.get();
+        To* dy = (To*)dy_managed.get();
+        if(!dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return call(dx, dy);
+    }
+
+    // the offsets of element (i, j), a vector with a negative increment starts at its end
+    auto offset = [&](rocblas_int i, rocblas_int j, rocblas_int inc, rocblas_int ld) {
+        return inc < 0 ? (size_t)((ptrdiff_t)(1 - M + i) * inc) : (size_t)i * inc + (size_t)j * ld;
+    };
+
+    size_t size_x = matrix ? (size_t)lda * N : (size_t)M * (incx < 0 ? -incx : incx);
+    size_t size_y = matrix ? (size_t)ldb * N : (size_t)M * (incy < 0 ? -incy : incy);
+    size_x        = size_x > 0 ? size_x : 1;
+    size_t count  = (size_t)M * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<Ti> hx(size_x);
+    vector<To> hy(size_y), hy_gold(size_y), hy_result(size_y);
+
+    // Initial Data on CPU: fractions of both signs, every 7th tiny and every 11th large, every
+    // 13th a tie between two values of To
+    srand(1);
+    for(size_t k = 0; k < size_x; k++)
+    {
+        double value = 20.0 * rand() / RAND_MAX - 10.0;
+        if(k % 7 == 0)
+            value *= 1e-6;
+        else if(k % 11 == 0)
+            value *= 1e4;
+        else if(k % 13 == 0)
+            value = 1.0 + (k % 2 ? 3 : 1) * std::ldexp(1.0, -convert_traits<To>::digits);
+        convert_store(value, hx[k]);
+    }
+    for(size_t k = 0; k < size_y; k++)
+        convert_store(double(k % 100), hy[k]);
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(Ti) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(To) * size_y),
+                                         rocblas_test::device_free};
+    Ti* dx = (Ti*)dx_managed.get();
+    To* dy = (To*)dy_managed.get();
+    if(!dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Ti) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(To) * size_y, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // CPU conversion: the products in Tc in the order of the random bits, then rounded
+        vector<Tc> hx_c(size_x), products(count);
+        vector<To> rounded(count);
+
+        convert_widen(hx, hx_c);
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                products[i + (size_t)j * M] = Tc(h_alpha) * hx_c[offset(i, j, incx, lda)];
+
+        convert_narrow(products, rounded, rounding, seed);
+
+        hy_gold = hy;
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                hy_gold[offset(i, j, incy, ldb)] = rounded[i + (size_t)j * M];
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(call(dx, dy));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_result.data(), dy, sizeof(To) * size_y, hipMemcpyDeviceToHost));
+
+        bitwise_check_general<To>(1, size_y, 1, hy_gold.data(), hy_result.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            call(dx, dy);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            call(dx, dy);
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        // every element is read and written once
+        double bytes             = (double)count * (sizeof(Ti) + sizeof(To));
+        double rocblas_bandwidth = bytes * number_hot_calls / gpu_time_used / 1e3;
+
+        cout << "M,N,incx,incy,lda,ldb,us,rocblas-GB/s" << endl;
+
+        cout << M << "," << N << "," << incx << "," << incy << "," << lda << "," << ldb << ","
+             << gpu_time_used / number_hot_calls << "," << rocblas_bandwidth << endl;
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    the conversions between the precisions h, s and d, routine is copy_ex, convert or
+    convert_matrix
+*/
+template <typename Ti>
+rocblas_status testing_convert(Arguments argus, const string& routine)
+{
+    if(argus.y_precision_option == 'h')
+        return testing_convert<Ti, rocblas_half>(argus, routine);
+    else if(argus.y_precision_option == 's')
+        return testing_convert<Ti, float>(argus, routine);
+    else if(argus.y_precision_option == 'd')
+        return testing_convert<Ti, double>(argus, routine);
+
+    return rocblas_status_not_implemented;
+}
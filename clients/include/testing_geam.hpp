@@ -455,7 +455,50 @@ rocblas_status testing_geam(Arguments argus)
         gpu_time_used  = get_time_us() - gpu_time_used;
         rocblas_gflops = geam_gflop_count<T>(M, N) * number_hot_calls / gpu_time_used * 1e6;
 
-        cout << "transA,transB,M,N,alpha,lda,beta,ldb,ldc,rocblas-Gflops,us";
+        // C is written, A and B are read unless their scalar is zero
+        double bytes             = (1.0 * M * N) * sizeof(T) * (1 + (h_alpha != 0) + (h_beta != 0));
+        double rocblas_bandwidth = bytes * number_hot_calls / gpu_time_used / 1e3;
+
+        // the same geam without transposes on contiguous matrices, the bandwidth to reach
+        bool transposed     = transA != rocblas_operation_none || transB != rocblas_operation_none;
+        double nn_bandwidth = 0;
+        if(transposed)
+        {
+            auto dA_nn_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * M * N),
+                                                    rocblas_test::device_free};
+            auto dB_nn_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * M * N),
+                                                    rocblas_test::device_free};
+            T* dA_nn = (T*)dA_nn_managed.get();
+            T* dB_nn = (T*)dB_nn_managed.get();
+            if(!dA_nn || !dB_nn)
+            {
+                PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+                return rocblas_status_memory_error;
+            }
+
+            rocblas_operation none = rocblas_operation_none;
+
+            for(int i = 0; i < number_cold_calls; i++)
+            {
+                rocblas_geam<T>(
+                    handle, none, none, M, N, &h_alpha, dA_nn, M, &h_beta, dB_nn, M, dC, ldc);
+            }
+
+            double nn_time_used = get_time_us(); // in microseconds
+            for(int i = 0; i < number_hot_calls; i++)
+            {
+                rocblas_geam<T>(
+                    handle, none, none, M, N, &h_alpha, dA_nn, M, &h_beta, dB_nn, M, dC, ldc);
+            }
+            nn_time_used = get_time_us() - nn_time_used;
+            nn_bandwidth = bytes * number_hot_calls / nn_time_used / 1e3;
+        }
+
+        cout << "transA,transB,M,N,alpha,lda,beta,ldb,ldc,rocblas-Gflops,us,rocblas-GB/s";
+        if(transposed)
+        {
+            cout << ",NN-GB/s";
+        }
         if(argus.unit_check || argus.norm_check)
         {
             cout << ",CPU-Gflops,us,norm_error_ptr_host,norm_error_ptr_dev";
@@ -464,7 +507,11 @@ rocblas_status testing_geam(Arguments argus)
 
         cout << argus.transA_option << argus.transB_option << "," << M << "," << N << "," << h_alpha
              << "," << lda << "," << h_beta << "," << ldb << "," << ldc << "," << rocblas_gflops
-             << "," << gpu_time_used << ",";
+             << "," << gpu_time_used << "," << rocblas_bandwidth << ",";
+        if(transposed)
+        {
+            cout << nn_bandwidth << ",";
+        }
 
         if(argus.unit_check || argus.norm_check)
         {
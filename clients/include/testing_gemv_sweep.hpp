@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "gemv_select.h"
+
+using namespace std;
+
+/*
+    bandwidth of gemv on the two skinny aspect ratios: short-wide (m = s, n = argus.N) and
+    tall-skinny (m = argus.N, n = s) for s = 1, 2, 4, ... up to argus.M, in both operations.
+    Each line names the kernel rocblas_gemv_select picks, so a drop in GB/s where the kernel
+    changes shows a threshold of gemv_select.h on the wrong side of the crossover.
+*/
+template <typename T>
+rocblas_status testing_gemv_sweep(Arguments argus)
+{
+    rocblas_int S_max = argus.M;
+    rocblas_int L     = argus.N;
+
+    int number_cold_calls = 2;
+    int number_hot_calls  = 10;
+
+    if(S_max <= 0 || L <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    static const char* kernel_names[] = {"tiled", "split_n", "column", "split_m", "thread_column"};
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    size_t size_A = (size_t)S_max * L;
+
+    vector<T> hA(size_A);
+    vector<T> hx(L);
+
+    srand(1);
+    rocblas_init<T>(hA, S_max, L, S_max);
+    rocblas_init<T>(hx, 1, L, 1);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * L), rocblas_test::device_free};
+    auto dy_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * L), rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+    if(!dA || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * L, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(T) * L));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    T alpha = 1.0;
+    T beta  = 0.0;
+
+    cout << "transA,M,N,kernel,us,GB/s" << endl;
+
+    for(rocblas_operation transA : {rocblas_operation_none, rocblas_operation_transpose})
+    {
+        for(int wide = 1; wide >= 0; wide--)
+        {
+            for(rocblas_int s = 1; s <= S_max; s *= 2)
+            {
+                rocblas_int m = wide ? s : L;
+                rocblas_int n = wide ? L : s;
+
+                double gpu_time_used = 0.0;
+
+                for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+                {
+                    if(iter == number_cold_calls)
+                    {
+                        CHECK_HIP_ERROR(hipDeviceSynchronize());
+                        gpu_time_used = get_time_us(); // in microseconds
+                    }
+
+                    rocblas_gemv<T>(handle, transA, m, n, &alpha, dA, m, dx, 1, &beta, dy, 1);
+                }
+
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+                gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+                // A, x and y are each moved once
+                double bandwidth = (1.0 * m * n + m + n) * sizeof(T) / gpu_time_used / 1e3;
+
+                cout << rocblas2char_operation(transA) << ',' << m << ',' << n << ','
+                     << kernel_names[rocblas_gemv_select(transA, m, n)] << ',' << gpu_time_used
+                     << ',' << bandwidth << endl;
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
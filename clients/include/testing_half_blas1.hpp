@@ -0,0 +1,312 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "near.h"
+#include "unit.h"
+
+using namespace std;
+
+/*
+    one call of the Level 1 routine: dot, asum and nrm2 write result, iamax writes index, scal
+    scales x by alpha
+*/
+template <typename T>
+rocblas_status half_blas1_call(const string& routine,
+                               rocblas_handle handle,
+                               rocblas_int N,
+                               const T* alpha,
+                               T* dx,
+                               rocblas_int incx,
+                               const T* dy,
+                               rocblas_int incy,
+                               T* result,
+                               rocblas_int* index)
+{
+    if(routine == "dot")
+        return rocblas_dot<T>(handle, N, dx, incx, dy, incy, result);
+    else if(routine == "asum")
+        return rocblas_asum<T, T>(handle, N, dx, incx, result);
+    else if(routine == "nrm2")
+        return rocblas_nrm2<T, T>(handle, N, dx, incx, result);
+    else if(routine == "iamax")
+        return rocblas_iamax<T>(handle, N, dx, incx, index);
+    else if(routine == "scal")
+        return rocblas_scal<T>(handle, N, alpha, dx, incx);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    the rocblas_half routines against the float reference of cblas on the data converted with
+    half_to_float. x is read once from an address aligned to half8 and once from the next
+    element, so that both the half8 loads and the element by element path run, in both pointer
+    modes. scal and iamax must match exactly; the sums are accumulated in float, so they must
+    be within a rounding to rocblas_half on either side plus the error of the float sums. The
+    timing compares the routine with the float routine on the converted data.
+*/
+template <typename T>
+rocblas_status testing_half_blas1(Arguments argus, const string& routine)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    // asum, nrm2, iamax and scal quick return for incx <= 0
+    if(N <= 0 || incx <= 0 || incy <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_int size_x = N * incx;
+    rocblas_int size_y = N * incy;
+    T h_alpha          = float_to_half(argus.alpha);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hx_gold(size_x);
+    vector<T> hx_result(size_x);
+
+    // x has one element to spare, x + 1 is not aligned to half8
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * (size_x + 1)),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_result_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_index_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                                              rocblas_test::device_free};
+    T* dx                = (T*)dx_managed.get();
+    T* dy                = (T*)dy_managed.get();
+    T* d_alpha           = (T*)d_alpha_managed.get();
+    T* d_result          = (T*)d_result_managed.get();
+    rocblas_int* d_index = (rocblas_int*)d_index_managed.get();
+    if(!dx || !dy || !d_alpha || !d_result || !d_index)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU, of both signs and magnitudes up to 1 / sqrt(N), so that the sums
+    // fit in rocblas_half
+    srand(1);
+    float scale = 2 / sqrt((float)N);
+    for(rocblas_int i = 0; i < size_x; i++)
+        hx[i] = float_to_half(((float)rand() / RAND_MAX - 0.5f) * scale);
+    for(rocblas_int i = 0; i < size_y; i++)
+        hy[i] = float_to_half(((float)rand() / RAND_MAX - 0.5f) * scale);
+
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // CPU BLAS, in float
+        T h_result_gold;
+        rocblas_int h_index_gold;
+        double magnitude = 0.0;
+
+        hx_gold = hx;
+
+        if(routine == "dot")
+        {
+            cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &h_result_gold);
+            for(rocblas_int i = 0; i < N; i++)
+                magnitude += fabs(half_to_float(hx[i * incx]) * half_to_float(hy[i * incy]));
+        }
+        else if(routine == "asum")
+        {
+            cblas_asum<T, T>(N, hx.data(), incx, &h_result_gold);
+            for(rocblas_int i = 0; i < N; i++)
+                magnitude += fabs(half_to_float(hx[i * incx]));
+        }
+        else if(routine == "nrm2")
+        {
+            cblas_nrm2<T, T>(N, hx.data(), incx, &h_result_gold);
+            for(rocblas_int i = 0; i < N; i++)
+                magnitude += half_to_float(hx[i * incx]) * half_to_float(hx[i * incx]);
+            magnitude = sqrt(magnitude);
+        }
+        else if(routine == "iamax")
+        {
+            cblas_iamax<T>(N, hx.data(), incx, &h_index_gold);
+            h_index_gold += 1; // Fortran 1 based index
+        }
+        else if(routine == "scal")
+        {
+            cblas_scal<T>(N, h_alpha, hx_gold.data(), incx);
+        }
+
+        // the rounding to rocblas_half of the result and of the reference, and the error of
+        // the sums in float of both
+        const float half_eps  = 0.0009765625; // 2^-10
+        const float float_eps = std::numeric_limits<float>::epsilon();
+        float abs_error       = (half_eps + 2 * N * float_eps) * magnitude;
+
+        for(rocblas_int offset = 0; offset < 2; offset++)
+        {
+            for(int mode = 0; mode < 2; mode++)
+            {
+                T h_result;
+                rocblas_int h_index;
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dx + offset, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+                if(mode == 0)
+                {
+                    // GPU BLAS, rocblas_pointer_mode_host
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                    CHECK_ROCBLAS_ERROR(half_blas1_call<T>(routine,
+                                                           handle,
+                                                           N,
+                                                           &h_alpha,
+                                                           dx + offset,
+                                                           incx,
+                                                           dy,
+                                                           incy,
+                                                           &h_result,
+                                                           &h_index));
+                }
+                else
+                {
+                    // GPU BLAS, rocblas_pointer_mode_device
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                    CHECK_ROCBLAS_ERROR(half_blas1_call<T>(routine,
+                                                           handle,
+                                                           N,
+                                                           d_alpha,
+                                                           dx + offset,
+                                                           incx,
+                                                           dy,
+                                                           incy,
+                                                           d_result,
+                                                           d_index));
+                    CHECK_HIP_ERROR(
+                        hipMemcpy(&h_result, d_result, sizeof(T), hipMemcpyDeviceToHost));
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        &h_index, d_index, sizeof(rocblas_int), hipMemcpyDeviceToHost));
+                }
+
+                if(routine == "scal")
+                {
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        hx_result.data(), dx + offset, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+                    unit_check_general<T>(1, N, incx, hx_gold.data(), hx_result.data());
+                }
+                else if(routine == "iamax")
+                {
+                    unit_check_general<rocblas_int>(1, 1, 1, &h_index_gold, &h_index);
+                }
+                else
+                {
+                    float result_gold = half_to_float(h_result_gold);
+                    float result      = half_to_float(h_result);
+                    near_check_general<float, float>(1, 1, 1, &result_gold, &result, abs_error);
+                }
+            }
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        // the float routine on the converted data
+        vector<float> hx_float(size_x);
+        vector<float> hy_float(size_y);
+        for(rocblas_int i = 0; i < size_x; i++)
+            hx_float[i] = half_to_float(hx[i]);
+        for(rocblas_int i = 0; i < size_y; i++)
+            hy_float[i] = half_to_float(hy[i]);
+
+        float h_alpha_float = half_to_float(h_alpha);
+
+        auto dx_float_managed = rocblas_unique_ptr{
+            rocblas_test::device_malloc(sizeof(float) * size_x), rocblas_test::device_free};
+        auto dy_float_managed = rocblas_unique_ptr{
+            rocblas_test::device_malloc(sizeof(float) * size_y), rocblas_test::device_free};
+        auto d_float_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(float) * 2),
+                                                  rocblas_test::device_free};
+        float* dx_float = (float*)dx_float_managed.get();
+        float* dy_float = (float*)dy_float_managed.get();
+        float* d_float  = (float*)d_float_managed.get();
+        if(!dx_float || !dy_float || !d_float)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dx_float, hx_float.data(), sizeof(float) * size_x, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dy_float, hy_float.data(), sizeof(float) * size_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_float, &h_alpha_float, sizeof(float), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        double time_used[2];
+
+        for(int precision = 0; precision < 2; precision++)
+        {
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[precision] = get_time_us(); // in microseconds
+                }
+
+                if(precision == 0)
+                    half_blas1_call<T>(
+                        routine, handle, N, d_alpha, dx, incx, dy, incy, d_result, d_index);
+                else
+                    half_blas1_call<float>(routine,
+                                           handle,
+                                           N,
+                                           d_float,
+                                           dx_float,
+                                           incx,
+                                           dy_float,
+                                           incy,
+                                           d_float + 1,
+                                           d_index);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[precision] = (get_time_us() - time_used[precision]) / number_hot_calls;
+        }
+
+        // dot reads two vectors, scal reads and writes x
+        double elements = (routine == "dot" || routine == "scal" ? 2.0 : 1.0) * N;
+
+        cout << "routine,N,incx,incy,half-us,half-GB/s,float-us,float-GB/s" << endl;
+
+        cout << routine << ',' << N << ',' << incx << ',' << incy << ',' << time_used[0] << ','
+             << elements * sizeof(T) / time_used[0] / 1e3 << ',' << time_used[1] << ','
+             << elements * sizeof(float) / time_used[1] / 1e3 << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "unit.h"
+
+using namespace std;
+
+/*
+    rocblas_host_result_mode_async: batch_count reductions (dot and asum of lengths 1 to N) are
+    issued in host pointer mode without a wait and their results delivered later. Checks the
+    rules of the result slots: a result is not written before it is delivered, delivery is
+    complete once the device is idle, a quick return is not overwritten by an older result,
+    going back to blocking and destroying the handle deliver everything in flight. The timing
+    compares a call in each mode.
+*/
+template <typename T>
+rocblas_status testing_host_result_mode(Arguments argus)
+{
+    rocblas_int N     = argus.N;
+    rocblas_int calls = argus.batch_count;
+
+    if(N <= 0 || calls <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(N);
+    vector<T> hy(N);
+    vector<T> h_result(calls);
+    vector<T> h_result_gold(calls);
+
+    auto dx_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * N), rocblas_test::device_free};
+    auto dy_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * N), rocblas_test::device_free};
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+    if(!dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hx, 1, N, 1);
+    rocblas_init<T>(hy, 1, N, 1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    if(argus.unit_check)
+    {
+        const T sentinel = -1.0;
+
+        // CPU BLAS
+        for(rocblas_int i = 0; i < calls; i++)
+        {
+            rocblas_int n = 1 + i % N;
+            if(i % 2 == 0)
+                cblas_dot<T>(n, hx.data(), 1, hy.data(), 1, &h_result_gold[i]);
+            else
+                cblas_asum<T, T>(n, hx.data(), 1, &h_result_gold[i]);
+            h_result[i] = sentinel;
+        }
+
+        rocblas_host_result_mode mode;
+        CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, rocblas_host_result_mode_async));
+        CHECK_ROCBLAS_ERROR(rocblas_get_host_result_mode(handle, &mode));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(rocblas_host_result_mode_async, mode);
+#endif
+
+        // GPU BLAS, every call returns without waiting
+        for(rocblas_int i = 0; i < calls; i++)
+        {
+            rocblas_int n = 1 + i % N;
+            if(i % 2 == 0)
+                CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, n, dx, 1, dy, 1, &h_result[i]));
+            else
+                CHECK_ROCBLAS_ERROR((rocblas_asum<T, T>(handle, n, dx, 1, &h_result[i])));
+        }
+
+        // the last result can only be delivered by a query or a sync
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(sentinel, h_result[calls - 1]);
+#endif
+
+        // once the device is idle one query delivers all results
+        rocblas_int pending = 0;
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_ROCBLAS_ERROR(rocblas_query_host_results(handle, &pending));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(0, pending);
+        EXPECT_EQ(rocblas_status_invalid_pointer, rocblas_query_host_results(handle, nullptr));
+#endif
+
+        unit_check_general<T>(1, calls, 1, h_result_gold.data(), h_result.data());
+
+        // a quick return writes its result at once, the older result in flight must not
+        // overwrite it
+        T h_quick = sentinel;
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, dy, 1, &h_quick));
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, 0, dx, 1, dy, 1, &h_quick));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(0.0, h_quick);
+#endif
+        CHECK_ROCBLAS_ERROR(rocblas_sync_host_results(handle));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(0.0, h_quick);
+#endif
+
+        // going back to blocking delivers the results in flight
+        T h_last = sentinel;
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx, 1, dy, 1, &h_last));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_host_result_mode(handle, rocblas_host_result_mode_blocking));
+
+        T h_last_gold;
+        cblas_dot<T>(N, hx.data(), 1, hy.data(), 1, &h_last_gold);
+
+        unit_check_general<T>(1, 1, 1, &h_last_gold, &h_last);
+
+        // so does destroying the handle
+        T h_destroyed = sentinel;
+        {
+            std::unique_ptr<rocblas_test::handle_struct> other(new rocblas_test::handle_struct);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_set_host_result_mode(other->handle, rocblas_host_result_mode_async));
+            CHECK_ROCBLAS_ERROR(rocblas_dot<T>(other->handle, 1, dx, 1, dy, 1, &h_destroyed));
+        }
+
+        unit_check_general<T>(1, 1, 1, &h_result_gold[0], &h_destroyed);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        double time_used[2];
+
+        for(int m = 0; m < 2; m++)
+        {
+            rocblas_host_result_mode mode =
+                m == 0 ? rocblas_host_result_mode_blocking : rocblas_host_result_mode_async;
+            CHECK_ROCBLAS_ERROR(rocblas_set_host_result_mode(handle, mode));
+
+            for(int iter = 0; iter < number_cold_calls; iter++)
+                rocblas_dot<T>(handle, N, dx, 1, dy, 1, &h_result[0]);
+
+            CHECK_ROCBLAS_ERROR(rocblas_sync_host_results(handle));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[m] = get_time_us(); // in microseconds
+
+            for(rocblas_int i = 0; i < calls; i++)
+                rocblas_dot<T>(handle, N, dx, 1, dy, 1, &h_result[i]);
+
+            CHECK_ROCBLAS_ERROR(rocblas_sync_host_results(handle));
+            time_used[m] = (get_time_us() - time_used[m]) / calls;
+        }
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_host_result_mode(handle, rocblas_host_result_mode_blocking));
+
+        cout << "N,calls,blocking-us-per-call,async-us-per-call" << endl;
+
+        cout << N << ',' << calls << ',' << time_used[0] << ',' << time_used[1] << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <vector>
+#include <cmath> // std::abs
 
 #include "rocblas.hpp"
 #include "arg_check.h"
@@ -124,17 +125,11 @@ rocblas_status testing_iamin(Arguments argus)
 
     // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory, plz follow this practice
     vector<T> hx(size_x);
-    vector<T> hx_negated(size_x);
 
     // Initial Data on CPU
     srand(1);
     rocblas_init<T>(hx, 1, N, incx);
 
-    for(int i = 0; i < N; i++)
-    {
-        hx_negated[i] = hx[i];
-    }
-
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
 
@@ -153,11 +148,17 @@ rocblas_status testing_iamin(Arguments argus)
             &h_rocblas_result_2, d_rocblas_result, sizeof(rocblas_int), hipMemcpyDeviceToHost));
 
         // CPU BLAS
+        // CBLAS has no iamin, take the first index of the smallest magnitude
         cpu_time_used = get_time_us();
-        cblas_iamax<T>(N, hx_negated.data(), incx, &cpu_result);
+        cpu_result    = 0;
+        for(int i = 1; i < N; i++)
+        {
+            if(std::abs(hx[i * incx]) < std::abs(hx[cpu_result * incx]))
+                cpu_result = i;
+        }
 
         cpu_time_used = get_time_us() - cpu_time_used;
-        cpu_result += 1; // make index 1 based as in Fortran BLAS, not 0 based as in CBLAS
+        cpu_result += 1; // make index 1 based as in Fortran BLAS, not 0 based as in C
 
         if(argus.unit_check)
         {
@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+
+using namespace std;
+
+/*
+    maxpy computes y += V * alpha for K columns; the reference is a loop of cblas_axpy over the
+    columns. The timing compares maxpy with the K axpy calls and the gemv it replaces.
+*/
+template <typename T>
+rocblas_status testing_maxpy(Arguments argus)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int K    = argus.K;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incy = argus.incy;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K <= 0 || lda < N || lda < 1 || 0 == incy)
+    {
+        auto dV_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dV = (T*)dV_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dV || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        vector<T> h_alpha(K > 0 ? K : 1);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        status = rocblas_maxpy<T>(handle, N, K, h_alpha.data(), dV, lda, dy, incy);
+
+        mdot_maxpy_arg_check(status, N, K, lda, incy);
+
+        return status;
+    }
+
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    rocblas_int size_V = lda * K;
+    rocblas_int size_y = N * abs_incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hV(size_V);
+    vector<T> hy(size_y);
+    vector<T> hy_1(size_y);
+    vector<T> hy_2(size_y);
+    vector<T> hy_gold(size_y);
+    vector<T> h_alpha(K);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dV_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_V),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * K), rocblas_test::device_free};
+    T* dV      = (T*)dV_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    if(!dV || !dy || !d_alpha)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hV, N, K, lda);
+    rocblas_init<T>(hy, 1, N, abs_incy);
+
+    // small integer scalars, of both signs and zero, keep the sums exact
+    for(rocblas_int j = 0; j < K; j++)
+        h_alpha[j] = argus.alpha * ((j % 4) - 1);
+
+    hy_1    = hy;
+    hy_2    = hy;
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dV, hV.data(), sizeof(T) * size_V, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, h_alpha.data(), sizeof(T) * K, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_maxpy<T>(handle, N, K, h_alpha.data(), dV, lda, dy, incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_2.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_maxpy<T>(handle, N, K, d_alpha, dV, lda, dy, incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS, one axpy per column
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int j = 0; j < K; j++)
+            cblas_axpy<T>(N, h_alpha[j], hV.data() + j * lda, 1, hy_gold.data(), incy);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_1.data());
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_maxpy<T>(handle, N, K, d_alpha, dV, lda, dy, incy);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_maxpy<T>(handle, N, K, d_alpha, dV, lda, dy, incy);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // K separate axpy calls
+        double axpy_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            for(rocblas_int j = 0; j < K; j++)
+                rocblas_axpy<T>(handle, N, d_alpha + j, dV + j * lda, 1, dy, incy);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        axpy_time_used = (get_time_us() - axpy_time_used) / number_hot_calls;
+
+        // the gemv, y = V * alpha + y
+        T one = 1.0;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        double gemv_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv<T>(
+                handle, rocblas_operation_none, N, K, &one, dV, lda, d_alpha, 1, &one, dy, incy);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gemv_time_used = (get_time_us() - gemv_time_used) / number_hot_calls;
+
+        // V is read once, y read and written once
+        double rocblas_bandwidth = (double)(N * K + 2 * N) * sizeof(T) / gpu_time_used / 1e3;
+
+        cout << "N,K,lda,incy,rocblas-GB/s,us,axpy-loop-us,gemv-N-us";
+
+        if(argus.norm_check)
+            cout << ",CPU-us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << N << ',' << K << ',' << lda << ',' << incy << ',' << rocblas_bandwidth << ','
+             << gpu_time_used << ',' << axpy_time_used << ',' << gemv_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << cpu_time_used << ',' << rocblas_error_1 << ',' << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,231 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "near.h"
+
+// the kernel sums in a different order than cblas, allow this many eps per element of a column
+#define MDOT_EPS_MULTIPLIER 2
+
+using namespace std;
+
+/*
+    mdot computes the K dot products V(:, j) * x; the reference is a loop of cblas_dot over the
+    columns. The timing compares mdot with the K dot calls and the transposed gemv it replaces.
+*/
+template <typename T>
+rocblas_status testing_mdot(Arguments argus)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int K    = argus.K;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K <= 0 || lda < N || lda < 1 || 0 == incx)
+    {
+        auto dV_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dV = (T*)dV_managed.get();
+        T* dx = (T*)dx_managed.get();
+        if(!dV || !dx)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        vector<T> h_result(K > 0 ? K : 1);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        status = rocblas_mdot<T>(handle, N, K, dV, lda, dx, incx, h_result.data());
+
+        mdot_maxpy_arg_check(status, N, K, lda, incx);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+
+    rocblas_int size_V = lda * K;
+    rocblas_int size_x = N * abs_incx;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hV(size_V);
+    vector<T> hx(size_x);
+    vector<T> h_result_1(K);
+    vector<T> h_result_2(K);
+    vector<T> h_result_gold(K);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dV_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_V),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto d_result_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * K), rocblas_test::device_free};
+    T* dV       = (T*)dV_managed.get();
+    T* dx       = (T*)dx_managed.get();
+    T* d_result = (T*)d_result_managed.get();
+    if(!dV || !dx || !d_result)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hV, N, K, lda);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dV, hV.data(), sizeof(T) * size_V, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, dV, lda, dx, incx, h_result_1.data()));
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, dV, lda, dx, incx, d_result));
+        CHECK_HIP_ERROR(
+            hipMemcpy(h_result_2.data(), d_result, sizeof(T) * K, hipMemcpyDeviceToHost));
+
+        // CPU BLAS, one dot per column
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int j = 0; j < K; j++)
+            cblas_dot<T>(N, hV.data() + j * lda, 1, hx.data(), incx, &h_result_gold[j]);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        if(argus.unit_check)
+        {
+            // the data is positive, the largest result bounds the magnitude of the sums
+            T max_result = 0.0;
+            for(rocblas_int j = 0; j < K; j++)
+                max_result = max_result > h_result_gold[j] ? max_result : h_result_gold[j];
+
+            T abs_error = MDOT_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * N * max_result;
+
+            near_check_general<T, T>(1, K, 1, h_result_gold.data(), h_result_1.data(), abs_error);
+            near_check_general<T, T>(1, K, 1, h_result_gold.data(), h_result_2.data(), abs_error);
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, K, 1, h_result_gold.data(), h_result_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, K, 1, h_result_gold.data(), h_result_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_mdot<T>(handle, N, K, dV, lda, dx, incx, d_result);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_mdot<T>(handle, N, K, dV, lda, dx, incx, d_result);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // K separate dot calls
+        double dot_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            for(rocblas_int j = 0; j < K; j++)
+                rocblas_dot<T>(handle, N, dV + j * lda, 1, dx, incx, d_result + j);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        dot_time_used = (get_time_us() - dot_time_used) / number_hot_calls;
+
+        // the transposed gemv, result = V^T * x
+        T one  = 1.0;
+        T zero = 0.0;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        double gemv_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv<T>(handle,
+                            rocblas_operation_transpose,
+                            N,
+                            K,
+                            &one,
+                            dV,
+                            lda,
+                            dx,
+                            incx,
+                            &zero,
+                            d_result,
+                            1);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gemv_time_used = (get_time_us() - gemv_time_used) / number_hot_calls;
+
+        // V and x are read once
+        double rocblas_bandwidth = (double)(N * K + N) * sizeof(T) / gpu_time_used / 1e3;
+
+        cout << "N,K,lda,incx,rocblas-GB/s,us,dot-loop-us,gemv-T-us";
+
+        if(argus.norm_check)
+            cout << ",CPU-us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << N << ',' << K << ',' << lda << ',' << incx << ',' << rocblas_bandwidth << ','
+             << gpu_time_used << ',' << dot_time_used << ',' << gemv_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << cpu_time_used << ',' << rocblas_error_1 << ',' << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,581 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "near.h"
+#include "unit.h"
+
+// trsm solves with division, allow this many eps per element of the solved dimension
+#define ORDER_TRSM_EPS_MULTIPLIER 40
+
+using namespace std;
+
+/*
+    the routines taking a rocblas_order against host references written for either storage: the
+    element (i, j) of a matrix with leading dimension ld is at i + j * ld by columns and at
+    i * ld + j by rows. The data are small integers, so every routine but trsm is exact. The
+    padding of the leading dimensions is compared too, it must not be written.
+*/
+
+// the offset of the element (i, j)
+inline size_t order_index(rocblas_order order, rocblas_int i, rocblas_int j, rocblas_int ld)
+{
+    return order == rocblas_order_row_major ? (size_t)i * ld + j : i + (size_t)j * ld;
+}
+
+// the elements of a rows by cols matrix, the lines of the order are ld apart
+inline size_t order_size(rocblas_order order, rocblas_int rows, rocblas_int cols, rocblas_int ld)
+{
+    return order == rocblas_order_row_major ? (size_t)rows * ld : (size_t)cols * ld;
+}
+
+// the leading dimension is valid for a rows by cols matrix
+inline bool order_ld_valid(rocblas_order order, rocblas_int rows, rocblas_int cols, rocblas_int ld)
+{
+    return ld >= 1 && ld >= (order == rocblas_order_row_major ? cols : rows);
+}
+
+template <typename T>
+rocblas_status testing_gemm_order(Arguments argus)
+{
+    rocblas_order order      = char2rocblas_order(argus.order_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_operation transB = char2rocblas_operation(argus.transB_option);
+
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int K   = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldc = argus.ldc;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    if(M <= 0 || N <= 0 || K <= 0 || !order_ld_valid(order, A_row, A_col, lda) ||
+       !order_ld_valid(order, B_row, B_col, ldb) || !order_ld_valid(order, M, N, ldc))
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        if(!dA)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocblas_gemm_order<T>(
+            handle, order, transA, transB, M, N, K, &h_alpha, dA, lda, dA, ldb, &h_beta, dA, ldc);
+    }
+
+    size_t size_A = order_size(order, A_row, A_col, lda);
+    size_t size_B = order_size(order, B_row, B_col, ldb);
+    size_t size_C = order_size(order, M, N, ldc);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C);
+
+    srand(1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hB, 1, size_B, 1);
+    rocblas_init<T>(hC, 1, size_C, 1);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_C),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+    if(!dA || !dB || !dC)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+    // CPU reference
+    hC_gold = hC;
+    for(rocblas_int i = 0; i < M; i++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            T sum = 0;
+            for(rocblas_int l = 0; l < K; l++)
+            {
+                T a = transA == rocblas_operation_none ? hA[order_index(order, i, l, lda)]
+                                                       : hA[order_index(order, l, i, lda)];
+                T b = transB == rocblas_operation_none ? hB[order_index(order, l, j, ldb)]
+                                                       : hB[order_index(order, j, l, ldb)];
+                sum += a * b;
+            }
+            size_t c   = order_index(order, i, j, ldc);
+            hC_gold[c] = h_alpha * sum + h_beta * hC[c];
+        }
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_order<T>(
+        handle, order, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+    unit_check_general<T>(1, size_C, 1, hC_gold.data(), hC.data());
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status testing_gemv_order(Arguments argus)
+{
+    rocblas_order order      = char2rocblas_order(argus.order_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+
+    rocblas_int M    = argus.M;
+    rocblas_int N    = argus.N;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    if(M <= 0 || N <= 0 || incx <= 0 || incy <= 0 || !order_ld_valid(order, M, N, lda))
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        if(!dA)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocblas_gemv_order<T>(
+            handle, order, transA, M, N, &h_alpha, dA, lda, dA, incx, &h_beta, dA, incy);
+    }
+
+    rocblas_int len_x = transA == rocblas_operation_none ? N : M;
+    rocblas_int len_y = transA == rocblas_operation_none ? M : N;
+
+    size_t size_A = order_size(order, M, N, lda);
+    size_t size_x = (size_t)len_x * incx;
+    size_t size_y = (size_t)len_y * incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A), hx(size_x), hy(size_y), hy_gold(size_y);
+
+    srand(1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hx, 1, size_x, 1);
+    rocblas_init<T>(hy, 1, size_y, 1);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+    if(!dA || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    // CPU reference
+    hy_gold = hy;
+    for(rocblas_int i = 0; i < len_y; i++)
+    {
+        T sum = 0;
+        for(rocblas_int j = 0; j < len_x; j++)
+        {
+            T a = transA == rocblas_operation_none ? hA[order_index(order, i, j, lda)]
+                                                   : hA[order_index(order, j, i, lda)];
+            sum += a * hx[(size_t)j * incx];
+        }
+        hy_gold[(size_t)i * incy] = h_alpha * sum + h_beta * hy[(size_t)i * incy];
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_gemv_order<T>(
+        handle, order, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+    unit_check_general<T>(1, size_y, 1, hy_gold.data(), hy.data());
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status testing_ger_order(Arguments argus)
+{
+    rocblas_order order = char2rocblas_order(argus.order_option);
+
+    rocblas_int M    = argus.M;
+    rocblas_int N    = argus.N;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    T h_alpha = argus.alpha;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    if(M <= 0 || N <= 0 || incx <= 0 || incy <= 0 || !order_ld_valid(order, M, N, lda))
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        if(!dA)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocblas_ger_order<T>(handle, order, M, N, &h_alpha, dA, incx, dA, incy, dA, lda);
+    }
+
+    size_t size_A = order_size(order, M, N, lda);
+    size_t size_x = (size_t)M * incx;
+    size_t size_y = (size_t)N * incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A), hA_gold(size_A), hx(size_x), hy(size_y);
+
+    srand(1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hx, 1, size_x, 1);
+    rocblas_init<T>(hy, 1, size_y, 1);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+    if(!dA || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    // CPU reference
+    hA_gold = hA;
+    for(rocblas_int i = 0; i < M; i++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            size_t a = order_index(order, i, j, lda);
+            hA_gold[a] += h_alpha * hx[(size_t)i * incx] * hy[(size_t)j * incy];
+        }
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(
+        rocblas_ger_order<T>(handle, order, M, N, &h_alpha, dx, incx, dy, incy, dA, lda));
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+    unit_check_general<T>(1, size_A, 1, hA_gold.data(), hA.data());
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status testing_geam_order(Arguments argus)
+{
+    rocblas_order order      = char2rocblas_order(argus.order_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_operation transB = char2rocblas_operation(argus.transB_option);
+
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldc = argus.ldc;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : N;
+    rocblas_int A_col = transA == rocblas_operation_none ? N : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? M : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : M;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    if(M <= 0 || N <= 0 || !order_ld_valid(order, A_row, A_col, lda) ||
+       !order_ld_valid(order, B_row, B_col, ldb) || !order_ld_valid(order, M, N, ldc))
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dC = (T*)dC_managed.get();
+        if(!dA || !dC)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocblas_geam_order<T>(
+            handle, order, transA, transB, M, N, &h_alpha, dA, lda, &h_beta, dA, ldb, dC, ldc);
+    }
+
+    size_t size_A = order_size(order, A_row, A_col, lda);
+    size_t size_B = order_size(order, B_row, B_col, ldb);
+    size_t size_C = order_size(order, M, N, ldc);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C);
+
+    srand(1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hB, 1, size_B, 1);
+    rocblas_init<T>(hC, 1, size_C, 1);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_C),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+    if(!dA || !dB || !dC)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+    // CPU reference, the padding of C keeps its values
+    hC_gold = hC;
+    for(rocblas_int i = 0; i < M; i++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            T a = transA == rocblas_operation_none ? hA[order_index(order, i, j, lda)]
+                                                   : hA[order_index(order, j, i, lda)];
+            T b = transB == rocblas_operation_none ? hB[order_index(order, i, j, ldb)]
+                                                   : hB[order_index(order, j, i, ldb)];
+            hC_gold[order_index(order, i, j, ldc)] = h_alpha * a + h_beta * b;
+        }
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_geam_order<T>(
+        handle, order, transA, transB, M, N, &h_alpha, dA, lda, &h_beta, dB, ldb, dC, ldc));
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+    unit_check_general<T>(1, size_C, 1, hC_gold.data(), hC.data());
+
+    return rocblas_status_success;
+}
+
+/*
+    trsm: X is known, B is computed from it on the host and the solve must return X. The triangle
+    of A that is not referenced, and its diagonal when unit, hold large values that would show in
+    X if they were read.
+*/
+template <typename T>
+rocblas_status testing_trsm_order(Arguments argus)
+{
+    rocblas_order order      = char2rocblas_order(argus.order_option);
+    rocblas_side side        = char2rocblas_side(argus.side_option);
+    rocblas_fill uplo        = char2rocblas_fill(argus.uplo_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_diagonal diag    = char2rocblas_diagonal(argus.diag_option);
+
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int K   = side == rocblas_side_left ? M : N;
+
+    T h_alpha = argus.alpha;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    if(M <= 0 || N <= 0 || !order_ld_valid(order, K, K, lda) || !order_ld_valid(order, M, N, ldb))
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dB = (T*)dB_managed.get();
+        if(!dA || !dB)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocblas_trsm_order<T>(
+            handle, order, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb);
+    }
+
+    size_t size_A = order_size(order, K, K, lda);
+    size_t size_B = order_size(order, M, N, ldb);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A), hX(size_B), hB(size_B);
+
+    // the referenced triangle is small off the diagonal and 2 on it, A is well conditioned
+    srand(1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hX, 1, size_B, 1);
+    for(rocblas_int i = 0; i < K; i++)
+    {
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            size_t a        = order_index(order, i, j, lda);
+            bool referenced = uplo == rocblas_fill_upper ? i < j : i > j;
+            if(i == j)
+                hA[a] = diag == rocblas_diagonal_unit ? 1000 : 2;
+            else if(referenced)
+                hA[a] = hA[a] / (10 * K);
+            else
+                hA[a] = 1000;
+        }
+    }
+
+    // op( A )(i, j) as trsm reads it
+    auto op_A = [&](rocblas_int i, rocblas_int j) -> T {
+        if(transA != rocblas_operation_none)
+            std::swap(i, j);
+        if(i == j)
+            return diag == rocblas_diagonal_unit ? 1 : hA[order_index(order, i, i, lda)];
+        else if(uplo == rocblas_fill_upper ? i < j : i > j)
+            return hA[order_index(order, i, j, lda)];
+        return 0;
+    };
+
+    // B = op( A ) * X / alpha or X * op( A ) / alpha, the padding of B is that of X
+    hB = hX;
+    for(rocblas_int i = 0; i < M; i++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            T sum = 0;
+            for(rocblas_int l = 0; l < K; l++)
+            {
+                if(side == rocblas_side_left)
+                    sum += op_A(i, l) * hX[order_index(order, l, j, ldb)];
+                else
+                    sum += hX[order_index(order, i, l, ldb)] * op_A(l, j);
+            }
+            hB[order_index(order, i, j, ldb)] = sum / h_alpha;
+        }
+    }
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dB = (T*)dB_managed.get();
+    if(!dA || !dB)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_trsm_order<T>(
+        handle, order, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
+
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+    // the entries of X are at most 10
+    T eps = std::numeric_limits<T>::epsilon();
+    near_check_general<T, T>(
+        1, size_B, 1, hX.data(), hB.data(), ORDER_TRSM_EPS_MULTIPLIER * K * eps * 10);
+
+    return rocblas_status_success;
+}
+
+/*
+    the _order routines, routine is gemm_order, gemv_order, ger_order, geam_order or trsm_order;
+    gemm and trsm need Tensile
+*/
+template <typename T>
+rocblas_status testing_order(Arguments argus, const string& routine)
+{
+    if(routine == "gemv_order")
+        return testing_gemv_order<T>(argus);
+    else if(routine == "ger_order")
+        return testing_ger_order<T>(argus);
+    else if(routine == "geam_order")
+        return testing_geam_order<T>(argus);
+#if BUILD_WITH_TENSILE
+    else if(routine == "gemm_order")
+        return testing_gemm_order<T>(argus);
+    else if(routine == "trsm_order")
+        return testing_trsm_order<T>(argus);
+#endif
+
+    return rocblas_status_not_implemented;
+}
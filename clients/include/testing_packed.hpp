@@ -0,0 +1,449 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "near.h"
+#include "flops.h"
+
+// the kernel may sum in a different order and with fma, allow this many eps per unit of N
+#define TPSV_EPS_MULTIPLIER 40
+
+using namespace std;
+
+/*
+    one call of a packed routine, spmv, spr, spr2, tpmv, tpsv or tpttr. Each one only uses the
+    arguments of its own signature.
+*/
+template <typename T>
+rocblas_status packed_call(const string& routine,
+                           rocblas_handle handle,
+                           rocblas_fill uplo,
+                           rocblas_operation transA,
+                           rocblas_diagonal diag,
+                           rocblas_int N,
+                           const T* alpha,
+                           T* dAP,
+                           T* dx,
+                           rocblas_int incx,
+                           const T* beta,
+                           T* dy,
+                           rocblas_int incy,
+                           T* dA,
+                           rocblas_int lda)
+{
+    if(routine == "spmv")
+        return rocblas_spmv<T>(handle, uplo, N, alpha, dAP, dx, incx, beta, dy, incy);
+    else if(routine == "spr")
+        return rocblas_spr<T>(handle, uplo, N, alpha, dx, incx, dAP);
+    else if(routine == "spr2")
+        return rocblas_spr2<T>(handle, uplo, N, alpha, dx, incx, dy, incy, dAP);
+    else if(routine == "tpmv")
+        return rocblas_tpmv<T>(handle, uplo, transA, diag, N, dAP, dx, incx);
+    else if(routine == "tpsv")
+        return rocblas_tpsv<T>(handle, uplo, transA, diag, N, dAP, dx, incx);
+    else if(routine == "tpttr")
+        return rocblas_tpttr<T>(handle, uplo, N, dAP, dA, lda);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    the packed routines against cblas, tpttr against a host loop. The routines with scalars run
+    once with them on the host and once on the device.
+
+    Packed storage has no gaps to poison; the diagonal is NaN when a triangular matrix is unit,
+    so reading it shows up in the result. With timing the achieved bandwidth is printed, for
+    spmv and spr also the time of tpttr followed by the full storage symv or syr.
+*/
+template <typename T>
+rocblas_status testing_packed(Arguments argus, const string& routine)
+{
+    bool scalars = routine == "spmv" || routine == "spr" || routine == "spr2";
+    bool tri     = routine == "tpmv" || routine == "tpsv";
+    bool unpack  = routine == "tpttr";
+    bool uses_y  = routine == "spmv" || routine == "spr2";
+
+    rocblas_fill uplo        = char2rocblas_fill(argus.uplo_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_diagonal diag    = char2rocblas_diagonal(argus.diag_option);
+
+    rocblas_int N    = argus.N;
+    rocblas_int incx = unpack ? 1 : argus.incx;
+    rocblas_int incy = uses_y ? argus.incy : 1;
+    rocblas_int lda  = unpack ? argus.lda : (N > 1 ? N : 1);
+
+    T h_alpha = (T)argus.alpha;
+    T h_beta  = (T)argus.beta;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check and quick return before allocating invalid memory
+    if(N <= 0 || lda < N || 0 == incx || 0 == incy)
+    {
+        auto dAP_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                              rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dAP = (T*)dAP_managed.get();
+        T* dx  = (T*)dx_managed.get();
+        T* dy  = (T*)dy_managed.get();
+        if(!dAP || !dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = packed_call<T>(routine,
+                                handle,
+                                uplo,
+                                transA,
+                                diag,
+                                N,
+                                &h_alpha,
+                                dAP,
+                                dx,
+                                incx,
+                                &h_beta,
+                                dy,
+                                incy,
+                                dy,
+                                lda);
+
+        packed_arg_check(status, N, lda, incx, incy);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    rocblas_int size_AP = N * (N + 1) / 2;
+    rocblas_int size_x  = N * abs_incx;
+    rocblas_int size_y  = N * abs_incy;
+    rocblas_int size_A  = unpack ? lda * N : 1;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hAP(size_AP);
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hA(size_A);
+
+    double gpu_time_used, cpu_time_used, unpack_time_used;
+    double rocblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dAP_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_AP),
+                                          rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dAP     = (T*)dAP_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* dA      = (T*)dA_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if(!dAP || !dx || !dy || !dA || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hAP, 1, size_AP, 1);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    rocblas_init<T>(hy, 1, N, abs_incy);
+    rocblas_init<T>(hA, 1, size_A, 1);
+
+    // the diagonal of a unit matrix is not part of it; for tpsv the off diagonals are scaled down
+    // so that the solve stays well conditioned
+    for(rocblas_int j = 0; tri && j < N; j++)
+    {
+        size_t offset = uplo == rocblas_fill_upper ? (size_t)j * (j + 1) / 2
+                                                   : (size_t)j * (2 * N - j - 1) / 2;
+        rocblas_int first = uplo == rocblas_fill_upper ? 0 : j;
+        rocblas_int last  = uplo == rocblas_fill_upper ? j : N - 1;
+
+        for(rocblas_int i = first; i <= last; i++)
+        {
+            if(i == j && diag == rocblas_diagonal_unit)
+                hAP[i + offset] = std::numeric_limits<T>::quiet_NaN();
+            else if(i != j && routine == "tpsv")
+                hAP[i + offset] = hAP[i + offset] / (10 * N);
+        }
+    }
+
+    // the buffer the routine writes and its result for both pointer modes
+    vector<T>& h_in = routine == "spmv" ? hy : unpack ? hA : tri ? hx : hAP;
+    T* d_out        = routine == "spmv" ? dy : unpack ? dA : tri ? dx : dAP;
+
+    vector<T> h_out_1(h_in.size());
+    vector<T> h_out_2(h_in.size());
+    vector<T> h_gold = h_in;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP.data(), sizeof(T) * size_AP, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(packed_call<T>(routine,
+                                           handle,
+                                           uplo,
+                                           transA,
+                                           diag,
+                                           N,
+                                           &h_alpha,
+                                           dAP,
+                                           dx,
+                                           incx,
+                                           &h_beta,
+                                           dy,
+                                           incy,
+                                           dA,
+                                           lda));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(h_out_1.data(), d_out, sizeof(T) * h_in.size(), hipMemcpyDeviceToHost));
+
+        if(scalars)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(d_out, h_in.data(), sizeof(T) * h_in.size(), hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(packed_call<T>(routine,
+                                               handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               N,
+                                               d_alpha,
+                                               dAP,
+                                               dx,
+                                               incx,
+                                               d_beta,
+                                               dy,
+                                               incy,
+                                               dA,
+                                               lda));
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(h_out_2.data(), d_out, sizeof(T) * h_in.size(), hipMemcpyDeviceToHost));
+        }
+        else
+        {
+            h_out_2 = h_out_1;
+        }
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        if(routine == "spmv")
+            cblas_spmv<T>(
+                uplo, N, h_alpha, hAP.data(), hx.data(), incx, h_beta, h_gold.data(), incy);
+        else if(routine == "spr")
+            cblas_spr<T>(uplo, N, h_alpha, hx.data(), incx, h_gold.data());
+        else if(routine == "spr2")
+            cblas_spr2<T>(uplo, N, h_alpha, hx.data(), incx, hy.data(), incy, h_gold.data());
+        else if(routine == "tpmv")
+            cblas_tpmv<T>(uplo, transA, diag, N, hAP.data(), h_gold.data(), incx);
+        else if(routine == "tpsv")
+            cblas_tpsv<T>(uplo, transA, diag, N, hAP.data(), h_gold.data(), incx);
+        else
+        {
+            rocblas_int k = 0;
+            for(rocblas_int j = 0; j < N; j++)
+            {
+                rocblas_int first = uplo == rocblas_fill_upper ? 0 : j;
+                rocblas_int last  = uplo == rocblas_fill_upper ? j : N - 1;
+                for(rocblas_int i = first; i <= last; i++)
+                    h_gold[i + j * lda] = hAP[k++];
+            }
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // the inputs are small integers, all but the solve are exact in any order
+        if(argus.unit_check && routine == "tpsv")
+        {
+            T max_x = 0.0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                T x   = std::abs(h_gold[i * abs_incx]);
+                max_x = max_x > x ? max_x : x;
+            }
+
+            T abs_error = TPSV_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * N * max_x;
+
+            near_check_general<T, T>(1, N, abs_incx, h_gold.data(), h_out_1.data(), abs_error);
+        }
+        else if(argus.unit_check)
+        {
+            unit_check_general<T>(1, h_in.size(), 1, h_gold.data(), h_out_1.data());
+            unit_check_general<T>(1, h_in.size(), 1, h_gold.data(), h_out_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, h_in.size(), 1, h_gold.data(), h_out_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, h_in.size(), 1, h_gold.data(), h_out_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us(); // in microseconds
+
+            packed_call<T>(routine,
+                           handle,
+                           uplo,
+                           transA,
+                           diag,
+                           N,
+                           &h_alpha,
+                           dAP,
+                           dx,
+                           incx,
+                           &h_beta,
+                           dy,
+                           incy,
+                           dA,
+                           lda);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // elements read and written by each routine, the packed triangle counts once per pass
+        double packed = 0.5 * N * (N + 1);
+        double elements;
+        double gflops;
+        if(routine == "spmv")
+        {
+            elements = packed + 3.0 * N;
+            gflops   = symv_gflop_count<T>(N);
+        }
+        else if(routine == "spr")
+        {
+            elements = 2.0 * packed + N;
+            gflops   = spr_gflop_count<T>(N);
+        }
+        else if(routine == "spr2")
+        {
+            elements = 2.0 * packed + 2.0 * N;
+            gflops   = spr2_gflop_count<T>(N);
+        }
+        else if(tri)
+        {
+            elements = packed + 2.0 * N;
+            gflops   = routine == "tpmv" ? tpmv_gflop_count<T>(N) : trsv_gflop_count<T>(N);
+        }
+        else
+        {
+            elements = 2.0 * packed;
+            gflops   = 0.0;
+        }
+
+        rocblas_gflops    = gflops / gpu_time_used * 1e6;
+        rocblas_bandwidth = elements * sizeof(T) / gpu_time_used / 1e3;
+
+        // spmv and spr through full storage: unpack the triangle, then symv or syr
+        bool dense_path = routine == "spmv" || routine == "spr";
+        if(dense_path)
+        {
+            auto d_full_managed = rocblas_unique_ptr{
+                rocblas_test::device_malloc(sizeof(T) * N * N), rocblas_test::device_free};
+            T* d_full = (T*)d_full_managed.get();
+            if(!d_full)
+            {
+                PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+                return rocblas_status_memory_error;
+            }
+
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                    unpack_time_used = get_time_us(); // in microseconds
+
+                rocblas_tpttr<T>(handle, uplo, N, dAP, d_full, N);
+                if(routine == "spmv")
+                    rocblas_symv<T>(
+                        handle, uplo, N, &h_alpha, d_full, N, dx, incx, &h_beta, dy, incy);
+                else
+                    rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, incx, d_full, N);
+            }
+
+            unpack_time_used = (get_time_us() - unpack_time_used) / number_hot_calls;
+        }
+
+        cout << "routine,uplo,transA,diag,N,incx,incy,lda,rocblas-Gflops,rocblas-GB/s,us";
+
+        if(dense_path)
+            cout << ",unpack+dense-us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_device_ptr";
+
+        cout << endl;
+
+        cout << routine << ',' << argus.uplo_option << ',' << argus.transA_option << ','
+             << argus.diag_option << ',' << N << ',' << incx << ',' << incy << ',' << lda << ','
+             << rocblas_gflops << ',' << rocblas_bandwidth << ',' << gpu_time_used;
+
+        if(dense_path)
+            cout << ',' << unpack_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << gflops / cpu_time_used * 1e6 << ',' << cpu_time_used << ','
+                 << rocblas_error_1 << ',' << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
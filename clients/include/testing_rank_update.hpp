@@ -0,0 +1,547 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "flops.h"
+
+using namespace std;
+
+/*
+    one call of a real rank update: syr2, or ger, syr and syr2 strided batched. Each one only
+    uses the arguments of its own signature.
+*/
+template <typename T>
+rocblas_status rank_update_call(const string& routine,
+                                rocblas_handle handle,
+                                rocblas_fill uplo,
+                                rocblas_int M,
+                                rocblas_int N,
+                                const T* alpha,
+                                T* dx,
+                                rocblas_int incx,
+                                rocblas_int bsx,
+                                T* dy,
+                                rocblas_int incy,
+                                rocblas_int bsy,
+                                T* dA,
+                                rocblas_int lda,
+                                rocblas_int bsa,
+                                rocblas_int batch_count)
+{
+    if(routine == "syr2")
+        return rocblas_syr2<T>(handle, uplo, N, alpha, dx, incx, dy, incy, dA, lda);
+    else if(routine == "ger_strided_batched")
+        return rocblas_ger_strided_batched<T>(
+            handle, M, N, alpha, dx, incx, bsx, dy, incy, bsy, dA, lda, bsa, batch_count);
+    else if(routine == "syr_strided_batched")
+        return rocblas_syr_strided_batched<T>(
+            handle, uplo, N, alpha, dx, incx, bsx, dA, lda, bsa, batch_count);
+    else if(routine == "syr2_strided_batched")
+        return rocblas_syr2_strided_batched<T>(
+            handle, uplo, N, alpha, dx, incx, bsx, dy, incy, bsy, dA, lda, bsa, batch_count);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    the real rank updates against cblas, once with alpha on the host and once on the device.
+    The batched forms are checked against a host loop over the batch; M is only used by ger.
+
+    A starts out as a general matrix with lda >= N padding, and the whole buffer is compared
+    with the cblas result, so a write to the triangle that is not referenced or to the padding
+    between the columns shows up as an error.
+*/
+template <typename T>
+rocblas_status testing_rank_update(Arguments argus, const string& routine)
+{
+    bool ger     = routine == "ger_strided_batched";
+    bool two     = routine == "syr2" || routine == "syr2_strided_batched";
+    bool batched = routine != "syr2";
+    bool uses_y  = ger || two;
+
+    rocblas_fill uplo = char2rocblas_fill(argus.uplo_option);
+
+    rocblas_int N           = argus.N;
+    rocblas_int M           = ger ? argus.M : N;
+    rocblas_int incx        = argus.incx;
+    rocblas_int incy        = uses_y ? argus.incy : 1;
+    rocblas_int lda         = argus.lda;
+    rocblas_int batch_count = batched ? argus.batch_count : 1;
+
+    T h_alpha = (T)argus.alpha;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check and quick return before allocating invalid memory
+    if(M <= 0 || N <= 0 || lda < M || lda < 1 || 0 == incx || 0 == incy || batch_count <= 0)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dA || !dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rank_update_call<T>(routine,
+                                     handle,
+                                     uplo,
+                                     M,
+                                     N,
+                                     &h_alpha,
+                                     dx,
+                                     incx,
+                                     0,
+                                     dy,
+                                     incy,
+                                     0,
+                                     dA,
+                                     lda,
+                                     0,
+                                     batch_count);
+
+        rank_update_arg_check(status, M, N, lda, incx, incy, batch_count);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // the problems of a batch are packed back to back
+    rocblas_int bsx = M * abs_incx;
+    rocblas_int bsy = N * abs_incy;
+    rocblas_int bsa = lda * N;
+
+    size_t size_x = (size_t)bsx * batch_count;
+    size_t size_y = (size_t)bsy * batch_count;
+    size_t size_A = (size_t)bsa * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hA(size_A);
+    vector<T> hA_1(size_A);
+    vector<T> hA_2(size_A);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* dA      = (T*)dA_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    if(!dx || !dy || !dA || !d_alpha)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hx, 1, size_x, 1);
+    rocblas_init<T>(hy, 1, size_y, 1);
+    rocblas_init<T>(hA, 1, size_A, 1);
+
+    vector<T> hA_gold = hA;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rank_update_call<T>(routine,
+                                                handle,
+                                                uplo,
+                                                M,
+                                                N,
+                                                &h_alpha,
+                                                dx,
+                                                incx,
+                                                bsx,
+                                                dy,
+                                                incy,
+                                                bsy,
+                                                dA,
+                                                lda,
+                                                bsa,
+                                                batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_1.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rank_update_call<T>(routine,
+                                                handle,
+                                                uplo,
+                                                M,
+                                                N,
+                                                d_alpha,
+                                                dx,
+                                                incx,
+                                                bsx,
+                                                dy,
+                                                incy,
+                                                bsy,
+                                                dA,
+                                                lda,
+                                                bsa,
+                                                batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_2.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            T* x = hx.data() + (size_t)b * bsx;
+            T* y = hy.data() + (size_t)b * bsy;
+            T* A = hA_gold.data() + (size_t)b * bsa;
+
+            if(ger)
+                cblas_ger<T>(M, N, h_alpha, x, incx, y, incy, A, lda);
+            else if(two)
+                cblas_syr2<T>(uplo, N, h_alpha, x, incx, y, incy, A, lda);
+            else
+                cblas_syr<T>(uplo, N, h_alpha, x, incx, A, lda);
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // the inputs are small integers, the updates are exact in any order
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, size_A, 1, hA_gold.data(), hA_1.data());
+            unit_check_general<T>(1, size_A, 1, hA_gold.data(), hA_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', lda, N * batch_count, lda, hA_gold.data(), hA_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', lda, N * batch_count, lda, hA_gold.data(), hA_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us(); // in microseconds
+
+            rank_update_call<T>(routine,
+                                handle,
+                                uplo,
+                                M,
+                                N,
+                                &h_alpha,
+                                dx,
+                                incx,
+                                bsx,
+                                dy,
+                                incy,
+                                bsy,
+                                dA,
+                                lda,
+                                bsa,
+                                batch_count);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // elements read and written per problem, the triangle only for the symmetric updates
+        double elements;
+        double gflops;
+        if(ger)
+        {
+            elements = 2.0 * M * N + M + N;
+            gflops   = ger_gflop_count<T>(M, N);
+        }
+        else
+        {
+            elements = 1.0 * N * (N + 1) + (two ? 2.0 : 1.0) * N;
+            gflops   = two ? syr2_gflop_count<T>(N) : syr_gflop_count<T>(N);
+        }
+
+        rocblas_gflops    = batch_count * gflops / gpu_time_used * 1e6;
+        rocblas_bandwidth = batch_count * elements * sizeof(T) / gpu_time_used / 1e3;
+
+        cout << "routine,uplo,M,N,alpha,incx,incy,lda,batch_count,rocblas-Gflops,rocblas-GB/s,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_device_ptr";
+
+        cout << endl;
+
+        cout << routine << ',' << argus.uplo_option << ',' << M << ',' << N << ',' << h_alpha
+             << ',' << incx << ',' << incy << ',' << lda << ',' << batch_count << ','
+             << rocblas_gflops << ',' << rocblas_bandwidth << ',' << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << batch_count * gflops / cpu_time_used * 1e6 << ',' << cpu_time_used
+                 << ',' << rocblas_error_1 << ',' << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    her and her2 against cblas for the complex types T1, T2 is the real type of the alpha of
+    her. alpha is argus.alpha + argus.alpha i for her2. The diagonal of A starts with a non
+    zero imaginary part, both zero it, and as for the real updates the whole buffer is
+    compared.
+*/
+template <typename T1, typename T2>
+rocblas_status testing_hermitian_rank_update(Arguments argus, const string& routine)
+{
+    bool two = routine == "her2";
+
+    rocblas_fill uplo = char2rocblas_fill(argus.uplo_option);
+
+    rocblas_int N    = argus.N;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = two ? argus.incy : 1;
+    rocblas_int lda  = argus.lda;
+
+    T1 h_alpha   = (T1)argus.alpha;
+    T2 h_alpha_r = (T2)argus.alpha;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check and quick return before allocating invalid memory
+    if(N <= 0 || lda < N || lda < 1 || 0 == incx || 0 == incy)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * safe_size),
+                                             rocblas_test::device_free};
+        T1* dA = (T1*)dA_managed.get();
+        T1* dx = (T1*)dx_managed.get();
+        T1* dy = (T1*)dy_managed.get();
+        if(!dA || !dx || !dy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        if(two)
+            status = rocblas_her2<T1>(handle, uplo, N, &h_alpha, dx, incx, dy, incy, dA, lda);
+        else
+            status = rocblas_her<T1, T2>(handle, uplo, N, &h_alpha_r, dx, incx, dA, lda);
+
+        rank_update_arg_check(status, N, N, lda, incx, incy, 1);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    size_t size_x = (size_t)N * abs_incx;
+    size_t size_y = (size_t)N * abs_incy;
+    size_t size_A = (size_t)lda * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T1> hx(size_x);
+    vector<T1> hy(size_y);
+    vector<T1> hA(size_A);
+    vector<T1> hA_1(size_A);
+    vector<T1> hA_2(size_A);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, rocblas_bandwidth;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * size_y),
+                                         rocblas_test::device_free};
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1) * size_A),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T1)), rocblas_test::device_free};
+    T1* dx      = (T1*)dx_managed.get();
+    T1* dy      = (T1*)dy_managed.get();
+    T1* dA      = (T1*)dA_managed.get();
+    T1* d_alpha = (T1*)d_alpha_managed.get();
+    if(!dx || !dy || !dA || !d_alpha)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T1>(hx, 1, size_x, 1);
+    rocblas_init<T1>(hy, 1, size_y, 1);
+    rocblas_init<T1>(hA, 1, size_A, 1);
+
+    vector<T1> hA_gold = hA;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T1) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T1) * size_y, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T1) * size_A, hipMemcpyHostToDevice));
+
+        // her reads a real alpha from the device, her2 a complex one
+        if(two)
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T1), hipMemcpyHostToDevice));
+        else
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_r, sizeof(T2), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        if(two)
+            CHECK_ROCBLAS_ERROR(
+                rocblas_her2<T1>(handle, uplo, N, &h_alpha, dx, incx, dy, incy, dA, lda));
+        else
+            CHECK_ROCBLAS_ERROR(
+                rocblas_her<T1, T2>(handle, uplo, N, &h_alpha_r, dx, incx, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_1.data(), dA, sizeof(T1) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T1) * size_A, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        if(two)
+            CHECK_ROCBLAS_ERROR(
+                rocblas_her2<T1>(handle, uplo, N, d_alpha, dx, incx, dy, incy, dA, lda));
+        else
+            CHECK_ROCBLAS_ERROR(
+                rocblas_her<T1, T2>(handle, uplo, N, (T2*)d_alpha, dx, incx, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_2.data(), dA, sizeof(T1) * size_A, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        if(two)
+            cblas_her2<T1>(uplo, N, h_alpha, hx.data(), incx, hy.data(), incy, hA_gold.data(), lda);
+        else
+            cblas_her<T1, T2>(uplo, N, h_alpha_r, hx.data(), incx, hA_gold.data(), lda);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // the real and imaginary parts are small integers, the updates are exact in any order
+        if(argus.unit_check)
+        {
+            unit_check_general<T1>(1, size_A, 1, hA_gold.data(), hA_1.data());
+            unit_check_general<T1>(1, size_A, 1, hA_gold.data(), hA_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T1>('F', lda, N, lda, hA_gold.data(), hA_1.data());
+            rocblas_error_2 =
+                norm_check_general<T1>('F', lda, N, lda, hA_gold.data(), hA_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T1) * size_A, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us(); // in microseconds
+
+            if(two)
+                rocblas_her2<T1>(handle, uplo, N, &h_alpha, dx, incx, dy, incy, dA, lda);
+            else
+                rocblas_her<T1, T2>(handle, uplo, N, &h_alpha_r, dx, incx, dA, lda);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // the triangle is read and written once, the vectors read once
+        double elements = 1.0 * N * (N + 1) + (two ? 2.0 : 1.0) * N;
+        double gflops   = two ? syr2_gflop_count<T1>(N) : syr_gflop_count<T1>(N);
+
+        rocblas_gflops    = gflops / gpu_time_used * 1e6;
+        rocblas_bandwidth = elements * sizeof(T1) / gpu_time_used / 1e3;
+
+        cout << "routine,uplo,N,alpha,incx,incy,lda,rocblas-Gflops,rocblas-GB/s,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_device_ptr";
+
+        cout << endl;
+
+        cout << routine << ',' << argus.uplo_option << ',' << N << ',' << argus.alpha << ','
+             << incx << ',' << incy << ',' << lda << ',' << rocblas_gflops << ','
+             << rocblas_bandwidth << ',' << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << ',' << gflops / cpu_time_used * 1e6 << ',' << cpu_time_used << ','
+                 << rocblas_error_1 << ',' << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
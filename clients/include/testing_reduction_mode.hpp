@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "unit.h"
+#include "deterministic_sum.h"
+
+using namespace std;
+
+/*
+    one call of the reduction routine (dot, asum, nrm2, dot_nrm2 or mdot over the K columns of
+    V); result holds 1, 2 or K values.
+*/
+template <typename T>
+rocblas_status reduction_mode_call(const string& routine,
+                                   rocblas_handle handle,
+                                   rocblas_int N,
+                                   rocblas_int K,
+                                   const T* dx,
+                                   rocblas_int incx,
+                                   const T* dy,
+                                   rocblas_int incy,
+                                   const T* dV,
+                                   T* result)
+{
+    if(routine == "dot")
+        return rocblas_dot<T>(handle, N, dx, incx, dy, incy, result);
+    else if(routine == "asum")
+        return rocblas_asum<T, T>(handle, N, dx, incx, result);
+    else if(routine == "nrm2")
+        return rocblas_nrm2<T, T>(handle, N, dx, incx, result);
+    else if(routine == "dot_nrm2")
+        return rocblas_dot_nrm2<T>(handle, N, dx, incx, dy, incy, result, result + 1);
+    else if(routine == "mdot")
+        return rocblas_mdot<T>(handle, N, K, dV, N, dx, incx, result);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    in rocblas_reduction_mode_deterministic the results must match the host implementation of
+    the deterministic order bit for bit, in both pointer modes. The data are not integers, so
+    that the order of the sums shows in the last bits. The timing gives the cost of the mode.
+*/
+template <typename T>
+rocblas_status testing_reduction_mode(Arguments argus, const string& routine)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int K    = routine == "mdot" ? argus.K : 1;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    // asum and nrm2 quick return for incx <= 0, mdot needs at least one column
+    if(N <= 0 || K <= 0 || incx <= 0 || incy <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_int size_x  = N * incx;
+    rocblas_int size_y  = N * incy;
+    rocblas_int size_V  = N * K;
+    rocblas_int results = routine == "dot_nrm2" ? 2 : K;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hV(size_V);
+    vector<T> h_result(results);
+    vector<T> h_result_gold(results);
+    vector<T> terms(N);
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto dV_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_V),
+                                         rocblas_test::device_free};
+    auto d_result_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * results),
+                                               rocblas_test::device_free};
+    T* dx       = (T*)dx_managed.get();
+    T* dy       = (T*)dy_managed.get();
+    T* dV       = (T*)dV_managed.get();
+    T* d_result = (T*)d_result_managed.get();
+    if(!dx || !dy || !dV || !d_result)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU, of both signs and magnitudes from 1e-3 to 1
+    srand(1);
+    for(rocblas_int i = 0; i < size_x; i++)
+        hx[i] = ((T)rand() / RAND_MAX - 0.5) / (1 + rand() % 1000);
+    for(rocblas_int i = 0; i < size_y; i++)
+        hy[i] = ((T)rand() / RAND_MAX - 0.5) / (1 + rand() % 1000);
+    for(rocblas_int i = 0; i < size_V; i++)
+        hV[i] = ((T)rand() / RAND_MAX - 0.5) / (1 + rand() % 1000);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dV, hV.data(), sizeof(T) * size_V, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // CPU, the terms of each sum in the deterministic order
+        if(routine == "dot" || routine == "dot_nrm2")
+        {
+            for(rocblas_int i = 0; i < N; i++)
+                terms[i] = hx[i * incx] * hy[i * incy];
+            h_result_gold[0] = deterministic_sum(N, terms.data());
+        }
+        if(routine == "asum")
+        {
+            for(rocblas_int i = 0; i < N; i++)
+                terms[i] = fabs(hx[i * incx]);
+            h_result_gold[0] = deterministic_sum(N, terms.data());
+        }
+        if(routine == "nrm2" || routine == "dot_nrm2")
+        {
+            for(rocblas_int i = 0; i < N; i++)
+                terms[i] = hx[i * incx] * hx[i * incx];
+            h_result_gold[results - 1] = sqrt(deterministic_sum(N, terms.data()));
+        }
+        if(routine == "mdot")
+        {
+            for(rocblas_int j = 0; j < K; j++)
+            {
+                for(rocblas_int i = 0; i < N; i++)
+                    terms[i] = hV[i + j * N] * hx[i * incx];
+                h_result_gold[j] = deterministic_sum(N, terms.data());
+            }
+        }
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_reduction_mode(handle, rocblas_reduction_mode_deterministic));
+
+        // GPU BLAS, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            reduction_mode_call<T>(routine, handle, N, K, dx, incx, dy, incy, dV, h_result.data()));
+
+        bitwise_check_general<T>(1, results, 1, h_result_gold.data(), h_result.data());
+
+        // GPU BLAS, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            reduction_mode_call<T>(routine, handle, N, K, dx, incx, dy, incy, dV, d_result));
+        CHECK_HIP_ERROR(
+            hipMemcpy(h_result.data(), d_result, sizeof(T) * results, hipMemcpyDeviceToHost));
+
+        bitwise_check_general<T>(1, results, 1, h_result_gold.data(), h_result.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        double time_used[2];
+
+        for(int mode = 0; mode < 2; mode++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_reduction_mode(
+                handle,
+                mode == 0 ? rocblas_reduction_mode_default : rocblas_reduction_mode_deterministic));
+
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[mode] = get_time_us(); // in microseconds
+                }
+
+                reduction_mode_call<T>(routine, handle, N, K, dx, incx, dy, incy, dV, d_result);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[mode] = (get_time_us() - time_used[mode]) / number_hot_calls;
+        }
+
+        cout << "routine,N,K,incx,incy,default-us,deterministic-us,deterministic/default" << endl;
+
+        cout << routine << ',' << N << ',' << K << ',' << incx << ',' << incy << ','
+             << time_used[0] << ',' << time_used[1] << ',' << time_used[1] / time_used[0] << endl;
+    }
+
+    return rocblas_status_success;
+}
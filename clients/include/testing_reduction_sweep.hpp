@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/*
+    latency of the single pass Level 1 reductions over n = 1, 2, 4, ... up to argus.N, with the
+    result on the device and, for dot, on the host. For small n the time is the launch latency
+    of the one kernel; crossover is the first n at which dot takes twice as long as at n = 1,
+    below it the reductions are latency bound, above it bandwidth bound.
+*/
+template <typename T>
+rocblas_status testing_reduction_sweep(Arguments argus)
+{
+    rocblas_int N_max = argus.N;
+
+    int number_cold_calls = 2;
+    int number_hot_calls  = 100;
+
+    if(N_max <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    vector<T> hx(N_max);
+    vector<T> hy(N_max);
+
+    srand(1);
+    rocblas_init<T>(hx, 1, N_max, 1);
+    rocblas_init<T>(hy, 1, N_max, 1);
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * N_max),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * N_max),
+                                         rocblas_test::device_free};
+    auto d_result_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_index_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                                              rocblas_test::device_free};
+    T* dx                = (T*)dx_managed.get();
+    T* dy                = (T*)dy_managed.get();
+    T* d_result          = (T*)d_result_managed.get();
+    rocblas_int* d_index = (rocblas_int*)d_index_managed.get();
+    if(!dx || !dy || !d_result || !d_index)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * N_max, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N_max, hipMemcpyHostToDevice));
+
+    cout << "N,dot-us,nrm2-us,asum-us,iamax-us,iamin-us,dot-host-ptr-us" << endl;
+
+    double dot_time_n1    = 0.0;
+    rocblas_int crossover = 0;
+
+    for(rocblas_int n = 1; n <= N_max; n *= 2)
+    {
+        double time_used[6];
+
+        for(int routine = 0; routine < 6; routine++)
+        {
+            T h_result;
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, routine == 5 ? rocblas_pointer_mode_host : rocblas_pointer_mode_device));
+
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[routine] = get_time_us(); // in microseconds
+                }
+
+                switch(routine)
+                {
+                case 0: rocblas_dot<T>(handle, n, dx, 1, dy, 1, d_result); break;
+                case 1: rocblas_nrm2<T, T>(handle, n, dx, 1, d_result); break;
+                case 2: rocblas_asum<T, T>(handle, n, dx, 1, d_result); break;
+                case 3: rocblas_iamax<T>(handle, n, dx, 1, d_index); break;
+                case 4: rocblas_iamin<T>(handle, n, dx, 1, d_index); break;
+                case 5: rocblas_dot<T>(handle, n, dx, 1, dy, 1, &h_result); break;
+                }
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[routine] = (get_time_us() - time_used[routine]) / number_hot_calls;
+        }
+
+        if(n == 1)
+            dot_time_n1 = time_used[0];
+        else if(crossover == 0 && time_used[0] > 2 * dot_time_n1)
+            crossover = n;
+
+        cout << n;
+        for(int routine = 0; routine < 6; routine++)
+            cout << "," << time_used[routine];
+        cout << endl;
+    }
+
+    cout << "crossover,N=" << crossover << endl;
+
+    return rocblas_status_success;
+}
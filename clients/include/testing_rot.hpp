@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "near.h"
+
+// the rotations may be evaluated with fused multiply-adds, allow this many eps per rotation
+#define ROT_EPS_MULTIPLIER 4
+
+using namespace std;
+
+/*
+    one call of routine (rot, rot_strided_batched, rot_batched, rot_sequence, rotm or
+    rotm_strided_batched), or for rot_sequence when fused is false the k calls of rot it
+    replaces. c and s hold k rotations for rot_sequence, param holds batch_count params of 5
+    values for rotm_strided_batched.
+*/
+template <typename T>
+rocblas_status rot_call(const string& routine,
+                        bool fused,
+                        rocblas_handle handle,
+                        rocblas_int N,
+                        rocblas_int K,
+                        T* dx,
+                        T* const* dx_array,
+                        rocblas_int incx,
+                        rocblas_int bsx,
+                        T* dy,
+                        T* const* dy_array,
+                        rocblas_int incy,
+                        rocblas_int bsy,
+                        const T* c,
+                        const T* s,
+                        const T* param,
+                        rocblas_int batch_count)
+{
+    if(routine == "rot")
+        return rocblas_rot<T>(handle, N, dx, incx, dy, incy, c, s);
+    else if(routine == "rot_strided_batched")
+        return rocblas_rot_strided_batched<T>(
+            handle, N, dx, incx, bsx, dy, incy, bsy, c, s, batch_count);
+    else if(routine == "rot_batched")
+        return rocblas_rot_batched<T>(handle, N, dx_array, incx, dy_array, incy, c, s, batch_count);
+    else if(routine == "rot_sequence")
+    {
+        if(fused)
+            return rocblas_rot_sequence<T>(handle, N, K, dx, incx, dy, incy, c, s);
+
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            rocblas_status status = rocblas_rot<T>(handle, N, dx, incx, dy, incy, c + j, s + j);
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+    else if(routine == "rotm")
+        return rocblas_rotm<T>(handle, N, dx, incx, dy, incy, param);
+    else if(routine == "rotm_strided_batched")
+        return rocblas_rotm_strided_batched<T>(
+            handle, N, dx, incx, bsx, dy, incy, bsy, param, 5, batch_count);
+
+    return rocblas_status_not_implemented;
+}
+
+/*
+    the rotations of pairs of vectors against cblas in both pointer modes. The rotations are of
+    random angles, the params of rotm_strided_batched cycle through the flags -1, 0, 1 and -2.
+    The timing compares rot_sequence with k calls of rot.
+*/
+template <typename T>
+rocblas_status testing_rot(Arguments argus, const string& routine)
+{
+    rocblas_int N           = argus.N;
+    rocblas_int K           = routine == "rot_sequence" ? argus.K : 1;
+    rocblas_int incx        = argus.incx;
+    rocblas_int incy        = argus.incy;
+    rocblas_int batch_count = routine.find("batched") != string::npos ? argus.batch_count : 1;
+    bool rotm               = routine.find("rotm") == 0;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory, N <= 0 and K <= 0 are quick returns
+    if(N <= 0 || K <= 0 || batch_count <= 0)
+    {
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto d_array_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)),
+                                                  rocblas_test::device_free};
+        T* dx          = (T*)dx_managed.get();
+        T* dy          = (T*)dy_managed.get();
+        T* const* d_xy = (T* const*)d_array_managed.get();
+        if(!dx || !dy || !d_xy)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        T c = 1.0, s = 0.0;
+        T param[5] = {-2.0, 0.0, 0.0, 0.0, 0.0};
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        status = rot_call<T>(routine,
+                             true,
+                             handle,
+                             N,
+                             K,
+                             dx,
+                             d_xy,
+                             incx,
+                             0,
+                             dy,
+                             d_xy,
+                             incy,
+                             0,
+                             &c,
+                             &s,
+                             param,
+                             batch_count);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    // the vectors of the batch follow each other
+    rocblas_int bsx    = N * abs_incx;
+    rocblas_int bsy    = N * abs_incy;
+    rocblas_int size_x = bsx * batch_count;
+    rocblas_int size_y = bsy * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hx(size_x);
+    vector<T> hy(size_y);
+    vector<T> hx_gold(size_x);
+    vector<T> hy_gold(size_y);
+    vector<T> hx_1(size_x);
+    vector<T> hy_1(size_y);
+    vector<T> hc(K);
+    vector<T> hs(K);
+    vector<T> hparam(5 * batch_count);
+    vector<T*> hx_array(batch_count);
+    vector<T*> hy_array(batch_count);
+
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_x),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_y),
+                                         rocblas_test::device_free};
+    auto dc_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * K), rocblas_test::device_free};
+    auto ds_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * K), rocblas_test::device_free};
+    auto dparam_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T) * 5 * batch_count), rocblas_test::device_free};
+    auto dx_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    auto dy_array_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    T* dx        = (T*)dx_managed.get();
+    T* dy        = (T*)dy_managed.get();
+    T* dc        = (T*)dc_managed.get();
+    T* ds        = (T*)ds_managed.get();
+    T* dparam    = (T*)dparam_managed.get();
+    T** dx_array = (T**)dx_array_managed.get();
+    T** dy_array = (T**)dy_array_managed.get();
+    if(!dx || !dy || !dc || !ds || !dparam || !dx_array || !dy_array)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hx, 1, N * batch_count, abs_incx);
+    rocblas_init<T>(hy, 1, N * batch_count, abs_incy);
+
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        T angle = 2 * M_PI * rand() / RAND_MAX;
+        hc[j]   = cos(angle);
+        hs[j]   = sin(angle);
+    }
+
+    const T flags[] = {-1.0, 0.0, 1.0, -2.0};
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hparam[5 * b] = flags[b % 4];
+        for(rocblas_int k = 1; k < 5; k++)
+            hparam[5 * b + k] = 2 * (T)rand() / RAND_MAX - 1;
+
+        hx_array[b] = dx + (size_t)b * bsx;
+        hy_array[b] = dy + (size_t)b * bsy;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dc, hc.data(), sizeof(T) * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ds, hs.data(), sizeof(T) * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dparam, hparam.data(), sizeof(T) * 5 * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // CPU BLAS
+        hx_gold = hx;
+        hy_gold = hy;
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            T* x = hx_gold.data() + (size_t)b * bsx;
+            T* y = hy_gold.data() + (size_t)b * bsy;
+
+            if(rotm)
+                cblas_rotm<T>(N, x, incx, y, incy, hparam.data() + 5 * b);
+            else
+                for(rocblas_int j = 0; j < K; j++)
+                    cblas_rot<T>(N, x, incx, y, incy, hc[j], hs[j]);
+        }
+
+        // the elements are at most 10, a rotation keeps the norm of a pair and an entry of H
+        // is at most 1
+        T abs_error = ROT_EPS_MULTIPLIER * K * std::numeric_limits<T>::epsilon() * 20;
+
+        // GPU BLAS in rocblas_pointer_mode_host, then in rocblas_pointer_mode_device
+        for(int mode = 0; mode < 2; mode++)
+        {
+            bool host = mode == 0;
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, host ? rocblas_pointer_mode_host : rocblas_pointer_mode_device));
+
+            CHECK_ROCBLAS_ERROR(rot_call<T>(routine,
+                                            true,
+                                            handle,
+                                            N,
+                                            K,
+                                            dx,
+                                            dx_array,
+                                            incx,
+                                            bsx,
+                                            dy,
+                                            dy_array,
+                                            incy,
+                                            bsy,
+                                            host ? hc.data() : dc,
+                                            host ? hs.data() : ds,
+                                            host ? hparam.data() : dparam,
+                                            batch_count));
+
+            CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+            near_check_general<T, T>(
+                1, N * batch_count, abs_incx, hx_gold.data(), hx_1.data(), abs_error);
+            near_check_general<T, T>(
+                1, N * batch_count, abs_incy, hy_gold.data(), hy_1.data(), abs_error);
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 100;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        // the routine, then for rot_sequence the k calls of rot
+        int variants = routine == "rot_sequence" ? 2 : 1;
+        double time_used[2];
+
+        for(int variant = 0; variant < variants; variant++)
+        {
+            for(int iter = 0; iter < number_cold_calls + number_hot_calls; iter++)
+            {
+                if(iter == number_cold_calls)
+                {
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    time_used[variant] = get_time_us(); // in microseconds
+                }
+
+                rot_call<T>(routine,
+                            variant == 0,
+                            handle,
+                            N,
+                            K,
+                            dx,
+                            dx_array,
+                            incx,
+                            bsx,
+                            dy,
+                            dy_array,
+                            incy,
+                            bsy,
+                            dc,
+                            ds,
+                            dparam,
+                            batch_count);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            time_used[variant] = (get_time_us() - time_used[variant]) / number_hot_calls;
+        }
+
+        // x and y are read and written once
+        double bytes = 4.0 * N * batch_count * sizeof(T);
+
+        cout << "routine,N,K,incx,incy,batch_count,us,GB/s";
+        if(variants > 1)
+            cout << ",unfused-us";
+        cout << endl;
+
+        cout << routine << ',' << N << ',' << K << ',' << incx << ',' << incy << ','
+             << batch_count << ',' << time_used[0] << ',' << bytes / time_used[0] / 1e3;
+        if(variants > 1)
+            cout << ',' << time_used[1];
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
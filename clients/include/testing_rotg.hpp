@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "near.h"
+#include "unit.h"
+
+// cblas may compute the rotations in another order, allow this many eps of each value
+#define ROTG_EPS_MULTIPLIER 8
+
+using namespace std;
+
+/*
+    the construction of batch_count rotations (rotg) or modified rotations (rotmg) against
+    cblas in both pointer modes, by the single routine for a batch of one and by the
+    _strided_batched routine otherwise. The scalars of the batch are 2 elements apart, the
+    params 6. The inputs include zeros, the special cases of the constructions.
+*/
+template <typename T>
+rocblas_status testing_rotg(Arguments argus, const string& routine)
+{
+    rocblas_int batch_count = argus.batch_count;
+
+    if(batch_count <= 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    const rocblas_int stride       = 2;
+    const rocblas_int stride_param = 6;
+
+    rocblas_int size       = stride * batch_count;
+    rocblas_int size_param = stride_param * batch_count;
+    bool rotg              = routine == "rotg";
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    // rotg: a, b, c, s; rotmg: d1, d2, x1, y1
+    vector<T> h_in[4];
+    vector<T> h_gold[4];
+    vector<T> h_result[4];
+    vector<T> hparam_gold(size_param, 0.0);
+    vector<T> hparam_result(size_param);
+
+    rocblas_unique_ptr d_managed[4] = {
+        {rocblas_test::device_malloc(sizeof(T) * size), rocblas_test::device_free},
+        {rocblas_test::device_malloc(sizeof(T) * size), rocblas_test::device_free},
+        {rocblas_test::device_malloc(sizeof(T) * size), rocblas_test::device_free},
+        {rocblas_test::device_malloc(sizeof(T) * size), rocblas_test::device_free}};
+    auto dparam_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_param),
+                                             rocblas_test::device_free};
+    T* d[4];
+    for(int k = 0; k < 4; k++)
+        d[k] = (T*)d_managed[k].get();
+    T* dparam = (T*)dparam_managed.get();
+    if(!d[0] || !d[1] || !d[2] || !d[3] || !dparam)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU, of both signs and with zeros in every fifth entry
+    srand(1);
+    for(int k = 0; k < 4; k++)
+    {
+        h_in[k].assign(size, 0.0);
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            T value = 20 * (T)rand() / RAND_MAX - 10;
+            if(i % 5 == k + 1)
+                value = 0;
+            // the scaling factors of rotmg are positive, but for the case of a negative d1
+            if(!rotg && k < 2 && !(k == 0 && i % 7 == 6))
+                value = value < 0 ? -value : value;
+            h_in[k][i * stride] = value;
+        }
+    }
+
+    if(argus.unit_check)
+    {
+        // CPU BLAS
+        for(int k = 0; k < 4; k++)
+            h_gold[k] = h_in[k];
+
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            if(rotg)
+                cblas_rotg<T>(&h_gold[0][i * stride],
+                              &h_gold[1][i * stride],
+                              &h_gold[2][i * stride],
+                              &h_gold[3][i * stride]);
+            else
+                cblas_rotmg<T>(&h_gold[0][i * stride],
+                               &h_gold[1][i * stride],
+                               &h_gold[2][i * stride],
+                               h_gold[3][i * stride],
+                               &hparam_gold[i * stride_param]);
+        }
+
+        T eps = std::numeric_limits<T>::epsilon();
+
+        // GPU BLAS in rocblas_pointer_mode_host, then in rocblas_pointer_mode_device
+        for(int mode = 0; mode < 2; mode++)
+        {
+            bool host = mode == 0;
+
+            for(int k = 0; k < 4; k++)
+                h_result[k] = h_in[k];
+            hparam_result.assign(size_param, 0.0);
+
+            for(int k = 0; k < 4; k++)
+                CHECK_HIP_ERROR(
+                    hipMemcpy(d[k], h_in[k].data(), sizeof(T) * size, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(
+                dparam, hparam_result.data(), sizeof(T) * size_param, hipMemcpyHostToDevice));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(
+                handle, host ? rocblas_pointer_mode_host : rocblas_pointer_mode_device));
+
+            T* p[4];
+            for(int k = 0; k < 4; k++)
+                p[k] = host ? h_result[k].data() : d[k];
+            T* p_param = host ? hparam_result.data() : dparam;
+
+            rocblas_status status;
+            if(rotg && batch_count == 1)
+                status = rocblas_rotg<T>(handle, p[0], p[1], p[2], p[3]);
+            else if(rotg)
+                status = rocblas_rotg_strided_batched<T>(
+                    handle, p[0], stride, p[1], stride, p[2], stride, p[3], stride, batch_count);
+            else if(batch_count == 1)
+                status = rocblas_rotmg<T>(handle, p[0], p[1], p[2], p[3], p_param);
+            else
+                status = rocblas_rotmg_strided_batched<T>(handle,
+                                                          p[0],
+                                                          stride,
+                                                          p[1],
+                                                          stride,
+                                                          p[2],
+                                                          stride,
+                                                          p[3],
+                                                          stride,
+                                                          p_param,
+                                                          stride_param,
+                                                          batch_count);
+            CHECK_ROCBLAS_ERROR(status);
+
+            if(!host)
+            {
+                for(int k = 0; k < 4; k++)
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        h_result[k].data(), d[k], sizeof(T) * size, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hparam_result.data(),
+                                          dparam,
+                                          sizeof(T) * size_param,
+                                          hipMemcpyDeviceToHost));
+            }
+
+            // each value within a few eps of its magnitude, the flag of rotmg exactly
+            for(rocblas_int i = 0; i < batch_count; i++)
+            {
+                for(int k = 0; k < 4; k++)
+                {
+                    T gold = h_gold[k][i * stride];
+                    near_check_general<T, T>(1,
+                                             1,
+                                             1,
+                                             &gold,
+                                             &h_result[k][i * stride],
+                                             ROTG_EPS_MULTIPLIER * eps * fabs(gold));
+                }
+
+                if(!rotg)
+                {
+                    T* gold   = &hparam_gold[i * stride_param];
+                    T* result = &hparam_result[i * stride_param];
+                    unit_check_general<T>(1, 1, 1, gold, result);
+                    for(int k = 1; k < 5; k++)
+                        near_check_general<T, T>(1,
+                                                 1,
+                                                 1,
+                                                 gold + k,
+                                                 result + k,
+                                                 ROTG_EPS_MULTIPLIER * eps * fabs(gold[k]));
+                }
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
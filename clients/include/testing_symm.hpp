@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <sys/time.h>
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "flops.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+rocblas_status testing_symm(Arguments argus)
+{
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldc = argus.ldc;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_side side = char2rocblas_side(argus.side_option);
+    rocblas_fill uplo = char2rocblas_fill(argus.uplo_option);
+
+    rocblas_int safe_size = 100; // arbitrarily set to 100
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // A is K by K
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || lda < K || lda < 1 || ldb < M || ldb < 1 || ldc < M || ldc < 1)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dB = (T*)dB_managed.get();
+        T* dC = (T*)dC_managed.get();
+        if(!dA || !dB || !dC)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rocblas_symm<T>(
+            handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+
+        symm_arg_check(status, M, N, lda, ldb, ldc);
+
+        return status;
+    }
+
+    rocblas_int size_A = lda * K;
+    rocblas_int size_B = ldb * N;
+    rocblas_int size_C = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hC_1(size_C);
+    vector<T> hC_2(size_C);
+    vector<T> hC_gold(size_C);
+
+    // allocate memory on device
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_C),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dB      = (T*)dB_managed.get();
+    T* dC      = (T*)dC_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if(!dA || !dB || !dC || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hA, K, K, lda);
+    rocblas_init<T>(hB, M, N, ldb);
+    rocblas_init<T>(hC_1, M, N, ldc);
+
+    // poison the triangle that is not stored: any read of it shows up as NaN in C
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        for(rocblas_int i = 0; i < K; i++)
+        {
+            if(uplo == rocblas_fill_lower ? i < j : i > j)
+                hA[i + j * lda] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_symm<T>(
+            handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_symm<T>(handle, side, uplo, M, N, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_symm<T>(
+            side, uplo, M, N, h_alpha, hA.data(), lda, hB.data(), ldb, h_beta, hC_gold.data(), ldc);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = symm_gflop_count<T>(side, M, N) / cpu_time_used * 1e6;
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_1.data());
+            unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', M, N, ldc, hC_gold.data(), hC_1.data());
+            rocblas_error_2 = norm_check_general<T>('F', M, N, ldc, hC_gold.data(), hC_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_symm<T>(handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_symm<T>(handle, side, uplo, M, N, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = symm_gflop_count<T>(side, M, N) / gpu_time_used * 1e6;
+
+        cout << "side,uplo,M,N,alpha,lda,ldb,beta,ldc,rocblas-Gflops,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << argus.side_option << "," << argus.uplo_option << "," << M << "," << N << ","
+             << h_alpha << "," << lda << "," << ldb << "," << h_beta << "," << ldc << ","
+             << rocblas_gflops << "," << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error_1 << ","
+                 << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <vector>
 
 #include "rocblas.hpp"
@@ -26,26 +27,20 @@ rocblas_status testing_symv(Arguments argus)
     rocblas_int incx = argus.incx;
     rocblas_int incy = argus.incy;
 
-    T alpha = (T)argus.alpha;
-    T beta  = (T)argus.beta;
+    T h_alpha = (T)argus.alpha;
+    T h_beta  = (T)argus.beta;
 
     rocblas_int safe_size = 100;
 
     rocblas_fill uplo = char2rocblas_fill(argus.uplo_option);
 
-    T *dA, *dx, *dy;
-
-    rocblas_int size_A = lda * N;
-    rocblas_int size_X = N * incx;
-    rocblas_int size_Y = N * incy;
-
     rocblas_status status;
 
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
     rocblas_handle handle = unique_ptr_handle->handle;
 
     // argument sanity check before allocating invalid memory
-    if(N < 0 || lda < 0 || incx < 0 || incy < 0)
+    if(N <= 0 || lda < N || lda < 1 || 0 == incx || 0 == incy)
     {
         auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
                                              rocblas_test::device_free};
@@ -59,44 +54,34 @@ rocblas_status testing_symv(Arguments argus)
         if(!dA || !dx || !dy)
         {
             PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
-            return;
+            return rocblas_status_memory_error;
         }
 
-        status =
-            rocblas_symv<T>(handle, uplo, N, (T*)&alpha, dA, lda, dx, incx, (T*)&beta, dy, incy);
+        status = rocblas_symv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
 
         symv_arg_check(status, N, lda, incx, incy);
 
         return status;
     }
 
-    if(N < 0)
-    {
-        status = rocblas_status_invalid_size;
-        return status;
-    }
-    else if(lda < 0)
-    {
-        status = rocblas_status_invalid_size;
-        return status;
-    }
-    else if(incx < 0)
-    {
-        status = rocblas_status_invalid_size;
-        return status;
-    }
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_X = N * abs_incx;
+    rocblas_int size_Y = N * abs_incy;
 
     // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
     vector<T> hA(size_A);
     vector<T> hx(size_X);
-    vector<T> hy(size_Y);
-    vector<T> hz(size_Y);
+    vector<T> hy_1(size_Y);
+    vector<T> hy_2(size_Y);
+    vector<T> hy_gold(size_Y);
 
-    double gpu_time_used, cpu_time_used;
+    double gpu_time_used, cpu_time_used, gemv_time_used;
     double rocblas_gflops, cblas_gflops;
-    double rocblas_error;
-
-    char char_fill = argus.uplo_option;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
 
     auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
                                          rocblas_test::device_free};
@@ -104,111 +89,382 @@ rocblas_status testing_symv(Arguments argus)
                                          rocblas_test::device_free};
     auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_Y),
                                          rocblas_test::device_free};
-    T* dA = (T*)dA_managed.get();
-    T* dx = (T*)dx_managed.get();
-    T* dy = (T*)dy_managed.get();
-    if(!dA || !dx || !dy)
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if(!dA || !dx || !dy || !d_alpha || !d_beta)
     {
         PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
-        return;
+        return rocblas_status_memory_error;
     }
 
     // Initial Data on CPU
     srand(1);
     rocblas_init_symmetric<T>(hA, N, lda);
-    rocblas_init<T>(hx, 1, N, incx);
-    rocblas_init<T>(hy, 1, N, incy);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    rocblas_init<T>(hy_1, 1, N, abs_incy);
 
-    // copy vector is easy in STL; hz = hy: save a copy in hz which will be output of CPU BLAS
-    hz = hy;
+    // poison the triangle that is not referenced: any read of it shows up as NaN in y
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            if(uplo == rocblas_fill_lower ? i < j : i > j)
+                hA[i + j * lda] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
 
     // copy data from CPU to device
-    hipMemcpy(dA, hA.data(), sizeof(T) * lda * N, hipMemcpyHostToDevice);
-    hipMemcpy(dx, hx.data(), sizeof(T) * N * incx, hipMemcpyHostToDevice);
-    hipMemcpy(dy, hy.data(), sizeof(T) * N * incy, hipMemcpyHostToDevice);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
 
-    /* =====================================================================
-           ROCBLAS
-    =================================================================== */
-    if(argus.timing)
+    if(argus.unit_check || argus.norm_check)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * size_Y, hipMemcpyHostToDevice));
 
-    for(int iter = 0; iter < 1; iter++)
-    {
+        CHECK_ROCBLAS_ERROR(
+            rocblas_symv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_Y, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_2.data(), sizeof(T) * size_Y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
-        status =
-            rocblas_symv<T>(handle, uplo, N, (T*)&alpha, dA, lda, dx, incx, (T*)&beta, dy, incy);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_symv<T>(handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
 
-        if(status != rocblas_status_success)
-            return status;
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * size_Y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_symv<T>(
+            uplo, N, h_alpha, hA.data(), lda, hx.data(), incx, h_beta, hy_gold.data(), incy);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = symv_gflop_count<T>(N) / cpu_time_used * 1e6;
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_1.data());
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_2.data());
+        }
+
+        // if enable norm check, norm check is invasive
+        // any typeinfo(T) will not work here, because template deduction is matched in compilation
+        // time
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_2.data());
+        }
     }
+
     if(argus.timing)
     {
-        gpu_time_used  = get_time_us() - gpu_time_used;
-        rocblas_gflops = symv_gflop_count<T>(N) / gpu_time_used * 1e6 * 1;
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // symv is memory bound, time it next to a gemv on the same n to see the bandwidth gain
+        // of reading the triangle once; both run on the full symmetric matrix without NaN
+        rocblas_init_symmetric<T>(hA, N, lda);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_symv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_symv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = symv_gflop_count<T>(N) / gpu_time_used * 1e6;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_gemv<T>(handle,
+                            rocblas_operation_none,
+                            N,
+                            N,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            dx,
+                            incx,
+                            &h_beta,
+                            dy,
+                            incy);
+        }
+
+        gemv_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_gemv<T>(handle,
+                            rocblas_operation_none,
+                            N,
+                            N,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            dx,
+                            incx,
+                            &h_beta,
+                            dy,
+                            incy);
+        }
+
+        gemv_time_used = (get_time_us() - gemv_time_used) / number_hot_calls;
+
+        // bytes of A, x and y (y is read and written) that each routine has to move
+        double symv_gbyte = (0.5 * N * (N + 1) + 3.0 * N) * sizeof(T) / 1e9;
+        double gemv_gbyte = (1.0 * N * N + 3.0 * N) * sizeof(T) / 1e9;
+
+        double symv_bandwidth = symv_gbyte / gpu_time_used * 1e6;
+        double gemv_bandwidth = gemv_gbyte / gemv_time_used * 1e6;
+
+        cout << "uplo,N,alpha,lda,incx,beta,incy,rocblas-Gflops,rocblas-GB/s,us,gemv-GB/s,gemv-us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << argus.uplo_option << "," << N << "," << h_alpha << "," << lda << "," << incx << ","
+             << h_beta << "," << incy << "," << rocblas_gflops << "," << symv_bandwidth << ","
+             << gpu_time_used << "," << gemv_bandwidth << "," << gemv_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error_1 << ","
+                 << rocblas_error_2;
+
+        cout << endl;
     }
 
-    // copy output from device to CPU
-    hipMemcpy(hy.data(), dy, sizeof(T) * N * incy, hipMemcpyDeviceToHost);
+    return rocblas_status_success;
+}
 
-    if(argus.unit_check || argus.norm_check)
+/*
+    chemv and zhemv, T is the complex type and Tr its real type. The triangle that is not
+    referenced holds NaN, the elements are small integers so the results are exact in any
+    order of the sums.
+*/
+template <typename T, typename Tr>
+rocblas_status testing_hemv(Arguments argus)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+    rocblas_int incy = argus.incy;
+
+    T h_alpha = (T)argus.alpha;
+    T h_beta  = (T)argus.beta;
+
+    rocblas_int safe_size = 100;
+
+    rocblas_fill uplo = char2rocblas_fill(argus.uplo_option);
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || lda < N || lda < 1 || 0 == incx || 0 == incy)
     {
-        /* =====================================================================
-           CPU BLAS
-        =================================================================== */
-        if(argus.timing)
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+        if(!dA || !dx || !dy)
         {
-            cpu_time_used = get_time_us();
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
         }
 
-        cblas_symv<T>(uplo, N, alpha, hA.data(), lda, hx.data(), incx, beta, hz.data(), incy);
+        status = rocblas_hemv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
+
+        symv_arg_check(status, N, lda, incx, incy);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+    rocblas_int abs_incy = incy >= 0 ? incy : -incy;
+
+    size_t size_A = (size_t)lda * N;
+    size_t size_X = (size_t)N * abs_incx;
+    size_t size_Y = (size_t)N * abs_incy;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hx(size_X);
+    vector<T> hy_1(size_Y);
+    vector<T> hy_2(size_Y);
+    vector<T> hy_gold(size_Y);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_X),
+                                         rocblas_test::device_free};
+    auto dy_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_Y),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if(!dA || !dx || !dy || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
 
-        if(argus.timing)
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init_hermitian<T>(hA, N, lda);
+    rocblas_init<T>(hx, 1, N, abs_incx);
+    rocblas_init<T>(hy_1, 1, N, abs_incy);
+
+    // poison the triangle that is not referenced: any read of it shows up as NaN in y
+    T nan;
+    nan.x = std::numeric_limits<Tr>::quiet_NaN();
+    nan.y = std::numeric_limits<Tr>::quiet_NaN();
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < N; i++)
         {
-            cpu_time_used = get_time_us() - cpu_time_used;
-            cblas_gflops  = symv_gflop_count<T>(N) / cpu_time_used * 1e6;
+            if(uplo == rocblas_fill_lower ? i < j : i > j)
+                hA[i + (size_t)j * lda] = nan;
         }
+    }
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * size_Y, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_hemv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy, sizeof(T) * size_Y, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_2.data(), sizeof(T) * size_Y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_hemv<T>(handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * size_Y, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_hemv<T>(
+            uplo, N, h_alpha, hA.data(), lda, hx.data(), incx, h_beta, hy_gold.data(), incy);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
 
-        // enable unit check, notice unit check is not invasive, but norm check is,
-        // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
-            unit_check_general<T>(1, N, incy, hz.data(), hy.data());
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_1.data());
+            unit_check_general<T>(1, N, abs_incy, hy_gold.data(), hy_2.data());
         }
 
-        for(int i = 0; i < 32; i++)
-        {
-            printf("CPU[%d]=%f, GPU[%d]=%f\n", i, hz[i], i, hy[i]);
-        }
-        // if enable norm check, norm check is invasive
-        // any typeinfo(T) will not work here, because template deduction is matched in compilation
-        // time
         if(argus.norm_check)
         {
-            rocblas_error = norm_check_general<T>('F', 1, N, incy, hz.data(), hy.data());
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, N, abs_incy, hy_gold.data(), hy_2.data());
         }
     }
 
     if(argus.timing)
     {
-        // only norm_check return an norm error, unit check won't return anything
-        cout << "N, lda, rocblas-Gflops (us) ";
-        if(argus.norm_check)
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
         {
-            cout << "CPU-Gflops(us), norm-error";
+            rocblas_hemv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
         }
-        cout << endl;
 
-        cout << N << ',' << lda << ',' << rocblas_gflops << "(" << gpu_time_used << "),";
+        gpu_time_used = get_time_us(); // in microseconds
 
-        if(argus.norm_check)
+        for(int iter = 0; iter < number_hot_calls; iter++)
         {
-            cout << cblas_gflops << "(" << cpu_time_used << "),";
-            cout << rocblas_error;
+            rocblas_hemv<T>(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
         }
 
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // bytes of the triangle of A, x and y (y is read and written)
+        double hemv_gbyte     = (0.5 * N * (N + 1) + 3.0 * N) * sizeof(T) / 1e9;
+        double hemv_bandwidth = hemv_gbyte / gpu_time_used * 1e6;
+
+        cout << "uplo,N,lda,incx,incy,rocblas-GB/s,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << argus.uplo_option << "," << N << "," << lda << "," << incx << "," << incy << ","
+             << hemv_bandwidth << "," << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cpu_time_used << "," << rocblas_error_1 << "," << rocblas_error_2;
+
         cout << endl;
     }
 
@@ -0,0 +1,512 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <sys/time.h>
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "unit.h"
+#include "flops.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+rocblas_status testing_syr2k(Arguments argus)
+{
+    rocblas_int N   = argus.N;
+    rocblas_int K   = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldc = argus.ldc;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_fill uplo       = char2rocblas_fill(argus.uplo_option);
+    rocblas_operation trans = char2rocblas_operation(argus.transA_option);
+
+    rocblas_int safe_size = 100; // arbitrarily set to 100
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? N : K;
+    rocblas_int A_col = trans == rocblas_operation_none ? K : N;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K < 0 || lda < A_row || lda < 1 || ldb < A_row || ldb < 1 || ldc < N || ldc < 1)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dB = (T*)dB_managed.get();
+        T* dC = (T*)dC_managed.get();
+        if(!dA || !dB || !dC)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rocblas_syr2k<T>(
+            handle, uplo, trans, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+
+        syrk_arg_check(status, N, K, min(lda, ldb), ldc, 1);
+
+        return status;
+    }
+
+    rocblas_int size_A = lda * A_col;
+    rocblas_int size_B = ldb * A_col;
+    rocblas_int size_C = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hC_1(size_C);
+    vector<T> hC_2(size_C);
+    vector<T> hC_gold(size_C);
+
+    // allocate memory on device
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_C),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dB      = (T*)dB_managed.get();
+    T* dC      = (T*)dC_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if((!dA && (size_A != 0)) || (!dB && (size_B != 0)) || !dC || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init<T>(hB, A_row, A_col, ldb);
+    rocblas_init<T>(hC_1, N, N, ldc);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k<T>(
+            handle, uplo, trans, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k<T>(
+            handle, uplo, trans, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_syr2k<T>(uplo,
+                       trans,
+                       N,
+                       K,
+                       h_alpha,
+                       hA.data(),
+                       lda,
+                       hB.data(),
+                       ldb,
+                       h_beta,
+                       hC_gold.data(),
+                       ldc);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = syr2k_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+
+        // the unreferenced triangle is compared too: it must come back untouched
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(N, N, ldc, hC_gold.data(), hC_1.data());
+            unit_check_general<T>(N, N, ldc, hC_gold.data(), hC_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>('F', N, N, ldc, hC_gold.data(), hC_1.data());
+            rocblas_error_2 = norm_check_general<T>('F', N, N, ldc, hC_gold.data(), hC_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_syr2k<T>(
+                handle, uplo, trans, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_syr2k<T>(
+                handle, uplo, trans, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = syr2k_gflop_count<T>(N, K) / gpu_time_used * 1e6;
+
+        cout << "uplo,trans,N,K,alpha,lda,ldb,beta,ldc,rocblas-Gflops,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << argus.uplo_option << "," << argus.transA_option << "," << N << "," << K << ","
+             << h_alpha << "," << lda << "," << ldb << "," << h_beta << "," << ldc << ","
+             << rocblas_gflops << "," << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error_1 << ","
+                 << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status testing_syr2k_strided_batched(Arguments argus)
+{
+    rocblas_int N           = argus.N;
+    rocblas_int K           = argus.K;
+    rocblas_int lda         = argus.lda;
+    rocblas_int ldb         = argus.ldb;
+    rocblas_int ldc         = argus.ldc;
+    rocblas_int batch_count = argus.batch_count;
+
+    T h_alpha = argus.alpha;
+    T h_beta  = argus.beta;
+
+    rocblas_fill uplo       = char2rocblas_fill(argus.uplo_option);
+    rocblas_operation trans = char2rocblas_operation(argus.transA_option);
+
+    rocblas_int safe_size = 100; // arbitrarily set to 100
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? N : K;
+    rocblas_int A_col = trans == rocblas_operation_none ? K : N;
+
+    //  make bsa, bsb, bsc two times minimum size so matrices are non-contiguous
+    rocblas_int bsa = lda * A_col * 2;
+    rocblas_int bsb = ldb * A_col * 2;
+    rocblas_int bsc = ldc * N * 2;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K < 0 || lda < A_row || lda < 1 || ldb < A_row || ldb < 1 || ldc < N || ldc < 1 ||
+       batch_count <= 0)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dB = (T*)dB_managed.get();
+        T* dC = (T*)dC_managed.get();
+        if(!dA || !dB || !dC)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rocblas_syr2k_strided_batched<T>(handle,
+                                                  uplo,
+                                                  trans,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA,
+                                                  lda,
+                                                  bsa,
+                                                  dB,
+                                                  ldb,
+                                                  bsb,
+                                                  &h_beta,
+                                                  dC,
+                                                  ldc,
+                                                  bsc,
+                                                  batch_count);
+
+        syrk_arg_check(status, N, K, min(lda, ldb), ldc, batch_count);
+
+        return status;
+    }
+
+    rocblas_int size_A = bsa * batch_count;
+    rocblas_int size_B = bsb * batch_count;
+    rocblas_int size_C = bsc * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hC_1(size_C);
+    vector<T> hC_2(size_C);
+    vector<T> hC_gold(size_C);
+
+    // allocate memory on device
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_C),
+                                         rocblas_test::device_free};
+    auto d_alpha_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    auto d_beta_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dB      = (T*)dB_managed.get();
+    T* dC      = (T*)dC_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+    if((!dA && (size_A != 0)) || (!dB && (size_B != 0)) || !dC || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    // Initial Data on CPU, the padding between matrices is initialized too
+    srand(1);
+    rocblas_init<T>(hA, lda, size_A / lda, lda);
+    rocblas_init<T>(hB, ldb, size_B / ldb, ldb);
+    rocblas_init<T>(hC_1, ldc, size_C / ldc, ldc);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_1.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k_strided_batched<T>(handle,
+                                                             uplo,
+                                                             trans,
+                                                             N,
+                                                             K,
+                                                             &h_alpha,
+                                                             dA,
+                                                             lda,
+                                                             bsa,
+                                                             dB,
+                                                             ldb,
+                                                             bsb,
+                                                             &h_beta,
+                                                             dC,
+                                                             ldc,
+                                                             bsc,
+                                                             batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_2.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k_strided_batched<T>(handle,
+                                                             uplo,
+                                                             trans,
+                                                             N,
+                                                             K,
+                                                             d_alpha,
+                                                             dA,
+                                                             lda,
+                                                             bsa,
+                                                             dB,
+                                                             ldb,
+                                                             bsb,
+                                                             d_beta,
+                                                             dC,
+                                                             ldc,
+                                                             bsc,
+                                                             batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            cblas_syr2k<T>(uplo,
+                           trans,
+                           N,
+                           K,
+                           h_alpha,
+                          hA.data() + bsa * i,
+                          lda,
+                          hB.data() + bsb * i,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + bsc * i,
+                          ldc);
+        }
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = syr2k_gflop_count<T>(N, K) * batch_count / cpu_time_used * 1e6;
+
+        // compare the whole strided buffer, padding between matrices must be untouched as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(ldc, size_C / ldc, ldc, hC_gold.data(), hC_1.data());
+            unit_check_general<T>(ldc, size_C / ldc, ldc, hC_gold.data(), hC_2.data());
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 = norm_check_general<T>(
+                'F', ldc, size_C / ldc, ldc, hC_gold.data(), hC_1.data());
+            rocblas_error_2 = norm_check_general<T>(
+                'F', ldc, size_C / ldc, ldc, hC_gold.data(), hC_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_syr2k_strided_batched<T>(handle,
+                                             uplo,
+                                             trans,
+                                             N,
+                                             K,
+                                             &h_alpha,
+                                             dA,
+                                             lda,
+                                             bsa,
+                                             dB,
+                                             ldb,
+                                             bsb,
+                                             &h_beta,
+                                             dC,
+                                             ldc,
+                                             bsc,
+                                             batch_count);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_syr2k_strided_batched<T>(handle,
+                                             uplo,
+                                             trans,
+                                             N,
+                                             K,
+                                             &h_alpha,
+                                             dA,
+                                             lda,
+                                             bsa,
+                                             dB,
+                                             ldb,
+                                             bsb,
+                                             &h_beta,
+                                             dC,
+                                             ldc,
+                                             bsc,
+                                             batch_count);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = syr2k_gflop_count<T>(N, K) * batch_count / gpu_time_used * 1e6;
+
+        cout << "uplo,trans,N,K,alpha,lda,bsa,ldb,bsb,beta,ldc,bsc,Batch_Count,rocblas-Gflops,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << argus.uplo_option << "," << argus.transA_option << "," << N << "," << K << ","
+             << h_alpha << "," << lda << "," << bsa << "," << ldb << "," << bsb << "," << h_beta
+             << "," << ldc << "," << bsc << "," << batch_count << "," << rocblas_gflops << ","
+             << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error_1 << ","
+                 << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include <cmath> // std::abs
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "near.h"
+#include "flops.h"
+
+// the kernel may sum in a different order and with fma, allow this many eps per unit of K
+#define TBSV_EPS_MULTIPLIER 40
+
+using namespace std;
+
+template <typename T>
+rocblas_status testing_tbsv(Arguments argus)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int K    = argus.K;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+
+    char char_uplo   = argus.uplo_option;
+    char char_transA = argus.transA_option;
+    char char_diag   = argus.diag_option;
+
+    rocblas_fill uplo        = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal diag    = char2rocblas_diagonal(char_diag);
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K < 0 || lda < K + 1 || 0 == incx)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dx = (T*)dx_managed.get();
+        if(!dA || !dx)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rocblas_tbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx, incx);
+
+        tbsv_arg_check(status, N, K, lda, incx);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_X = N * abs_incx;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hb(size_X);
+    vector<T> hx_1(size_X);
+    vector<T> hx_gold(size_X);
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error = 0.0;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_X),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dx = (T*)dx_managed.get();
+    if(!dA || !dx)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hA, lda, N, lda);
+    rocblas_init<T>(hb, 1, N, abs_incx);
+
+    // row d of the band array holds the diagonal (upper: d == K, lower: d == 0); the off
+    // diagonals are scaled down so that the solve stays well conditioned, every entry of the
+    // array that is not part of A (and the diagonal when unit) is poisoned with NaN
+    rocblas_int d_diag = uplo == rocblas_fill_upper ? K : 0;
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int d = 0; d < lda; d++)
+        {
+            // row of A stored at band row d of column j
+            rocblas_int i = uplo == rocblas_fill_upper ? j + d - K : j + d;
+
+            if(d > K || i < 0 || i >= N)
+                hA[d + j * lda] = std::numeric_limits<T>::quiet_NaN();
+            else if(d == d_diag && diag == rocblas_diagonal_unit)
+                hA[d + j * lda] = std::numeric_limits<T>::quiet_NaN();
+            else if(d != d_diag)
+                hA[d + j * lda] = hA[d + j * lda] / (10 * (K + 1));
+        }
+    }
+
+    hx_1    = hb;
+    hx_gold = hb;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx_1.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_tbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx, incx));
+
+        CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx, sizeof(T) * size_X, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_tbsv<T>(uplo, transA, diag, N, K, hA.data(), lda, hx_gold.data(), incx);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = tbsv_gflop_count<T>(N, K) / cpu_time_used * 1e6;
+
+        if(argus.unit_check)
+        {
+            T max_x = 0.0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                T x   = std::abs(hx_gold[i * abs_incx]);
+                max_x = max_x > x ? max_x : x;
+            }
+
+            T abs_error =
+                TBSV_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * (K + 1) * max_x;
+
+            near_check_general<T, T>(1, N, abs_incx, hx_gold.data(), hx_1.data(), abs_error);
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', 1, N, abs_incx, hx_gold.data(), hx_1.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hb.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_tbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx, incx);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_tbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx, incx);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = tbsv_gflop_count<T>(N, K) / gpu_time_used * 1e6;
+
+        cout << "uplo,transA,diag,N,K,lda,incx,rocblas-Gflops,us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error";
+
+        cout << endl;
+
+        cout << char_uplo << ',' << char_transA << ',' << char_diag << ',' << N << ',' << K << ','
+             << lda << ',' << incx << ',' << rocblas_gflops << ',' << gpu_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "unit.h"
+
+using namespace std;
+
+/*
+    the in-place transpose of batch_count M by N matrices, by transpose_inplace for a batch of
+    one and by transpose_inplace_batched, the strided batched form, otherwise. A square matrix
+    keeps its lda, a rectangular one is contiguous and lda is ignored. The transpose only moves
+    elements, so it is checked exactly, including the padding of a square lda that it must not
+    touch.
+*/
+template <typename T>
+rocblas_status testing_transpose_inplace(Arguments argus, const string& routine)
+{
+    rocblas_int M           = argus.M;
+    rocblas_int N           = argus.N;
+    rocblas_int lda         = M == N ? argus.lda : (M > 1 ? M : 1);
+    rocblas_int batch_count = routine == "transpose_inplace" ? 1 : argus.batch_count;
+
+    rocblas_int safe_size = 100; // arbitararily set to 100
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating
+    // invalid memory
+    if(M <= 0 || N <= 0 || lda < M || batch_count <= 0)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        if(!dA)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        if(batch_count == 1)
+            status = rocblas_transpose_inplace<T>(handle, M, N, dA, lda);
+        else
+            status = rocblas_transpose_inplace_strided_batched<T>(
+                handle, M, N, dA, lda, safe_size, batch_count);
+
+        return status;
+    }
+
+    // the square matrices of a batch keep their padding, A_i and its transpose occupy lda * N
+    rocblas_int stride_a = lda * N;
+    rocblas_int size_A   = stride_a * batch_count;
+    rocblas_int ldt      = M == N ? lda : N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hA_gold(size_A);
+    vector<T> hA_result(size_A);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    if(!dA)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU, every element distinct so a misplaced one is caught
+    for(rocblas_int i = 0; i < size_A; i++)
+        hA[i] = (T)(i % 1000000);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // CPU transpose, the padding is left as it is
+        hA_gold = hA;
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int j = 0; j < N; j++)
+            {
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    hA_gold[b * stride_a + j + i * ldt] = hA[b * stride_a + i + j * lda];
+                }
+            }
+        }
+
+        if(batch_count == 1)
+            status = rocblas_transpose_inplace<T>(handle, M, N, dA, lda);
+        else
+            status = rocblas_transpose_inplace_strided_batched<T>(
+                handle, M, N, dA, lda, stride_a, batch_count);
+        CHECK_ROCBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_result.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+        unit_check_general<T>(1, size_A, 1, hA_gold.data(), hA_result.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_transpose_inplace_strided_batched<T>(
+                handle, M, N, dA, lda, stride_a, batch_count);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_transpose_inplace_strided_batched<T>(
+                handle, M, N, dA, lda, stride_a, batch_count);
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        // every element is read and written once
+        double bytes             = 2.0 * M * N * batch_count * sizeof(T);
+        double rocblas_bandwidth = bytes * number_hot_calls / gpu_time_used / 1e3;
+
+        cout << "M,N,lda,batch_count,us,rocblas-GB/s" << endl;
+
+        cout << M << "," << N << "," << lda << "," << batch_count << ","
+             << gpu_time_used / number_hot_calls << "," << rocblas_bandwidth << endl;
+    }
+
+    return rocblas_status_success;
+}
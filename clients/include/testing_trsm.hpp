@@ -383,3 +383,80 @@ rocblas_status testing_trsm(Arguments argus)
     }
     return rocblas_status_success;
 }
+
+/* ============================================================================================ */
+// alpha == 0 sets B to zero without reading it, like reference BLAS, so NaN in B does not
+// survive in either pointer mode
+template <typename T>
+void testing_trsm_alpha_zero(Arguments argus)
+{
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+
+    rocblas_side side        = char2rocblas_side(argus.side_option);
+    rocblas_fill uplo        = char2rocblas_fill(argus.uplo_option);
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_diagonal diag    = char2rocblas_diagonal(argus.diag_option);
+    T alpha_h                = 0;
+
+    rocblas_int K      = side == rocblas_side_left ? M : N;
+    rocblas_int size_A = lda * K;
+    rocblas_int size_B = ldb * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        // bad arguments are tested in other tests
+        return;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    vector<T> hA(size_A, 1.0);
+    vector<T> hB(size_B, 1.0);
+    vector<T> hZero(size_B, 1.0);
+
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < M; j++)
+        {
+            hB[j + i * ldb]    = std::numeric_limits<T>::quiet_NaN();
+            hZero[j + i * ldb] = 0;
+        }
+    }
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                         rocblas_test::device_free};
+    auto alpha_d_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dB      = (T*)dB_managed.get();
+    T* alpha_d = (T*)alpha_d_managed.get();
+    if(!dA || !dB || !alpha_d)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+    for(rocblas_pointer_mode mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        const T* alpha = mode == rocblas_pointer_mode_host ? &alpha_h : alpha_d;
+        vector<T> hXorB(hB);
+
+        CHECK_HIP_ERROR(hipMemcpy(dB, hXorB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_trsm<T>(handle, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb));
+        CHECK_HIP_ERROR(hipMemcpy(hXorB.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        unit_check_general<T>(M, N, ldb, hZero.data(), hXorB.data());
+    }
+}
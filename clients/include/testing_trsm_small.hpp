@@ -0,0 +1,296 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <cmath>  // std::abs
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "near.h"
+#include "flops.h"
+
+// small path and blocked path may differ by this many eps per unit of k, relative to max |X|
+#define TRSM_SMALL_EPS_MULTIPLIER 40
+
+// TRSM_SMALL_MAX_K of the library, the largest k the single kernel path accepts
+#define TRSM_SMALL_SWEEP_MAX_K 64
+
+using namespace std;
+
+/* ============================================================================================ */
+
+/*
+    ROCBLAS_TRSM_SMALL_K is read when a handle is created, so a handle pinned to one path is made
+    by setting it around rocblas_create_handle and restoring the previous value afterwards
+*/
+inline rocblas_test::handle_struct* trsm_small_create_handle(const char* small_k)
+{
+    const char* env = getenv("ROCBLAS_TRSM_SMALL_K");
+    std::string saved = env ? env : "";
+
+    setenv("ROCBLAS_TRSM_SMALL_K", small_k, 1);
+
+    rocblas_test::handle_struct* handle = new rocblas_test::handle_struct;
+
+    if(env)
+        setenv("ROCBLAS_TRSM_SMALL_K", saved.c_str(), 1);
+    else
+        unsetenv("ROCBLAS_TRSM_SMALL_K");
+
+    return handle;
+}
+
+/*
+    triangular K by K matrix whose off diagonal entries are scaled down to at most 1 / K, so every
+    row and column is diagonally dominant for unit and non unit diagonal and the solve stays well
+    conditioned for all side / uplo / transA combinations
+*/
+template <typename T>
+void trsm_small_init_A(vector<T>& hA, rocblas_int K, rocblas_int lda)
+{
+    rocblas_init<T>(hA, K, K, lda);
+
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        for(rocblas_int i = 0; i < lda; i++)
+        {
+            if(i >= K)
+                hA[i + j * lda] = 0.0;
+            else if(i != j)
+                hA[i + j * lda] = hA[i + j * lda] / (10 * K);
+        }
+    }
+}
+
+template <typename T>
+rocblas_status testing_trsm_small(Arguments argus)
+{
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+
+    char char_side   = argus.side_option;
+    char char_uplo   = argus.uplo_option;
+    char char_transA = argus.transA_option;
+    char char_diag   = argus.diag_option;
+    T alpha_h        = argus.alpha;
+
+    rocblas_side side        = char2rocblas_side(char_side);
+    rocblas_fill uplo        = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal diag    = char2rocblas_diagonal(char_diag);
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // only sizes both paths can solve are meaningful here, testing_trsm covers the argument checks
+    if(M <= 0 || N <= 0 || lda < K || ldb < M || K > TRSM_SMALL_SWEEP_MAX_K)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> blocked_handle_ptr(trsm_small_create_handle("0"));
+    std::unique_ptr<rocblas_test::handle_struct> small_handle_ptr(
+        trsm_small_create_handle(std::to_string(TRSM_SMALL_SWEEP_MAX_K).c_str()));
+    rocblas_handle blocked_handle = blocked_handle_ptr->handle;
+    rocblas_handle small_handle   = small_handle_ptr->handle;
+
+    rocblas_int size_A = lda * K;
+    rocblas_int size_B = ldb * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hX_blocked(size_B);
+    vector<T> hX_small_1(size_B);
+    vector<T> hX_small_2(size_B);
+
+    // allocate memory on device
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dXorB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                                            rocblas_test::device_free};
+    auto alpha_d_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+    T* dA      = (T*)dA_managed.get();
+    T* dXorB   = (T*)dXorB_managed.get();
+    T* alpha_d = (T*)alpha_d_managed.get();
+    if(!dA || !dXorB || !alpha_d)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    trsm_small_init_A<T>(hA, K, lda);
+    rocblas_init<T>(hB, M, N, ldb);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // blocked path: trtri of the diagonal blocks followed by gemm
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(blocked_handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsm<T>(
+            blocked_handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, dXorB, ldb));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hX_blocked.data(), dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // small path, rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(small_handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsm<T>(
+            small_handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, dXorB, ldb));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hX_small_1.data(), dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        // small path, rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(small_handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dXorB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsm<T>(
+            small_handle, side, uplo, transA, diag, M, N, alpha_d, dA, lda, dXorB, ldb));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hX_small_2.data(), dXorB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+        T max_x = 0.0;
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                T x   = std::abs(hX_blocked[i + j * ldb]);
+                max_x = max_x > x ? max_x : x;
+            }
+        }
+
+        T abs_error = TRSM_SMALL_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * K * max_x;
+
+        if(argus.unit_check)
+        {
+            near_check_general<T, T>(M, N, ldb, hX_blocked.data(), hX_small_1.data(), abs_error);
+            near_check_general<T, T>(M, N, ldb, hX_blocked.data(), hX_small_2.data(), abs_error);
+        }
+    }
+
+    if(argus.timing)
+    {
+        // sweep k up to the small path limit with the other dimension fixed, the largest k at
+        // which the small path still wins is the value to use for ROCBLAS_TRSM_SMALL_K
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        rocblas_int nrhs      = side == rocblas_side_left ? N : M;
+        rocblas_int crossover = 0;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(blocked_handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(small_handle, rocblas_pointer_mode_host));
+
+        cout << "side,uplo,transA,diag,k,nrhs,small-Gflops,small-us,blocked-Gflops,blocked-us"
+             << endl;
+
+        for(rocblas_int k = 1; k <= TRSM_SMALL_SWEEP_MAX_K; k = k < 8 ? k * 2 : k + 8)
+        {
+            rocblas_int m     = side == rocblas_side_left ? k : nrhs;
+            rocblas_int n     = side == rocblas_side_left ? nrhs : k;
+            rocblas_int k_lda = k;
+            rocblas_int k_ldb = m;
+
+            vector<T> hA_k(k_lda * k);
+            vector<T> hB_k(k_ldb * n);
+            trsm_small_init_A<T>(hA_k, k, k_lda);
+            rocblas_init<T>(hB_k, m, n, k_ldb);
+
+            auto dA_k_managed = rocblas_unique_ptr{
+                rocblas_test::device_malloc(sizeof(T) * k_lda * k), rocblas_test::device_free};
+            auto dB_k_managed = rocblas_unique_ptr{
+                rocblas_test::device_malloc(sizeof(T) * k_ldb * n), rocblas_test::device_free};
+            T* dA_k = (T*)dA_k_managed.get();
+            T* dB_k = (T*)dB_k_managed.get();
+            if(!dA_k || !dB_k)
+            {
+                PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+                return rocblas_status_memory_error;
+            }
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dA_k, hA_k.data(), sizeof(T) * k_lda * k, hipMemcpyHostToDevice));
+
+            double path_time_used[2];
+            rocblas_handle path_handle[2] = {small_handle, blocked_handle};
+
+            for(int path = 0; path < 2; path++)
+            {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dB_k, hB_k.data(), sizeof(T) * k_ldb * n, hipMemcpyHostToDevice));
+
+                for(int iter = 0; iter < number_cold_calls; iter++)
+                {
+                    rocblas_trsm<T>(path_handle[path],
+                                    side,
+                                    uplo,
+                                    transA,
+                                    diag,
+                                    m,
+                                    n,
+                                    &alpha_h,
+                                    dA_k,
+                                    k_lda,
+                                    dB_k,
+                                    k_ldb);
+                }
+
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+                path_time_used[path] = get_time_us(); // in microseconds
+
+                for(int iter = 0; iter < number_hot_calls; iter++)
+                {
+                    rocblas_trsm<T>(path_handle[path],
+                                    side,
+                                    uplo,
+                                    transA,
+                                    diag,
+                                    m,
+                                    n,
+                                    &alpha_h,
+                                    dA_k,
+                                    k_lda,
+                                    dB_k,
+                                    k_ldb);
+                }
+
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+                path_time_used[path] = (get_time_us() - path_time_used[path]) / number_hot_calls;
+            }
+
+            if(path_time_used[0] < path_time_used[1])
+                crossover = k;
+
+            double small_gflops   = trsm_gflop_count<T>(m, n, k) / path_time_used[0] * 1e6;
+            double blocked_gflops = trsm_gflop_count<T>(m, n, k) / path_time_used[1] * 1e6;
+
+            cout << char_side << ',' << char_uplo << ',' << char_transA << ',' << char_diag << ','
+                 << k << ',' << nrhs << ',' << small_gflops << ',' << path_time_used[0] << ','
+                 << blocked_gflops << ',' << path_time_used[1] << endl;
+        }
+
+        cout << "ROCBLAS_TRSM_SMALL_K=" << crossover << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include <cmath> // std::abs
+
+#include "rocblas.hpp"
+#include "arg_check.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "near.h"
+#include "flops.h"
+
+// the blocked solve and the cblas substitution may differ by this many eps per unit of n
+#define TRSV_EPS_MULTIPLIER 40
+
+using namespace std;
+
+template <typename T>
+rocblas_status testing_trsv(Arguments argus)
+{
+    rocblas_int N    = argus.N;
+    rocblas_int lda  = argus.lda;
+    rocblas_int incx = argus.incx;
+
+    char char_uplo   = argus.uplo_option;
+    char char_transA = argus.transA_option;
+    char char_diag   = argus.diag_option;
+
+    rocblas_fill uplo        = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal diag    = char2rocblas_diagonal(char_diag);
+
+    rocblas_int safe_size = 100;
+
+    rocblas_status status;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || lda < N || lda < 1 || 0 == incx)
+    {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                                             rocblas_test::device_free};
+        T* dA = (T*)dA_managed.get();
+        T* dx = (T*)dx_managed.get();
+        if(!dA || !dx)
+        {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        status = rocblas_trsv<T>(handle, uplo, transA, diag, N, dA, lda, dx, incx);
+
+        trsv_arg_check(status, N, lda, incx);
+
+        return status;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_X = N * abs_incx;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hb(size_X);
+    vector<T> hx_1(size_X);
+    vector<T> hx_2(size_X);
+    vector<T> hx_gold(size_X);
+
+    double gpu_time_used, cpu_time_used, trsm_time_used;
+    double rocblas_gflops, cblas_gflops;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                                         rocblas_test::device_free};
+    auto dx_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_X),
+                                         rocblas_test::device_free};
+    T* dA = (T*)dA_managed.get();
+    T* dx = (T*)dx_managed.get();
+    if(!dA || !dx)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    rocblas_init<T>(hA, N, N, lda);
+    rocblas_init<T>(hb, 1, N, abs_incx);
+
+    // scale the off diagonal entries down to at most 1 / N so that the unit and non unit
+    // triangles are diagonally dominant and the solve stays well conditioned for any N;
+    // the triangle that is not referenced (and the diagonal when unit) is poisoned with NaN
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            if(uplo == rocblas_fill_lower ? i < j : i > j)
+                hA[i + j * lda] = std::numeric_limits<T>::quiet_NaN();
+            else if(i == j && diag == rocblas_diagonal_unit)
+                hA[i + j * lda] = std::numeric_limits<T>::quiet_NaN();
+            else if(i != j)
+                hA[i + j * lda] = hA[i + j * lda] / (10 * N);
+        }
+    }
+
+    hx_1    = hb;
+    hx_2    = hb;
+    hx_gold = hb;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx_1.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsv<T>(handle, uplo, transA, diag, N, dA, lda, dx, incx));
+
+        CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx, sizeof(T) * size_X, hipMemcpyDeviceToHost));
+
+        // ROCBLAS rocblas_pointer_mode_device, trsv has no scalar argument but must leave the
+        // pointer mode of the handle as it found it
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx_2.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+        CHECK_ROCBLAS_ERROR(rocblas_trsv<T>(handle, uplo, transA, diag, N, dA, lda, dx, incx));
+
+        CHECK_HIP_ERROR(hipMemcpy(hx_2.data(), dx, sizeof(T) * size_X, hipMemcpyDeviceToHost));
+
+        rocblas_pointer_mode mode;
+        CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(rocblas_pointer_mode_device, mode);
+#endif
+
+        // CPU BLAS
+        cpu_time_used = get_time_us();
+
+        cblas_trsv<T>(uplo, transA, diag, N, hA.data(), lda, hx_gold.data(), incx);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+        cblas_gflops  = trsv_gflop_count<T>(N) / cpu_time_used * 1e6;
+
+        // the blocked solve sums in a different order than the substitution of cblas
+        if(argus.unit_check)
+        {
+            T max_x = 0.0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                T x   = std::abs(hx_gold[i * abs_incx]);
+                max_x = max_x > x ? max_x : x;
+            }
+
+            T abs_error = TRSV_EPS_MULTIPLIER * std::numeric_limits<T>::epsilon() * N * max_x;
+
+            near_check_general<T, T>(1, N, abs_incx, hx_gold.data(), hx_1.data(), abs_error);
+            near_check_general<T, T>(1, N, abs_incx, hx_gold.data(), hx_2.data(), abs_error);
+        }
+
+        if(argus.norm_check)
+        {
+            rocblas_error_1 =
+                norm_check_general<T>('F', 1, N, abs_incx, hx_gold.data(), hx_1.data());
+            rocblas_error_2 =
+                norm_check_general<T>('F', 1, N, abs_incx, hx_gold.data(), hx_2.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = 10;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // solve with a full (not poisoned) triangle, the same one for trsv and trsm
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            hA[j + j * lda] = 1.0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                if(uplo == rocblas_fill_lower ? i < j : i > j)
+                    hA[i + j * lda] = 0.0;
+            }
+        }
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dx, hb.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+            rocblas_trsv<T>(handle, uplo, transA, diag, N, dA, lda, dx, incx);
+        }
+
+        gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_trsv<T>(handle, uplo, transA, diag, N, dA, lda, dx, incx);
+        }
+
+        gpu_time_used  = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocblas_gflops = trsv_gflop_count<T>(N) / gpu_time_used * 1e6;
+
+        // the same solve as an N by 1 trsm, what callers had to use without trsv
+        T one = 1.0;
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_trsm<T>(
+                handle, rocblas_side_left, uplo, transA, diag, N, 1, &one, dA, lda, dx, N);
+        }
+
+        trsm_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_trsm<T>(
+                handle, rocblas_side_left, uplo, transA, diag, N, 1, &one, dA, lda, dx, N);
+        }
+
+        trsm_time_used = (get_time_us() - trsm_time_used) / number_hot_calls;
+
+        cout << "uplo,transA,diag,N,lda,incx,rocblas-Gflops,us,trsm-n1-us";
+
+        if(argus.norm_check)
+            cout << ",CPU-Gflops,us,norm_error_host_ptr,norm_error_dev_ptr";
+
+        cout << endl;
+
+        cout << char_uplo << ',' << char_transA << ',' << char_diag << ',' << N << ',' << lda
+             << ',' << incx << ',' << rocblas_gflops << ',' << gpu_time_used << ','
+             << trsm_time_used;
+
+        if(argus.norm_check)
+            cout << "," << cblas_gflops << "," << cpu_time_used << "," << rocblas_error_1 << ","
+                 << rocblas_error_2;
+
+        cout << endl;
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _ROCBLAS_TUNE_H_
+#define _ROCBLAS_TUNE_H_
+
+#include "rocblas.h"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief rocblas-tune: picks the Tensile solution of each gemm of a problem set by timing them
+ * all, and writes the picks into Logic files for Tensile_LOGIC=other.
+ *
+ * The Logic files of Tensile are YAML lists of nine items: version, schedule, architecture,
+ * device names, problem type, solutions, index order, exact logic and range logic. The exact
+ * logic holds [[m, n, batch_count, k], [solution, gflops]] pairs that Tensile looks up before
+ * the range logic. rocblas-tune keeps the first seven items and the range logic of a base Logic
+ * file and adds the tuned sizes to its exact logic; the solution indices are positions in the
+ * solutions item.
+ *
+ * The search and the Logic writing do not depend on how a solution is timed, tune_timer is the
+ * only part that runs on the device.
+ */
+
+/*! \brief a gemm or gemm_strided_batched of the problem set. The two are the same Tensile
+ * problem, but only gemm_strided_batched can run on the small batched kernels. */
+struct tune_problem
+{
+    char precision; // h, s or d
+    char transA_option;
+    char transB_option;
+    rocblas_int M;
+    rocblas_int N;
+    rocblas_int K;
+    rocblas_int batch_count;
+    bool strided_batched; // gemm_strided_batched, false for gemm
+};
+
+/*! \brief the solution picked for a problem */
+struct tune_result
+{
+    tune_problem problem;
+    rocblas_int solution;
+    double gflops;
+};
+
+/*! \brief times one solution of the Tensile library on one problem, in microseconds */
+class tune_timer
+{
+    public:
+    virtual ~tune_timer() {}
+    virtual double time_us(const tune_problem& problem, rocblas_int solution) = 0;
+};
+
+/*! \brief deterministic stand-in for the device: every (problem, solution) runs at its own
+ * fraction of peak_gflops, so the search and the Logic writing can be run without a GPU */
+class tune_simulated_timer : public tune_timer
+{
+    public:
+    tune_simulated_timer(double peak_gflops = 10000.0) : peak_gflops(peak_gflops) {}
+    virtual double time_us(const tune_problem& problem, rocblas_int solution);
+
+    private:
+    double peak_gflops;
+};
+
+/*! \brief runs a benchmark command per (problem, solution), e.g. the Tensile client built with
+ * the base Logic file. The tokens {precision}, {transA}, {transB}, {m}, {n}, {k}, {batch} and
+ * {solution} of the command are replaced, the last number the command prints is the time in
+ * microseconds. A command that fails, or prints no number, takes the solution out of the
+ * search. */
+class tune_command_timer : public tune_timer
+{
+    public:
+    tune_command_timer(const std::string& command) : command(command) {}
+    virtual double time_us(const tune_problem& problem, rocblas_int solution);
+
+    std::string expand(const tune_problem& problem, rocblas_int solution) const;
+
+    private:
+    std::string command;
+};
+
+/*! \brief reads a problem from a rocblas-bench command line, as written by
+ * ROCBLAS_LAYER=2, or from its arguments alone. Returns false for blank lines, comments
+ * starting with # and functions other than gemm and gemm_strided_batched. */
+bool tune_parse_problem(const std::string& line, tune_problem& problem);
+
+/*! \brief whether rocBLAS gives the problem to Tensile, degenerate and small batched shapes
+ * run on kernels of their own and are not tuned */
+bool tune_uses_tensile(const tune_problem& problem);
+
+/*! \brief the problem type of the Logic file, e.g. Cijk_Ailk_Bljk_SB */
+std::string tune_logic_name(const tune_problem& problem);
+
+/*! \brief gflops of the problem run in time_us microseconds */
+double tune_gflops(const tune_problem& problem, double time_us);
+
+/*! \brief number of solutions in a Logic file */
+rocblas_int tune_solution_count(const std::string& logic);
+
+/*! \brief the fastest of the solution_count solutions on each problem, best of iters timings.
+ * Problems no solution runs are left out. */
+std::vector<tune_result> tune_search(const std::vector<tune_problem>& problems,
+                                     rocblas_int solution_count,
+                                     tune_timer& timer,
+                                     rocblas_int iters);
+
+/*! \brief the base Logic file with results, all of its problem type, in its exact logic. A
+ * size already in the exact logic is replaced, the others are appended. Returns an empty string
+ * if logic is not a Logic file. */
+std::string tune_write_logic(const std::string& logic, const std::vector<tune_result>& results);
+
+#endif
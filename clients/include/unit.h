@@ -33,6 +33,11 @@
 template <typename T>
 void unit_check_general(rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU);
 
+/*! \brief Template: gtest compare the bit patterns of two matrices, for results that must be
+ * reproducible exactly, see rocblas_reduction_mode_deterministic */
+template <typename T>
+void bitwise_check_general(rocblas_int M, rocblas_int N, rocblas_int lda, T* hCPU, T* hGPU);
+
 template <typename T>
 void trsm_err_res_check(T max_error, rocblas_int M, T forward_tolerance, T eps);
 
@@ -102,6 +102,27 @@ inline float half_to_float(rocblas_half val)
     return _cvtsh_ss(val);
 }
 
+// Converts n floats into halves, eight at a time with the F16C instructions and rounding to the
+// nearest like the device conversion
+inline void float_to_half(rocblas_int n, const float* x, rocblas_half* y)
+{
+    rocblas_int i = 0;
+    for(; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)(y + i), _mm256_cvtps_ph(_mm256_loadu_ps(x + i), 0));
+    for(; i < n; i++)
+        y[i] = float_to_half(x[i]);
+}
+
+// Converts n halves into floats, eight at a time with the F16C instructions
+inline void half_to_float(rocblas_int n, const rocblas_half* x, float* y)
+{
+    rocblas_int i = 0;
+    for(; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(x + i))));
+    for(; i < n; i++)
+        y[i] = half_to_float(x[i]);
+}
+
 /* ============================================================================================ */
 /* generate random number :*/
 
@@ -327,6 +348,8 @@ rocblas_diagonal char2rocblas_diagonal(char value);
 
 rocblas_side char2rocblas_side(char value);
 
+rocblas_order char2rocblas_order(char value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -345,6 +368,9 @@ class Arguments
     rocblas_int N = 128;
     rocblas_int K = 128;
 
+    rocblas_int KL = 128;
+    rocblas_int KU = 128;
+
     rocblas_int rows = 128;
     rocblas_int cols = 128;
 
@@ -369,6 +395,11 @@ class Arguments
     char side_option   = 'L';
     char uplo_option   = 'L';
     char diag_option   = 'N';
+    char order_option  = 'C';
+
+    char y_precision_option = 's';
+    char rounding_option    = 'N';
+    rocblas_int seed        = 0;
 
     rocblas_int apiCallCount = 1;
     rocblas_int batch_count  = 10;
@@ -387,6 +418,9 @@ class Arguments
         N = rhs.N;
         K = rhs.K;
 
+        KL = rhs.KL;
+        KU = rhs.KU;
+
         lda = rhs.lda;
         ldb = rhs.ldb;
         ldc = rhs.ldc;
@@ -408,6 +442,11 @@ class Arguments
         side_option   = rhs.side_option;
         uplo_option   = rhs.uplo_option;
         diag_option   = rhs.diag_option;
+        order_option  = rhs.order_option;
+
+        y_precision_option = rhs.y_precision_option;
+        rounding_option    = rhs.rounding_option;
+        seed               = rhs.seed;
 
         apiCallCount = rhs.apiCallCount;
         batch_count  = rhs.batch_count;
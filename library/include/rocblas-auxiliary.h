@@ -65,6 +65,56 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_pointer_mode(rocblas_handle handle,
 ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_mode(rocblas_handle handle,
                                                        rocblas_pointer_mode* pointer_mode);
 
+/********************************************************************************
+ * \brief set rocblas_reduction_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_reduction_mode(rocblas_handle handle,
+                                                         rocblas_reduction_mode reduction_mode);
+
+/********************************************************************************
+ * \brief get rocblas_reduction_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_reduction_mode(rocblas_handle handle,
+                                                         rocblas_reduction_mode* reduction_mode);
+
+/********************************************************************************
+ * \brief set rocblas_accumulation_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+rocblas_set_accumulation_mode(rocblas_handle handle, rocblas_accumulation_mode accumulation_mode);
+
+/********************************************************************************
+ * \brief get rocblas_accumulation_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+rocblas_get_accumulation_mode(rocblas_handle handle, rocblas_accumulation_mode* accumulation_mode);
+
+/********************************************************************************
+ * \brief set rocblas_host_result_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+rocblas_set_host_result_mode(rocblas_handle handle, rocblas_host_result_mode host_result_mode);
+
+/********************************************************************************
+ * \brief get rocblas_host_result_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+rocblas_get_host_result_mode(rocblas_handle handle, rocblas_host_result_mode* host_result_mode);
+
+/********************************************************************************
+ * \brief copies the results of the asynchronous host pointer mode reductions that
+ * have completed to their result pointers, without waiting. pending returns the
+ * number of calls whose results are still in flight.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_query_host_results(rocblas_handle handle,
+                                                         rocblas_int* pending);
+
+/********************************************************************************
+ * \brief waits for the asynchronous host pointer mode reductions and copies all
+ * their results to their result pointers.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sync_host_results(rocblas_handle handle);
+
 /********************************************************************************
  * \brief copy vector from host to device
  *******************************************************************************/
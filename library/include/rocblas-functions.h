@@ -56,6 +56,12 @@ extern "C" {
 
     ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_hscal(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const rocblas_half* alpha,
+                                            rocblas_half* x,
+                                            rocblas_int incx);
+
 ROCBLAS_EXPORT rocblas_status
 rocblas_sscal(rocblas_handle handle, rocblas_int n, const float* alpha, float* x, rocblas_int incx);
 
@@ -139,6 +145,9 @@ rocblas_zcopy(rocblas_handle handle,
 
         result = conjugate (x) * y;
 
+    hdot of rocblas_half vectors accumulates in float and rounds the result to rocblas_half
+    once.
+
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -156,6 +165,14 @@ rocblas_zcopy(rocblas_handle handle,
 
     ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_hdot(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const rocblas_half* x,
+                                           rocblas_int incx,
+                                           const rocblas_half* y,
+                                           rocblas_int incy,
+                                           rocblas_half* result);
+
 ROCBLAS_EXPORT rocblas_status rocblas_sdot(rocblas_handle handle,
                                            rocblas_int n,
                                            const float* x,
@@ -318,9 +335,16 @@ rocblas_zaxpy(rocblas_handle handle,
     result
               store the asum product. either on the host CPU or device GPU.
               return is 0.0 if n, incx<=0.
+              hasum accumulates in float and rounds the result to rocblas_half once.
 
     ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_hasum(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const rocblas_half* x,
+                                            rocblas_int incx,
+                                            rocblas_half* result);
+
 ROCBLAS_EXPORT rocblas_status rocblas_sasum(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result);
 
@@ -362,8 +386,16 @@ rocblas_dzasum(rocblas_handle handle,
     result
               store the nrm2 product. either on the host CPU or device GPU.
               return is 0.0 if n, incx<=0.
+              hnrm2 accumulates the squares in float and rounds the norm to rocblas_half
+              once.
     ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_hnrm2(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const rocblas_half* x,
+                                            rocblas_int incx,
+                                            rocblas_half* result);
+
 ROCBLAS_EXPORT rocblas_status rocblas_snrm2(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result);
 
@@ -407,6 +439,12 @@ rocblas_dznrm2(rocblas_handle handle,
               return is 0.0 if n, incx<=0.
     ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_ihamax(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const rocblas_half* x,
+                                             rocblas_int incx,
+                                             rocblas_int* result);
+
 ROCBLAS_EXPORT rocblas_status rocblas_isamax(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result);
 
@@ -472,583 +510,3920 @@ rocblas_idzamin(rocblas_handle handle,
 
 /*
  * ===========================================================================
- *    level 2 BLAS
+ *    level 1 BLAS, batched
+ *
+ *    _strided_batched routines take the first vector of the batch and the stride bsx from
+ *    one vector to the next, _batched routines take an array of batch_count device pointers.
+ *    The whole batch is computed in one call, launched in chunks of at most 65535 vectors.
  * ===========================================================================
  */
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xGEMV performs one of the matrix-vector operations
-
-        y := alpha*A*x    + beta*y,   or
-        y := alpha*A**T*x + beta*y,   or
-        y := alpha*A**H*x + beta*y,
+    scal_strided_batched and scal_batched scale batch_count vectors x_i with the same scalar
+    alpha
 
-    where alpha and beta are scalars, x and y are vectors and A is an
-    m by n matrix.
+        x_i := alpha * x_i ,
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    trans     rocblas_operation
+    n         rocblas_int.
     @param[in]
-    m         rocblas_int
+    alpha     specifies the scalar alpha, shared by the batch.
+    @param[inout]
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
-    n         rocblas_int
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
     @param[in]
-    alpha
-              specifies the scalar alpha.
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const float* alpha,
+                                                            float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* alpha,
+                                                    float* const x[],
+                                                    rocblas_int incx,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const double* alpha,
+                                                            double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* alpha,
+                                                    double* const x[],
+                                                    rocblas_int incx,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    copy_strided_batched and copy_batched copy batch_count vectors x_i into the vectors y_i
+
+        y_i := x_i,
+
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
     @param[in]
-    x         pointer storing vector x on the GPU.
+    n         rocblas_int.
     @param[in]
-    incx      specifies the increment for the elements of x.
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
-    beta      specifies the scalar beta.
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
     @param[out]
-    y         pointer storing vector y on the GPU.
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
     incy      rocblas_int
-              specifies the increment for the elements of y.
-
+              specifies the increment for the elements of each y.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_sgemv(rocblas_handle handle,
-                                            rocblas_operation trans,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            const float* alpha,
-                                            const float* A,
-                                            rocblas_int lda,
-                                            const float* x,
-                                            rocblas_int incx,
-                                            const float* beta,
-                                            float* y,
-                                            rocblas_int incy);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgemv(rocblas_handle handle,
-                                            rocblas_operation trans,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            const double* alpha,
-                                            const double* A,
-                                            rocblas_int lda,
-                                            const double* x,
-                                            rocblas_int incx,
-                                            const double* beta,
-                                            double* y,
-                                            rocblas_int incy);
+ROCBLAS_EXPORT rocblas_status rocblas_scopy_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cgemv(rocblas_handle handle,
-                 rocblas_operation trans,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *A, rocblas_int lda,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                 const rocblas_float_complex *beta,
-                 rocblas_float_complex *y, rocblas_int incy);
+ROCBLAS_EXPORT rocblas_status rocblas_scopy_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    float* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zgemv(rocblas_handle handle,
-                 rocblas_operation trans,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *A, rocblas_int lda,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                 const rocblas_double_complex *beta,
-                 rocblas_double_complex *y, rocblas_int incy);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_dcopy_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
 
-/*! \brief BLAS Level 2 API
+ROCBLAS_EXPORT rocblas_status rocblas_dcopy_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    double* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
 
     \details
-    xHE(SY)MV performs the matrix-vector operation:
+    copy_ex copies the vector x into the vector y of another precision, for  i = 1 , … , n
 
-        y := alpha*A*x + beta*y,
+        y := x,
 
-    where alpha and beta are scalars, x and y are n element vectors and
-    A is an n by n Hermitian(Symmetric) matrix.
+    as rocblas_convert with rocblas_rounding_mode_nearest and no scaling.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    uplo      rocblas_fill.
-              specifies whether the upper or lower
-    @param[in]
     n         rocblas_int.
     @param[in]
-    alpha
-              specifies the scalar alpha.
-    @param[in]
-    A         pointer storing matrix A on the GPU.
-    @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
-    @param[in]
     x         pointer storing vector x on the GPU.
     @param[in]
-    incx      specifies the increment for the elements of x.
+    x_type    rocblas_precision
+              precision of x, rocblas_precision_half, single or double.
     @param[in]
-    beta      specifies the scalar beta.
+    incx      specifies the increment for the elements of x.
     @param[out]
     y         pointer storing vector y on the GPU.
     @param[in]
+    y_type    rocblas_precision
+              precision of y, rocblas_precision_half, single or double.
+    @param[in]
     incy      rocblas_int
               specifies the increment for the elements of y.
 
     ********************************************************************/
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_ssymv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const float *alpha,
-                 const float *A, rocblas_int lda,
-                 const float *x, rocblas_int incx,
-                 const float *beta,
-                 float *y, rocblas_int incy);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_dsymv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const double *alpha,
-                 const double *A, rocblas_int lda,
-                 const double *x, rocblas_int incx,
-                 const double *beta,
-                 double *y, rocblas_int incy);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_copy_ex(rocblas_handle handle,
+                                              rocblas_int n,
+                                              const void* x,
+                                              rocblas_precision x_type,
+                                              rocblas_int incx,
+                                              void* y,
+                                              rocblas_precision y_type,
+                                              rocblas_int incy);
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_chemv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *A, rocblas_int lda,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                 const rocblas_float_complex *beta,
-                 rocblas_float_complex *y, rocblas_int incy);
+/*! \brief BLAS Level 1 API
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zhemv(rocblas_handle handle,
-                 rocblas_fill uplo,
-                 rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *A, rocblas_int lda,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                 const rocblas_double_complex *beta,
-                 rocblas_double_complex *y, rocblas_int incy);
-*/
+    \details
+    convert converts the vector x into the vector y of another precision, for  i = 1 , … , n
 
-/*! \brief BLAS Level 2 API
+        y := round( alpha * x ),
 
-    \details
-    xGER performs the matrix-vector operations
+    and convert_matrix the m by n matrix A into the matrix B
 
-        A := A + alpha*x*y**T
+        B := round( alpha * A ).
 
-    where alpha is a scalars, x and y are vectors, and A is an
-    m by n matrix.
+    The product is formed in double if x or y is double or y is half and in float otherwise,
+    and rounded once to the precision of y when that is narrower. In rocblas_rounding_mode_stochastic the
+    product is scaled by a power of 2 so that the units of the last place of y are 1, and
+    rounded up if its fraction times 2^32 exceeds the random bits of the element
+
+        h = seed * 0x9E3779B9 + k,  h ^= h >> 16,  h *= 0x7FEB352D,
+        h ^= h >> 15,  h *= 0x846CA68B,  h ^= h >> 16,
+
+    in unsigned 32 bit arithmetic, where k is i - 1 for element i of x and (i - 1) + (j - 1) * m
+    for element (i, j) of A. The results are therefore reproducible on the host.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    m         rocblas_int
+    rounding  rocblas_rounding_mode.
     @param[in]
-    n         rocblas_int
+    seed      rocblas_int.
+              seed of the random bits, taken as 32 unsigned bits, stochastic rounding only.
     @param[in]
-    alpha
-              specifies the scalar alpha.
+    m         rocblas_int.
+              rows of A, convert_matrix only.
     @param[in]
-    x         pointer storing vector x on the GPU.
+    n         rocblas_int.
+              elements of x, or columns of A.
+    @param[in]
+    alpha     specifies the scalar alpha in double, nullptr for no scaling.
+    @param[in]
+    x         pointer storing vector x (matrix A) on the GPU.
+    @param[in]
+    x_type    rocblas_precision
+              precision of x (A), rocblas_precision_half, single or double.
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of x (leading dimension of A).
+    @param[out]
+    y         pointer storing vector y (matrix B) on the GPU.
     @param[in]
-    y         pointer storing vector y on the GPU.
+    y_type    rocblas_precision
+              precision of y (B), rocblas_precision_half, single or double.
     @param[in]
     incy      rocblas_int
-              specifies the increment for the elements of y.
-    @param[inout]
-    A         pointer storing matrix A on the GPU.
-    @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+              specifies the increment for the elements of y (leading dimension of B).
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_sger(rocblas_handle handle,
-                                           rocblas_int m,
-                                           rocblas_int n,
-                                           const float* alpha,
-                                           const float* x,
-                                           rocblas_int incx,
-                                           const float* y,
-                                           rocblas_int incy,
-                                           float* A,
-                                           rocblas_int lda);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dger(rocblas_handle handle,
-                                           rocblas_int m,
-                                           rocblas_int n,
-                                           const double* alpha,
-                                           const double* x,
-                                           rocblas_int incx,
-                                           const double* y,
-                                           rocblas_int incy,
-                                           double* A,
-                                           rocblas_int lda);
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cger(rocblas_handle handle,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                 const rocblas_float_complex *y, rocblas_int incy,
-                       rocblas_float_complex *A, rocblas_int lda);
-
-ROCBLAS_EXPORT rocblas_status
-rocblas_zger(rocblas_handle handle,
-                 rocblas_int m, rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                 const rocblas_double_complex *y, rocblas_int incy,
-                       rocblas_double_complex *A, rocblas_int lda);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_convert(rocblas_handle handle,
+                                              rocblas_rounding_mode rounding,
+                                              rocblas_int seed,
+                                              rocblas_int n,
+                                              const double* alpha,
+                                              const void* x,
+                                              rocblas_precision x_type,
+                                              rocblas_int incx,
+                                              void* y,
+                                              rocblas_precision y_type,
+                                              rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_convert_matrix(rocblas_handle handle,
+                                                     rocblas_rounding_mode rounding,
+                                                     rocblas_int seed,
+                                                     rocblas_int m,
+                                                     rocblas_int n,
+                                                     const double* alpha,
+                                                     const void* A,
+                                                     rocblas_precision a_type,
+                                                     rocblas_int lda,
+                                                     void* B,
+                                                     rocblas_precision b_type,
+                                                     rocblas_int ldb);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    xSYR performs the matrix-vector operations
+    dot_strided_batched and dot_batched perform the dot products of batch_count pairs of
+    vectors
 
-        A := A + alpha*x*x**T
-
-    where alpha is a scalars, x is a vector, and A is an
-    n by n symmetric matrix.
+        result[i] = x_i * y_i;
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    n         rocblas_int
-    @param[in]
-    alpha
-              specifies the scalar alpha.
+    n         rocblas_int.
     @param[in]
-    x         pointer storing vector x on the GPU.
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
     incx      rocblas_int
-              specifies the increment for the elements of x.
-    @param[inout]
-    A         pointer storing matrix A on the GPU.
+              specifies the increment for the elements of each x.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
-
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[in]
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[inout]
+    result
+              array of batch_count dot products, either on the host CPU or device GPU.
+              every entry is 0.0 if n <= 0.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
-                                           rocblas_fill uplo,
-                                           rocblas_int n,
-                                           const float* alpha,
-                                           const float* x,
-                                           rocblas_int incx,
-                                           float* A,
-                                           rocblas_int lda);
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_strided_batched(rocblas_handle handle,
+                                                           rocblas_int n,
+                                                           const float* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           const float* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           float* result,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_batched(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const float* const x[],
+                                                   rocblas_int incx,
+                                                   const float* const y[],
+                                                   rocblas_int incy,
+                                                   float* result,
+                                                   rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_strided_batched(rocblas_handle handle,
+                                                           rocblas_int n,
+                                                           const double* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           const double* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           double* result,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_batched(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   const double* const x[],
+                                                   rocblas_int incx,
+                                                   const double* const y[],
+                                                   rocblas_int incy,
+                                                   double* result,
+                                                   rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
-                                           rocblas_fill uplo,
-                                           rocblas_int n,
-                                           const double* alpha,
-                                           const double* x,
-                                           rocblas_int incx,
-                                           double* A,
-                                           rocblas_int lda);
+/*! \brief BLAS Level 1 API
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_csyr(rocblas_handle handle,
-                 rocblas_int n,
-                 const rocblas_float_complex *alpha,
-                 const rocblas_float_complex *x, rocblas_int incx,
-                       rocblas_float_complex *A, rocblas_int lda);
+    \details
+    swap_strided_batched and swap_batched interchange batch_count pairs of vectors
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zsyr(rocblas_handle handle,
-                 rocblas_int n,
-                 const rocblas_double_complex *alpha,
-                 const rocblas_double_complex *x, rocblas_int incx,
-                       rocblas_double_complex *A, rocblas_int lda);
-*/
+        y_i := x_i; x_i := y_i
 
-/*
- * ===========================================================================
- *    level 3 BLAS
- * ===========================================================================
- */
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+    @param[inout]
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
+    ********************************************************************/
 
-/*! \brief BLAS Level 3 API
+ROCBLAS_EXPORT rocblas_status rocblas_sswap_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sswap_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    float* const x[],
+                                                    rocblas_int incx,
+                                                    float* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dswap_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dswap_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    double* const x[],
+                                                    rocblas_int incx,
+                                                    double* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
 
     \details
-    trtri  compute the inverse of a matrix  A, namely, invA
+    axpy_strided_batched and axpy_batched compute batch_count vectors with the same scalar
+    alpha
 
-        and write the result into invA;
+        y_i := alpha * x_i + y_i
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    uplo      rocblas_fill.
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-              if rocblas_fill_upper, the lower part of A is not referenced
-              if rocblas_fill_lower, the upper part of A is not referenced
+    n         rocblas_int.
     @param[in]
-    diag      rocblas_diagonal.
-              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
-              = 'rocblas_diagonal_unit', A is unit triangular;
+    alpha     specifies the scalar alpha, shared by the batch.
     @param[in]
-    n         rocblas_int.
-              size of matrix A and invA
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
-    @param[output]
-    invA      pointer storing matrix invA on the GPU.
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
-    ldinvA    rocblas_int
-              specifies the leading dimension of invA.
+    incy      rocblas_int
+              specifies the increment for the elements of each y.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
+    ********************************************************************/
 
-********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const float* alpha,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_strtri(rocblas_handle handle,
-                                             rocblas_fill uplo,
-                                             rocblas_diagonal diag,
-                                             rocblas_int n,
-                                             float* A,
-                                             rocblas_int lda,
-                                             float* invA,
-                                             rocblas_int ldinvA);
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* alpha,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    float* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrtri(rocblas_handle handle,
-                                             rocblas_fill uplo,
-                                             rocblas_diagonal diag,
-                                             rocblas_int n,
-                                             double* A,
-                                             rocblas_int lda,
-                                             double* invA,
-                                             rocblas_int ldinvA);
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const double* alpha,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
 
-/*! \brief BLAS Level 3 API
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* alpha,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    double* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
 
     \details
-    trtri  compute the inverse of a matrix  A
+    asum_strided_batched and asum_batched compute the sums of the magnitudes of the elements of
+    batch_count real vectors
 
-        inv(A);
+        result[i] = sum_j |x_i[j]|
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    uplo      rocblas_fill.
-              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+    n         rocblas_int.
     @param[in]
-    diag      rocblas_diagonal.
-              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
-              = 'rocblas_diagonal_unit', A is unit triangular;
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    result
+              array of batch_count results, either on the host CPU or device GPU.
+              every entry is 0.0 if n, incx <= 0.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* result,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sasum_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    float* result,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dasum_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* result,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dasum_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    double* result,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    nrm2_strided_batched and nrm2_batched compute the euclidean norms of batch_count real
+    vectors
+
+        result[i] = sqrt( x_i'*x_i )
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
     @param[in]
     n         rocblas_int.
     @param[in]
-    A         pointer storing matrix A on the GPU.
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
     @param[in]
-    lda       rocblas_int
-              specifies the leading dimension of A.
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
     @param[in]
-    bsa       rocblas_int
-             "batch stride a": stride from the start of one "A" matrix to the next
-    @param[output]
-    invA      pointer storing the inverse matrix A on the GPU.
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    result
+              array of batch_count results, either on the host CPU or device GPU.
+              every entry is 0.0 if n, incx <= 0.
     @param[in]
-    ldinvA    rocblas_int
-              specifies the leading dimension of invA.
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_snrm2_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* result,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_snrm2_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    float* result,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnrm2_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* result,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnrm2_batched(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    double* result,
+                                                    rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    amax_strided_batched and amax_batched find the first index of the element of maximum
+    magnitude of each of batch_count real vectors
+
     @param[in]
-    bsinvA    rocblas_int
-             "batch stride invA": stride from the start of one "invA" matrix to the next
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
     @param[in]
-    batch_count       rocblas_int
-              numbers of matrices in the batch
+    n         rocblas_int.
+    @param[in]
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    result
+              array of batch_count amax indices, either on the host CPU or device GPU.
+              every entry is 0 if n, incx <= 0.
+    @param[in]
+    batch_count rocblas_int
+              number of vectors in the batch, quick return if 0.
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strtri_batched(rocblas_handle handle,
-                                                     rocblas_fill uplo,
-                                                     rocblas_diagonal diag,
-                                                     rocblas_int n,
-                                                     float* A,
-                                                     rocblas_int lda,
-                                                     rocblas_int bsa,
-                                                     float* invA,
-                                                     rocblas_int ldinvA,
-                                                     rocblas_int bsinvA,
-                                                     rocblas_int batch_count);
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_strided_batched(rocblas_handle handle,
+                                                             rocblas_int n,
+                                                             const float* x,
+                                                             rocblas_int incx,
+                                                             rocblas_int bsx,
+                                                             rocblas_int* result,
+                                                             rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_batched(rocblas_handle handle,
-                                                     rocblas_fill uplo,
-                                                     rocblas_diagonal diag,
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_batched(rocblas_handle handle,
                                                      rocblas_int n,
-                                                     double* A,
-                                                     rocblas_int lda,
-                                                     rocblas_int bsa,
-                                                     double* invA,
-                                                     rocblas_int ldinvA,
-                                                     rocblas_int bsinvA,
+                                                     const float* const x[],
+                                                     rocblas_int incx,
+                                                     rocblas_int* result,
                                                      rocblas_int batch_count);
 
-/*! \brief BLAS Level 3 API
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_strided_batched(rocblas_handle handle,
+                                                             rocblas_int n,
+                                                             const double* x,
+                                                             rocblas_int incx,
+                                                             rocblas_int bsx,
+                                                             rocblas_int* result,
+                                                             rocblas_int batch_count);
 
-    \details
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_batched(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const double* const x[],
+                                                     rocblas_int incx,
+                                                     rocblas_int* result,
+                                                     rocblas_int batch_count);
 
-    trsm solves
+/*
+ * ===========================================================================
+ *    level 1 BLAS, fused multi-vector
+ * ===========================================================================
+ */
 
-        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+/*! \brief BLAS Level 1 API
 
-    where alpha is a scalar, X and B are m by n matrices,
-    A is triangular matrix and op(A) is one of
+    \details
+    mdot performs the dot products of the k columns of the n by k matrix V with the vector x
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+        result[j] = V(:, j) * x,  for j = 0, ... , k - 1,
 
-    The matrix X is overwritten on B.
+    i.e. result = V^T * x for a tall and skinny V. x is read once for up to 32 columns, the
+    k results come from one launch instead of k dot calls.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
-
-    @param[in]
-    side    rocblas_side.
-            rocblas_side_left:       op(A)*X = alpha*B.
-            rocblas_side_right:      X*op(A) = alpha*B.
-
     @param[in]
-    uplo    rocblas_fill.
-            rocblas_fill_upper:  A is an upper triangular matrix.
-            rocblas_fill_lower:  A is a  lower triangular matrix.
-
+    n         rocblas_int. number of rows of V and elements of x.
     @param[in]
-    transA  rocblas_operation.
-            transB:    op(A) = A.
-            rocblas_operation_transpose:      op(A) = A^T.
-            rocblas_operation_conjugate_transpose:  op(A) = A^H.
-
+    k         rocblas_int. number of columns of V.
     @param[in]
-    diag    rocblas_diagonal.
-            rocblas_diagonal_unit:     A is assumed to be unit triangular.
-            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
-
+    V         pointer storing matrix V on the GPU.
     @param[in]
-    m       rocblas_int.
-            m specifies the number of rows of B. m >= 0.
-
+    ldv       rocblas_int
+              specifies the leading dimension of V, ldv >= max(1, n).
     @param[in]
-    n       rocblas_int.
-            n specifies the number of columns of B. n >= 0.
-
+    x         pointer storing vector x on the GPU.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
-            entry.
+    incx      rocblas_int
+              specifies the increment for the elements of x, incx != 0.
+    @param[inout]
+    result
+              array of k dot products, either on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_smdot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const float* V,
+                                            rocblas_int ldv,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dmdot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* V,
+                                            rocblas_int ldv,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            double* result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    maxpy adds a linear combination of the k columns of the n by k matrix V to the vector y
+
+        y := y + sum_j alpha[j] * V(:, j),  for j = 0, ... , k - 1,
+
+    i.e. y := V * alpha + y for a tall and skinny V. y is read and written once for up to 32
+    columns instead of once per axpy.
 
     @param[in]
-    A       pointer storing matrix A on the GPU.
-            of dimension ( lda, k ), where k is m
-            when  rocblas_side_left  and
-            is  n  when  rocblas_side_right
-            only the upper/lower triangular part is accessed.
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int. number of rows of V and elements of y.
+    @param[in]
+    k         rocblas_int. number of columns of V.
+    @param[in]
+    alpha     array of the k scalars alpha[j], on the host CPU or device GPU.
+    @param[in]
+    V         pointer storing matrix V on the GPU.
+    @param[in]
+    ldv       rocblas_int
+              specifies the leading dimension of V, ldv >= max(1, n).
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y, incy != 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_smaxpy(rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const float* alpha,
+                                             const float* V,
+                                             rocblas_int ldv,
+                                             float* y,
+                                             rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dmaxpy(rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const double* alpha,
+                                             const double* V,
+                                             rocblas_int ldv,
+                                             double* y,
+                                             rocblas_int incy);
+
+/*
+ * ===========================================================================
+ *    level 1 BLAS, fused
+ * ===========================================================================
+ */
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_dot updates y and takes its dot product with z in one pass over the vectors
+
+        y := alpha * x + y,
+        result = y * z,
+
+    instead of an axpy followed by a dot that reads y again. z may be y.
 
     @param[in]
-    lda     rocblas_int.
-            lda specifies the first dimension of A.
-            if side = rocblas_side_left,  lda >= max( 1, m ),
-            if side = rocblas_side_right, lda >= max( 1, n ).
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[in]
+    z         pointer storing vector z on the GPU.
+    @param[in]
+    incz      rocblas_int
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              store the dot product. either on the host CPU or device GPU.
+              return is 0.0 if n <= 0.
+    ********************************************************************/
 
-    @param[in,output]
-    B       pointer storing matrix B on the GPU.
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* alpha,
+                                                const float* x,
+                                                rocblas_int incx,
+                                                float* y,
+                                                rocblas_int incy,
+                                                const float* z,
+                                                rocblas_int incz,
+                                                float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* alpha,
+                                                const double* x,
+                                                rocblas_int incx,
+                                                double* y,
+                                                rocblas_int incy,
+                                                const double* z,
+                                                rocblas_int incz,
+                                                double* result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    dot_nrm2 computes the dot product of x and y and the euclidean norm of x in one pass over
+    the vectors
+
+        dot_result  = x * y,
+        nrm2_result = sqrt( x * x ),
+
+    instead of a dot and a nrm2 that both read x.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    dot_result
+              store the dot product. either on the host CPU or device GPU.
+    @param[inout]
+    nrm2_result
+              store the norm of x, in the same memory as dot_result.
+              both results are 0.0 if n <= 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_nrm2(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* x,
+                                                rocblas_int incx,
+                                                const float* y,
+                                                rocblas_int incy,
+                                                float* dot_result,
+                                                float* nrm2_result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_nrm2(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* x,
+                                                rocblas_int incx,
+                                                const double* y,
+                                                rocblas_int incy,
+                                                double* dot_result,
+                                                double* nrm2_result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    scal_copy writes the scaled vector x to y in one pass
+
+        y := alpha * x ,
+
+    instead of a copy followed by a scal that reads and writes y again.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[out]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_copy(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 const float* alpha,
+                                                 const float* x,
+                                                 rocblas_int incx,
+                                                 float* y,
+                                                 rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_copy(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 const double* alpha,
+                                                 const double* x,
+                                                 rocblas_int incx,
+                                                 double* y,
+                                                 rocblas_int incy);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot applies the plane rotation (c, s) to the pairs of elements of x and y
+
+        x[i] :=  c * x[i] + s * y[i],
+        y[i] := -s * x[i] + c * y[i],  for  i = 1 , … , n
+
+    c and s are real, csrot and zdrot rotate the real and imaginary parts of complex vectors
+    alike.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    c         the cosine of the rotation, on the host CPU or device GPU.
+    @param[in]
+    s         the sine of the rotation, on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srot(rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* x,
+                                           rocblas_int incx,
+                                           float* y,
+                                           rocblas_int incy,
+                                           const float* c,
+                                           const float* s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot(rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* x,
+                                           rocblas_int incx,
+                                           double* y,
+                                           rocblas_int incy,
+                                           const double* c,
+                                           const double* s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csrot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_float_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_float_complex* y,
+                                            rocblas_int incy,
+                                            const float* c,
+                                            const float* s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zdrot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_double_complex* x,
+                                            rocblas_int incx,
+                                            rocblas_double_complex* y,
+                                            rocblas_int incy,
+                                            const double* c,
+                                            const double* s);
+
+/* not implemented, complex s
+ROCBLAS_EXPORT rocblas_status
+rocblas_crot(rocblas_handle handle,
+    rocblas_int n,
+    rocblas_float_complex *x, rocblas_int incx,
+    rocblas_float_complex *y, rocblas_int incy,
+    const float *c, const rocblas_float_complex *s);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zrot(rocblas_handle handle,
+    rocblas_int n,
+    rocblas_double_complex *x, rocblas_int incx,
+    rocblas_double_complex *y, rocblas_int incy,
+    const double *c, const rocblas_double_complex *s);
+*/
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot_strided_batched and rot_batched apply the same plane rotation (c, s) to batch_count
+    pairs of vectors x_i and y_i in one call
+
+        x_i :=  c * x_i + s * y_i,
+        y_i := -s * x_i + c * y_i ,
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[inout]
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of each x.
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of each y.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[in]
+    c         the cosine of the rotation, shared by the batch.
+    @param[in]
+    s         the sine of the rotation, shared by the batch.
+    @param[in]
+    batch_count rocblas_int
+              number of pairs of vectors in the batch, quick return if 0.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srot_strided_batched(rocblas_handle handle,
+                                                           rocblas_int n,
+                                                           float* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           float* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           const float* c,
+                                                           const float* s,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_srot_batched(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   float* const x[],
+                                                   rocblas_int incx,
+                                                   float* const y[],
+                                                   rocblas_int incy,
+                                                   const float* c,
+                                                   const float* s,
+                                                   rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_strided_batched(rocblas_handle handle,
+                                                           rocblas_int n,
+                                                           double* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           double* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           const double* c,
+                                                           const double* s,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_batched(rocblas_handle handle,
+                                                   rocblas_int n,
+                                                   double* const x[],
+                                                   rocblas_int incx,
+                                                   double* const y[],
+                                                   rocblas_int incy,
+                                                   const double* c,
+                                                   const double* s,
+                                                   rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot_sequence applies the k plane rotations (c[j], s[j]) in turn to the pair of vectors x
+    and y
+
+        for j = 0, ... , k - 1
+            x :=  c[j] * x + s[j] * y,
+            y := -s[j] * x + c[j] * y ,
+
+    the result of k calls of rot in one pass over x and y instead of k passes: the pairs of
+    elements stay in registers across the sequence.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[in]
+    k         rocblas_int. number of rotations, quick return if k <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    c         array of the k cosines c[j], on the host CPU or device GPU.
+    @param[in]
+    s         array of the k sines s[j], on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    float* x,
+                                                    rocblas_int incx,
+                                                    float* y,
+                                                    rocblas_int incy,
+                                                    const float* c,
+                                                    const float* s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    double* x,
+                                                    rocblas_int incx,
+                                                    double* y,
+                                                    rocblas_int incy,
+                                                    const double* c,
+                                                    const double* s);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotg constructs the plane rotation (c, s) that zeros the second entry of [a, b]
+
+        [  c  s ] * [ a ] = [ r ]
+        [ -s  c ]   [ b ]   [ 0 ] ,
+
+    a is overwritten by r and b by z, from which c and s can be recovered as in the reference
+    BLAS.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[inout]
+    a         the scalar a, overwritten by r, on the host CPU or device GPU.
+    @param[inout]
+    b         the scalar b, overwritten by z, on the host CPU or device GPU.
+    @param[out]
+    c         the cosine of the rotation, on the host CPU or device GPU.
+    @param[out]
+    s         the sine of the rotation, on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_srotg(rocblas_handle handle, float* a, float* b, float* c, float* s);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_drotg(rocblas_handle handle, double* a, double* b, double* c, double* s);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_crotg(rocblas_handle handle,
+    rocblas_float_complex *a, rocblas_float_complex *b,
+    float *c, rocblas_float_complex *s);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zrotg(rocblas_handle handle,
+    rocblas_double_complex *a, rocblas_double_complex *b,
+    double *c, rocblas_double_complex *s);
+*/
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotg_strided_batched constructs batch_count plane rotations, a_i, b_i, c_i and s_i start
+    stride_a, stride_b, stride_c and stride_s elements apart, on the host CPU or device GPU.
+    ********************************************************************/
 
+ROCBLAS_EXPORT rocblas_status rocblas_srotg_strided_batched(rocblas_handle handle,
+                                                            float* a,
+                                                            rocblas_int stride_a,
+                                                            float* b,
+                                                            rocblas_int stride_b,
+                                                            float* c,
+                                                            rocblas_int stride_c,
+                                                            float* s,
+                                                            rocblas_int stride_s,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotg_strided_batched(rocblas_handle handle,
+                                                            double* a,
+                                                            rocblas_int stride_a,
+                                                            double* b,
+                                                            rocblas_int stride_b,
+                                                            double* c,
+                                                            rocblas_int stride_c,
+                                                            double* s,
+                                                            rocblas_int stride_s,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotm applies the modified Givens transformation H to the pairs of elements of x and y
+
+        [ x[i] ] := H * [ x[i] ] ,  for  i = 1 , … , n
+        [ y[i] ]        [ y[i] ]
+
+    H is given by param = (flag, h11, h21, h12, h22):
+
+        flag = -1: H = [ h11 h12 ]   flag = 0: H = [ 1   h12 ]
+                       [ h21 h22 ]                 [ h21 1   ]
+
+        flag =  1: H = [ h11 1   ]   flag = -2: H = identity
+                       [ -1  h22 ]
+
+    the entries of H implied by the flag are not read.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    param     array of 5 values, on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srotm(rocblas_handle handle,
+                                            rocblas_int n,
+                                            float* x,
+                                            rocblas_int incx,
+                                            float* y,
+                                            rocblas_int incy,
+                                            const float* param);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotm(rocblas_handle handle,
+                                            rocblas_int n,
+                                            double* x,
+                                            rocblas_int incx,
+                                            double* y,
+                                            rocblas_int incy,
+                                            const double* param);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotm_strided_batched applies the modified Givens transformation H_i of param_i to
+    batch_count pairs of vectors x_i and y_i, the vectors start bsx (bsy) elements apart and
+    the params stride_param elements apart. In host pointer mode each pair is a launch of its
+    own.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srotm_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            const float* param,
+                                                            rocblas_int stride_param,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotm_strided_batched(rocblas_handle handle,
+                                                            rocblas_int n,
+                                                            double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            const double* param,
+                                                            rocblas_int stride_param,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotmg constructs the modified Givens transformation H that zeros the second entry of
+    [sqrt(d1) * x1, sqrt(d2) * y1]
+
+        H * [ x1 ] = [ x1' ]
+            [ y1 ]   [ 0   ] ,
+
+    d1, d2 and x1 are overwritten by the scaled factors and x1', param by the flag and the
+    entries of H, see rotm.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[inout]
+    d1        the scaling factor d1, on the host CPU or device GPU.
+    @param[inout]
+    d2        the scaling factor d2, on the host CPU or device GPU.
+    @param[inout]
+    x1        the scalar x1, on the host CPU or device GPU.
+    @param[in]
+    y1        the scalar y1, on the host CPU or device GPU.
+    @param[out]
+    param     array of 5 values, on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srotmg(
+    rocblas_handle handle, float* d1, float* d2, float* x1, const float* y1, float* param);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotmg(
+    rocblas_handle handle, double* d1, double* d2, double* x1, const double* y1, double* param);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotmg_strided_batched constructs batch_count modified Givens transformations, the scalars
+    and params of each start stride_d1, stride_d2, stride_x1, stride_y1 and stride_param
+    elements apart, on the host CPU or device GPU.
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_srotmg_strided_batched(rocblas_handle handle,
+                                                             float* d1,
+                                                             rocblas_int stride_d1,
+                                                             float* d2,
+                                                             rocblas_int stride_d2,
+                                                             float* x1,
+                                                             rocblas_int stride_x1,
+                                                             const float* y1,
+                                                             rocblas_int stride_y1,
+                                                             float* param,
+                                                             rocblas_int stride_param,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotmg_strided_batched(rocblas_handle handle,
+                                                             double* d1,
+                                                             rocblas_int stride_d1,
+                                                             double* d2,
+                                                             rocblas_int stride_d2,
+                                                             double* x1,
+                                                             rocblas_int stride_x1,
+                                                             const double* y1,
+                                                             rocblas_int stride_y1,
+                                                             double* param,
+                                                             rocblas_int stride_param,
+                                                             rocblas_int batch_count);
+
+/*
+ * ===========================================================================
+ *    level 2 BLAS
+ * ===========================================================================
+ */
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGEMV performs one of the matrix-vector operations
+
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
+
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     rocblas_operation
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[out]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv(rocblas_handle handle,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* beta,
+                                            float* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv(rocblas_handle handle,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* y,
+                                            rocblas_int incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGEMV_ORDER performs xGEMV on a matrix A stored in order. With rocblas_order_row_major A
+    is an m by n matrix whose rows start lda >= n elements apart, and the call is computed as
+    the column-major xGEMV of the n by m matrix A**T with the other operation, without moving
+    any data. trans == rocblas_operation_conjugate_transpose is the transpose.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    order     rocblas_order
+              the storage of A.
+
+    the other arguments as xGEMV.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation trans,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const float* alpha,
+                                                  const float* A,
+                                                  rocblas_int lda,
+                                                  const float* x,
+                                                  rocblas_int incx,
+                                                  const float* beta,
+                                                  float* y,
+                                                  rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation trans,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const double* alpha,
+                                                  const double* A,
+                                                  rocblas_int lda,
+                                                  const double* x,
+                                                  rocblas_int incx,
+                                                  const double* beta,
+                                                  double* y,
+                                                  rocblas_int incy);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_cgemv(rocblas_handle handle,
+                 rocblas_operation trans,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *A, rocblas_int lda,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                 const rocblas_float_complex *beta,
+                 rocblas_float_complex *y, rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zgemv(rocblas_handle handle,
+                 rocblas_operation trans,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *A, rocblas_int lda,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                 const rocblas_double_complex *beta,
+                 rocblas_double_complex *y, rocblas_int incy);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGBMV performs the matrix-vector operation
+
+        y := alpha*op(A)*x + beta*y,
+
+    where alpha and beta are scalars, x and y are vectors and A is an m by n band matrix with
+    kl sub-diagonals and ku super-diagonals, op(A) = A or op(A) = A^T.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    kl        rocblas_int
+              number of sub-diagonals of A.
+    @param[in]
+    ku        rocblas_int
+              number of super-diagonals of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU, A(i, j) is at
+              A[ku + i - j + j * lda].
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= kl + ku + 1.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv(rocblas_handle handle,
+                                            rocblas_operation transA,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int kl,
+                                            rocblas_int ku,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* beta,
+                                            float* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv(rocblas_handle handle,
+                                            rocblas_operation transA,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int kl,
+                                            rocblas_int ku,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* y,
+                                            rocblas_int incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    gbmv_strided_batched and gbmv_batched compute batch_count band matrix-vector products with
+    the same scalars alpha and beta
+
+        y_i := alpha*op(A_i)*x_i + beta*y_i
+
+    the arguments are those of xGBMV, plus
+
+    @param[in]
+    A         pointer storing the first band matrix A_1 on the GPU (strided_batched) or array
+              of batch_count device pointers to the band matrices on the GPU (batched).
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one A to the next, strided_batched only.
+    @param[in]
+    x         pointer storing the first vector x_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one x to the next, strided_batched only.
+    @param[inout]
+    y         pointer storing the first vector y_1 on the GPU (strided_batched) or array of
+              batch_count device pointers to the vectors on the GPU (batched).
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one y to the next, strided_batched only.
+    @param[in]
+    batch_count rocblas_int
+              number of problems in the batch, quick return if 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int kl,
+                                                            rocblas_int ku,
+                                                            const float* alpha,
+                                                            const float* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const float* beta,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgbmv_batched(rocblas_handle handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int kl,
+                                                    rocblas_int ku,
+                                                    const float* alpha,
+                                                    const float* const A[],
+                                                    rocblas_int lda,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    const float* beta,
+                                                    float* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int kl,
+                                                            rocblas_int ku,
+                                                            const double* alpha,
+                                                            const double* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const double* beta,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgbmv_batched(rocblas_handle handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int kl,
+                                                    rocblas_int ku,
+                                                    const double* alpha,
+                                                    const double* const A[],
+                                                    rocblas_int lda,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    const double* beta,
+                                                    double* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_cgbmv(rocblas_handle handle,
+                 rocblas_operation trans,
+                 rocblas_int m, rocblas_int n,
+                 rocblas_int kl, rocblas_int ku,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *A, rocblas_int lda,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                 const rocblas_float_complex *beta,
+                 rocblas_float_complex *y, rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zgbmv(rocblas_handle handle,
+                 rocblas_operation trans,
+                 rocblas_int m, rocblas_int n,
+                 rocblas_int kl, rocblas_int ku,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *A, rocblas_int lda,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                 const rocblas_double_complex *beta,
+                 rocblas_double_complex *y, rocblas_int incy);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHE(SY)MV performs the matrix-vector operation:
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and
+    A is an n by n Hermitian(Symmetric) matrix. Only the uplo triangle of A is referenced,
+    and of its diagonal only the real parts for xHEMV.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper or lower
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[out]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssymv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* beta,
+                                            float* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsymv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_chemv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int incx,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zhemv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int incx,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex* y,
+                                            rocblas_int incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHB(SB)MV performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an n by n
+    Hermitian(Symmetric) band matrix with k super-diagonals, of which only the uplo triangle
+    is stored.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  the upper triangle of A is stored.
+              rocblas_fill_lower:  the lower triangle of A is stored.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    k         rocblas_int
+              number of super-diagonals (sub-diagonals) of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU, A(i, j) is at
+              A[k + i - j + j * lda] (upper) or A[i - j + j * lda] (lower).
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= k + 1.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* beta,
+                                            float* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* y,
+                                            rocblas_int incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    sbmv_strided_batched and sbmv_batched compute batch_count symmetric band matrix-vector
+    products with the same scalars alpha and beta
+
+        y_i := alpha*A_i*x_i + beta*y_i
+
+    the arguments are those of xSBMV, A, x and y and the strides bsa, bsx and bsy are given as
+    for gbmv_strided_batched and gbmv_batched.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const float* alpha,
+                                                            const float* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const float* beta,
+                                                            float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssbmv_batched(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const float* alpha,
+                                                    const float* const A[],
+                                                    rocblas_int lda,
+                                                    const float* const x[],
+                                                    rocblas_int incx,
+                                                    const float* beta,
+                                                    float* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const double* alpha,
+                                                            const double* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const double* beta,
+                                                            double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsbmv_batched(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const double* alpha,
+                                                    const double* const A[],
+                                                    rocblas_int lda,
+                                                    const double* const x[],
+                                                    rocblas_int incx,
+                                                    const double* beta,
+                                                    double* const y[],
+                                                    rocblas_int incy,
+                                                    rocblas_int batch_count);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_chbmv(rocblas_handle handle,
+                 rocblas_fill uplo,
+                 rocblas_int n, rocblas_int k,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *A, rocblas_int lda,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                 const rocblas_float_complex *beta,
+                 rocblas_float_complex *y, rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zhbmv(rocblas_handle handle,
+                 rocblas_fill uplo,
+                 rocblas_int n, rocblas_int k,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *A, rocblas_int lda,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                 const rocblas_double_complex *beta,
+                 rocblas_double_complex *y, rocblas_int incy);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER performs the matrix-vector operations
+
+        A := A + alpha*x*y**T
+
+    where alpha is a scalars, x and y are vectors, and A is an
+    m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           const float* x,
+                                           rocblas_int incx,
+                                           const float* y,
+                                           rocblas_int incy,
+                                           float* A,
+                                           rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger(rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const double* alpha,
+                                           const double* x,
+                                           rocblas_int incx,
+                                           const double* y,
+                                           rocblas_int incy,
+                                           double* A,
+                                           rocblas_int lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER_ORDER performs xGER on a matrix A stored in order. With rocblas_order_row_major A is
+    an m by n matrix whose rows start lda >= n elements apart, and the call is computed as the
+    column-major xGER of the n by m matrix A**T with x and y exchanged, without moving any data.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    order     rocblas_order
+              the storage of A.
+
+    the other arguments as xGER.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_order(rocblas_handle handle,
+                                                 rocblas_order order,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 const float* alpha,
+                                                 const float* x,
+                                                 rocblas_int incx,
+                                                 const float* y,
+                                                 rocblas_int incy,
+                                                 float* A,
+                                                 rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_order(rocblas_handle handle,
+                                                 rocblas_order order,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 const double* alpha,
+                                                 const double* x,
+                                                 rocblas_int incx,
+                                                 const double* y,
+                                                 rocblas_int incy,
+                                                 double* A,
+                                                 rocblas_int lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGER_STRIDED_BATCHED performs batch_count xGER operations with the same m, n and alpha,
+
+        A_i := A_i + alpha*x_i*y_i**T,  i = 0 .. batch_count - 1
+
+    in one call.
+
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one vector x_i to the next.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one vector y_i to the next.
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one matrix A_i to the next.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of problems, batch_count >= 0.
+
+    the other arguments as xGER.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sger_strided_batched(rocblas_handle handle,
+                                                           rocblas_int m,
+                                                           rocblas_int n,
+                                                           const float* alpha,
+                                                           const float* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           const float* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           float* A,
+                                                           rocblas_int lda,
+                                                           rocblas_int bsa,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_strided_batched(rocblas_handle handle,
+                                                           rocblas_int m,
+                                                           rocblas_int n,
+                                                           const double* alpha,
+                                                           const double* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           const double* y,
+                                                           rocblas_int incy,
+                                                           rocblas_int bsy,
+                                                           double* A,
+                                                           rocblas_int lda,
+                                                           rocblas_int bsa,
+                                                           rocblas_int batch_count);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_cger(rocblas_handle handle,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                 const rocblas_float_complex *y, rocblas_int incy,
+                       rocblas_float_complex *A, rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zger(rocblas_handle handle,
+                 rocblas_int m, rocblas_int n,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                 const rocblas_double_complex *y, rocblas_int incy,
+                       rocblas_double_complex *A, rocblas_int lda);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR performs the matrix-vector operations
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalars, x is a vector, and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           const float* x,
+                                           rocblas_int incx,
+                                           float* A,
+                                           rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const double* alpha,
+                                           const double* x,
+                                           rocblas_int incx,
+                                           double* A,
+                                           rocblas_int lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR_STRIDED_BATCHED performs batch_count xSYR operations with the same uplo, n and alpha,
+
+        A_i := A_i + alpha*x_i*x_i**T,  i = 0 .. batch_count - 1
+
+    in one call.
+
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one vector x_i to the next.
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one matrix A_i to the next.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of problems, batch_count >= 0.
+
+    the other arguments as xSYR.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill uplo,
+                                                           rocblas_int n,
+                                                           const float* alpha,
+                                                           const float* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           float* A,
+                                                           rocblas_int lda,
+                                                           rocblas_int bsa,
+                                                           rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
+                                                           rocblas_fill uplo,
+                                                           rocblas_int n,
+                                                           const double* alpha,
+                                                           const double* x,
+                                                           rocblas_int incx,
+                                                           rocblas_int bsx,
+                                                           double* A,
+                                                           rocblas_int lda,
+                                                           rocblas_int bsa,
+                                                           rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are n element vectors, and A is an
+    n by n symmetric matrix. Only the uplo triangle of A is read and written.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* y,
+                                            rocblas_int incy,
+                                            float* A,
+                                            rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* y,
+                                            rocblas_int incy,
+                                            double* A,
+                                            rocblas_int lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2_STRIDED_BATCHED performs batch_count xSYR2 operations with the same uplo, n and
+    alpha,
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T,  i = 0 .. batch_count - 1
+
+    in one call.
+
+    @param[in]
+    bsx       rocblas_int
+              stride from the start of one vector x_i to the next.
+    @param[in]
+    bsy       rocblas_int
+              stride from the start of one vector y_i to the next.
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one matrix A_i to the next.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of problems, batch_count >= 0.
+
+    the other arguments as xSYR2.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_int n,
+                                                            const float* alpha,
+                                                            const float* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const float* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            float* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_int n,
+                                                            const double* alpha,
+                                                            const double* x,
+                                                            rocblas_int incx,
+                                                            rocblas_int bsx,
+                                                            const double* y,
+                                                            rocblas_int incy,
+                                                            rocblas_int bsy,
+                                                            double* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER performs the matrix-vector operations
+
+        A := A + alpha*x*x**H
+
+    where alpha is a real scalar, x is an n element vector, and A is an
+    n by n hermitian matrix. Only the uplo triangle of A is read and written, the imaginary
+    parts of its diagonal elements are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the real scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int incx,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const double* alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int incx,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+
+    where alpha is a scalar, x and y are n element vectors, and A is an
+    n by n hermitian matrix. Only the uplo triangle of A is read and written, the imaginary
+    parts of its diagonal elements are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* x,
+                                            rocblas_int incx,
+                                            const rocblas_float_complex* y,
+                                            rocblas_int incy,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* x,
+                                            rocblas_int incx,
+                                            const rocblas_double_complex* y,
+                                            rocblas_int incy,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_csyr(rocblas_handle handle,
+                 rocblas_int n,
+                 const rocblas_float_complex *alpha,
+                 const rocblas_float_complex *x, rocblas_int incx,
+                       rocblas_float_complex *A, rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zsyr(rocblas_handle handle,
+                 rocblas_int n,
+                 const rocblas_double_complex *alpha,
+                 const rocblas_double_complex *x, rocblas_int incx,
+                       rocblas_double_complex *A, rocblas_int lda);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTRSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit,
+    upper or lower triangular matrix, op(A) = A or op(A) = A^T.
+
+    The vector x is overwritten on b. No test for singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= max(1, n).
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            float* x,
+                                            rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            double* x,
+                                            rocblas_int incx);
+
+/* not implemented, requires complex gemm
+ROCBLAS_EXPORT rocblas_status
+rocblas_ctrsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_float_complex *A, rocblas_int lda,
+                    rocblas_float_complex *x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_ztrsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_double_complex *A, rocblas_int lda,
+                    rocblas_double_complex *x, rocblas_int incx);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTBSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit,
+    upper or lower triangular band matrix with k super-diagonals (upper) or
+    k sub-diagonals (lower), op(A) = A or op(A) = A^T.
+
+    A is stored in the BLAS band format: column j of A is stored in column j of
+    the k+1 by n array A, with the diagonal in row k (upper) or row 0 (lower).
+
+    The vector x is overwritten on b. No test for singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular band matrix.
+              rocblas_fill_lower:  A is a  lower triangular band matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    k         rocblas_int
+              number of super-diagonals (upper) or sub-diagonals (lower) of A, k >= 0.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= k + 1.
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stbsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            float* x,
+                                            rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtbsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            double* x,
+                                            rocblas_int incx);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_ctbsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n, rocblas_int k,
+              const rocblas_float_complex *A, rocblas_int lda,
+                    rocblas_float_complex *x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_ztbsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n, rocblas_int k,
+              const rocblas_double_complex *A, rocblas_int lda,
+                    rocblas_double_complex *x, rocblas_int incx);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPMV performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an n by n
+    symmetric matrix of which the uplo triangle is given in packed storage.
+
+    AP holds the triangle column by column, n * (n + 1) / 2 elements:
+        upper:  A(i, j), i <= j, at AP[i + j*(j+1)/2],
+        lower:  A(i, j), i >= j, at AP[i + j*(2*n-j-1)/2].
+    The same layout is used by xSPR, xSPR2, xTPMV, xTPSV and xTPTTR.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies which triangle of A is stored in AP.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sspmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* AP,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* beta,
+                                            float* y,
+                                            rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* AP,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* beta,
+                                            double* y,
+                                            rocblas_int incy);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_chpmv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_int n,
+              const rocblas_float_complex *alpha,
+              const rocblas_float_complex *AP,
+              const rocblas_float_complex *x, rocblas_int incx,
+              const rocblas_float_complex *beta,
+                    rocblas_float_complex *y, rocblas_int incy);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zhpmv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_int n,
+              const rocblas_double_complex *alpha,
+              const rocblas_double_complex *AP,
+              const rocblas_double_complex *x, rocblas_int incx,
+              const rocblas_double_complex *beta,
+                    rocblas_double_complex *y, rocblas_int incy);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPR performs the matrix-vector operation
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is an n element vector and A is an n by n symmetric matrix of
+    which the uplo triangle is given in packed storage, see xSPMV.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies which triangle of A is stored in AP.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    AP        pointer storing the packed triangle of A on the GPU.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sspr(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const float* alpha,
+                                           const float* x,
+                                           rocblas_int incx,
+                                           float* AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspr(rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           const double* alpha,
+                                           const double* x,
+                                           rocblas_int incx,
+                                           double* AP);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_chpr(rocblas_handle handle,
+             rocblas_fill uplo, rocblas_int n,
+             const float *alpha,
+             const rocblas_float_complex *x, rocblas_int incx,
+                   rocblas_float_complex *AP);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zhpr(rocblas_handle handle,
+             rocblas_fill uplo, rocblas_int n,
+             const double *alpha,
+             const rocblas_double_complex *x, rocblas_int incx,
+                   rocblas_double_complex *AP);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPR2 performs the matrix-vector operation
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are n element vectors and A is an n by n symmetric matrix
+    of which the uplo triangle is given in packed storage, see xSPMV.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies which triangle of A is stored in AP.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    AP        pointer storing the packed triangle of A on the GPU.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sspr2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* y,
+                                            rocblas_int incy,
+                                            float* AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspr2(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* y,
+                                            rocblas_int incy,
+                                            double* AP);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_chpr2(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_int n,
+              const rocblas_float_complex *alpha,
+              const rocblas_float_complex *x, rocblas_int incx,
+              const rocblas_float_complex *y, rocblas_int incy,
+                    rocblas_float_complex *AP);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zhpr2(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_int n,
+              const rocblas_double_complex *alpha,
+              const rocblas_double_complex *x, rocblas_int incx,
+              const rocblas_double_complex *y, rocblas_int incy,
+                    rocblas_double_complex *AP);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPMV performs the matrix-vector operation
+
+        x := op(A)*x,
+
+    where x is an n element vector and A is an n by n unit or non-unit, upper or lower
+    triangular matrix given in packed storage, see xSPMV, op(A) = A or op(A) = A^T.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const float* AP,
+                                            float* x,
+                                            rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpmv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const double* AP,
+                                            double* x,
+                                            rocblas_int incx);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_ctpmv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_float_complex *AP,
+                    rocblas_float_complex *x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_ztpmv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_double_complex *AP,
+                    rocblas_double_complex *x, rocblas_int incx);
+*/
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit, upper or lower
+    triangular matrix given in packed storage, see xSPMV, op(A) = A or op(A) = A^T.
+
+    The vector x is overwritten on b. No test for singularity is included.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const float* AP,
+                                            float* x,
+                                            rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpsv(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int n,
+                                            const double* AP,
+                                            double* x,
+                                            rocblas_int incx);
+
+/* not implemented, requires complex arithmetic in the device kernels
+ROCBLAS_EXPORT rocblas_status
+rocblas_ctpsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_float_complex *AP,
+                    rocblas_float_complex *x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_ztpsv(rocblas_handle handle,
+              rocblas_fill uplo, rocblas_operation transA, rocblas_diagonal diag,
+              rocblas_int n,
+              const rocblas_double_complex *AP,
+                    rocblas_double_complex *x, rocblas_int incx);
+*/
+
+/*! \brief BLAS Level 2 auxiliary API
+
+    \details
+    xTPTTR copies the uplo triangle of an n by n matrix A from packed storage AP, see xSPMV,
+    to full storage. The other triangle of A is not referenced.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies which triangle of A is stored in AP.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle on the GPU.
+    @param[out]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= max(1, n).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stpttr(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             const float* AP,
+                                             float* A,
+                                             rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpttr(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             const double* AP,
+                                             double* A,
+                                             rocblas_int lda);
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trtri  compute the inverse of a matrix  A, namely, invA
+
+        and write the result into invA;
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              if rocblas_fill_upper, the lower part of A is not referenced
+              if rocblas_fill_lower, the upper part of A is not referenced
+    @param[in]
+    diag      rocblas_diagonal.
+              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
+              = 'rocblas_diagonal_unit', A is unit triangular;
+    @param[in]
+    n         rocblas_int.
+              size of matrix A and invA
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[output]
+    invA      pointer storing matrix invA on the GPU.
+    @param[in]
+    ldinvA    rocblas_int
+              specifies the leading dimension of invA.
+
+********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strtri(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_diagonal diag,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             float* invA,
+                                             rocblas_int ldinvA);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_diagonal diag,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             double* invA,
+                                             rocblas_int ldinvA);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trtri  compute the inverse of a matrix  A
+
+        inv(A);
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+    @param[in]
+    diag      rocblas_diagonal.
+              = 'rocblas_diagonal_non_unit', A is non-unit triangular;
+              = 'rocblas_diagonal_unit', A is unit triangular;
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    bsa       rocblas_int
+             "batch stride a": stride from the start of one "A" matrix to the next
+    @param[output]
+    invA      pointer storing the inverse matrix A on the GPU.
+    @param[in]
+    ldinvA    rocblas_int
+              specifies the leading dimension of invA.
+    @param[in]
+    bsinvA    rocblas_int
+             "batch stride invA": stride from the start of one "invA" matrix to the next
+    @param[in]
+    batch_count       rocblas_int
+              numbers of matrices in the batch
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strtri_batched(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_diagonal diag,
+                                                     rocblas_int n,
+                                                     float* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     float* invA,
+                                                     rocblas_int ldinvA,
+                                                     rocblas_int bsinvA,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrtri_batched(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_diagonal diag,
+                                                     rocblas_int n,
+                                                     double* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     double* invA,
+                                                     rocblas_int ldinvA,
+                                                     rocblas_int bsinvA,
+                                                     rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    trsm solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    where alpha is a scalar, X and B are m by n matrices,
+    A is triangular matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    The matrix X is overwritten on B.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+
+    @param[in]
+    side    rocblas_side.
+            rocblas_side_left:       op(A)*X = alpha*B.
+            rocblas_side_right:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  rocblas_operation.
+            transB:    op(A) = A.
+            rocblas_operation_transpose:      op(A) = A^T.
+            rocblas_operation_conjugate_transpose:  op(A) = A^H.
+
+    @param[in]
+    diag    rocblas_diagonal.
+            rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       rocblas_int.
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       rocblas_int.
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+
+    @param[in]
+    A       pointer storing matrix A on the GPU.
+            of dimension ( lda, k ), where k is m
+            when  rocblas_side_left  and
+            is  n  when  rocblas_side_right
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     rocblas_int.
+            lda specifies the first dimension of A.
+            if side = rocblas_side_left,  lda >= max( 1, m ),
+            if side = rocblas_side_right, lda >= max( 1, n ).
+
+    @param[in,output]
+    B       pointer storing matrix B on the GPU.
+
+    @param[in]
+    ldb    rocblas_int.
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm(rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            float* A,
+                                            rocblas_int lda,
+                                            float* B,
+                                            rocblas_int ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm(rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_fill uplo,
+                                            rocblas_operation transA,
+                                            rocblas_diagonal diag,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            double* A,
+                                            rocblas_int lda,
+                                            double* B,
+                                            rocblas_int ldb);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xTRSM_ORDER performs xTRSM on matrices stored in order. With rocblas_order_row_major B is
+    an m by n matrix whose rows start ldb >= n elements apart, and A the same by lda. The call
+    is computed as the column-major xTRSM of the n by m matrix B**T, from the other side and
+    with the other triangle of A**T referenced, without moving any data.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    order     rocblas_order
+              the storage of A and B.
+
+    the other arguments as xTRSM.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_side side,
+                                                  rocblas_fill uplo,
+                                                  rocblas_operation transA,
+                                                  rocblas_diagonal diag,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const float* alpha,
+                                                  float* A,
+                                                  rocblas_int lda,
+                                                  float* B,
+                                                  rocblas_int ldb);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_side side,
+                                                  rocblas_fill uplo,
+                                                  rocblas_operation transA,
+                                                  rocblas_diagonal diag,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const double* alpha,
+                                                  double* A,
+                                                  rocblas_int lda,
+                                                  double* B,
+                                                  rocblas_int ldb);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    transB    rocblas_operation
+              specifies the form of op( B )
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm(rocblas_handle handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const rocblas_half* alpha,
+                                            const rocblas_half* A,
+                                            rocblas_int lda,
+                                            const rocblas_half* B,
+                                            rocblas_int ldb,
+                                            const rocblas_half* beta,
+                                            rocblas_half* C,
+                                            rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm(rocblas_handle handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* B,
+                                            rocblas_int ldb,
+                                            const float* beta,
+                                            float* C,
+                                            rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm(rocblas_handle handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* B,
+                                            rocblas_int ldb,
+                                            const double* beta,
+                                            double* C,
+                                            rocblas_int ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEMM_ORDER performs xGEMM on matrices stored in order. With rocblas_order_row_major C is
+    an m by n matrix whose rows start ldc >= n elements apart, and A and B the same by lda and
+    ldb. The call is computed as the column-major xGEMM of C**T = op( B )**T*op( A )**T, the n
+    by m product with A and B exchanged, without moving any data.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    order     rocblas_order
+              the storage of A, B and C.
+
+    the other arguments as xGEMM.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation transa,
+                                                  rocblas_operation transb,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_int k,
+                                                  const rocblas_half* alpha,
+                                                  const rocblas_half* A,
+                                                  rocblas_int lda,
+                                                  const rocblas_half* B,
+                                                  rocblas_int ldb,
+                                                  const rocblas_half* beta,
+                                                  rocblas_half* C,
+                                                  rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation transa,
+                                                  rocblas_operation transb,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_int k,
+                                                  const float* alpha,
+                                                  const float* A,
+                                                  rocblas_int lda,
+                                                  const float* B,
+                                                  rocblas_int ldb,
+                                                  const float* beta,
+                                                  float* C,
+                                                  rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation transa,
+                                                  rocblas_operation transb,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_int k,
+                                                  const double* alpha,
+                                                  const double* A,
+                                                  rocblas_int lda,
+                                                  const double* B,
+                                                  rocblas_int ldb,
+                                                  const double* beta,
+                                                  double* C,
+                                                  rocblas_int ldc);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_qgemm(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_half_complex *alpha,
+    const rocblas_half_complex *A, rocblas_int lda,
+    const rocblas_half_complex *B, rocblas_int ldb,
+    const rocblas_half_complex *beta,
+          rocblas_half_complex *C, rocblas_int ldc);
+*/
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_cgemm(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_float_complex *alpha,
+    const rocblas_float_complex *A, rocblas_int lda,
+    const rocblas_float_complex *B, rocblas_int ldb,
+    const rocblas_float_complex *beta,
+          rocblas_float_complex *C, rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zgemm(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_double_complex *alpha,
+    const rocblas_double_complex *A, rocblas_int lda,
+    const rocblas_double_complex *B, rocblas_int ldb,
+    const rocblas_double_complex *beta,
+          rocblas_double_complex *C, rocblas_int ldc);
+*/
+
+/***************************************************************************
+ * batched
+ * bsa - "batch stride a": stride from the start of one "A" matrix to the next
+ * bsb
+ * bsc
+ * batch_count - numbers of gemm's in the batch
+ **************************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const rocblas_half* alpha,
+                                                            const rocblas_half* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const rocblas_half* B,
+                                                            rocblas_int ldb,
+                                                            rocblas_int bsb,
+                                                            const rocblas_half* beta,
+                                                            rocblas_half* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const float* alpha,
+                                                            const float* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const float* B,
+                                                            rocblas_int ldb,
+                                                            rocblas_int bsb,
+                                                            const float* beta,
+                                                            float* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const double* alpha,
+                                                            const double* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const double* B,
+                                                            rocblas_int ldb,
+                                                            rocblas_int bsb,
+                                                            const double* beta,
+                                                            double* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_qgemm_strided_batched(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_half_complex *alpha,
+    const rocblas_half_complex *A, rocblas_int lda, rocblas_int bsa,
+    const rocblas_half_complex *B, rocblas_int ldb, rocblas_int bsb,
+    const rocblas_half_complex *beta,
+          rocblas_half_complex *C, rocblas_int ldc, rocblas_int bsc,
+    rocblas_int batch_count );
+*/
+
+/* not implemented
+ROCBLAS_EXPORT rocblas_status
+rocblas_cgemm_strided_batched(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_float_complex *alpha,
+    const rocblas_float_complex *A, rocblas_int lda, rocblas_int bsa,
+    const rocblas_float_complex *B, rocblas_int ldb, rocblas_int bsb,
+    const rocblas_float_complex *beta,
+          rocblas_float_complex *C, rocblas_int ldc, rocblas_int bsc,
+    rocblas_int batch_count );
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zgemm_strided_batched(
+    rocblas_handle handle,
+    rocblas_operation transa, rocblas_operation transb,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    const rocblas_double_complex *alpha,
+    const rocblas_double_complex *A, rocblas_int lda, rocblas_int bsa,
+    const rocblas_double_complex *B, rocblas_int ldb, rocblas_int bsb,
+    const rocblas_double_complex *beta,
+          rocblas_double_complex *C, rocblas_int ldc, rocblas_int bsc,
+    rocblas_int batch_count );
+*/
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYRK performs one of the symmetric rank k operations
+
+        C := alpha*op( A )*op( A )**T + beta*C,
+
+    where op( A ) = A or op( A ) = A**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is computed, the other triangle is not referenced.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  C is an upper triangular matrix.
+              rocblas_fill_lower:  C is a  lower triangular matrix.
+    @param[in]
+    trans     rocblas_operation
+              specifies the form of op( A )
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const float* alpha,
+                                            const float* A,
+                                            rocblas_int lda,
+                                            const float* beta,
+                                            float* C,
+                                            rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* alpha,
+                                            const double* A,
+                                            rocblas_int lda,
+                                            const double* beta,
+                                            double* C,
+                                            rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_operation trans,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const float* alpha,
+                                                            const float* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const float* beta,
+                                                            float* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill uplo,
+                                                            rocblas_operation trans,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const double* alpha,
+                                                            const double* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const double* beta,
+                                                            double* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYR2K performs one of the symmetric rank 2k operations
+
+        C := alpha*op( A )*op( B )**T + alpha*op( B )*op( A )**T + beta*C,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is computed, the other triangle is not referenced.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  C is an upper triangular matrix.
+              rocblas_fill_lower:  C is a  lower triangular matrix.
+    @param[in]
+    trans     rocblas_operation
+              specifies the form of op( A ) and op( B )
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    k         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
     @param[in]
-    ldb    rocblas_int.
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    ldc       rocblas_int
+              specifies the leading dimension of C.
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_strsm(rocblas_handle handle,
-                                            rocblas_side side,
-                                            rocblas_fill uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal diag,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            const float* alpha,
-                                            float* A,
-                                            rocblas_int lda,
-                                            float* B,
-                                            rocblas_int ldb);
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const float* alpha,
+                                             const float* A,
+                                             rocblas_int lda,
+                                             const float* B,
+                                             rocblas_int ldb,
+                                             const float* beta,
+                                             float* C,
+                                             rocblas_int ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dtrsm(rocblas_handle handle,
-                                            rocblas_side side,
-                                            rocblas_fill uplo,
-                                            rocblas_operation transA,
-                                            rocblas_diagonal diag,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            const double* alpha,
-                                            double* A,
-                                            rocblas_int lda,
-                                            double* B,
-                                            rocblas_int ldb);
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const double* alpha,
+                                             const double* A,
+                                             rocblas_int lda,
+                                             const double* B,
+                                             rocblas_int ldb,
+                                             const double* beta,
+                                             double* C,
+                                             rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill uplo,
+                                                             rocblas_operation trans,
+                                                             rocblas_int n,
+                                                             rocblas_int k,
+                                                             const float* alpha,
+                                                             const float* A,
+                                                             rocblas_int lda,
+                                                             rocblas_int bsa,
+                                                             const float* B,
+                                                             rocblas_int ldb,
+                                                             rocblas_int bsb,
+                                                             const float* beta,
+                                                             float* C,
+                                                             rocblas_int ldc,
+                                                             rocblas_int bsc,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill uplo,
+                                                             rocblas_operation trans,
+                                                             rocblas_int n,
+                                                             rocblas_int k,
+                                                             const double* alpha,
+                                                             const double* A,
+                                                             rocblas_int lda,
+                                                             rocblas_int bsa,
+                                                             const double* B,
+                                                             rocblas_int ldb,
+                                                             rocblas_int bsb,
+                                                             const double* beta,
+                                                             double* C,
+                                                             rocblas_int ldc,
+                                                             rocblas_int bsc,
+                                                             rocblas_int batch_count);
+
+/* not implemented, requires complex gemm
+ROCBLAS_EXPORT rocblas_status
+rocblas_cherk(
+    rocblas_handle handle,
+    rocblas_fill uplo, rocblas_operation trans,
+    rocblas_int n, rocblas_int k,
+    const float *alpha,
+    const rocblas_float_complex *A, rocblas_int lda,
+    const float *beta,
+          rocblas_float_complex *C, rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status
+rocblas_zherk(
+    rocblas_handle handle,
+    rocblas_fill uplo, rocblas_operation trans,
+    rocblas_int n, rocblas_int k,
+    const double *alpha,
+    const rocblas_double_complex *A, rocblas_int lda,
+    const double *beta,
+          rocblas_double_complex *C, rocblas_int ldc);
+*/
 
 /*! \brief BLAS Level 3 API
 
     \details
-    xGEMM performs one of the matrix-matrix operations
-
-        C = alpha*op( A )*op( B ) + beta*C,
+    xSYMM performs one of the matrix-matrix operations
 
-    where op( X ) is one of
-
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+        C := alpha*A*B + beta*C   if side == rocblas_side_left,
+        C := alpha*B*A + beta*C   if side == rocblas_side_right,
 
-    alpha and beta are scalars, and A, B and C are matrices, with
-    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+    where alpha and beta are scalars, B and C are m by n matrices and A is a symmetric matrix
+    of which only the uplo triangle is referenced.
 
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
     @param[in]
-    transA    rocblas_operation
-              specifies the form of op( A )
+    side      rocblas_side.
+              rocblas_side_left:  A is m by m.
+              rocblas_side_right: A is n by n.
     @param[in]
-    transB    rocblas_operation
-              specifies the form of op( B )
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  the upper triangle of A is referenced.
+              rocblas_fill_lower:  the lower triangle of A is referenced.
     @param[in]
     m         rocblas_int.
     @param[in]
     n         rocblas_int.
     @param[in]
-    k         rocblas_int.
-    @param[in]
     alpha     specifies the scalar alpha.
     @param[in]
     A         pointer storing matrix A on the GPU.
@@ -1070,27 +4445,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_dtrsm(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm(rocblas_handle handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_int k,
-                                            const rocblas_half* alpha,
-                                            const rocblas_half* A,
-                                            rocblas_int lda,
-                                            const rocblas_half* B,
-                                            rocblas_int ldb,
-                                            const rocblas_half* beta,
-                                            rocblas_half* C,
-                                            rocblas_int ldc);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm(rocblas_handle handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
+ROCBLAS_EXPORT rocblas_status rocblas_ssymm(rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_fill uplo,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_int k,
                                             const float* alpha,
                                             const float* A,
                                             rocblas_int lda,
@@ -1100,12 +4459,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_sgemm(rocblas_handle handle,
                                             float* C,
                                             rocblas_int ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm(rocblas_handle handle,
-                                            rocblas_operation transa,
-                                            rocblas_operation transb,
+ROCBLAS_EXPORT rocblas_status rocblas_dsymm(rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_fill uplo,
                                             rocblas_int m,
                                             rocblas_int n,
-                                            rocblas_int k,
                                             const double* alpha,
                                             const double* A,
                                             rocblas_int lda,
@@ -1115,25 +4473,12 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgemm(rocblas_handle handle,
                                             double* C,
                                             rocblas_int ldc);
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_qgemm(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_half_complex *alpha,
-    const rocblas_half_complex *A, rocblas_int lda,
-    const rocblas_half_complex *B, rocblas_int ldb,
-    const rocblas_half_complex *beta,
-          rocblas_half_complex *C, rocblas_int ldc);
-*/
-
-/* not implemented
+/* not implemented, requires complex gemm
 ROCBLAS_EXPORT rocblas_status
-rocblas_cgemm(
+rocblas_chemm(
     rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
+    rocblas_side side, rocblas_fill uplo,
+    rocblas_int m, rocblas_int n,
     const rocblas_float_complex *alpha,
     const rocblas_float_complex *A, rocblas_int lda,
     const rocblas_float_complex *B, rocblas_int ldb,
@@ -1141,10 +4486,10 @@ rocblas_cgemm(
           rocblas_float_complex *C, rocblas_int ldc);
 
 ROCBLAS_EXPORT rocblas_status
-rocblas_zgemm(
+rocblas_zhemm(
     rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
+    rocblas_side side, rocblas_fill uplo,
+    rocblas_int m, rocblas_int n,
     const rocblas_double_complex *alpha,
     const rocblas_double_complex *A, rocblas_int lda,
     const rocblas_double_complex *B, rocblas_int ldb,
@@ -1152,111 +4497,6 @@ rocblas_zgemm(
           rocblas_double_complex *C, rocblas_int ldc);
 */
 
-/***************************************************************************
- * batched
- * bsa - "batch stride a": stride from the start of one "A" matrix to the next
- * bsb
- * bsc
- * batch_count - numbers of gemm's in the batch
- **************************************************************************/
-
-ROCBLAS_EXPORT rocblas_status rocblas_hgemm_strided_batched(rocblas_handle handle,
-                                                            rocblas_operation transa,
-                                                            rocblas_operation transb,
-                                                            rocblas_int m,
-                                                            rocblas_int n,
-                                                            rocblas_int k,
-                                                            const rocblas_half* alpha,
-                                                            const rocblas_half* A,
-                                                            rocblas_int lda,
-                                                            rocblas_int bsa,
-                                                            const rocblas_half* B,
-                                                            rocblas_int ldb,
-                                                            rocblas_int bsb,
-                                                            const rocblas_half* beta,
-                                                            rocblas_half* C,
-                                                            rocblas_int ldc,
-                                                            rocblas_int bsc,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_sgemm_strided_batched(rocblas_handle handle,
-                                                            rocblas_operation transa,
-                                                            rocblas_operation transb,
-                                                            rocblas_int m,
-                                                            rocblas_int n,
-                                                            rocblas_int k,
-                                                            const float* alpha,
-                                                            const float* A,
-                                                            rocblas_int lda,
-                                                            rocblas_int bsa,
-                                                            const float* B,
-                                                            rocblas_int ldb,
-                                                            rocblas_int bsb,
-                                                            const float* beta,
-                                                            float* C,
-                                                            rocblas_int ldc,
-                                                            rocblas_int bsc,
-                                                            rocblas_int batch_count);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dgemm_strided_batched(rocblas_handle handle,
-                                                            rocblas_operation transa,
-                                                            rocblas_operation transb,
-                                                            rocblas_int m,
-                                                            rocblas_int n,
-                                                            rocblas_int k,
-                                                            const double* alpha,
-                                                            const double* A,
-                                                            rocblas_int lda,
-                                                            rocblas_int bsa,
-                                                            const double* B,
-                                                            rocblas_int ldb,
-                                                            rocblas_int bsb,
-                                                            const double* beta,
-                                                            double* C,
-                                                            rocblas_int ldc,
-                                                            rocblas_int bsc,
-                                                            rocblas_int batch_count);
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_qgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_half_complex *alpha,
-    const rocblas_half_complex *A, rocblas_int lda, rocblas_int bsa,
-    const rocblas_half_complex *B, rocblas_int ldb, rocblas_int bsb,
-    const rocblas_half_complex *beta,
-          rocblas_half_complex *C, rocblas_int ldc, rocblas_int bsc,
-    rocblas_int batch_count );
-*/
-
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_float_complex *alpha,
-    const rocblas_float_complex *A, rocblas_int lda, rocblas_int bsa,
-    const rocblas_float_complex *B, rocblas_int ldb, rocblas_int bsb,
-    const rocblas_float_complex *beta,
-          rocblas_float_complex *C, rocblas_int ldc, rocblas_int bsc,
-    rocblas_int batch_count );
-
-ROCBLAS_EXPORT rocblas_status
-rocblas_zgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_double_complex *alpha,
-    const rocblas_double_complex *A, rocblas_int lda, rocblas_int bsa,
-    const rocblas_double_complex *B, rocblas_int ldb, rocblas_int bsb,
-    const rocblas_double_complex *beta,
-          rocblas_double_complex *C, rocblas_int ldc, rocblas_int bsc,
-    rocblas_int batch_count );
-*/
-
 /*! \brief BLAS Level 3 API
 
     \details
@@ -1336,6 +4576,115 @@ ROCBLAS_EXPORT rocblas_status rocblas_dgeam(rocblas_handle handle,
                                             double* C,
                                             rocblas_int ldc);
 
+/*! \brief BLAS Level 3 API
+
+    \details
+    xGEAM_ORDER performs xGEAM on matrices stored in order. With rocblas_order_row_major C is
+    an m by n matrix whose rows start ldc >= n elements apart, and A and B the same by lda and
+    ldb. The call is computed as the column-major xGEAM of the n by m matrix C**T with the same
+    operations, without moving any data.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    order     rocblas_order
+              the storage of A, B and C.
+
+    the other arguments as xGEAM.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgeam_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation transa,
+                                                  rocblas_operation transb,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const float* alpha,
+                                                  const float* A,
+                                                  rocblas_int lda,
+                                                  const float* beta,
+                                                  const float* B,
+                                                  rocblas_int ldb,
+                                                  float* C,
+                                                  rocblas_int ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgeam_order(rocblas_handle handle,
+                                                  rocblas_order order,
+                                                  rocblas_operation transa,
+                                                  rocblas_operation transb,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  const double* alpha,
+                                                  const double* A,
+                                                  rocblas_int lda,
+                                                  const double* beta,
+                                                  const double* B,
+                                                  rocblas_int ldb,
+                                                  double* C,
+                                                  rocblas_int ldc);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xTRANSPOSE_INPLACE overwrites the m by n matrix A by its n by m transpose
+
+        A := A**T,
+
+    without a second matrix. A square matrix keeps its leading dimension lda and is
+    transposed by pairs of tiles. A rectangular matrix must be contiguous, lda == m, and
+    its transpose is contiguous too, with leading dimension n. It is transposed along the
+    cycles of the permutation of its elements, computed on the host on first use of the
+    shape and cached in the handle. The cycles are split into segments of at most 256
+    moves, and the device workspace is one element per segment, O(m * n / 256) plus one
+    per cycle.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda == max(1, m) if m != n.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stranspose_inplace(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtranspose_inplace(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xTRANSPOSE_INPLACE_STRIDED_BATCHED transposes batch_count m by n matrices A_i in place,
+    as xTRANSPOSE_INPLACE. A_i starts stride_a elements after A_(i-1).
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_stranspose_inplace_strided_batched(rocblas_handle handle,
+                                                                         rocblas_int m,
+                                                                         rocblas_int n,
+                                                                         float* A,
+                                                                         rocblas_int lda,
+                                                                         rocblas_int stride_a,
+                                                                         rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtranspose_inplace_strided_batched(rocblas_handle handle,
+                                                                         rocblas_int m,
+                                                                         rocblas_int n,
+                                                                         double* A,
+                                                                         rocblas_int lda,
+                                                                         rocblas_int stride_a,
+                                                                         rocblas_int batch_count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -75,6 +75,15 @@ typedef enum rocblas_side_ {
     rocblas_side_both = 143
 } rocblas_side;
 
+/*! \brief Used to specify whether the matrices of a call are stored by columns or by rows.
+ * The routines taking a rocblas_order compute a call on row-major matrices as the equivalent
+ * column-major call on their transposes, without moving any data.
+ */
+typedef enum rocblas_order_ {
+    rocblas_order_row_major    = 101, /**< Consecutive elements of a row are adjacent. */
+    rocblas_order_column_major = 102  /**< Consecutive elements of a column are adjacent. */
+} rocblas_order;
+
 /* ============================================================================================ */
 /**
  *   @brief rocblas status codes definition
@@ -99,12 +108,67 @@ typedef enum rocblas_precision_ {
     rocblas_precision_complex_double = 155
 } rocblas_precision;
 
+/*! \brief Indicates how rocblas_convert rounds to a narrower precision.
+ *
+ * rocblas_rounding_mode_stochastic rounds up with a probability equal to the distance to the
+ * value below in units of the last place, drawn from 32 random bits per element that depend
+ * only on the seed and the index of the element.
+ */
+typedef enum rocblas_rounding_mode_ {
+    rocblas_rounding_mode_nearest    = 0, /**< to the nearest value, ties to even */
+    rocblas_rounding_mode_stochastic = 1
+} rocblas_rounding_mode;
+
 /*! \brief Indicates the pointer is device pointer or host pointer */
 typedef enum rocblas_pointer_mode_ {
     rocblas_pointer_mode_host   = 0,
     rocblas_pointer_mode_device = 1
 } rocblas_pointer_mode;
 
+/*! \brief Indicates the order of the sums of the Level 1 reductions.
+ *
+ * In rocblas_reduction_mode_deterministic the order depends only on the length of the vector:
+ * the elements are summed in blocks of ROCBLAS_DETERMINISTIC_NB consecutive elements by a
+ * binary tree (element l + s is added to element l for s = NB / 2, ... , 1), and the block
+ * sums in the same tree after the sums of every NB-th block, so results are bitwise identical
+ * across launches, devices and library builds. The default mode may use any order.
+ */
+typedef enum rocblas_reduction_mode_ {
+    rocblas_reduction_mode_default       = 0,
+    rocblas_reduction_mode_deterministic = 1
+} rocblas_reduction_mode;
+
+/*! \brief Block length of the deterministic reduction order, part of its definition. */
+#define ROCBLAS_DETERMINISTIC_NB 1024
+
+/*! \brief Indicates the precision in which the Level 1 reductions accumulate.
+ *
+ * rocblas_accumulation_mode_native accumulates in the type of the result, and rocblas_half
+ * in float. rocblas_accumulation_mode_compensated carries the rounding error of every product
+ * and sum alongside the sum (TwoProd and TwoSum), which roughly doubles the working precision.
+ * rocblas_accumulation_mode_double accumulates single precision in double. Complex dot
+ * products accumulate natively in every mode.
+ */
+typedef enum rocblas_accumulation_mode_ {
+    rocblas_accumulation_mode_native      = 0,
+    rocblas_accumulation_mode_compensated = 1,
+    rocblas_accumulation_mode_double      = 2
+} rocblas_accumulation_mode;
+
+/*! \brief Indicates whether the Level 1 reductions wait for their results in host pointer mode.
+ *
+ * In rocblas_host_result_mode_async they return once the reduction is enqueued; the results
+ * are written to pinned host memory of the handle and copied to the result pointers of the
+ * calls, in call order, by rocblas_query_host_results without waiting or by
+ * rocblas_sync_host_results. A result pointer must stay valid, and must not be read, until
+ * then; rocblas_destroy_handle and switching back to rocblas_host_result_mode_blocking
+ * deliver all results.
+ */
+typedef enum rocblas_host_result_mode_ {
+    rocblas_host_result_mode_blocking = 0,
+    rocblas_host_result_mode_async    = 1
+} rocblas_host_result_mode;
+
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocblas_layer_mode {
     rocblas_layer_mode_none      = 0b0000000000,
@@ -1,3 +1,6 @@
+#pragma once
+#ifndef _DEVICE_TEMPLATE_H_
+#define _DEVICE_TEMPLATE_H_
 
 /*
  * ===========================================================================
@@ -702,3 +705,568 @@ __device__ void rocblas_maxid_reduce(rocblas_int tx, T* x, rocblas_int* index)
     }
 }
 // end maxid_reduce
+
+/*! \brief last block done
+
+    \details
+
+    single pass reductions: every block writes its partial result to global memory and takes a
+    ticket, the block that takes the last ticket sees the partial results of all the other
+    blocks and finishes the reduction. The last block resets the ticket for the next launch.
+    All threads of the block must call it, the partial result must be written before.
+
+    @param[in]
+    tx        rocblas_int. thread id
+    @param[inout]
+    ticket    pointer to the block counter on the GPU, 0 when the grid starts.
+
+    returns true in all threads of the last block, false otherwise.
+    ********************************************************************/
+static __device__ bool rocblas_last_block(rocblas_int tx, unsigned int* ticket)
+{
+    __shared__ bool last;
+
+    if(tx == 0)
+    {
+        // make the partial result of this block visible to the last block before counting it
+        __threadfence();
+
+        unsigned int done = atomicAdd(ticket, 1);
+        last              = done == hipGridDim_x - 1;
+
+        if(last)
+            *ticket = 0;
+    }
+    __syncthreads();
+
+    return last;
+}
+// end last_block
+
+/*! \brief single pass grid reduction: sum
+
+    \details
+
+    reduces x over the block, then the partial results of all the blocks in the last block.
+    With NB = ROCBLAS_DETERMINISTIC_NB and one element per thread the sums are in the order of
+    rocblas_reduction_mode_deterministic.
+
+    @param[in]
+    tx        rocblas_int. thread id
+    @param[inout]
+    x         pointer storing vector x in shared memory, NB elements;
+              x[0] stores the final result in the last block.
+    @param[inout]
+    partial   pointer to hipGridDim_x partial results on the GPU.
+    @param[inout]
+    ticket    pointer to the block counter on the GPU, see rocblas_last_block.
+
+    returns true in all threads of the last block, false otherwise.
+    ********************************************************************/
+template <rocblas_int NB, typename T>
+__device__ bool rocblas_sum_reduce_grid(rocblas_int tx, T* x, T* partial, unsigned int* ticket)
+{
+    rocblas_sum_reduce<NB, T>(tx, x);
+
+    if(tx == 0)
+        partial[hipBlockIdx_x] = x[0];
+
+    if(!rocblas_last_block(tx, ticket))
+        return false;
+
+    rocblas_int blocks = hipGridDim_x;
+
+    x[tx] = 0.0;
+    for(rocblas_int i = tx; i < blocks; i += NB)
+    {
+        x[tx] += partial[i];
+    }
+
+    rocblas_sum_reduce<NB, T>(tx, x);
+
+    return true;
+}
+// end sum_reduce_grid
+
+/*! \brief single pass grid reduction: minid
+
+    \details
+
+    finds the first index of the minimum element of x over the block, then over the partial
+    results of all the blocks in the last block. Threads without an element of x should
+    hold +inf and an index past the end of x.
+
+    @param[in]
+    tx        rocblas_int. thread id
+    @param[inout]
+    x         pointer storing vector x in shared memory, NB elements;
+    @param[inout]
+    index     pointer storing the index of x in shared memory, NB elements;
+              index[0] stores the final result in the last block.
+    @param[inout]
+    partial   pointer to hipGridDim_x partial results on the GPU.
+    @param[inout]
+    partial_index
+              pointer to hipGridDim_x partial indices on the GPU.
+    @param[inout]
+    ticket    pointer to the block counter on the GPU, see rocblas_last_block.
+
+    returns true in all threads of the last block, false otherwise.
+    ********************************************************************/
+template <rocblas_int NB, typename T>
+__device__ bool rocblas_minid_reduce_grid(rocblas_int tx,
+                                          T* x,
+                                          rocblas_int* index,
+                                          T* partial,
+                                          rocblas_int* partial_index,
+                                          unsigned int* ticket)
+{
+    rocblas_minid_reduce<NB, T>(tx, x, index);
+
+    if(tx == 0)
+    {
+        partial[hipBlockIdx_x]       = x[0];
+        partial_index[hipBlockIdx_x] = index[0];
+    }
+
+    if(!rocblas_last_block(tx, ticket))
+        return false;
+
+    rocblas_int blocks = hipGridDim_x;
+
+    x[tx]     = INFINITY;
+    index[tx] = blocks * NB;
+    for(rocblas_int i = tx; i < blocks; i += NB)
+    {
+        if(x[tx] == partial[i])
+        {
+            index[tx] = min(index[tx], partial_index[i]); // if equal take the smaller index
+        }
+        else if(x[tx] > partial[i])
+        {
+            x[tx]     = partial[i];
+            index[tx] = partial_index[i];
+        }
+    }
+
+    rocblas_minid_reduce<NB, T>(tx, x, index);
+
+    return true;
+}
+// end minid_reduce_grid
+
+/*! \brief single pass grid reduction: maxid
+
+    \details
+
+    finds the first index of the maximum element of x over the block, then over the partial
+    results of all the blocks in the last block. x holds magnitudes; threads without an
+    element of x should hold -1 and an index past the end of x.
+
+    @param[in]
+    tx        rocblas_int. thread id
+    @param[inout]
+    x         pointer storing vector x in shared memory, NB elements;
+    @param[inout]
+    index     pointer storing the index of x in shared memory, NB elements;
+              index[0] stores the final result in the last block.
+    @param[inout]
+    partial   pointer to hipGridDim_x partial results on the GPU.
+    @param[inout]
+    partial_index
+              pointer to hipGridDim_x partial indices on the GPU.
+    @param[inout]
+    ticket    pointer to the block counter on the GPU, see rocblas_last_block.
+
+    returns true in all threads of the last block, false otherwise.
+    ********************************************************************/
+template <rocblas_int NB, typename T>
+__device__ bool rocblas_maxid_reduce_grid(rocblas_int tx,
+                                          T* x,
+                                          rocblas_int* index,
+                                          T* partial,
+                                          rocblas_int* partial_index,
+                                          unsigned int* ticket)
+{
+    rocblas_maxid_reduce<NB, T>(tx, x, index);
+
+    if(tx == 0)
+    {
+        partial[hipBlockIdx_x]       = x[0];
+        partial_index[hipBlockIdx_x] = index[0];
+    }
+
+    if(!rocblas_last_block(tx, ticket))
+        return false;
+
+    rocblas_int blocks = hipGridDim_x;
+
+    x[tx]     = -1;
+    index[tx] = blocks * NB;
+    for(rocblas_int i = tx; i < blocks; i += NB)
+    {
+        if(x[tx] == partial[i])
+        {
+            index[tx] = min(index[tx], partial_index[i]); // if equal take the smaller index
+        }
+        else if(x[tx] < partial[i])
+        {
+            x[tx]     = partial[i];
+            index[tx] = partial_index[i];
+        }
+    }
+
+    rocblas_maxid_reduce<NB, T>(tx, x, index);
+
+    return true;
+}
+// end maxid_reduce_grid
+
+/*! \brief batched vectors
+
+    \details
+
+    returns the vector of the batch picked by hipBlockIdx_y. Strided batched vectors start bsx
+    elements apart, batched vectors are given by an array of pointers on the GPU; a single
+    vector is a strided batch of one.
+
+    @param[in]
+    x         pointer storing the first vector, or the array of pointers, on the GPU.
+    @param[in]
+    bsx       rocblas_int. stride from the start of one vector to the next, strided only.
+    ********************************************************************/
+template <typename T>
+__device__ T* load_batch_ptr(T* x, rocblas_int bsx)
+{
+    return x + (size_t)hipBlockIdx_y * bsx;
+}
+
+template <typename T>
+__device__ T* load_batch_ptr(T* const* x, rocblas_int bsx)
+{
+    return x[hipBlockIdx_y];
+}
+// end load_batch_ptr
+
+/*! \brief batches of a launch
+
+    \details
+
+    the batch goes to the y (or z) dimension of the grid, which holds at most
+    ROCBLAS_MAX_BATCH_GRID blocks. Larger batches are launched in chunks: the chunk starting at
+    batch b0 holds batch_chunk(batch_count, b0) vectors, the first of them batch_offset(x, bsx,
+    b0), strided or given by an array of pointers.
+    ********************************************************************/
+#define ROCBLAS_MAX_BATCH_GRID 65535
+
+inline rocblas_int batch_chunk(rocblas_int batch_count, rocblas_int b0)
+{
+    return batch_count - b0 < ROCBLAS_MAX_BATCH_GRID ? batch_count - b0 : ROCBLAS_MAX_BATCH_GRID;
+}
+
+template <typename T>
+T* batch_offset(T* x, rocblas_int bsx, rocblas_int b0)
+{
+    return x + (size_t)b0 * bsx;
+}
+
+template <typename T>
+T* const* batch_offset(T* const* x, rocblas_int bsx, rocblas_int b0)
+{
+    return x + b0;
+}
+// end batch_chunk
+
+/*! \brief scalar in either pointer mode
+
+    \details
+
+    kernels that take A alpha with A = T for a scalar passed by value from the host or
+    A = const T* for a scalar on the device read it with load_scalar(alpha).
+    ********************************************************************/
+template <typename T>
+__device__ T load_scalar(T alpha)
+{
+    return alpha;
+}
+
+template <typename T>
+__device__ T load_scalar(const T* alpha)
+{
+    return *alpha;
+}
+// end load_scalar
+
+/*! \brief compensated accumulator
+
+    \details
+
+    sum plus the rounding error of the operations that produced it. Products enter exactly
+    by TwoProd (the error of x * y is fma(x, y, -x * y)), additions carry the error of the
+    addition by TwoSum, so the sum err + sum is accurate to about twice the working precision.
+    It has no constructor of its own for the default, so it can live in shared memory, and
+    reductions written for T work unchanged on it.
+    ********************************************************************/
+template <typename T>
+struct rocblas_compensated
+{
+    T sum;
+    T err;
+
+    rocblas_compensated() = default;
+
+    __host__ __device__ rocblas_compensated(T s, T e = 0) : sum(s), err(e) {}
+
+    __device__ rocblas_compensated& operator+=(const rocblas_compensated& b)
+    {
+        T s  = sum + b.sum;
+        T bp = s - sum;
+        T e  = (sum - (s - bp)) + (b.sum - bp);
+
+        sum = s;
+        err += b.err + e;
+        return *this;
+    }
+
+    __device__ explicit operator T() const { return sum + err; }
+};
+
+/*! \brief accumulator types
+
+    \details
+
+    the types a reduction over elements of T accumulates in for each rocblas_accumulation_mode.
+    rocblas_half accumulates in float, complex dot products natively in every mode.
+    ********************************************************************/
+template <typename T>
+struct rocblas_accumulator
+{
+    typedef T native;
+    typedef rocblas_compensated<T> compensated;
+    typedef double promoted;
+};
+
+template <>
+struct rocblas_accumulator<rocblas_half>
+{
+    typedef float native;
+    typedef rocblas_compensated<float> compensated;
+    typedef double promoted;
+};
+
+template <>
+struct rocblas_accumulator<rocblas_float_complex>
+{
+    typedef rocblas_float_complex native;
+    typedef rocblas_float_complex compensated;
+    typedef rocblas_float_complex promoted;
+};
+
+template <>
+struct rocblas_accumulator<rocblas_double_complex>
+{
+    typedef rocblas_double_complex native;
+    typedef rocblas_double_complex compensated;
+    typedef rocblas_double_complex promoted;
+};
+
+/*! \brief product into an accumulator
+
+    \details
+
+    z = x * y in the precision of the accumulator A, exactly for the compensated accumulator.
+    ********************************************************************/
+template <typename A, typename T>
+__device__ void rocblas_acc_product(A& z, T x, T y)
+{
+    z = A(x) * A(y);
+}
+
+template <typename T>
+__device__ void rocblas_acc_product(rocblas_compensated<T>& z, T x, T y)
+{
+    T p = x * y;
+    z   = rocblas_compensated<T>(p, fma(x, y, -p));
+}
+// end accumulators
+
+/*! \brief half vector loads
+
+    \details
+
+    the P elements of a rocblas_half vector that thread i works on, as floats. P = 1 reads
+    element i of a strided vector; P = 8 reads elements [8 * i, 8 * i + 8) of a contiguous
+    vector aligned to half8 with one half8 load, as haxpy does. Elements past n read as 0.
+
+    @param[in]
+    n         rocblas_int. number of elements of x
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int. increment of x, P = 1 only
+    @param[in]
+    i         rocblas_int. thread id
+    @param[out]
+    v         P floats
+    ********************************************************************/
+template <rocblas_int P>
+__device__ void
+rocblas_load_half(rocblas_int n, const __fp16* x, rocblas_int incx, rocblas_int i, float* v)
+{
+    v[0] = i < n ? float(x[i * incx]) : 0.0f;
+}
+
+template <>
+__device__ inline void
+rocblas_load_half<8>(rocblas_int n, const __fp16* x, rocblas_int incx, rocblas_int i, float* v)
+{
+    if(8 * i + 8 <= n)
+    {
+        half8 x8 = ((const half8*)x)[i];
+        for(rocblas_int k = 0; k < 8; k++)
+            v[k] = x8[k];
+    }
+    else
+    {
+        for(rocblas_int k = 0; k < 8; k++)
+            v[k] = 8 * i + k < n ? float(x[8 * i + k]) : 0.0f;
+    }
+}
+// end load_half
+
+/*! \brief rounding to a narrower precision
+
+    \details
+
+    rounds a, of the compute type T, to the values of the narrower type To (__fp16 or float)
+    and returns them in T, so that the conversion to To that follows is exact. a is scaled by a
+    power of 2 so that its ulp in To is 1: rocblas_rounding_mode_nearest rounds to the nearest
+    value and ties to even, rocblas_rounding_mode_stochastic rounds up if the fraction times 2^32
+    exceeds the 32 random bits r. Values past the largest of To convert to infinity, zeros,
+    infinities and NaNs are returned as they are.
+    ********************************************************************/
+template <typename T>
+struct rocblas_round_traits;
+
+template <>
+struct rocblas_round_traits<__fp16>
+{
+    static constexpr int digits  = 11;
+    static constexpr int min_exp = -14;
+};
+
+template <>
+struct rocblas_round_traits<float>
+{
+    static constexpr int digits  = 24;
+    static constexpr int min_exp = -126;
+};
+
+template <>
+struct rocblas_round_traits<double>
+{
+    static constexpr int digits  = 53;
+    static constexpr int min_exp = -1022;
+};
+
+template <typename To, typename T>
+__device__ T rocblas_round(T a, rocblas_rounding_mode rounding, uint32_t r)
+{
+    T m = fabs(a);
+    if(!(m > 0) || isinf(m))
+        return a;
+
+    // the exponent of the ulp of m in To, subnormals of To share that of the smallest normal
+    int e = ilogb(m);
+    if(e < rocblas_round_traits<To>::min_exp)
+        e = rocblas_round_traits<To>::min_exp;
+    e += 1 - rocblas_round_traits<To>::digits;
+
+    T q     = ldexp(m, -e);
+    T lower = floor(q);
+    T frac  = q - lower;
+
+    bool up;
+    if(rounding == rocblas_rounding_mode_stochastic)
+        up = ldexp((double)frac, 32) > (double)r;
+    else
+        up = frac > T(0.5) || (frac == T(0.5) && fmod(lower, T(2)) != 0);
+
+    return copysign(ldexp(lower + (up ? 1 : 0), e), a);
+}
+
+/*! \brief random bits of the stochastic rounding
+
+    \details
+
+    the 32 random bits of element k, the hash of seed * 0x9E3779B9 + k as documented with
+    rocblas_convert.
+    ********************************************************************/
+__device__ inline uint32_t rocblas_random_bits(uint32_t seed, uint32_t k)
+{
+    uint32_t h = seed * 0x9E3779B9u + k;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h;
+}
+// end rounding
+
+/*! \brief complex arithmetic
+
+    \details
+
+    the products, conjugates and real parts of the symmetric and hermitian blas2 kernels. The
+    rocblas_float_complex and rocblas_double_complex vector types only have elementwise
+    operators, the real types are their own conjugate and real part. rank_equal compares with a
+    real value on the host and on the device.
+    ********************************************************************/
+__device__ inline float rank_conj(float a) { return a; }
+__device__ inline double rank_conj(double a) { return a; }
+__device__ inline rocblas_float_complex rank_conj(rocblas_float_complex a)
+{
+    return make_float2(a.x, -a.y);
+}
+__device__ inline rocblas_double_complex rank_conj(rocblas_double_complex a)
+{
+    return make_double2(a.x, -a.y);
+}
+
+__device__ inline float rank_mul(float a, float b) { return a * b; }
+__device__ inline double rank_mul(double a, double b) { return a * b; }
+__device__ inline rocblas_float_complex rank_mul(rocblas_float_complex a, rocblas_float_complex b)
+{
+    return make_float2(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+__device__ inline rocblas_double_complex rank_mul(rocblas_double_complex a,
+                                                  rocblas_double_complex b)
+{
+    return make_double2(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+
+__device__ inline float rank_real(float a) { return a; }
+__device__ inline double rank_real(double a) { return a; }
+__device__ inline rocblas_float_complex rank_real(rocblas_float_complex a)
+{
+    return make_float2(a.x, 0);
+}
+__device__ inline rocblas_double_complex rank_real(rocblas_double_complex a)
+{
+    return make_double2(a.x, 0);
+}
+
+__host__ __device__ inline bool rank_equal(float a, double v) { return a == v; }
+__host__ __device__ inline bool rank_equal(double a, double v) { return a == v; }
+__host__ __device__ inline bool rank_equal(rocblas_float_complex a, double v)
+{
+    return a.x == v && a.y == 0;
+}
+__host__ __device__ inline bool rank_equal(rocblas_double_complex a, double v)
+{
+    return a.x == v && a.y == 0;
+}
+// end complex arithmetic
+
+#endif // _DEVICE_TEMPLATE_H_
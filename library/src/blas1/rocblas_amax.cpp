@@ -14,10 +14,20 @@
 #include "logging.h"
 #include "utility.h"
 
-template <typename T1, typename T2, rocblas_int NB>
-__global__ void iamax_kernel_part1(
-    rocblas_int n, const T1* x, rocblas_int incx, T2* workspace, rocblas_int* workspace_index)
+// single pass: the last block to finish reduces the partial results of all the blocks of its
+// vector, hipBlockIdx_y picks the vector of the batch
+template <typename T1, typename T2, rocblas_int NB, typename U>
+__global__ void iamax_kernel(rocblas_int n,
+                             U xa,
+                             rocblas_int incx,
+                             rocblas_int bsx,
+                             T2* partial,
+                             rocblas_int* partial_index,
+                             unsigned int* tickets,
+                             rocblas_int* results)
 {
+    const T1* x = load_batch_ptr(xa, bsx);
+
     rocblas_int tx  = hipThreadIdx_x;
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
@@ -33,148 +43,109 @@ __global__ void iamax_kernel_part1(
         index[tx]      = tid;
     }
     else
-    { // pad with zero
-        shared_tep[tx] = 0.0;
-        index[tx]      = -1;
+    { // pad with a value that never wins and an index past the end that loses every tie
+        shared_tep[tx] = -1;
+        index[tx]      = hipGridDim_x * NB;
     }
 
-    rocblas_maxid_reduce<NB, T2>(tx, shared_tep, index);
+    partial += hipBlockIdx_y * hipGridDim_x;
+    partial_index += hipBlockIdx_y * hipGridDim_x;
 
-    if(tx == 0)
+    if(rocblas_maxid_reduce_grid<NB, T2>(
+           tx, shared_tep, index, partial, partial_index, tickets + hipBlockIdx_y) &&
+       tx == 0)
     {
-        workspace[hipBlockIdx_x]       = shared_tep[0];
-        workspace_index[hipBlockIdx_x] = index[0];
+        // return Fortran 1 based index as in BLAS standard, not C zero based index
+        results[hipBlockIdx_y] = index[0] + 1;
     }
 }
 
-template <typename T, rocblas_int NB, rocblas_int flag>
-__global__ void
-iamax_kernel_part2(rocblas_int n, T* workspace, rocblas_int* workspace_index, rocblas_int* result)
-{
-    rocblas_int tx = hipThreadIdx_x;
-
-    __shared__ T shared_tep[NB];
-    __shared__ rocblas_int index[NB];
-
-    shared_tep[tx] = 0.0;
-    index[tx]      = -1;
-
-    // bound, loop
-    for(rocblas_int i = tx; i < n; i += NB)
-    {
-        if(shared_tep[tx] == workspace[i])
-        {
-            index[tx] = min(index[tx], workspace_index[i]); // if equal take the smaller index
-        }
-        else if(shared_tep[tx] < workspace[i]) // if smaller, then take the bigger one
-        {
-            shared_tep[tx] = workspace[i];
-            index[tx]      = workspace_index[i];
-        }
-    }
-
-    __syncthreads();
-
-    rocblas_maxid_reduce<NB, T>(tx, shared_tep, index);
+// HIP support up to 1024 threads/work itmes per thread block/work group
+#define NB_X 1024
 
-    if(tx == 0)
+/*
+    iamax of batch_count vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID vectors. U is const T1* for strided vectors (a single vector is a
+    strided batch of one) or const T1* const* for an array of pointers. results holds
+    batch_count results on the host or the device.
+*/
+template <typename T1, typename T2, typename U>
+rocblas_status rocblas_iamax_launch(rocblas_handle handle,
+                                    rocblas_int n,
+                                    U x,
+                                    rocblas_int incx,
+                                    rocblas_int bsx,
+                                    rocblas_int* results,
+                                    rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || incx <= 0 || 0 == batch_count)
     {
-        if(flag)
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            // flag == 1, write the result on device memory
-            // return Fortran 1 based index as in BLAS standard, not C zero based index
-            *result = index[0] + 1; // result[0] works, too
+            RETURN_IF_HIP_ERROR(hipMemset(results, 0, sizeof(rocblas_int) * batch_count));
         }
-        else // if flag == 0, cannot write to result which is in host memory, instead write to
-             // worksapce
+        else
         {
-            workspace_index[0] = index[0];
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->wait_host_results(results, sizeof(rocblas_int) * batch_count));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                results[b] = 0;
         }
+        return rocblas_status_success;
     }
-}
 
-// HIP support up to 1024 threads/work itmes per thread block/work group
-#define NB_X 1024
-
-// assume workspace has already been allocated, recommened for repeated calling of iamax product
-// routine
-template <typename T1, typename T2>
-rocblas_status rocblas_iamax_template_workspace(rocblas_handle handle,
-                                                rocblas_int n,
-                                                const T1* x,
-                                                rocblas_int incx,
-                                                rocblas_int* result,
-                                                T2* workspace,
-                                                rocblas_int* workspace_index,
-                                                rocblas_int lworkspace)
-{
     rocblas_int blocks = (n - 1) / NB_X + 1;
 
-    // At least two kernels are needed to finish the reduction
-    // kennel 1 write partial result per thread block in workspace, number of partial result is
-    // blocks
-    // kernel 2 gather all the partial result in workspace and finish the final reduction.
+    // the partial indices follow the partial values
+    unsigned int* tickets;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(
+        handle->get_reduction_buffer(batch_count,
+                                     sizeof(rocblas_int),
+                                     (sizeof(T2) + sizeof(rocblas_int)) * blocks * batch_count,
+                                     &tickets,
+                                     &slots,
+                                     &partial));
 
-    if(lworkspace < blocks)
-    {
-        printf("size of workspace = %d is too small, allocate at least %d", lworkspace, blocks);
-        return rocblas_status_not_implemented;
-    }
+    rocblas_int* partial_index = (rocblas_int*)((T2*)partial + (size_t)blocks * batch_count);
+
+    // in host pointer mode the results are written to the slots of the buffer and copied back
+    rocblas_int* d_results =
+        rocblas_pointer_mode_device == handle->pointer_mode ? results : (rocblas_int*)slots;
 
-    dim3 grid(blocks, 1, 1);
     dim3 threads(NB_X, 1, 1);
 
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
-    hipLaunchKernelGGL((iamax_kernel_part1<T1, T2, NB_X>),
-                       dim3(grid),
-                       dim3(threads),
-                       0,
-                       rocblas_stream,
-                       n,
-                       x,
-                       incx,
-                       workspace,
-                       workspace_index);
-
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
     {
-        // the last argument 1 indicate the result is a device pointer, not memcpy is required
-        hipLaunchKernelGGL((iamax_kernel_part2<T2, NB_X, 1>),
-                           dim3(1, 1, 1),
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((iamax_kernel<T1, T2, NB_X, U>),
+                           dim3(grid),
                            dim3(threads),
                            0,
                            rocblas_stream,
-                           blocks,
-                           workspace,
-                           workspace_index,
-                           result);
+                           n,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           (T2*)partial + (size_t)blocks * b0,
+                           partial_index + (size_t)blocks * b0,
+                           tickets + b0,
+                           d_results + b0);
     }
-    else
-    {
-        // the last argument 0 indicate the result is a host pointer
-        // workspace[0] has a copy of the final result, if the result pointer is on host, a memory
-        // copy is required
-        // printf("it is a host pointer\n");
-        // only for blocks > 1, otherwise the final result is already reduced in workspace[0]
-        if(blocks > 1)
-        {
-            hipLaunchKernelGGL((iamax_kernel_part2<T2, NB_X, 0>),
-                               dim3(1, 1, 1),
-                               dim3(threads),
-                               0,
-                               rocblas_stream,
-                               blocks,
-                               workspace,
-                               workspace_index,
-                               result);
-        }
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(result, workspace_index, sizeof(rocblas_int), hipMemcpyDeviceToHost));
 
-        // return Fortran 1 based index as in the BLAS standard, not C zero based index
-        *result += 1;
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(results, slots, sizeof(rocblas_int) * batch_count));
     }
+
     return rocblas_status_success;
 }
 
@@ -204,7 +175,6 @@ rocblas_status rocblas_iamax_template_workspace(rocblas_handle handle,
               (Fortran) is used, not 0 based indexing (C).
     ********************************************************************/
 
-// allocate workspace inside this API
 template <typename T1, typename T2>
 rocblas_status rocblas_iamax_template(
     rocblas_handle handle, rocblas_int n, const T1* x, rocblas_int incx, rocblas_int* result)
@@ -216,6 +186,166 @@ rocblas_status rocblas_iamax_template(
 
     log_bench(handle, "./rocblas-bench -f iamax -r", replaceX<T1>("X"), "-n", n, "--incx", incx);
 
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_iamax_launch<T1, T2>(handle, n, x, incx, 0, result, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    iamax_strided_batched and iamax_batched find the first index of the element of maximum
+    magnitude of batch_count vectors x_i in one call, result[i] is the result of x_i. The
+    vectors of iamax_strided_batched start bsx elements apart, the vectors of iamax_batched are
+    given by an array of batch_count device pointers on the GPU. result is an array of
+    batch_count values, either on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T1, typename T2>
+rocblas_status rocblas_iamax_strided_batched_template(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      const T1* x,
+                                                      rocblas_int incx,
+                                                      rocblas_int bsx,
+                                                      rocblas_int* result,
+                                                      rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T1>("rocblas_iXamax_strided_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              bsx,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f iamax_batched -r",
+              replaceX<T1>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_iamax_launch<T1, T2>(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <typename T1, typename T2>
+rocblas_status rocblas_iamax_batched_template(rocblas_handle handle,
+                                              rocblas_int n,
+                                              const T1* const* x,
+                                              rocblas_int incx,
+                                              rocblas_int* result,
+                                              rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(
+        handle, replaceX<T1>("rocblas_iXamax_batched"), n, (const void*&)x, incx, batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f iamax_batched -r",
+              replaceX<T1>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_iamax_launch<T1, T2>(handle, n, x, incx, 0, result, batch_count);
+}
+
+/*
+    ihamax reads P elements of the rocblas_half vector per thread: P = 8 in the half8 loads of
+    haxpy when the vector is contiguous and aligned to half8, P = 1 otherwise. The magnitudes
+    are compared as floats.
+*/
+template <rocblas_int NB, rocblas_int P>
+__global__ void ihamax_kernel(rocblas_int n,
+                              const __fp16* x,
+                              rocblas_int incx,
+                              float* partial,
+                              rocblas_int* partial_index,
+                              unsigned int* ticket,
+                              rocblas_int* result)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    float xv[P];
+    rocblas_load_half<P>(n, x, incx, tid, xv);
+
+    __shared__ float shared_tep[NB];
+    __shared__ rocblas_int index[NB];
+
+    // start from a value that never wins and an index past the end that loses every tie, the
+    // first of the equal magnitudes of the thread wins
+    shared_tep[tx] = -1;
+    index[tx]      = n;
+
+    for(rocblas_int k = 0; k < P; k++)
+    {
+        if(P * tid + k < n && fabs(xv[k]) > shared_tep[tx])
+        {
+            shared_tep[tx] = fabs(xv[k]);
+            index[tx]      = P * tid + k;
+        }
+    }
+
+    if(rocblas_maxid_reduce_grid<NB, float>(
+           tx, shared_tep, index, partial, partial_index, ticket) &&
+       tx == 0)
+    {
+        // return Fortran 1 based index as in BLAS standard, not C zero based index
+        *result = index[0] + 1;
+    }
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    ihamax finds the first index of the element of maximum magnitude of a rocblas_half vector
+    x, in one pass over x in the half8 loads of haxpy if x is contiguous.
+
+    ********************************************************************/
+
+rocblas_status rocblas_iamax_half(rocblas_handle handle,
+                                  rocblas_int n,
+                                  const rocblas_half* x,
+                                  rocblas_int incx,
+                                  rocblas_int* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, "rocblas_ihamax", n, (const void*&)x, incx);
+
+    log_bench(handle, "./rocblas-bench -f iamax -r h", "-n", n, "--incx", incx);
+
     if(nullptr == x)
         return rocblas_status_invalid_pointer;
     else if(nullptr == result)
@@ -232,39 +362,73 @@ rocblas_status rocblas_iamax_template(
         }
         else
         {
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(rocblas_int)));
             *result = 0;
         }
         return rocblas_status_success;
     }
 
-    rocblas_int blocks = (n - 1) / NB_X + 1;
+    bool packed                     = 1 == incx && 0 == (uintptr_t)x % sizeof(half8);
+    rocblas_int elements_per_thread = packed ? 8 : 1;
+    rocblas_int blocks              = (n - 1) / (NB_X * elements_per_thread) + 1;
+
+    // the partial indices follow the partial values
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(
+        handle->get_reduction_buffer(1,
+                                     sizeof(rocblas_int),
+                                     (sizeof(float) + sizeof(rocblas_int)) * blocks,
+                                     &ticket,
+                                     &slots,
+                                     &partial));
 
-    rocblas_status status;
+    rocblas_int* partial_index = (rocblas_int*)((float*)partial + blocks);
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T2) * blocks), rocblas::device_free};
-    if(!workspace)
+    // in host pointer mode the result is written to the slot of the buffer and copied back
+    rocblas_int* d_result =
+        rocblas_pointer_mode_device == handle->pointer_mode ? result : (rocblas_int*)slots;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(packed)
     {
-        return rocblas_status_memory_error;
+        hipLaunchKernelGGL((ihamax_kernel<NB_X, 8>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (float*)partial,
+                           partial_index,
+                           ticket,
+                           d_result);
     }
-
-    auto workspace_index = rocblas_unique_ptr{rocblas::device_malloc(sizeof(rocblas_int) * blocks),
-                                              rocblas::device_free};
-    if(!workspace_index)
+    else
     {
-        return rocblas_status_memory_error;
+        hipLaunchKernelGGL((ihamax_kernel<NB_X, 1>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (float*)partial,
+                           partial_index,
+                           ticket,
+                           d_result);
     }
 
-    status = rocblas_iamax_template_workspace<T1, T2>(handle,
-                                                      n,
-                                                      x,
-                                                      incx,
-                                                      result,
-                                                      (T2*)workspace.get(),
-                                                      (rocblas_int*)workspace_index.get(),
-                                                      blocks);
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slots, sizeof(rocblas_int)));
+    }
 
-    return status;
+    return rocblas_status_success;
 }
 
 /*
@@ -273,6 +437,15 @@ rocblas_status rocblas_iamax_template(
  * ===========================================================================
  */
 
+extern "C" rocblas_status rocblas_ihamax(rocblas_handle handle,
+                                         rocblas_int n,
+                                         const rocblas_half* x,
+                                         rocblas_int incx,
+                                         rocblas_int* result)
+{
+    return rocblas_iamax_half(handle, n, x, incx, result);
+}
+
 extern "C" rocblas_status rocblas_isamax(
     rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, rocblas_int* result)
 {
@@ -302,3 +475,47 @@ extern "C" rocblas_status rocblas_idzamax(rocblas_handle handle,
 {
     return rocblas_iamax_template<rocblas_double_complex, double>(handle, n, x, incx, result);
 }
+
+extern "C" rocblas_status rocblas_isamax_strided_batched(rocblas_handle handle,
+                                                         rocblas_int n,
+                                                         const float* x,
+                                                         rocblas_int incx,
+                                                         rocblas_int bsx,
+                                                         rocblas_int* result,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_iamax_strided_batched_template<float, float>(
+        handle, n, x, incx, bsx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_idamax_strided_batched(rocblas_handle handle,
+                                                         rocblas_int n,
+                                                         const double* x,
+                                                         rocblas_int incx,
+                                                         rocblas_int bsx,
+                                                         rocblas_int* result,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_iamax_strided_batched_template<double, double>(
+        handle, n, x, incx, bsx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_isamax_batched(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 const float* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_int* result,
+                                                 rocblas_int batch_count)
+{
+    return rocblas_iamax_batched_template<float, float>(handle, n, x, incx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_idamax_batched(rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 const double* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_int* result,
+                                                 rocblas_int batch_count)
+{
+    return rocblas_iamax_batched_template<double, double>(handle, n, x, incx, result, batch_count);
+}
@@ -14,9 +14,15 @@
 #include "logging.h"
 #include "utility.h"
 
+// single pass: the last block to finish reduces the partial results of all the blocks
 template <typename T1, typename T2, rocblas_int NB>
-__global__ void iamin_kernel_part1(
-    rocblas_int n, const T1* x, rocblas_int incx, T2* workspace, rocblas_int* workspace_index)
+__global__ void iamin_kernel(rocblas_int n,
+                             const T1* x,
+                             rocblas_int incx,
+                             T2* partial,
+                             rocblas_int* partial_index,
+                             unsigned int* ticket,
+                             rocblas_int* result)
 {
     rocblas_int tx  = hipThreadIdx_x;
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
@@ -33,147 +39,22 @@ __global__ void iamin_kernel_part1(
         index[tx]      = tid;
     }
     else
-    { // pad with zero
-        shared_tep[tx] = 0.0;
-        index[tx]      = -1;
+    { // pad with a value that never wins and an index past the end that loses every tie
+        shared_tep[tx] = INFINITY;
+        index[tx]      = hipGridDim_x * NB;
     }
 
-    rocblas_maxid_reduce<NB, T2>(tx, shared_tep, index);
-
-    if(tx == 0)
-    {
-        workspace[hipBlockIdx_x]       = shared_tep[0];
-        workspace_index[hipBlockIdx_x] = index[0];
-    }
-}
-
-template <typename T, rocblas_int NB, rocblas_int flag>
-__global__ void
-iamin_kernel_part2(rocblas_int n, T* workspace, rocblas_int* workspace_index, rocblas_int* result)
-{
-    rocblas_int tx = hipThreadIdx_x;
-
-    __shared__ T shared_tep[NB];
-    __shared__ rocblas_int index[NB];
-
-    shared_tep[tx] = 0.0;
-    index[tx]      = -1;
-
-    // bound, loop
-    for(rocblas_int i = tx; i < n; i += NB)
-    {
-        if(shared_tep[tx] == workspace[i])
-        {
-            index[tx] = min(index[tx], workspace_index[i]); // if equal take the smaller index
-        }
-        else if(shared_tep[tx] < workspace[i]) // if smaller, then take the bigger one
-        {
-            shared_tep[tx] = workspace[i];
-            index[tx]      = workspace_index[i];
-        }
-    }
-
-    __syncthreads();
-
-    rocblas_maxid_reduce<NB, T>(tx, shared_tep, index);
-
-    if(tx == 0)
+    if(rocblas_minid_reduce_grid<NB, T2>(tx, shared_tep, index, partial, partial_index, ticket)
+       && tx == 0)
     {
-        if(flag)
-        {
-            // flag == 1, write the result on device memory
-            *result = index[0]; // result[0] works, too
-        }
-        else // if flag == 0, cannot write to result which is in host memory, instead write to
-             // worksapce
-        {
-            workspace_index[0] = index[0];
-        }
+        // return Fortran 1 based index as in BLAS standard, not C zero based index
+        *result = index[0] + 1;
     }
 }
 
 // HIP support up to 1024 threads/work itmes per thread block/work group
 #define NB_X 1024
 
-// assume workspace has already been allocated, recommened for repeated calling of iamin product
-// routine
-template <typename T1, typename T2>
-rocblas_status rocblas_iamin_template_workspace(rocblas_handle handle,
-                                                rocblas_int n,
-                                                const T1* x,
-                                                rocblas_int incx,
-                                                rocblas_int* result,
-                                                T2* workspace,
-                                                rocblas_int* workspace_index,
-                                                rocblas_int lworkspace)
-{
-
-    rocblas_int blocks = (n - 1) / NB_X + 1;
-
-    // At least two kernels are needed to finish the reduction
-    // kennel 1 write partial result per thread block in workspace, number of partial result is
-    // blocks
-    // kernel 2 gather all the partial result in workspace and finish the final reduction.
-
-    if(lworkspace < blocks)
-    {
-        printf("size of workspace = %d is too small, allocate at least %d", lworkspace, blocks);
-        return rocblas_status_not_implemented;
-    }
-
-    dim3 grid(blocks, 1, 1);
-    dim3 threads(NB_X, 1, 1);
-
-    hipStream_t rocblas_stream = handle->rocblas_stream;
-
-    hipLaunchKernelGGL((iamin_kernel_part1<T1, T2, NB_X>),
-                       dim3(grid),
-                       dim3(threads),
-                       0,
-                       rocblas_stream,
-                       n,
-                       x,
-                       incx,
-                       workspace,
-                       workspace_index);
-
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
-    {
-        // the last argument 1 indicate the result is a device pointer, not memcpy is required
-        hipLaunchKernelGGL((iamin_kernel_part2<T2, NB_X, 1>),
-                           dim3(1, 1, 1),
-                           dim3(threads),
-                           0,
-                           rocblas_stream,
-                           blocks,
-                           workspace,
-                           workspace_index,
-                           result);
-    }
-    else
-    {
-        // the last argument 0 indicate the result is a host pointer
-        // workspace[0] has a copy of the final result, if the result pointer is on host, a memory
-        // copy is required
-        // printf("it is a host pointer\n");
-        // only for blocks > 1, otherwise the final result is already reduced in workspace[0]
-        if(blocks > 1)
-            hipLaunchKernelGGL((iamin_kernel_part2<T2, NB_X, 0>),
-                               dim3(1, 1, 1),
-                               dim3(threads),
-                               0,
-                               rocblas_stream,
-                               blocks,
-                               workspace,
-                               workspace_index,
-                               result);
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(result, workspace_index, sizeof(rocblas_int), hipMemcpyDeviceToHost));
-    }
-
-    return rocblas_status_success;
-}
-
 /* ============================================================================================ */
 
 /*! \brief BLAS Level 1 API
@@ -200,7 +81,6 @@ rocblas_status rocblas_iamin_template_workspace(rocblas_handle handle,
               (Fortran) is used, not 0 based indexing (C).
     ********************************************************************/
 
-// allocate workspace inside this API
 template <typename T1, typename T2>
 rocblas_status rocblas_iamin_template(
     rocblas_handle handle, rocblas_int n, const T1* x, rocblas_int incx, rocblas_int* result)
@@ -224,43 +104,60 @@ rocblas_status rocblas_iamin_template(
     {
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(T2)));
+            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(rocblas_int)));
         }
         else
         {
-            *result = 0.0;
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(rocblas_int)));
+            *result = 0;
         }
         return rocblas_status_success;
     }
 
     rocblas_int blocks = (n - 1) / NB_X + 1;
 
-    rocblas_status status;
+    // the partial indices follow the partial values
+    unsigned int* ticket;
+    void* slot;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(
+        handle->get_reduction_buffer(1,
+                                     sizeof(rocblas_int),
+                                     (sizeof(T2) + sizeof(rocblas_int)) * blocks,
+                                     &ticket,
+                                     &slot,
+                                     &partial));
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T2) * blocks), rocblas::device_free};
-    if(!workspace)
-    {
-        return rocblas_status_memory_error;
-    }
+    rocblas_int* partial_index = (rocblas_int*)((T2*)partial + blocks);
+
+    // in host pointer mode the result is written to the slot of the buffer and copied back
+    rocblas_int* d_result =
+        rocblas_pointer_mode_device == handle->pointer_mode ? result : (rocblas_int*)slot;
+
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    hipLaunchKernelGGL((iamin_kernel<T1, T2, NB_X>),
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       rocblas_stream,
+                       n,
+                       x,
+                       incx,
+                       (T2*)partial,
+                       partial_index,
+                       ticket,
+                       d_result);
 
-    auto workspace_index = rocblas_unique_ptr{rocblas::device_malloc(sizeof(rocblas_int) * blocks),
-                                              rocblas::device_free};
-    if(!workspace_index)
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
     {
-        return rocblas_status_memory_error;
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slot, sizeof(rocblas_int)));
     }
 
-    status = rocblas_iamin_template_workspace<T1, T2>(handle,
-                                                      n,
-                                                      x,
-                                                      incx,
-                                                      result,
-                                                      (T2*)workspace.get(),
-                                                      (rocblas_int*)workspace_index.get(),
-                                                      blocks);
-
-    return status;
+    return rocblas_status_success;
 }
 
 /*
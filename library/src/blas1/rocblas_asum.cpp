@@ -14,156 +14,162 @@
 #include "logging.h"
 #include "utility.h"
 
-template <typename T1, typename T2, rocblas_int NB>
-__global__ void asum_kernel_part1(rocblas_int n, const T1* x, rocblas_int incx, T2* workspace)
+// single pass: the last block to finish reduces the partial results of all the blocks of its
+// vector, hipBlockIdx_y picks the vector of the batch. The sums are accumulated in A.
+template <typename T1, typename T2, rocblas_int NB, typename U, typename A>
+__global__ void asum_kernel(rocblas_int n,
+                            U xa,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            A* partial,
+                            unsigned int* tickets,
+                            T2* results)
 {
+    const T1* x = load_batch_ptr(xa, bsx);
+
     rocblas_int tx  = hipThreadIdx_x;
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    __shared__ T2 shared_tep[NB];
+    __shared__ A shared_tep[NB];
     // bound
     if(tid < n)
     {
         T2 real        = fetch_real<T1, T2>(x[tid * incx]);
         T2 imag        = fetch_imag<T1, T2>(x[tid * incx]);
-        shared_tep[tx] = fabs(real) + fabs(imag);
+        shared_tep[tx] = fabs(real);
+        shared_tep[tx] += A(fabs(imag));
     }
     else
     { // pad with zero
         shared_tep[tx] = 0.0;
     }
 
-    rocblas_sum_reduce<NB, T2>(tx, shared_tep);
+    partial += hipBlockIdx_y * hipGridDim_x;
 
-    if(tx == 0)
-        workspace[hipBlockIdx_x] = shared_tep[0];
+    if(rocblas_sum_reduce_grid<NB, A>(tx, shared_tep, partial, tickets + hipBlockIdx_y) &&
+       tx == 0)
+        results[hipBlockIdx_y] = T2(shared_tep[0]);
 }
 
-template <typename T, rocblas_int NB, rocblas_int flag>
-__global__ void asum_kernel_part2(rocblas_int n, T* workspace, T* result)
-{
-    rocblas_int tx = hipThreadIdx_x;
-
-    __shared__ T shared_tep[NB];
-
-    shared_tep[tx] = 0.0;
-
-    // bound, loop
-    for(rocblas_int i = tx; i < n; i += NB)
-    {
-        shared_tep[tx] += workspace[i];
-    }
-
-    __syncthreads();
-
-    if(n < 32)
-    {
-        // no need parallel reduction
-        if(tx == 0)
-        {
-            for(rocblas_int i = 1; i < n; i++)
-            {
-                shared_tep[0] += shared_tep[i];
-            }
-        }
-    }
-    else
-    {
-        // parallel reduction,
-        rocblas_sum_reduce<NB, T>(tx, shared_tep);
-    }
+// HIP support up to 1024 threads/work itmes per thread block/work group
+#define NB_X 1024
 
-    if(tx == 0)
+/*
+    asum of batch_count vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID vectors. U is const T1* for strided vectors (a single vector is a
+    strided batch of one) or const T1* const* for an array of pointers. results holds
+    batch_count results on the host or the device. The sums are accumulated in A.
+*/
+template <rocblas_int NB, typename A, typename T1, typename T2, typename U>
+rocblas_status rocblas_asum_launch_nb(rocblas_handle handle,
+                                      rocblas_int n,
+                                      U x,
+                                      rocblas_int incx,
+                                      rocblas_int bsx,
+                                      T2* results,
+                                      rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || incx <= 0 || 0 == batch_count)
     {
-        if(flag)
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            // flag == 1, write to result of device memory
-            *result = shared_tep[0]; // result[0] works, too
+            RETURN_IF_HIP_ERROR(hipMemset(results, 0, sizeof(T2) * batch_count));
         }
         else
         {
-            workspace[0] = shared_tep[0];
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(results, sizeof(T2) * batch_count));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                results[b] = 0.0;
         }
+        return rocblas_status_success;
     }
-}
-
-// HIP support up to 1024 threads/work itmes per thread block/work group
-#define NB_X 1024
 
-// assume workspace has already been allocated, recommened for repeated calling of asum product
-// routine
-template <typename T1, typename T2>
-rocblas_status rocblas_asum_template_workspace(rocblas_handle handle,
-                                               rocblas_int n,
-                                               const T1* x,
-                                               rocblas_int incx,
-                                               T2* result,
-                                               T2* workspace,
-                                               rocblas_int lworkspace)
-{
-    rocblas_int blocks = (n - 1) / NB_X + 1;
+    rocblas_int blocks = (n - 1) / NB + 1;
 
-    // At least two kernels are needed to finish the reduction
-    // kennel 1 write partial result per thread block in workspace, number of partial result is
-    // blocks
-    // kernel 2 gather all the partial result in workspace and finish the final reduction. number of
-    // threads (NB_X) loop blocks
+    unsigned int* tickets;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        batch_count, sizeof(T2), sizeof(A) * blocks * batch_count, &tickets, &slots, &partial));
 
-    if(lworkspace < blocks)
-    {
-        printf("size workspace = %d is too small, allocate at least %d", lworkspace, blocks);
-        return rocblas_status_not_implemented;
-    }
+    // in host pointer mode the results are written to the slots of the buffer and copied back
+    T2* d_results = rocblas_pointer_mode_device == handle->pointer_mode ? results : (T2*)slots;
 
-    dim3 grid(blocks, 1, 1);
-    dim3 threads(NB_X, 1, 1);
+    dim3 threads(NB, 1, 1);
 
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
-    hipLaunchKernelGGL((asum_kernel_part1<T1, T2, NB_X>),
-                       dim3(grid),
-                       dim3(threads),
-                       0,
-                       rocblas_stream,
-                       n,
-                       x,
-                       incx,
-                       workspace);
-
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
     {
-        // the last argument 1 indicate the result is on device, not memcpy is required
-        hipLaunchKernelGGL((asum_kernel_part2<T2, NB_X, 1>),
-                           dim3(1, 1, 1),
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((asum_kernel<T1, T2, NB, U, A>),
+                           dim3(grid),
                            dim3(threads),
                            0,
                            rocblas_stream,
-                           blocks,
-                           workspace,
-                           result);
+                           n,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           (A*)partial + (size_t)blocks * b0,
+                           tickets + b0,
+                           d_results + b0);
     }
-    else
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
     {
-        // the last argument 0 indicate the result is on host
-        // workspace[0] has a copy of the final result, if the result pointer is on host, a memory
-        // copy is required
-        // printf("it is a host pointer\n");
-        // only for blocks > 1, otherwise the final result is already reduced in workspace[0]
-        if(blocks > 1)
-            hipLaunchKernelGGL((asum_kernel_part2<T2, NB_X, 0>),
-                               dim3(1, 1, 1),
-                               dim3(threads),
-                               0,
-                               rocblas_stream,
-                               blocks,
-                               workspace,
-                               result);
-        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T2), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(results, slots, sizeof(T2) * batch_count));
     }
 
     return rocblas_status_success;
 }
 
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<T2>
+template <rocblas_int NB, typename T1, typename T2, typename U>
+rocblas_status rocblas_asum_launch_acc(rocblas_handle handle,
+                                       rocblas_int n,
+                                       U x,
+                                       rocblas_int incx,
+                                       rocblas_int bsx,
+                                       T2* results,
+                                       rocblas_int batch_count)
+{
+    typedef rocblas_accumulator<T2> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_asum_launch_nb<NB, typename acc::compensated, T1, T2>(
+            handle, n, x, incx, bsx, results, batch_count);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_asum_launch_nb<NB, typename acc::promoted, T1, T2>(
+            handle, n, x, incx, bsx, results, batch_count);
+    else
+        return rocblas_asum_launch_nb<NB, typename acc::native, T1, T2>(
+            handle, n, x, incx, bsx, results, batch_count);
+}
+
+// the deterministic reduction mode sums in the order fixed by ROCBLAS_DETERMINISTIC_NB, the
+// default mode in the order of NB_X, which may be tuned
+template <typename T1, typename T2, typename U>
+rocblas_status rocblas_asum_launch(rocblas_handle handle,
+                                   rocblas_int n,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   T2* results,
+                                   rocblas_int batch_count)
+{
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_asum_launch_acc<ROCBLAS_DETERMINISTIC_NB, T1, T2>(
+            handle, n, x, incx, bsx, results, batch_count);
+    else
+        return rocblas_asum_launch_acc<NB_X, T1, T2>(handle, n, x, incx, bsx, results, batch_count);
+}
+
 /* ============================================================================================ */
 
 /*! \brief BLAS Level 1 API
@@ -189,7 +195,6 @@ rocblas_status rocblas_asum_template_workspace(rocblas_handle handle,
               result is 0.0 if n <= 0 or incx <= 0.
     ********************************************************************/
 
-// allocate workspace inside this API
 template <typename T1, typename T2>
 rocblas_status rocblas_asum_template(
     rocblas_handle handle, rocblas_int n, const T1* x, rocblas_int incx, T2* result)
@@ -210,6 +215,231 @@ rocblas_status rocblas_asum_template(
         return rocblas_status_invalid_pointer;
     }
 
+    return rocblas_asum_launch<T1, T2>(handle, n, x, incx, 0, result, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    asum_strided_batched and asum_batched compute the sums of magnitudes of batch_count vectors
+    x_i in one call, result[i] is the result of x_i. The vectors of asum_strided_batched start
+    bsx elements apart, the vectors of asum_batched are given by an array of batch_count device
+    pointers on the GPU. result is an array of batch_count values, either on the host CPU or
+    device GPU.
+
+    ********************************************************************/
+
+template <typename T1, typename T2>
+rocblas_status rocblas_asum_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const T1* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     T2* result,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T1>("rocblas_Xasum_strided_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              bsx,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f asum_batched -r",
+              replaceX<T1>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_asum_launch<T1, T2>(handle, n, x, incx, bsx, result, batch_count);
+}
+
+template <typename T1, typename T2>
+rocblas_status rocblas_asum_batched_template(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const T1* const* x,
+                                             rocblas_int incx,
+                                             T2* result,
+                                             rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, replaceX<T1>("rocblas_Xasum_batched"), n, (const void*&)x, incx, batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f asum_batched -r",
+              replaceX<T1>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_asum_launch<T1, T2>(handle, n, x, incx, 0, result, batch_count);
+}
+
+/*
+    hasum reads P elements of the rocblas_half vector per thread: P = 8 in the half8 loads of
+    haxpy when the vector is contiguous and aligned to half8, P = 1 otherwise. The absolute values
+    are summed in A, at least float, and rounded to rocblas_half once.
+*/
+template <rocblas_int NB, rocblas_int P, typename A>
+__global__ void hasum_kernel(rocblas_int n,
+                             const __fp16* x,
+                             rocblas_int incx,
+                             A* partial,
+                             unsigned int* ticket,
+                             __fp16* result)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    float xv[P];
+    rocblas_load_half<P>(n, x, incx, tid, xv);
+
+    __shared__ A shared_tep[NB];
+    shared_tep[tx] = 0.0;
+
+    // the elements past n are 0
+    for(rocblas_int k = 0; k < P; k++)
+    {
+        shared_tep[tx] += A(fabs(xv[k]));
+    }
+
+    if(rocblas_sum_reduce_grid<NB, A>(tx, shared_tep, partial, ticket) && tx == 0)
+        *result = float(shared_tep[0]);
+}
+
+// hasum of a non-empty vector with NB threads per block, NB fixes the order of the sums
+template <rocblas_int NB, typename A>
+rocblas_status rocblas_hasum_launch_nb(rocblas_handle handle,
+                                       rocblas_int n,
+                                       const rocblas_half* x,
+                                       rocblas_int incx,
+                                       rocblas_half* result)
+{
+    bool packed                     = 1 == incx && 0 == (uintptr_t)x % sizeof(half8);
+    rocblas_int elements_per_thread = packed ? 8 : 1;
+    rocblas_int blocks              = (n - 1) / (NB * elements_per_thread) + 1;
+
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        1, sizeof(rocblas_half), sizeof(A) * blocks, &ticket, &slots, &partial));
+
+    // in host pointer mode the result is written to the slot of the buffer and copied back
+    __fp16* d_result =
+        rocblas_pointer_mode_device == handle->pointer_mode ? (__fp16*)result : (__fp16*)slots;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(packed)
+    {
+        hipLaunchKernelGGL((hasum_kernel<NB, 8, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (A*)partial,
+                           ticket,
+                           d_result);
+    }
+    else
+    {
+        hipLaunchKernelGGL((hasum_kernel<NB, 1, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (A*)partial,
+                           ticket,
+                           d_result);
+    }
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slots, sizeof(rocblas_half)));
+    }
+
+    return rocblas_status_success;
+}
+
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<rocblas_half>
+template <rocblas_int NB>
+rocblas_status rocblas_hasum_launch_acc(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const rocblas_half* x,
+                                        rocblas_int incx,
+                                        rocblas_half* result)
+{
+    typedef rocblas_accumulator<rocblas_half> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_hasum_launch_nb<NB, acc::compensated>(handle, n, x, incx, result);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_hasum_launch_nb<NB, acc::promoted>(handle, n, x, incx, result);
+    else
+        return rocblas_hasum_launch_nb<NB, acc::native>(handle, n, x, incx, result);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    hasum computes the sum of the absolute values of the elements of a rocblas_half vector x,
+    accumulated in float and rounded to rocblas_half once, so that the sum neither loses the
+    precision nor overflows the range of rocblas_half before the result does.
+
+    ********************************************************************/
+
+rocblas_status rocblas_asum_half(rocblas_handle handle,
+                                 rocblas_int n,
+                                 const rocblas_half* x,
+                                 rocblas_int incx,
+                                 rocblas_half* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, "rocblas_hasum", n, (const void*&)x, incx);
+
+    log_bench(handle, "./rocblas-bench -f asum -r h", "-n", n, "--incx", incx);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
     /*
      * Quick return if possible.
      */
@@ -217,30 +447,20 @@ rocblas_status rocblas_asum_template(
     {
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(T2)));
+            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(rocblas_half)));
         }
         else
         {
-            *result = 0.0;
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(rocblas_half)));
+            *result = 0; // +0.0
         }
         return rocblas_status_success;
     }
 
-    rocblas_int blocks = (n - 1) / NB_X + 1;
-
-    rocblas_status status;
-
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T2) * blocks), rocblas::device_free};
-    if(!workspace)
-    {
-        return rocblas_status_memory_error;
-    }
-
-    status = rocblas_asum_template_workspace<T1, T2>(
-        handle, n, x, incx, result, (T2*)workspace.get(), blocks);
-
-    return status;
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_hasum_launch_acc<ROCBLAS_DETERMINISTIC_NB>(handle, n, x, incx, result);
+    else
+        return rocblas_hasum_launch_acc<NB_X>(handle, n, x, incx, result);
 }
 
 /*
@@ -249,6 +469,15 @@ rocblas_status rocblas_asum_template(
  * ===========================================================================
  */
 
+extern "C" rocblas_status rocblas_hasum(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const rocblas_half* x,
+                                        rocblas_int incx,
+                                        rocblas_half* result)
+{
+    return rocblas_asum_half(handle, n, x, incx, result);
+}
+
 extern "C" rocblas_status
 rocblas_sasum(rocblas_handle handle, rocblas_int n, const float* x, rocblas_int incx, float* result)
 {
@@ -278,3 +507,47 @@ extern "C" rocblas_status rocblas_dzasum(rocblas_handle handle,
 {
     return rocblas_asum_template<rocblas_double_complex, double>(handle, n, x, incx, result);
 }
+
+extern "C" rocblas_status rocblas_sasum_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        float* result,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_asum_strided_batched_template<float, float>(
+        handle, n, x, incx, bsx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dasum_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        double* result,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_asum_strided_batched_template<double, double>(
+        handle, n, x, incx, bsx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_sasum_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* const x[],
+                                                rocblas_int incx,
+                                                float* result,
+                                                rocblas_int batch_count)
+{
+    return rocblas_asum_batched_template<float, float>(handle, n, x, incx, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dasum_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* const x[],
+                                                rocblas_int incx,
+                                                double* result,
+                                                rocblas_int batch_count)
+{
+    return rocblas_asum_batched_template<double, double>(handle, n, x, incx, result, batch_count);
+}
@@ -4,16 +4,27 @@
 #include <hip/hip_runtime.h>
 #include "rocblas.h"
 #include "definitions.h"
+#include "device_template.h"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
 
 #define NB_X 256
 
-template <typename T>
-__global__ void axpy_kernel_host_scalar(
-    rocblas_int n, const T alpha, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+// hipBlockIdx_y picks the vector of the batch, alpha is shared by all of them
+template <typename T, typename U, typename V>
+__global__ void axpy_kernel_host_scalar(rocblas_int n,
+                                        const T alpha,
+                                        U xa,
+                                        rocblas_int incx,
+                                        rocblas_int bsx,
+                                        V ya,
+                                        rocblas_int incy,
+                                        rocblas_int bsy)
 {
+    const T* x = load_batch_ptr(xa, bsx);
+    T* y       = load_batch_ptr(ya, bsy);
+
     int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
     if(incx >= 0 && incy >= 0)
@@ -46,10 +57,19 @@ __global__ void axpy_kernel_host_scalar(
     }
 }
 
-template <typename T>
-__global__ void axpy_kernel_device_scalar(
-    rocblas_int n, const T* alpha, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+template <typename T, typename U, typename V>
+__global__ void axpy_kernel_device_scalar(rocblas_int n,
+                                          const T* alpha,
+                                          U xa,
+                                          rocblas_int incx,
+                                          rocblas_int bsx,
+                                          V ya,
+                                          rocblas_int incy,
+                                          rocblas_int bsy)
 {
+    const T* x = load_batch_ptr(xa, bsx);
+    T* y       = load_batch_ptr(ya, bsy);
+
     int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     // bound
     if(incx >= 0 && incy >= 0)
@@ -195,6 +215,82 @@ __global__ void haxpy_mlt_8_host_scalar(int n_mlt_8, const half2 alpha, const ha
     }
 }
 
+/*
+    axpy of batch_count pairs of vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID pairs. U and V are const T* and T* for strided vectors (a single pair
+    is a strided batch of one) or const T* const* and T* const* for arrays of pointers.
+*/
+template <typename T, typename U, typename V>
+rocblas_status rocblas_axpy_launch(rocblas_handle handle,
+                                   rocblas_int n,
+                                   const T* alpha,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   V y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   rocblas_int batch_count)
+{
+    if(n <= 0 || 0 == batch_count) // Quick return if possible. Not Argument error
+    {
+        return rocblas_status_success;
+    }
+
+    int blocks = ((n - 1) / NB_X) + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // alpha is on the host in host pointer mode, alpha == 0 leaves y as it is
+    T scalar = rocblas_pointer_mode_host == handle->pointer_mode ? *alpha : T(0);
+    if(rocblas_pointer_mode_host == handle->pointer_mode && 0.0 == scalar)
+    {
+        return rocblas_status_success;
+    }
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            hipLaunchKernelGGL((axpy_kernel_device_scalar<T, U, V>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy);
+        }
+        else
+        {
+            hipLaunchKernelGGL((axpy_kernel_host_scalar<T, U, V>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
 /*! \brief BLAS Level 1 API
 
     \details
@@ -274,54 +370,152 @@ rocblas_status rocblas_axpy_template(rocblas_handle handle,
     else if(nullptr == y)
         return rocblas_status_invalid_pointer;
 
-    if(n <= 0) // Quick return if possible. Not Argument error
+    return rocblas_axpy_launch<T>(handle, n, alpha, x, incx, 0, y, incy, 0, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_strided_batched and axpy_batched compute batch_count vectors y_i with the same scalar
+    alpha in one call
+
+        y_i := alpha * x_i + y_i
+
+    the vectors of axpy_strided_batched start bsx (bsy) elements apart, the vectors of
+    axpy_batched are given by arrays of batch_count device pointers on the GPU.
+
+    ********************************************************************/
+
+template <class T>
+rocblas_status rocblas_axpy_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const T* alpha,
+                                                     const T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
     {
-        return rocblas_status_success;
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_strided_batched"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
+        log_bench(handle,
+                  "./rocblas-bench -f axpy_batched -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_strided_batched"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
     }
 
-    int blocks = ((n - 1) / NB_X) + 1;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
 
-    dim3 grid(blocks, 1, 1);
-    dim3 threads(NB_X, 1, 1);
+    return rocblas_axpy_launch<T>(handle, n, alpha, x, incx, bsx, y, incy, bsy, batch_count);
+}
 
-    hipStream_t rocblas_stream = handle->rocblas_stream;
+template <class T>
+rocblas_status rocblas_axpy_batched_template(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const T* alpha,
+                                             const T* const* x,
+                                             rocblas_int incx,
+                                             T* const* y,
+                                             rocblas_int incy,
+                                             rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
 
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
     {
-        hipLaunchKernelGGL(axpy_kernel_device_scalar,
-                           dim3(blocks),
-                           dim3(threads),
-                           0,
-                           rocblas_stream,
-                           n,
-                           alpha,
-                           x,
-                           incx,
-                           y,
-                           incy);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_batched"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
+        log_bench(handle,
+                  "./rocblas-bench -f axpy_batched -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
     }
-    else // alpha is on host
+    else
     {
-        T scalar = *alpha;
-        if(0.0 == scalar)
-        {
-            return rocblas_status_success;
-        }
-
-        hipLaunchKernelGGL(axpy_kernel_host_scalar,
-                           dim3(blocks),
-                           dim3(threads),
-                           0,
-                           rocblas_stream,
-                           n,
-                           scalar,
-                           x,
-                           incx,
-                           y,
-                           incy);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_batched"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
     }
 
-    return rocblas_status_success;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_axpy_launch<T>(handle, n, alpha, x, incx, 0, y, incy, 0, batch_count);
 }
 
 template <class T>
@@ -367,7 +561,7 @@ rocblas_status rocblas_axpy_half(rocblas_handle handle,
 
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            hipLaunchKernelGGL(axpy_kernel_device_scalar,
+            hipLaunchKernelGGL((axpy_kernel_device_scalar<__fp16, const __fp16*, __fp16*>),
                                dim3(blocks),
                                dim3(threads),
                                0,
@@ -376,8 +570,10 @@ rocblas_status rocblas_axpy_half(rocblas_handle handle,
                                (const __fp16*)alpha,
                                (const __fp16*)x,
                                incx,
+                               0,
                                (__fp16*)y,
-                               incy);
+                               incy,
+                               0);
         }
         else // alpha is on host
         {
@@ -387,7 +583,7 @@ rocblas_status rocblas_axpy_half(rocblas_handle handle,
             }
 
             const __fp16 f16_alpha = *reinterpret_cast<const __fp16*>(alpha);
-            hipLaunchKernelGGL(axpy_kernel_host_scalar,
+            hipLaunchKernelGGL((axpy_kernel_host_scalar<__fp16, const __fp16*, __fp16*>),
                                dim3(blocks),
                                dim3(threads),
                                0,
@@ -396,8 +592,10 @@ rocblas_status rocblas_axpy_half(rocblas_handle handle,
                                f16_alpha,
                                (const __fp16*)x,
                                incx,
+                               0,
                                (__fp16*)y,
-                               incy);
+                               incy,
+                               0);
         }
     }
     else // half8 load-store and half2 arithmetic
@@ -477,6 +675,282 @@ rocblas_status rocblas_axpy_half(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/*
+    fused axpy and dot: each thread updates its element of y and multiplies the new value by
+    the element of z in the same pass, the block sums reduce to result in the last block. U is
+    T for a host scalar or const T* for a device scalar, the sums are accumulated in A.
+*/
+template <typename T, rocblas_int NB, typename U, typename A>
+__global__ void axpy_dot_kernel(rocblas_int n,
+                                U alpha,
+                                const T* x,
+                                rocblas_int incx,
+                                T* y,
+                                rocblas_int incy,
+                                const T* z,
+                                rocblas_int incz,
+                                A* partial,
+                                unsigned int* ticket,
+                                T* result)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+    if(incz < 0)
+        z -= (n - 1) * incz;
+
+    __shared__ A shared_tep[NB];
+
+    if(tid < n)
+    {
+        T yi          = y[tid * incy] + load_scalar(alpha) * x[tid * incx];
+        y[tid * incy] = yi;
+
+        // z may be y, the thread reads back the element it has just written
+        rocblas_acc_product(shared_tep[tx], yi, z[tid * incz]);
+    }
+    else
+    { // pad with zero
+        shared_tep[tx] = 0.0;
+    }
+
+    if(rocblas_sum_reduce_grid<NB, A>(tx, shared_tep, partial, ticket) && tx == 0)
+        *result = T(shared_tep[0]);
+}
+
+// axpy_dot of a non-empty vector with NB threads per block, NB fixes the order of the sums,
+// the sums are accumulated in A
+template <rocblas_int NB, typename A, typename T>
+rocblas_status rocblas_axpy_dot_launch_nb(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const T* alpha,
+                                          const T* x,
+                                          rocblas_int incx,
+                                          T* y,
+                                          rocblas_int incy,
+                                          const T* z,
+                                          rocblas_int incz,
+                                          T* result)
+{
+    rocblas_int blocks = (n - 1) / NB + 1;
+
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        1, sizeof(T), sizeof(A) * blocks, &ticket, &slots, &partial));
+
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(NB, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((axpy_dot_kernel<T, NB, const T*, A>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           n,
+                           alpha,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           z,
+                           incz,
+                           (A*)partial,
+                           ticket,
+                           result);
+    }
+    else // alpha is on host, the result is written to the slot of the buffer and copied back
+    {
+        T scalar = *alpha;
+        hipLaunchKernelGGL((axpy_dot_kernel<T, NB, T, A>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           n,
+                           scalar,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           z,
+                           incz,
+                           (A*)partial,
+                           ticket,
+                           (T*)slots);
+
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slots, sizeof(T)));
+    }
+
+    return rocblas_status_success;
+}
+
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<T>
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_axpy_dot_launch_acc(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           T* y,
+                                           rocblas_int incy,
+                                           const T* z,
+                                           rocblas_int incz,
+                                           T* result)
+{
+    typedef rocblas_accumulator<T> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_axpy_dot_launch_nb<NB, typename acc::compensated>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_axpy_dot_launch_nb<NB, typename acc::promoted>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result);
+    else
+        return rocblas_axpy_dot_launch_nb<NB, typename acc::native>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpy_dot updates y and takes its dot product with z in one pass over the vectors
+
+        y := alpha * x + y,
+        result = y * z,
+
+    the update of the residual and its inner product in an iteration of conjugate gradients.
+    z may be y.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+    @param[in]
+    z         pointer storing vector z on the GPU.
+    @param[in]
+    incz      rocblas_int
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              store the dot product. either on the host CPU or device GPU.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+
+template <class T>
+rocblas_status rocblas_axpy_dot_template(rocblas_handle handle,
+                                         rocblas_int n,
+                                         const T* alpha,
+                                         const T* x,
+                                         rocblas_int incx,
+                                         T* y,
+                                         rocblas_int incy,
+                                         const T* z,
+                                         rocblas_int incz,
+                                         T* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_dot"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)z,
+                  incz,
+                  (const void*&)result);
+        log_bench(handle,
+                  "./rocblas-bench -f axpy_dot -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xaxpy_dot"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)z,
+                  incz,
+                  (const void*&)result);
+    }
+
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == z)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0)
+    {
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(T)));
+        }
+        else
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(T)));
+            *result = 0.0;
+        }
+        return rocblas_status_success;
+    }
+
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_axpy_dot_launch_acc<ROCBLAS_DETERMINISTIC_NB, T>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result);
+    else
+        return rocblas_axpy_dot_launch_acc<NB_X, T>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
 /* ============================================================================================ */
 
 /*
@@ -541,3 +1015,87 @@ extern "C" rocblas_status rocblas_zaxpy(rocblas_handle handle,
 }
 
 /* ============================================================================================ */
+
+extern "C" rocblas_status rocblas_saxpy_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const float* alpha,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_axpy_strided_batched_template<float>(
+        handle, n, alpha, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_daxpy_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const double* alpha,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_axpy_strided_batched_template<double>(
+        handle, n, alpha, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_saxpy_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* alpha,
+                                                const float* const x[],
+                                                rocblas_int incx,
+                                                float* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_axpy_batched_template<float>(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_daxpy_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* alpha,
+                                                const double* const x[],
+                                                rocblas_int incx,
+                                                double* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_axpy_batched_template<double>(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+/* ============================================================================================ */
+
+extern "C" rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const float* alpha,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            float* y,
+                                            rocblas_int incy,
+                                            const float* z,
+                                            rocblas_int incz,
+                                            float* result)
+{
+    return rocblas_axpy_dot_template<float>(handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
+
+extern "C" rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* alpha,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            double* y,
+                                            rocblas_int incy,
+                                            const double* z,
+                                            rocblas_int incz,
+                                            double* result)
+{
+    return rocblas_axpy_dot_template<double>(handle, n, alpha, x, incx, y, incy, z, incz, result);
+}
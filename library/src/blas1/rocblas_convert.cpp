@@ -0,0 +1,448 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+#include "rocblas.h"
+
+#include "definitions.h"
+#include "device_template.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define NB_X 256
+
+/*
+    y := round( alpha * x ) for an m by n array, element (i, j) is at i * incx + j * ldx in x and
+    at i * incy + j * ldy in y; a vector is an array of one column. The grid is blocks of rows by
+    at most ROCBLAS_MAX_BATCH_GRID columns from column j0. Tc is the compute type, A is double
+    for alpha from the host or const double* for alpha on the device. Every element is read and
+    written once.
+*/
+template <typename Ti, typename To, typename Tc, typename A>
+__global__ void convert_kernel(rocblas_int m,
+                               rocblas_int j0,
+                               A alpha,
+                               const Ti* x,
+                               rocblas_int incx,
+                               rocblas_int ldx,
+                               To* y,
+                               rocblas_int incy,
+                               rocblas_int ldy,
+                               rocblas_rounding_mode rounding,
+                               uint32_t seed)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = j0 + hipBlockIdx_y;
+
+    if(i < m)
+    {
+        Tc v = Tc(load_scalar(alpha)) * Tc(x[i * (ptrdiff_t)incx + j * (ptrdiff_t)ldx]);
+
+        if(sizeof(To) < sizeof(Tc))
+        {
+            uint32_t r = rounding == rocblas_rounding_mode_stochastic
+                             ? rocblas_random_bits(seed, (uint32_t)i + (uint32_t)j * m)
+                             : 0;
+            v = rocblas_round<To>(v, rounding, r);
+        }
+
+        y[i * (ptrdiff_t)incy + j * (ptrdiff_t)ldy] = To(v);
+    }
+}
+
+// the element types of the kernels, rocblas_half is __fp16 on the device
+template <typename Ti, typename To>
+rocblas_status rocblas_convert_launch(rocblas_handle handle,
+                                      rocblas_rounding_mode rounding,
+                                      rocblas_int seed,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      const double* alpha,
+                                      const void* x,
+                                      rocblas_int incx,
+                                      rocblas_int ldx,
+                                      void* y,
+                                      rocblas_int incy,
+                                      rocblas_int ldy)
+{
+    // Quick return if possible. Not Argument error
+    if(m <= 0 || n <= 0)
+        return rocblas_status_success;
+
+    // the compute type, double also when y is half so that alpha * x is rounded to y only once
+    constexpr bool use_double = std::is_same<Ti, double>::value ||
+                                std::is_same<To, double>::value || sizeof(To) < sizeof(float);
+    typedef typename std::conditional<use_double, double, float>::type Tc;
+
+    // a vector with a negative increment starts at its last element
+    const Ti* xt = (const Ti*)x;
+    To* yt       = (To*)y;
+    if(incx < 0)
+        xt -= (ptrdiff_t)(m - 1) * incx;
+    if(incy < 0)
+        yt -= (ptrdiff_t)(m - 1) * incy;
+
+    rocblas_int blocks = (m - 1) / NB_X + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode && alpha != nullptr)
+    {
+        for(rocblas_int j0 = 0; j0 < n; j0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 grid(blocks, batch_chunk(n, j0), 1);
+
+            hipLaunchKernelGGL((convert_kernel<Ti, To, Tc, const double*>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               j0,
+                               alpha,
+                               xt,
+                               incx,
+                               ldx,
+                               yt,
+                               incy,
+                               ldy,
+                               rounding,
+                               (uint32_t)seed);
+        }
+    }
+    else // alpha is on host, or 1
+    {
+        double scalar = alpha != nullptr ? *alpha : 1.0;
+        for(rocblas_int j0 = 0; j0 < n; j0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 grid(blocks, batch_chunk(n, j0), 1);
+
+            hipLaunchKernelGGL((convert_kernel<Ti, To, Tc, double>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               j0,
+                               scalar,
+                               xt,
+                               incx,
+                               ldx,
+                               yt,
+                               incy,
+                               ldy,
+                               rounding,
+                               (uint32_t)seed);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename Ti>
+rocblas_status rocblas_convert_launch(rocblas_handle handle,
+                                      rocblas_rounding_mode rounding,
+                                      rocblas_int seed,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      const double* alpha,
+                                      const void* x,
+                                      rocblas_int incx,
+                                      rocblas_int ldx,
+                                      void* y,
+                                      rocblas_precision y_type,
+                                      rocblas_int incy,
+                                      rocblas_int ldy)
+{
+    switch(y_type)
+    {
+    case rocblas_precision_half:
+        return rocblas_convert_launch<Ti, __fp16>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, incy, ldy);
+    case rocblas_precision_single:
+        return rocblas_convert_launch<Ti, float>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, incy, ldy);
+    case rocblas_precision_double:
+        return rocblas_convert_launch<Ti, double>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, incy, ldy);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
+// the conversion between two of half, single and double, other precisions are not implemented
+rocblas_status rocblas_convert_launch(rocblas_handle handle,
+                                      rocblas_rounding_mode rounding,
+                                      rocblas_int seed,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      const double* alpha,
+                                      const void* x,
+                                      rocblas_precision x_type,
+                                      rocblas_int incx,
+                                      rocblas_int ldx,
+                                      void* y,
+                                      rocblas_precision y_type,
+                                      rocblas_int incy,
+                                      rocblas_int ldy)
+{
+    switch(x_type)
+    {
+    case rocblas_precision_half:
+        return rocblas_convert_launch<__fp16>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, y_type, incy, ldy);
+    case rocblas_precision_single:
+        return rocblas_convert_launch<float>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, y_type, incy, ldy);
+    case rocblas_precision_double:
+        return rocblas_convert_launch<double>(
+            handle, rounding, seed, m, n, alpha, x, incx, ldx, y, y_type, incy, ldy);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
+// the -r letter of rocblas-bench
+static char rocblas_precision_letter(rocblas_precision type)
+{
+    switch(type)
+    {
+    case rocblas_precision_half: return 'h';
+    case rocblas_precision_single: return 's';
+    case rocblas_precision_double: return 'd';
+    case rocblas_precision_complex_single: return 'c';
+    case rocblas_precision_complex_double: return 'z';
+    default: return '?';
+    }
+}
+
+static bool rocblas_convert_types_valid(rocblas_precision x_type, rocblas_precision y_type)
+{
+    return (x_type == rocblas_precision_half || x_type == rocblas_precision_single ||
+            x_type == rocblas_precision_double) &&
+           (y_type == rocblas_precision_half || y_type == rocblas_precision_single ||
+            y_type == rocblas_precision_double);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_copy_ex(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const void* x,
+                                          rocblas_precision x_type,
+                                          rocblas_int incx,
+                                          void* y,
+                                          rocblas_precision y_type,
+                                          rocblas_int incy)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, "rocblas_copy_ex", n, x, x_type, incx, y, y_type, incy);
+
+    log_bench(handle,
+              "./rocblas-bench -f copy_ex -r",
+              rocblas_precision_letter(x_type),
+              "--y_precision",
+              rocblas_precision_letter(y_type),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy);
+
+    if(x == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(y == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(!rocblas_convert_types_valid(x_type, y_type))
+        return rocblas_status_not_implemented;
+
+    return rocblas_convert_launch(handle,
+                                  rocblas_rounding_mode_nearest,
+                                  0,
+                                  n,
+                                  1,
+                                  nullptr,
+                                  x,
+                                  x_type,
+                                  incx,
+                                  0,
+                                  y,
+                                  y_type,
+                                  incy,
+                                  0);
+}
+
+extern "C" rocblas_status rocblas_convert(rocblas_handle handle,
+                                          rocblas_rounding_mode rounding,
+                                          rocblas_int seed,
+                                          rocblas_int n,
+                                          const double* alpha,
+                                          const void* x,
+                                          rocblas_precision x_type,
+                                          rocblas_int incx,
+                                          void* y,
+                                          rocblas_precision y_type,
+                                          rocblas_int incy)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host || alpha == nullptr)
+    {
+        double scalar = alpha != nullptr ? *alpha : 1.0;
+
+        log_trace(
+            handle, "rocblas_convert", rounding, seed, n, scalar, x, x_type, incx, y, y_type, incy);
+
+        log_bench(handle,
+                  "./rocblas-bench -f convert -r",
+                  rocblas_precision_letter(x_type),
+                  "--y_precision",
+                  rocblas_precision_letter(y_type),
+                  "--rounding",
+                  rounding == rocblas_rounding_mode_stochastic ? 'S' : 'N',
+                  "--seed",
+                  seed,
+                  "-n",
+                  n,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--alpha",
+                  scalar);
+    }
+    else
+    {
+        log_trace(handle,
+                  "rocblas_convert",
+                  rounding,
+                  seed,
+                  n,
+                  (const void*&)alpha,
+                  x,
+                  x_type,
+                  incx,
+                  y,
+                  y_type,
+                  incy);
+    }
+
+    if(x == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(y == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(!rocblas_convert_types_valid(x_type, y_type))
+        return rocblas_status_not_implemented;
+    else if(rounding != rocblas_rounding_mode_nearest &&
+            rounding != rocblas_rounding_mode_stochastic)
+        return rocblas_status_not_implemented;
+
+    return rocblas_convert_launch(
+        handle, rounding, seed, n, 1, alpha, x, x_type, incx, 0, y, y_type, incy, 0);
+}
+
+extern "C" rocblas_status rocblas_convert_matrix(rocblas_handle handle,
+                                                 rocblas_rounding_mode rounding,
+                                                 rocblas_int seed,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 const double* alpha,
+                                                 const void* A,
+                                                 rocblas_precision a_type,
+                                                 rocblas_int lda,
+                                                 void* B,
+                                                 rocblas_precision b_type,
+                                                 rocblas_int ldb)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host || alpha == nullptr)
+    {
+        double scalar = alpha != nullptr ? *alpha : 1.0;
+
+        log_trace(handle,
+                  "rocblas_convert_matrix",
+                  rounding,
+                  seed,
+                  m,
+                  n,
+                  scalar,
+                  A,
+                  a_type,
+                  lda,
+                  B,
+                  b_type,
+                  ldb);
+
+        log_bench(handle,
+                  "./rocblas-bench -f convert_matrix -r",
+                  rocblas_precision_letter(a_type),
+                  "--y_precision",
+                  rocblas_precision_letter(b_type),
+                  "--rounding",
+                  rounding == rocblas_rounding_mode_stochastic ? 'S' : 'N',
+                  "--seed",
+                  seed,
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--lda",
+                  lda,
+                  "--ldb",
+                  ldb,
+                  "--alpha",
+                  scalar);
+    }
+    else
+    {
+        log_trace(handle,
+                  "rocblas_convert_matrix",
+                  rounding,
+                  seed,
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  A,
+                  a_type,
+                  lda,
+                  B,
+                  b_type,
+                  ldb);
+    }
+
+    if(A == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(B == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(m < 0 || n < 0 || lda < m || lda < 1 || ldb < m || ldb < 1)
+        return rocblas_status_invalid_size;
+    else if(!rocblas_convert_types_valid(a_type, b_type))
+        return rocblas_status_not_implemented;
+    else if(rounding != rocblas_rounding_mode_nearest &&
+            rounding != rocblas_rounding_mode_stochastic)
+        return rocblas_status_not_implemented;
+
+    return rocblas_convert_launch(
+        handle, rounding, seed, m, n, alpha, A, a_type, 1, lda, B, b_type, 1, ldb);
+}
+
+/* ============================================================================================ */
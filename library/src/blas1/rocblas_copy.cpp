@@ -6,15 +6,26 @@
 #include "rocblas.h"
 
 #include "definitions.h"
+#include "device_template.h"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
 
 #define NB_X 256
 
-template <typename T>
-__global__ void copy_kernel(rocblas_int n, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+// hipBlockIdx_y picks the vector of the batch
+template <typename T, typename U, typename V>
+__global__ void copy_kernel(rocblas_int n,
+                            U xa,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            V ya,
+                            rocblas_int incy,
+                            rocblas_int bsy)
 {
+    const T* x = load_batch_ptr(xa, bsx);
+    T* y       = load_batch_ptr(ya, bsy);
+
     int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     // bound
     if(incx >= 0 && incy >= 0)
@@ -47,6 +58,55 @@ __global__ void copy_kernel(rocblas_int n, const T* x, rocblas_int incx, T* y, r
     }
 }
 
+/*
+    copy of batch_count pairs of vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID pairs. U and V are const T* and T* for strided vectors (a single pair
+    is a strided batch of one) or const T* const* and T* const* for arrays of pointers.
+*/
+template <typename T, typename U, typename V>
+rocblas_status rocblas_copy_launch(rocblas_handle handle,
+                                   rocblas_int n,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   V y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || 0 == batch_count)
+        return rocblas_status_success;
+
+    int blocks = (n - 1) / NB_X + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((copy_kernel<T, U, V>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           n,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           batch_offset(y, bsy, b0),
+                           incy,
+                           bsy);
+    }
+
+    return rocblas_status_success;
+}
+
 /*! \brief BLAS Level 1 API
 
     \details
@@ -97,23 +157,110 @@ rocblas_status rocblas_copy_template(
     else if(y == nullptr)
         return rocblas_status_invalid_pointer;
 
-    /*
-     * Quick return if possible.
-     */
-    if(n <= 0)
-        return rocblas_status_success;
+    return rocblas_copy_launch<T>(handle, n, x, incx, 0, y, incy, 0, 1);
+}
 
-    int blocks = (n - 1) / NB_X + 1;
+/*! \brief BLAS Level 1 API
 
-    dim3 grid(blocks, 1, 1);
-    dim3 threads(NB_X, 1, 1);
+    \details
+    copy_strided_batched and copy_batched copy batch_count vectors x_i into the vectors y_i in
+    one call
 
-    hipStream_t rocblas_stream = handle->rocblas_stream;
+        y_i := x_i,
 
-    hipLaunchKernelGGL(
-        copy_kernel, dim3(grid), dim3(threads), 0, rocblas_stream, n, x, incx, y, incy);
+    the vectors of copy_strided_batched start bsx (bsy) elements apart, the vectors of
+    copy_batched are given by arrays of batch_count device pointers on the GPU.
 
-    return rocblas_status_success;
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_copy_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     rocblas_int batch_count)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xcopy_strided_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              bsx,
+              (const void*&)y,
+              incy,
+              bsy,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f copy_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(x == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(y == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_copy_launch<T>(handle, n, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_copy_batched_template(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const T* const* x,
+                                             rocblas_int incx,
+                                             T* const* y,
+                                             rocblas_int incy,
+                                             rocblas_int batch_count)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xcopy_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              (const void*&)y,
+              incy,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f copy_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(x == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(y == nullptr)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_copy_launch<T>(handle, n, x, incx, 0, y, incy, 0, batch_count);
 }
 
 /* ============================================================================================ */
@@ -168,4 +315,54 @@ extern "C" rocblas_status rocblas_zcopy(rocblas_handle handle,
     return rocblas_copy_template<rocblas_double_complex>(handle, n, x, incx, y, incy);
 }
 
+extern "C" rocblas_status rocblas_scopy_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_copy_strided_batched_template<float>(
+        handle, n, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dcopy_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_copy_strided_batched_template<double>(
+        handle, n, x, incx, bsx, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_scopy_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* const x[],
+                                                rocblas_int incx,
+                                                float* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_copy_batched_template<float>(handle, n, x, incx, y, incy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dcopy_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* const x[],
+                                                rocblas_int incx,
+                                                double* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_copy_batched_template<double>(handle, n, x, incx, y, incy, batch_count);
+}
+
 /* ============================================================================================ */
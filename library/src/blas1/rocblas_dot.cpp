@@ -13,152 +13,457 @@
 #include "logging.h"
 #include "utility.h"
 
-template <typename T, rocblas_int NB>
-__global__ void dot_kernel_part1(
-    rocblas_int n, const T* x, rocblas_int incx, const T* y, rocblas_int incy, T* workspace)
+// single pass: the last block to finish reduces the partial results of all the blocks of its
+// vector, hipBlockIdx_y picks the vector of the batch. The sums are accumulated in A.
+template <typename T, rocblas_int NB, typename U, typename A>
+__global__ void dot_kernel(rocblas_int n,
+                           U xa,
+                           rocblas_int incx,
+                           rocblas_int bsx,
+                           U ya,
+                           rocblas_int incy,
+                           rocblas_int bsy,
+                           A* partial,
+                           unsigned int* tickets,
+                           T* results)
 {
+    const T* x = load_batch_ptr(xa, bsx);
+    const T* y = load_batch_ptr(ya, bsy);
+
     rocblas_int tx  = hipThreadIdx_x;
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    __shared__ T shared_tep[NB];
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    __shared__ A shared_tep[NB];
     // bound
-    if(incx >= 0 && incy >= 0)
+    if(tid < n)
     {
-        if(tid < n)
-        {
-            shared_tep[tx] = y[tid * incy] * x[tid * incx];
-        }
-        else
-        { // pad with zero
-            shared_tep[tx] = 0.0;
-        }
+        rocblas_acc_product(shared_tep[tx], y[tid * incy], x[tid * incx]);
     }
-    else if(incx < 0 && incy < 0)
+    else
+    { // pad with zero
+        shared_tep[tx] = 0.0;
+    }
+
+    partial += hipBlockIdx_y * hipGridDim_x;
+
+    if(rocblas_sum_reduce_grid<NB, A>(tx, shared_tep, partial, tickets + hipBlockIdx_y) &&
+       tx == 0)
+        results[hipBlockIdx_y] = T(shared_tep[0]);
+}
+
+// HIP support up to 1024 threads/work itmes per thread block/work group
+#define NB_X 1024
+
+/*
+    dot of batch_count pairs of vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID pairs. U is const T* for strided vectors (a single pair is a strided
+    batch of one) or const T* const* for an array of pointers. results holds batch_count
+    results on the host or the device. The sums are accumulated in A.
+*/
+template <rocblas_int NB, typename A, typename T, typename U>
+rocblas_status rocblas_dot_launch_nb(rocblas_handle handle,
+                                     rocblas_int n,
+                                     U x,
+                                     rocblas_int incx,
+                                     rocblas_int bsx,
+                                     U y,
+                                     rocblas_int incy,
+                                     rocblas_int bsy,
+                                     T* results,
+                                     rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || 0 == batch_count)
     {
-        if(tid < n)
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            shared_tep[tx] = y[(1 - n + tid) * incy] * x[(1 - n + tid) * incx];
+            RETURN_IF_HIP_ERROR(hipMemset(results, 0, sizeof(T) * batch_count));
         }
         else
-        { // pad with zero
-            shared_tep[tx] = 0.0;
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(results, sizeof(T) * batch_count));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                results[b] = 0.0;
         }
+        return rocblas_status_success;
     }
-    else if(incx >= 0)
+
+    rocblas_int blocks = (n - 1) / NB + 1;
+
+    unsigned int* tickets;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        batch_count, sizeof(T), sizeof(A) * blocks * batch_count, &tickets, &slots, &partial));
+
+    // in host pointer mode the results are written to the slots of the buffer and copied back
+    T* d_results = rocblas_pointer_mode_device == handle->pointer_mode ? results : (T*)slots;
+
+    dim3 threads(NB, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
     {
-        if(tid < n)
-        {
-            shared_tep[tx] = y[(1 - n + tid) * incy] * x[tid * incx];
-        }
-        else
-        { // pad with zero
-            shared_tep[tx] = 0.0;
-        }
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((dot_kernel<T, NB, U, A>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           n,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           batch_offset(y, bsy, b0),
+                           incy,
+                           bsy,
+                           (A*)partial + (size_t)blocks * b0,
+                           tickets + b0,
+                           d_results + b0);
     }
-    else
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
     {
-        if(tid < n)
-        {
-            shared_tep[tx] = y[tid * incy] * x[(1 - n + tid) * incx];
-        }
-        else
-        { // pad with zero
-            shared_tep[tx] = 0.0;
-        }
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(results, slots, sizeof(T) * batch_count));
     }
 
-    rocblas_sum_reduce<NB, T>(tx, shared_tep);
+    return rocblas_status_success;
+}
 
-    if(tx == 0)
-        workspace[hipBlockIdx_x] = shared_tep[0];
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<T>
+template <rocblas_int NB, typename T, typename U>
+rocblas_status rocblas_dot_launch_acc(rocblas_handle handle,
+                                      rocblas_int n,
+                                      U x,
+                                      rocblas_int incx,
+                                      rocblas_int bsx,
+                                      U y,
+                                      rocblas_int incy,
+                                      rocblas_int bsy,
+                                      T* results,
+                                      rocblas_int batch_count)
+{
+    typedef rocblas_accumulator<T> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_dot_launch_nb<NB, typename acc::compensated, T>(
+            handle, n, x, incx, bsx, y, incy, bsy, results, batch_count);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_dot_launch_nb<NB, typename acc::promoted, T>(
+            handle, n, x, incx, bsx, y, incy, bsy, results, batch_count);
+    else
+        return rocblas_dot_launch_nb<NB, typename acc::native, T>(
+            handle, n, x, incx, bsx, y, incy, bsy, results, batch_count);
 }
 
-template <typename T, rocblas_int NB, rocblas_int flag>
-__global__ void dot_kernel_part2(rocblas_int n, T* workspace, T* result)
+// the deterministic reduction mode sums in the order fixed by ROCBLAS_DETERMINISTIC_NB, the
+// default mode in the order of NB_X, which may be tuned
+template <typename T, typename U>
+rocblas_status rocblas_dot_launch(rocblas_handle handle,
+                                  rocblas_int n,
+                                  U x,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  U y,
+                                  rocblas_int incy,
+                                  rocblas_int bsy,
+                                  T* results,
+                                  rocblas_int batch_count)
 {
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_dot_launch_acc<ROCBLAS_DETERMINISTIC_NB, T>(
+            handle, n, x, incx, bsx, y, incy, bsy, results, batch_count);
+    else
+        return rocblas_dot_launch_acc<NB_X, T>(
+            handle, n, x, incx, bsx, y, incy, bsy, results, batch_count);
+}
 
-    rocblas_int tx = hipThreadIdx_x;
+/* ============================================================================================ */
 
-    __shared__ T shared_tep[NB];
+/*! \brief BLAS Level 1 API
 
-    shared_tep[tx] = 0.0;
+    \details
+    dot(u)  perform dot product of vector x and y
 
-    // bound, loop
-    for(rocblas_int i = tx; i < n; i += NB)
-    {
-        shared_tep[tx] += workspace[i];
-    }
-    __syncthreads();
+        result = x * y;
+
+    dotc  perform dot product of complex vector x and complex y
+
+        result = conjugate (x) * y;
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              store the dot product. either on the host CPU or device GPU.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_dot_template(rocblas_handle handle,
+                                    rocblas_int n,
+                                    const T* x,
+                                    rocblas_int incx,
+                                    const T* y,
+                                    rocblas_int incy,
+                                    T* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, replaceX<T>("rocblas_Xdot"), n, (const void*&)x, incx, (const void*&)y, incy);
+
+    log_bench(handle,
+              "./rocblas-bench -f dot -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_dot_launch<T>(handle, n, x, incx, 0, y, incy, 0, result, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    dot_strided_batched and dot_batched perform the dot products of batch_count pairs of
+    vectors x_i and y_i in one call
+
+        result[i] = x_i * y_i;
+
+    the vectors of dot_strided_batched start bsx (bsy) elements apart, the vectors of
+    dot_batched are given by arrays of batch_count device pointers on the GPU.
+    result is an array of batch_count values, either on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_dot_strided_batched_template(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    const T* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    const T* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    T* result,
+                                                    rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
 
-    if(n < 32)
+    log_trace(handle,
+              replaceX<T>("rocblas_Xdot_strided_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              bsx,
+              (const void*&)y,
+              incy,
+              bsy,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f dot_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_dot_launch<T>(handle, n, x, incx, bsx, y, incy, bsy, result, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_dot_batched_template(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const T* const* x,
+                                            rocblas_int incx,
+                                            const T* const* y,
+                                            rocblas_int incy,
+                                            T* result,
+                                            rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xdot_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              (const void*&)y,
+              incy,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f dot_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_dot_launch<T>(handle, n, x, incx, 0, y, incy, 0, result, batch_count);
+}
+
+/*
+    fused dot and nrm2: each thread loads its element of x once for both sums, the block
+    reduces the two sums side by side and the last block reduces both sets of partial results,
+    the dot products at partial[0, blocks) and the squares at partial[blocks, 2 * blocks).
+    The sums are accumulated in A.
+*/
+template <typename T, rocblas_int NB, typename A>
+__global__ void dot_nrm2_kernel(rocblas_int n,
+                                const T* x,
+                                rocblas_int incx,
+                                const T* y,
+                                rocblas_int incy,
+                                A* partial,
+                                unsigned int* ticket,
+                                T* dot_result,
+                                T* nrm2_result)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    __shared__ A shared_dot[NB];
+    __shared__ A shared_nrm2[NB];
+
+    if(tid < n)
     {
-        // no need parallel reduction
-        if(tx == 0)
-        {
-            for(rocblas_int i = 1; i < n; i++)
-            {
-                shared_tep[0] += shared_tep[i];
-            }
-        }
+        T xi = x[tid * incx];
+        rocblas_acc_product(shared_dot[tx], xi, y[tid * incy]);
+        rocblas_acc_product(shared_nrm2[tx], xi, xi);
     }
     else
-    {
-        // parallel reduction,
-        rocblas_sum_reduce<NB, T>(tx, shared_tep);
+    { // pad with zero
+        shared_dot[tx]  = 0.0;
+        shared_nrm2[tx] = 0.0;
     }
 
+    rocblas_sum_reduce<NB, A>(tx, shared_dot);
+    rocblas_sum_reduce<NB, A>(tx, shared_nrm2);
+
+    rocblas_int blocks = hipGridDim_x;
+
     if(tx == 0)
     {
-        if(flag)
-        {
-            // flag == 1, write to result of device memory
-            *result = shared_tep[0]; // result[0] works, too
-        }
-        else
-        {
-            workspace[0] = shared_tep[0];
-        }
+        partial[hipBlockIdx_x]          = shared_dot[0];
+        partial[blocks + hipBlockIdx_x] = shared_nrm2[0];
     }
-}
 
-// HIP support up to 1024 threads/work itmes per thread block/work group
-#define NB_X 1024
+    if(!rocblas_last_block(tx, ticket))
+        return;
 
-// assume workspace has already been allocated, recommened for repeated calling of dot product
-// routine
-template <typename T>
-rocblas_status rocblas_dot_template_workspace(rocblas_handle handle,
-                                              rocblas_int n,
-                                              const T* x,
-                                              rocblas_int incx,
-                                              const T* y,
-                                              rocblas_int incy,
-                                              T* result,
-                                              T* workspace,
-                                              rocblas_int lworkspace)
-{
-    rocblas_int blocks = (n - 1) / NB_X + 1;
+    shared_dot[tx]  = 0.0;
+    shared_nrm2[tx] = 0.0;
+    for(rocblas_int i = tx; i < blocks; i += NB)
+    {
+        shared_dot[tx] += partial[i];
+        shared_nrm2[tx] += partial[blocks + i];
+    }
 
-    // At least two kernels are needed to finish the reduction
-    // kennel 1 write partial result per thread block in workspace, number of partial result is
-    // blocks
-    // kernel 2 gather all the partial result in workspace and finish the final reduction. number of
-    // threads (NB_X) loop blocks
+    rocblas_sum_reduce<NB, A>(tx, shared_dot);
+    rocblas_sum_reduce<NB, A>(tx, shared_nrm2);
 
-    if(lworkspace < blocks)
+    if(tx == 0)
     {
-        printf("size workspace = %d is too small, allocate at least %d", lworkspace, blocks);
-        return rocblas_status_not_implemented;
+        *dot_result  = T(shared_dot[0]);
+        *nrm2_result = sqrt(T(shared_nrm2[0]));
     }
+}
+
+// dot_nrm2 of a non-empty vector with NB threads per block, NB fixes the order of the sums,
+// the sums are accumulated in A
+template <rocblas_int NB, typename A, typename T>
+rocblas_status rocblas_dot_nrm2_launch_nb(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const T* x,
+                                          rocblas_int incx,
+                                          const T* y,
+                                          rocblas_int incy,
+                                          T* dot_result,
+                                          T* nrm2_result)
+{
+    rocblas_int blocks = (n - 1) / NB + 1;
+
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        1, 2 * sizeof(T), 2 * sizeof(A) * blocks, &ticket, &slots, &partial));
 
-    dim3 grid(blocks, 1, 1);
-    dim3 threads(NB_X, 1, 1);
+    // in host pointer mode both results are written to the slot of the buffer and copied back
+    bool device_mode = rocblas_pointer_mode_device == handle->pointer_mode;
+    T* d_dot         = device_mode ? dot_result : (T*)slots;
+    T* d_nrm2        = device_mode ? nrm2_result : (T*)slots + 1;
 
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
-    hipLaunchKernelGGL((dot_kernel_part1<T, NB_X>),
-                       dim3(grid),
-                       dim3(threads),
+    hipLaunchKernelGGL((dot_nrm2_kernel<T, NB, A>),
+                       dim3(blocks),
+                       dim3(NB),
                        0,
                        rocblas_stream,
                        n,
@@ -166,54 +471,55 @@ rocblas_status rocblas_dot_template_workspace(rocblas_handle handle,
                        incx,
                        y,
                        incy,
-                       workspace);
+                       (A*)partial,
+                       ticket,
+                       d_dot,
+                       d_nrm2);
 
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    if(!device_mode)
     {
-        // the last argument 1 indicate the result is on device, not memcpy is required
-        hipLaunchKernelGGL((dot_kernel_part2<T, NB_X, 1>),
-                           dim3(1, 1, 1),
-                           dim3(threads),
-                           0,
-                           rocblas_stream,
-                           blocks,
-                           workspace,
-                           result);
-    }
-    else
-    {
-        // the last argument 0 indicate the result is on host
-        // workspace[0] has a copy of the final result, if the result pointer is on host, a memory
-        // copy is required
-        // printf("it is a host pointer\n");
-        // only for blocks > 1, otherwise the final result is already reduced in workspace[0]
-        if(blocks > 1)
-            hipLaunchKernelGGL((dot_kernel_part2<T, NB_X, 0>),
-                               dim3(1, 1, 1),
-                               dim3(threads),
-                               0,
-                               rocblas_stream,
-                               blocks,
-                               workspace,
-                               result);
-        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(dot_result, slots, sizeof(T)));
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->copy_results_to_host(nrm2_result, (T*)slots + 1, sizeof(T)));
     }
 
     return rocblas_status_success;
 }
 
-/* ============================================================================================ */
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<T>
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_dot_nrm2_launch_acc(rocblas_handle handle,
+                                           rocblas_int n,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           const T* y,
+                                           rocblas_int incy,
+                                           T* dot_result,
+                                           T* nrm2_result)
+{
+    typedef rocblas_accumulator<T> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_dot_nrm2_launch_nb<NB, typename acc::compensated>(
+            handle, n, x, incx, y, incy, dot_result, nrm2_result);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_dot_nrm2_launch_nb<NB, typename acc::promoted>(
+            handle, n, x, incx, y, incy, dot_result, nrm2_result);
+    else
+        return rocblas_dot_nrm2_launch_nb<NB, typename acc::native>(
+            handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
 
 /*! \brief BLAS Level 1 API
 
     \details
-    dot(u)  perform dot product of vector x and y
-
-        result = x * y;
+    dot_nrm2 computes the dot product of x and y and the euclidean norm of x in one pass over
+    the vectors
 
-    dotc  perform dot product of complex vector x and complex y
+        dot_result  = x * y,
+        nrm2_result = sqrt( x * x ),
 
-        result = conjugate (x) * y;
+    as needed together by the orthogonalization and normalization steps of Krylov methods.
 
     @param[in]
     handle    rocblas_handle.
@@ -224,31 +530,47 @@ rocblas_status rocblas_dot_template_workspace(rocblas_handle handle,
     x         pointer storing vector x on the GPU.
     @param[in]
     incx      rocblas_int
+              specifies the increment for the elements of x.
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
               specifies the increment for the elements of y.
     @param[inout]
-    result
+    dot_result
               store the dot product. either on the host CPU or device GPU.
-              return is 0.0 if n <= 0.
+    @param[inout]
+    nrm2_result
+              store the norm of x, in the same memory as dot_result.
+              both results are 0.0 if n <= 0.
 
     ********************************************************************/
 
-// allocate workspace inside this API
 template <typename T>
-rocblas_status rocblas_dot_template(rocblas_handle handle,
-                                    rocblas_int n,
-                                    const T* x,
-                                    rocblas_int incx,
-                                    const T* y,
-                                    rocblas_int incy,
-                                    T* result)
+rocblas_status rocblas_dot_nrm2_template(rocblas_handle handle,
+                                         rocblas_int n,
+                                         const T* x,
+                                         rocblas_int incx,
+                                         const T* y,
+                                         rocblas_int incy,
+                                         T* dot_result,
+                                         T* nrm2_result)
 {
     if(nullptr == handle)
         return rocblas_status_invalid_handle;
 
-    log_trace(handle, replaceX<T>("rocblas_Xdot"), n, (const void*&)x, incx, (const void*&)y, incy);
+    log_trace(handle,
+              replaceX<T>("rocblas_Xdot_nrm2"),
+              n,
+              (const void*&)x,
+              incx,
+              (const void*&)y,
+              incy,
+              (const void*&)dot_result,
+              (const void*&)nrm2_result);
 
     log_bench(handle,
-              "./rocblas-bench -f dot -r",
+              "./rocblas-bench -f dot_nrm2 -r",
               replaceX<T>("X"),
               "-n",
               n,
@@ -261,7 +583,9 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
         return rocblas_status_invalid_pointer;
     else if(nullptr == y)
         return rocblas_status_invalid_pointer;
-    else if(nullptr == result)
+    else if(nullptr == dot_result)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == nrm2_result)
         return rocblas_status_invalid_pointer;
 
     /*
@@ -271,30 +595,214 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
     {
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
-            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(T)));
+            RETURN_IF_HIP_ERROR(hipMemset(dot_result, 0, sizeof(T)));
+            RETURN_IF_HIP_ERROR(hipMemset(nrm2_result, 0, sizeof(T)));
         }
         else
         {
-            *result = 0.0;
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(dot_result, sizeof(T)));
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(nrm2_result, sizeof(T)));
+            *dot_result  = 0.0;
+            *nrm2_result = 0.0;
         }
         return rocblas_status_success;
     }
 
-    rocblas_int blocks = (n - 1) / NB_X + 1;
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_dot_nrm2_launch_acc<ROCBLAS_DETERMINISTIC_NB, T>(
+            handle, n, x, incx, y, incy, dot_result, nrm2_result);
+    else
+        return rocblas_dot_nrm2_launch_acc<NB_X, T>(
+            handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
 
-    rocblas_status status;
+/*
+    hdot reads P elements of each rocblas_half vector per thread: P = 8 in the half8 loads of
+    haxpy when both vectors are contiguous and aligned to half8, P = 1 otherwise. The products
+    and sums are accumulated in A, at least float, and rounded to rocblas_half once.
+*/
+template <rocblas_int NB, rocblas_int P, typename A>
+__global__ void hdot_kernel(rocblas_int n,
+                            const __fp16* x,
+                            rocblas_int incx,
+                            const __fp16* y,
+                            rocblas_int incy,
+                            A* partial,
+                            unsigned int* ticket,
+                            __fp16* result)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T) * blocks), rocblas::device_free};
-    if(!workspace)
+    float xv[P];
+    float yv[P];
+    rocblas_load_half<P>(n, x, incx, tid, xv);
+    rocblas_load_half<P>(n, y, incy, tid, yv);
+
+    __shared__ A shared_tep[NB];
+    shared_tep[tx] = 0.0;
+
+    // the elements past n are 0
+    for(rocblas_int k = 0; k < P; k++)
     {
-        return rocblas_status_memory_error;
+        A product;
+        rocblas_acc_product(product, xv[k], yv[k]);
+        shared_tep[tx] += product;
     }
 
-    status = rocblas_dot_template_workspace<T>(
-        handle, n, x, incx, y, incy, result, (T*)workspace.get(), blocks);
+    if(rocblas_sum_reduce_grid<NB, A>(tx, shared_tep, partial, ticket) && tx == 0)
+        *result = float(shared_tep[0]);
+}
+
+// hdot of a non-empty pair with NB threads per block, NB fixes the order of the sums
+template <rocblas_int NB, typename A>
+rocblas_status rocblas_hdot_launch_nb(rocblas_handle handle,
+                                      rocblas_int n,
+                                      const rocblas_half* x,
+                                      rocblas_int incx,
+                                      const rocblas_half* y,
+                                      rocblas_int incy,
+                                      rocblas_half* result)
+{
+    bool packed = 1 == incx && 1 == incy && 0 == (uintptr_t)x % sizeof(half8) &&
+                  0 == (uintptr_t)y % sizeof(half8);
+    rocblas_int elements_per_thread = packed ? 8 : 1;
+    rocblas_int blocks              = (n - 1) / (NB * elements_per_thread) + 1;
+
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        1, sizeof(rocblas_half), sizeof(A) * blocks, &ticket, &slots, &partial));
 
-    return status;
+    // in host pointer mode the result is written to the slot of the buffer and copied back
+    __fp16* d_result =
+        rocblas_pointer_mode_device == handle->pointer_mode ? (__fp16*)result : (__fp16*)slots;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(packed)
+    {
+        hipLaunchKernelGGL((hdot_kernel<NB, 8, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (const __fp16*)y,
+                           incy,
+                           (A*)partial,
+                           ticket,
+                           d_result);
+    }
+    else
+    {
+        hipLaunchKernelGGL((hdot_kernel<NB, 1, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           (const __fp16*)x,
+                           incx,
+                           (const __fp16*)y,
+                           incy,
+                           (A*)partial,
+                           ticket,
+                           d_result);
+    }
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slots, sizeof(rocblas_half)));
+    }
+
+    return rocblas_status_success;
+}
+
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<rocblas_half>
+template <rocblas_int NB>
+rocblas_status rocblas_hdot_launch_acc(rocblas_handle handle,
+                                       rocblas_int n,
+                                       const rocblas_half* x,
+                                       rocblas_int incx,
+                                       const rocblas_half* y,
+                                       rocblas_int incy,
+                                       rocblas_half* result)
+{
+    typedef rocblas_accumulator<rocblas_half> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_hdot_launch_nb<NB, acc::compensated>(handle, n, x, incx, y, incy, result);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_hdot_launch_nb<NB, acc::promoted>(handle, n, x, incx, y, incy, result);
+    else
+        return rocblas_hdot_launch_nb<NB, acc::native>(handle, n, x, incx, y, incy, result);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    hdot performs the dot product of rocblas_half vectors x and y
+
+        result = x * y;
+
+    accumulated in float and rounded to rocblas_half once, so that the sum neither loses the
+    precision nor overflows the range of rocblas_half before the result does.
+
+    ********************************************************************/
+
+rocblas_status rocblas_dot_half(rocblas_handle handle,
+                                rocblas_int n,
+                                const rocblas_half* x,
+                                rocblas_int incx,
+                                const rocblas_half* y,
+                                rocblas_int incy,
+                                rocblas_half* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, "rocblas_hdot", n, (const void*&)x, incx, (const void*&)y, incy);
+
+    log_bench(handle, "./rocblas-bench -f dot -r h", "-n", n, "--incx", incx, "--incy", incy);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0)
+    {
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(rocblas_half)));
+        }
+        else
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(rocblas_half)));
+            *result = 0; // +0.0
+        }
+        return rocblas_status_success;
+    }
+
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_hdot_launch_acc<ROCBLAS_DETERMINISTIC_NB>(
+            handle, n, x, incx, y, incy, result);
+    else
+        return rocblas_hdot_launch_acc<NB_X>(handle, n, x, incx, y, incy, result);
 }
 
 /*
@@ -303,6 +811,17 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
  * ===========================================================================
  */
 
+extern "C" rocblas_status rocblas_hdot(rocblas_handle handle,
+                                       rocblas_int n,
+                                       const rocblas_half* x,
+                                       rocblas_int incx,
+                                       const rocblas_half* y,
+                                       rocblas_int incy,
+                                       rocblas_half* result)
+{
+    return rocblas_dot_half(handle, n, x, incx, y, incy, result);
+}
+
 extern "C" rocblas_status rocblas_sdot(rocblas_handle handle,
                                        rocblas_int n,
                                        const float* x,
@@ -346,3 +865,81 @@ extern "C" rocblas_status rocblas_zdotu(rocblas_handle handle,
 {
     return rocblas_dot_template<rocblas_double_complex>(handle, n, x, incx, y, incy, result);
 }
+
+extern "C" rocblas_status rocblas_sdot_strided_batched(rocblas_handle handle,
+                                                       rocblas_int n,
+                                                       const float* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       const float* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       float* result,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_dot_strided_batched_template<float>(
+        handle, n, x, incx, bsx, y, incy, bsy, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_ddot_strided_batched(rocblas_handle handle,
+                                                       rocblas_int n,
+                                                       const double* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       const double* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       double* result,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_dot_strided_batched_template<double>(
+        handle, n, x, incx, bsx, y, incy, bsy, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_sdot_batched(rocblas_handle handle,
+                                               rocblas_int n,
+                                               const float* const x[],
+                                               rocblas_int incx,
+                                               const float* const y[],
+                                               rocblas_int incy,
+                                               float* result,
+                                               rocblas_int batch_count)
+{
+    return rocblas_dot_batched_template<float>(handle, n, x, incx, y, incy, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_ddot_batched(rocblas_handle handle,
+                                               rocblas_int n,
+                                               const double* const x[],
+                                               rocblas_int incx,
+                                               const double* const y[],
+                                               rocblas_int incy,
+                                               double* result,
+                                               rocblas_int batch_count)
+{
+    return rocblas_dot_batched_template<double>(handle, n, x, incx, y, incy, result, batch_count);
+}
+
+extern "C" rocblas_status rocblas_sdot_nrm2(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const float* x,
+                                            rocblas_int incx,
+                                            const float* y,
+                                            rocblas_int incy,
+                                            float* dot_result,
+                                            float* nrm2_result)
+{
+    return rocblas_dot_nrm2_template<float>(handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
+
+extern "C" rocblas_status rocblas_ddot_nrm2(rocblas_handle handle,
+                                            rocblas_int n,
+                                            const double* x,
+                                            rocblas_int incx,
+                                            const double* y,
+                                            rocblas_int incy,
+                                            double* dot_result,
+                                            double* nrm2_result)
+{
+    return rocblas_dot_nrm2_template<double>(handle, n, x, incx, y, incy, dot_result, nrm2_result);
+}
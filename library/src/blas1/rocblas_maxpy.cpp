@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// the columns of V handled by one launch, more columns are processed in chunks of MAXPY_K
+#define MAXPY_K 32
+
+#define NB_X 256
+
+// the k scalars of a host pointer mode call, passed to the kernel by value
+template <typename T>
+struct maxpy_host_scalars
+{
+    T a[MAXPY_K];
+
+    __device__ const T& operator[](rocblas_int j) const { return a[j]; }
+};
+
+/*
+    y += V(:, 0:k) * alpha for the k <= K columns of V. Each thread reads and writes its element
+    of y once, whatever k. A is const T* for device pointer mode scalars or
+    maxpy_host_scalars<T> for host pointer mode scalars.
+*/
+template <typename T, rocblas_int K, typename A>
+__global__ void maxpy_kernel(rocblas_int n,
+                             rocblas_int k,
+                             A alpha,
+                             const T* V,
+                             rocblas_int ldv,
+                             T* y,
+                             rocblas_int incy)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    if(tid < n)
+    {
+        T sum = y[tid * incy];
+
+#pragma unroll
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            if(j < k)
+                sum += alpha[j] * V[tid + (size_t)j * ldv];
+        }
+
+        y[tid * incy] = sum;
+    }
+}
+
+template <typename T, typename A>
+void rocblas_maxpy_chunk(hipStream_t rocblas_stream,
+                         rocblas_int n,
+                         rocblas_int k,
+                         A alpha,
+                         const T* V,
+                         rocblas_int ldv,
+                         T* y,
+                         rocblas_int incy)
+{
+    rocblas_int blocks = (n - 1) / NB_X + 1;
+
+    // the smallest K that holds the chunk, the unrolled loop does no wasted work for small k
+    if(k <= 8)
+        hipLaunchKernelGGL((maxpy_kernel<T, 8, A>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           alpha,
+                           V,
+                           ldv,
+                           y,
+                           incy);
+    else if(k <= 16)
+        hipLaunchKernelGGL((maxpy_kernel<T, 16, A>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           alpha,
+                           V,
+                           ldv,
+                           y,
+                           incy);
+    else
+        hipLaunchKernelGGL((maxpy_kernel<T, MAXPY_K, A>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           alpha,
+                           V,
+                           ldv,
+                           y,
+                           incy);
+}
+
+/* ============================================================================================ */
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    maxpy adds a linear combination of the k columns of the n by k matrix V to the vector y
+
+        y := y + sum_j alpha[j] * V(:, j),  for j = 0, ... , k - 1,
+
+    i.e. y := V * alpha + y for a tall and skinny V, the update that follows mdot in the
+    classical Gram-Schmidt orthogonalization of Krylov methods. y is read and written once for
+    up to 32 columns, k > 32 is computed 32 columns at a time.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int. number of rows of V and elements of y.
+    @param[in]
+    k         rocblas_int. number of columns of V.
+    @param[in]
+    alpha     array of the k scalars alpha[j], on the host CPU or device GPU.
+    @param[in]
+    V         pointer storing matrix V on the GPU.
+    @param[in]
+    ldv       rocblas_int
+              specifies the leading dimension of V, ldv >= max(1, n).
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y, incy != 0.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_maxpy_template(rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      const T* alpha,
+                                      const T* V,
+                                      rocblas_int ldv,
+                                      T* y,
+                                      rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xmaxpy"),
+              n,
+              k,
+              (const void*&)alpha,
+              (const void*&)V,
+              ldv,
+              (const void*&)y,
+              incy);
+
+    log_bench(handle,
+              "./rocblas-bench -f maxpy -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "-k",
+              k,
+              "--lda",
+              ldv,
+              "--incy",
+              incy);
+
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == V)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    else if(ldv < n || ldv < 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n || 0 == k)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    for(rocblas_int j = 0; j < k; j += MAXPY_K)
+    {
+        rocblas_int kb = k - j < MAXPY_K ? k - j : MAXPY_K;
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            rocblas_maxpy_chunk<T>(
+                rocblas_stream, n, kb, alpha + j, V + (size_t)j * ldv, ldv, y, incy);
+        }
+        else // alpha is on host
+        {
+            maxpy_host_scalars<T> scalars;
+            for(rocblas_int jb = 0; jb < MAXPY_K; jb++)
+                scalars.a[jb] = jb < kb ? alpha[j + jb] : 0.0;
+
+            rocblas_maxpy_chunk<T>(
+                rocblas_stream, n, kb, scalars, V + (size_t)j * ldv, ldv, y, incy);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_smaxpy(rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const float* alpha,
+                                         const float* V,
+                                         rocblas_int ldv,
+                                         float* y,
+                                         rocblas_int incy)
+{
+    return rocblas_maxpy_template<float>(handle, n, k, alpha, V, ldv, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dmaxpy(rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const double* alpha,
+                                         const double* V,
+                                         rocblas_int ldv,
+                                         double* y,
+                                         rocblas_int incy)
+{
+    return rocblas_maxpy_template<double>(handle, n, k, alpha, V, ldv, y, incy);
+}
@@ -0,0 +1,384 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "device_template.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// the columns of V handled by one launch, more columns are processed in chunks of MDOT_K
+#define MDOT_K 32
+
+// threads per block and the largest grid, the blocks stride over the rows so that the
+// partial results of a launch stay at MDOT_MAX_BLOCKS * MDOT_K
+#define NB_X 256
+#define MDOT_MAX_BLOCKS 256
+
+/*
+    result[j] = V(:, j)^T * x for the k <= K columns of V. Each thread loads an element of x
+    once and accumulates it into the K sums held in registers, the unrolled loop over the
+    columns keeps the sums out of scratch memory. The blocks reduce their sums column by
+    column and the last block to finish reduces the partial results of all the blocks. The sums
+    are accumulated in A.
+*/
+template <typename T, rocblas_int NB, rocblas_int K, typename A>
+__global__ void mdot_kernel(rocblas_int n,
+                            rocblas_int k,
+                            const T* V,
+                            rocblas_int ldv,
+                            const T* x,
+                            rocblas_int incx,
+                            A* partial,
+                            unsigned int* ticket,
+                            T* result)
+{
+    rocblas_int tx = hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+
+    A sum[K];
+#pragma unroll
+    for(rocblas_int j = 0; j < K; j++)
+        sum[j] = 0.0;
+
+    for(rocblas_int i = hipBlockIdx_x * NB + tx; i < n; i += hipGridDim_x * NB)
+    {
+        T xi = x[i * incx];
+
+#pragma unroll
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            if(j < k)
+            {
+                A p;
+                rocblas_acc_product(p, V[i + (size_t)j * ldv], xi);
+                sum[j] += p;
+            }
+        }
+    }
+
+    __shared__ A shared_tep[NB];
+
+#pragma unroll
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        if(j < k)
+        {
+            shared_tep[tx] = sum[j];
+            rocblas_sum_reduce<NB, A>(tx, shared_tep);
+
+            if(tx == 0)
+                partial[j * hipGridDim_x + hipBlockIdx_x] = shared_tep[0];
+        }
+    }
+
+    if(!rocblas_last_block(tx, ticket))
+        return;
+
+    rocblas_int blocks = hipGridDim_x;
+
+    for(rocblas_int j = 0; j < k; j++)
+    {
+        shared_tep[tx] = 0.0;
+        for(rocblas_int b = tx; b < blocks; b += NB)
+            shared_tep[tx] += partial[j * blocks + b];
+
+        rocblas_sum_reduce<NB, A>(tx, shared_tep);
+
+        if(tx == 0)
+            result[j] = T(shared_tep[0]);
+    }
+}
+
+template <rocblas_int NB, typename A, typename T>
+void rocblas_mdot_chunk(hipStream_t rocblas_stream,
+                        rocblas_int blocks,
+                        rocblas_int n,
+                        rocblas_int k,
+                        const T* V,
+                        rocblas_int ldv,
+                        const T* x,
+                        rocblas_int incx,
+                        A* partial,
+                        unsigned int* ticket,
+                        T* result)
+{
+    // the smallest K that holds the chunk, the unrolled loops do no wasted work for small k
+    if(k <= 8)
+        hipLaunchKernelGGL((mdot_kernel<T, NB, 8, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           V,
+                           ldv,
+                           x,
+                           incx,
+                           partial,
+                           ticket,
+                           result);
+    else if(k <= 16)
+        hipLaunchKernelGGL((mdot_kernel<T, NB, 16, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           V,
+                           ldv,
+                           x,
+                           incx,
+                           partial,
+                           ticket,
+                           result);
+    else
+        hipLaunchKernelGGL((mdot_kernel<T, NB, MDOT_K, A>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           V,
+                           ldv,
+                           x,
+                           incx,
+                           partial,
+                           ticket,
+                           result);
+}
+
+/*
+    mdot of a non-empty V with NB threads per block, the sums are accumulated in A. The
+    deterministic reduction mode gives each thread one row, so that the order of the sums is
+    fixed by ROCBLAS_DETERMINISTIC_NB alone; the default mode caps the grid and strides.
+*/
+template <rocblas_int NB, typename A, typename T>
+rocblas_status rocblas_mdot_launch_nb(rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      const T* V,
+                                      rocblas_int ldv,
+                                      const T* x,
+                                      rocblas_int incx,
+                                      T* result)
+{
+    bool deterministic = rocblas_reduction_mode_deterministic == handle->reduction_mode;
+
+    rocblas_int blocks = (n - 1) / NB + 1;
+    if(!deterministic && blocks > MDOT_MAX_BLOCKS)
+        blocks = MDOT_MAX_BLOCKS;
+
+    unsigned int* ticket;
+    void* slots;
+    void* partial;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        1, sizeof(T) * k, sizeof(A) * blocks * MDOT_K, &ticket, &slots, &partial));
+
+    // in host pointer mode the results are written to the slots of the buffer and copied back
+    T* d_result = rocblas_pointer_mode_device == handle->pointer_mode ? result : (T*)slots;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // the chunks run one after the other on the stream and share the partials and the ticket
+    for(rocblas_int j = 0; j < k; j += MDOT_K)
+    {
+        rocblas_int kb = k - j < MDOT_K ? k - j : MDOT_K;
+
+        rocblas_mdot_chunk<NB, A, T>(rocblas_stream,
+                                     blocks,
+                                     n,
+                                     kb,
+                                     V + (size_t)j * ldv,
+                                     ldv,
+                                     x,
+                                     incx,
+                                     (A*)partial,
+                                     ticket,
+                                     d_result + j);
+    }
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->copy_results_to_host(result, slots, sizeof(T) * k));
+    }
+
+    return rocblas_status_success;
+}
+
+// the accumulation mode of the handle picks the accumulator of rocblas_accumulator<T>
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_mdot_launch_acc(rocblas_handle handle,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       const T* V,
+                                       rocblas_int ldv,
+                                       const T* x,
+                                       rocblas_int incx,
+                                       T* result)
+{
+    typedef rocblas_accumulator<T> acc;
+
+    if(rocblas_accumulation_mode_compensated == handle->accumulation_mode)
+        return rocblas_mdot_launch_nb<NB, typename acc::compensated>(
+            handle, n, k, V, ldv, x, incx, result);
+    else if(rocblas_accumulation_mode_double == handle->accumulation_mode)
+        return rocblas_mdot_launch_nb<NB, typename acc::promoted>(
+            handle, n, k, V, ldv, x, incx, result);
+    else
+        return rocblas_mdot_launch_nb<NB, typename acc::native>(
+            handle, n, k, V, ldv, x, incx, result);
+}
+
+/* ============================================================================================ */
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    mdot performs the dot products of the k columns of the n by k matrix V with the vector x
+
+        result[j] = V(:, j) * x,  for j = 0, ... , k - 1,
+
+    i.e. result = V^T * x for a tall and skinny V, as needed by the classical Gram-Schmidt
+    orthogonalization of Krylov methods. x is read once for up to 32 columns, k > 32 is
+    computed 32 columns at a time.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int. number of rows of V and elements of x.
+    @param[in]
+    k         rocblas_int. number of columns of V.
+    @param[in]
+    V         pointer storing matrix V on the GPU.
+    @param[in]
+    ldv       rocblas_int
+              specifies the leading dimension of V, ldv >= max(1, n).
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x, incx != 0.
+    @param[inout]
+    result
+              array of k dot products, either on the host CPU or device GPU.
+              every entry is 0.0 if n == 0.
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_mdot_template(rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const T* V,
+                                     rocblas_int ldv,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     T* result)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xmdot"),
+              n,
+              k,
+              (const void*&)V,
+              ldv,
+              (const void*&)x,
+              incx,
+              (const void*&)result);
+
+    log_bench(handle,
+              "./rocblas-bench -f mdot -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "-k",
+              k,
+              "--lda",
+              ldv,
+              "--incx",
+              incx);
+
+    if(nullptr == V)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == result)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    else if(ldv < n || ldv < 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible.
+     */
+    if(0 == k)
+        return rocblas_status_success;
+
+    if(0 == n)
+    {
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            RETURN_IF_HIP_ERROR(hipMemset(result, 0, sizeof(T) * k));
+        }
+        else
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->wait_host_results(result, sizeof(T) * k));
+            for(rocblas_int j = 0; j < k; j++)
+                result[j] = 0.0;
+        }
+        return rocblas_status_success;
+    }
+
+    if(rocblas_reduction_mode_deterministic == handle->reduction_mode)
+        return rocblas_mdot_launch_acc<ROCBLAS_DETERMINISTIC_NB, T>(
+            handle, n, k, V, ldv, x, incx, result);
+    else
+        return rocblas_mdot_launch_acc<NB_X, T>(handle, n, k, V, ldv, x, incx, result);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_smdot(rocblas_handle handle,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const float* V,
+                                        rocblas_int ldv,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        float* result)
+{
+    return rocblas_mdot_template<float>(handle, n, k, V, ldv, x, incx, result);
+}
+
+extern "C" rocblas_status rocblas_dmdot(rocblas_handle handle,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const double* V,
+                                        rocblas_int ldv,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        double* result)
+{
+    return rocblas_mdot_template<double>(handle, n, k, V, ldv, x, incx, result);
+}
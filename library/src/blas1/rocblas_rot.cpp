@@ -0,0 +1,722 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "definitions.h"
+#include "device_template.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// the rotations of a host pointer mode rot_sequence handled by one launch
+#define ROT_SEQUENCE_K 32
+
+#define NB_X 256
+
+/*
+    applies the rotation (c, s) to the elements of x and y. A complex element is M = 2
+    components, its real and imaginary parts are rotated as the elements of two real vectors,
+    increments and strides are in components. hipBlockIdx_y picks the pair of the batch. A is T
+    for host pointer mode scalars or const T* for device pointer mode scalars.
+*/
+template <typename T, rocblas_int M, typename U, typename A>
+__global__ void rot_kernel(rocblas_int n,
+                           U xa,
+                           rocblas_int incx,
+                           rocblas_int bsx,
+                           U ya,
+                           rocblas_int incy,
+                           rocblas_int bsy,
+                           A c_a,
+                           A s_a)
+{
+    T* x = load_batch_ptr(xa, bsx);
+    T* y = load_batch_ptr(ya, bsy);
+
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    if(tid < n * M)
+    {
+        T c = load_scalar(c_a);
+        T s = load_scalar(s_a);
+
+        // M is 1 or 2, the division is a shift
+        rocblas_int ix = (tid / M) * incx + tid % M;
+        rocblas_int iy = (tid / M) * incy + tid % M;
+
+        T tx  = x[ix];
+        T ty  = y[iy];
+        x[ix] = c * tx + s * ty;
+        y[iy] = c * ty - s * tx;
+    }
+}
+
+/*
+    rot of batch_count pairs of vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID pairs. R is the real type of c and s, U is R* for strided vectors (a
+    single pair is a strided batch of one) or R* const* for arrays of pointers, M the components
+    of an element of x and y.
+*/
+template <typename R, rocblas_int M, typename U>
+rocblas_status rocblas_rot_launch(rocblas_handle handle,
+                                  rocblas_int n,
+                                  U x,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  U y,
+                                  rocblas_int incy,
+                                  rocblas_int bsy,
+                                  const R* c,
+                                  const R* s,
+                                  rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || 0 == batch_count)
+        return rocblas_status_success;
+
+    rocblas_int blocks = (n * M - 1) / NB_X + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            hipLaunchKernelGGL((rot_kernel<R, M, U, const R*>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               batch_offset(x, bsx * M, b0),
+                               incx * M,
+                               bsx * M,
+                               batch_offset(y, bsy * M, b0),
+                               incy * M,
+                               bsy * M,
+                               c,
+                               s);
+        }
+        else // c and s are on host
+        {
+            hipLaunchKernelGGL((rot_kernel<R, M, U, R>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               batch_offset(x, bsx * M, b0),
+                               incx * M,
+                               bsx * M,
+                               batch_offset(y, bsy * M, b0),
+                               incy * M,
+                               bsy * M,
+                               *c,
+                               *s);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+// rocblas_Xrot for real vectors, rocblas_csrot and rocblas_zdrot for complex vectors
+template <typename T, typename R>
+std::string rot_name()
+{
+    if(std::is_same<T, R>::value)
+        return replaceX<T>("rocblas_Xrot");
+
+    return replaceX<T>("rocblas_X") + replaceX<R>("Xrot");
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot applies the plane rotation (c, s) to the pairs of elements of x and y
+
+        x[i] :=  c * x[i] + s * y[i],
+        y[i] := -s * x[i] + c * y[i],  for  i = 1 , … , n
+
+    c and s are real, complex vectors have their real and imaginary parts rotated alike.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    c         the cosine of the rotation, on the host CPU or device GPU.
+    @param[in]
+    s         the sine of the rotation, on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T, typename R>
+rocblas_status rocblas_rot_template(rocblas_handle handle,
+                                    rocblas_int n,
+                                    T* x,
+                                    rocblas_int incx,
+                                    T* y,
+                                    rocblas_int incy,
+                                    const R* c,
+                                    const R* s)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  rot_name<T, R>(),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  *c,
+                  *s);
+    }
+    else
+    {
+        log_trace(handle,
+                  rot_name<T, R>(),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)c,
+                  (const void*&)s);
+    }
+
+    log_bench(handle,
+              "./rocblas-bench -f rot -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+
+    constexpr rocblas_int M = sizeof(T) / sizeof(R);
+
+    return rocblas_rot_launch<R, M>(handle, n, (R*)x, incx, 0, (R*)y, incy, 0, c, s, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot_strided_batched and rot_batched apply the same plane rotation (c, s) to batch_count
+    pairs of vectors x_i and y_i in one call
+
+        x_i :=  c * x_i + s * y_i,
+        y_i := -s * x_i + c * y_i ,
+
+    the vectors of rot_strided_batched start bsx (bsy) elements apart, the vectors of
+    rot_batched are given by arrays of batch_count device pointers on the GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rot_strided_batched_template(rocblas_handle handle,
+                                                    rocblas_int n,
+                                                    T* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    T* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    const T* c,
+                                                    const T* s,
+                                                    rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xrot_strided_batched"),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  *c,
+                  *s,
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xrot_strided_batched"),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  (const void*&)c,
+                  (const void*&)s,
+                  batch_count);
+    }
+
+    log_bench(handle,
+              "./rocblas-bench -f rot_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_rot_launch<T, 1>(handle, n, x, incx, bsx, y, incy, bsy, c, s, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_rot_batched_template(rocblas_handle handle,
+                                            rocblas_int n,
+                                            T* const* x,
+                                            rocblas_int incx,
+                                            T* const* y,
+                                            rocblas_int incy,
+                                            const T* c,
+                                            const T* s,
+                                            rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xrot_batched"),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  *c,
+                  *s,
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xrot_batched"),
+                  n,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)c,
+                  (const void*&)s,
+                  batch_count);
+    }
+
+    log_bench(handle,
+              "./rocblas-bench -f rot_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_rot_launch<T, 1>(handle, n, x, incx, 0, y, incy, 0, c, s, batch_count);
+}
+
+// the cosines or sines of a host pointer mode rot_sequence, passed to the kernel by value
+template <typename T>
+struct rot_sequence_host_scalars
+{
+    T a[ROT_SEQUENCE_K];
+
+    __device__ const T& operator[](rocblas_int j) const { return a[j]; }
+};
+
+/*
+    applies the k rotations (c[j], s[j]) in turn to the elements of x and y. Each thread reads
+    and writes its pair of elements once and keeps them in registers across the sequence. A is
+    const T* for device pointer mode scalars or rot_sequence_host_scalars<T> for host pointer
+    mode scalars.
+*/
+template <typename T, typename A>
+__global__ void rot_sequence_kernel(rocblas_int n,
+                                    rocblas_int k,
+                                    T* x,
+                                    rocblas_int incx,
+                                    T* y,
+                                    rocblas_int incy,
+                                    A c,
+                                    A s)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    if(tid < n)
+    {
+        T tx = x[tid * incx];
+        T ty = y[tid * incy];
+
+        for(rocblas_int j = 0; j < k; j++)
+        {
+            T t = c[j] * tx + s[j] * ty;
+            ty  = c[j] * ty - s[j] * tx;
+            tx  = t;
+        }
+
+        x[tid * incx] = tx;
+        y[tid * incy] = ty;
+    }
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rot_sequence applies the k plane rotations (c[j], s[j]) in turn to the pair of vectors x
+    and y
+
+        for j = 0, ... , k - 1
+            x :=  c[j] * x + s[j] * y,
+            y := -s[j] * x + c[j] * y ,
+
+    with the result of k calls of rot, but x and y are read and written once: the pairs of
+    elements stay in registers across the sequence. In host pointer mode the sequence is
+    applied ROT_SEQUENCE_K = 32 rotations per pass.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[in]
+    k         rocblas_int. number of rotations, quick return if k <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    c         array of the k cosines c[j], on the host CPU or device GPU.
+    @param[in]
+    s         array of the k sines s[j], on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rot_sequence_template(rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             T* x,
+                                             rocblas_int incx,
+                                             T* y,
+                                             rocblas_int incy,
+                                             const T* c,
+                                             const T* s)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrot_sequence"),
+              n,
+              k,
+              (const void*&)x,
+              incx,
+              (const void*&)y,
+              incy,
+              (const void*&)c,
+              (const void*&)s);
+
+    log_bench(handle,
+              "./rocblas-bench -f rot_sequence -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "-k",
+              k,
+              "--incx",
+              incx,
+              "--incy",
+              incy);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(n <= 0 || k <= 0)
+        return rocblas_status_success;
+
+    rocblas_int blocks = (n - 1) / NB_X + 1;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((rot_sequence_kernel<T, const T*>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n,
+                           k,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           c,
+                           s);
+    }
+    else // c and s are on host
+    {
+        for(rocblas_int j = 0; j < k; j += ROT_SEQUENCE_K)
+        {
+            rocblas_int kb = k - j < ROT_SEQUENCE_K ? k - j : ROT_SEQUENCE_K;
+
+            rot_sequence_host_scalars<T> c_scalars, s_scalars;
+            for(rocblas_int jb = 0; jb < ROT_SEQUENCE_K; jb++)
+            {
+                c_scalars.a[jb] = jb < kb ? c[j + jb] : 1.0;
+                s_scalars.a[jb] = jb < kb ? s[j + jb] : 0.0;
+            }
+
+            hipLaunchKernelGGL((rot_sequence_kernel<T, rot_sequence_host_scalars<T>>),
+                               dim3(blocks),
+                               dim3(NB_X),
+                               0,
+                               rocblas_stream,
+                               n,
+                               kb,
+                               x,
+                               incx,
+                               y,
+                               incy,
+                               c_scalars,
+                               s_scalars);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_srot(rocblas_handle handle,
+                                       rocblas_int n,
+                                       float* x,
+                                       rocblas_int incx,
+                                       float* y,
+                                       rocblas_int incy,
+                                       const float* c,
+                                       const float* s)
+{
+    return rocblas_rot_template<float, float>(handle, n, x, incx, y, incy, c, s);
+}
+
+extern "C" rocblas_status rocblas_drot(rocblas_handle handle,
+                                       rocblas_int n,
+                                       double* x,
+                                       rocblas_int incx,
+                                       double* y,
+                                       rocblas_int incy,
+                                       const double* c,
+                                       const double* s)
+{
+    return rocblas_rot_template<double, double>(handle, n, x, incx, y, incy, c, s);
+}
+
+extern "C" rocblas_status rocblas_csrot(rocblas_handle handle,
+                                        rocblas_int n,
+                                        rocblas_float_complex* x,
+                                        rocblas_int incx,
+                                        rocblas_float_complex* y,
+                                        rocblas_int incy,
+                                        const float* c,
+                                        const float* s)
+{
+    return rocblas_rot_template<rocblas_float_complex, float>(handle, n, x, incx, y, incy, c, s);
+}
+
+extern "C" rocblas_status rocblas_zdrot(rocblas_handle handle,
+                                        rocblas_int n,
+                                        rocblas_double_complex* x,
+                                        rocblas_int incx,
+                                        rocblas_double_complex* y,
+                                        rocblas_int incy,
+                                        const double* c,
+                                        const double* s)
+{
+    return rocblas_rot_template<rocblas_double_complex, double>(
+        handle, n, x, incx, y, incy, c, s);
+}
+
+extern "C" rocblas_status rocblas_srot_strided_batched(rocblas_handle handle,
+                                                       rocblas_int n,
+                                                       float* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       float* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       const float* c,
+                                                       const float* s,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_rot_strided_batched_template<float>(
+        handle, n, x, incx, bsx, y, incy, bsy, c, s, batch_count);
+}
+
+extern "C" rocblas_status rocblas_drot_strided_batched(rocblas_handle handle,
+                                                       rocblas_int n,
+                                                       double* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       double* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       const double* c,
+                                                       const double* s,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_rot_strided_batched_template<double>(
+        handle, n, x, incx, bsx, y, incy, bsy, c, s, batch_count);
+}
+
+extern "C" rocblas_status rocblas_srot_batched(rocblas_handle handle,
+                                               rocblas_int n,
+                                               float* const x[],
+                                               rocblas_int incx,
+                                               float* const y[],
+                                               rocblas_int incy,
+                                               const float* c,
+                                               const float* s,
+                                               rocblas_int batch_count)
+{
+    return rocblas_rot_batched_template<float>(handle, n, x, incx, y, incy, c, s, batch_count);
+}
+
+extern "C" rocblas_status rocblas_drot_batched(rocblas_handle handle,
+                                               rocblas_int n,
+                                               double* const x[],
+                                               rocblas_int incx,
+                                               double* const y[],
+                                               rocblas_int incy,
+                                               const double* c,
+                                               const double* s,
+                                               rocblas_int batch_count)
+{
+    return rocblas_rot_batched_template<double>(handle, n, x, incx, y, incy, c, s, batch_count);
+}
+
+extern "C" rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                float* x,
+                                                rocblas_int incx,
+                                                float* y,
+                                                rocblas_int incy,
+                                                const float* c,
+                                                const float* s)
+{
+    return rocblas_rot_sequence_template<float>(handle, n, k, x, incx, y, incy, c, s);
+}
+
+extern "C" rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                double* x,
+                                                rocblas_int incx,
+                                                double* y,
+                                                rocblas_int incy,
+                                                const double* c,
+                                                const double* s)
+{
+    return rocblas_rot_sequence_template<double>(handle, n, k, x, incx, y, incy, c, s);
+}
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <cmath>
+
+#include "rocblas.h"
+
+#include "definitions.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define NB_X 256
+
+/*
+    the rotation (c, s) that zeros b in [a, b], as the reference BLAS: a is overwritten by r
+    and b by the value z from which c and s can be recovered. Shared by the host pointer mode
+    and the kernel.
+*/
+template <typename T>
+__host__ __device__ void rocblas_rotg_calc(T& a, T& b, T& c, T& s)
+{
+    T abs_a = a < 0 ? -a : a;
+    T abs_b = b < 0 ? -b : b;
+    T roe   = abs_a > abs_b ? a : b;
+    T scale = abs_a + abs_b;
+
+    if(scale == 0)
+    {
+        c = 1;
+        s = 0;
+        a = 0;
+        b = 0;
+        return;
+    }
+
+    T a_scaled = a / scale;
+    T b_scaled = b / scale;
+    T r        = scale * sqrt(a_scaled * a_scaled + b_scaled * b_scaled);
+    if(roe < 0)
+        r = -r;
+
+    c = a / r;
+    s = b / r;
+
+    T z = 1;
+    if(abs_a > abs_b)
+        z = s;
+    else if(c != 0)
+        z = 1 / c;
+
+    a = r;
+    b = z;
+}
+
+// one thread per rotation of the batch
+template <typename T>
+__global__ void rotg_kernel(T* a,
+                            rocblas_int stride_a,
+                            T* b,
+                            rocblas_int stride_b,
+                            T* c,
+                            rocblas_int stride_c,
+                            T* s,
+                            rocblas_int stride_s,
+                            rocblas_int batch_count)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < batch_count)
+    {
+        rocblas_rotg_calc(a[(size_t)tid * stride_a],
+                          b[(size_t)tid * stride_b],
+                          c[(size_t)tid * stride_c],
+                          s[(size_t)tid * stride_s]);
+    }
+}
+
+/*
+    rotg of batch_count rotations, computed by the host in host pointer mode and by one thread
+    per rotation in device pointer mode.
+*/
+template <typename T>
+rocblas_status rocblas_rotg_launch(rocblas_handle handle,
+                                   T* a,
+                                   rocblas_int stride_a,
+                                   T* b,
+                                   rocblas_int stride_b,
+                                   T* c,
+                                   rocblas_int stride_c,
+                                   T* s,
+                                   rocblas_int stride_s,
+                                   rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(0 == batch_count)
+        return rocblas_status_success;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        rocblas_int blocks = (batch_count - 1) / NB_X + 1;
+
+        hipStream_t rocblas_stream = handle->rocblas_stream;
+
+        hipLaunchKernelGGL((rotg_kernel<T>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           a,
+                           stride_a,
+                           b,
+                           stride_b,
+                           c,
+                           stride_c,
+                           s,
+                           stride_s,
+                           batch_count);
+    }
+    else // a, b, c and s are on host
+    {
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            rocblas_rotg_calc(a[(size_t)i * stride_a],
+                              b[(size_t)i * stride_b],
+                              c[(size_t)i * stride_c],
+                              s[(size_t)i * stride_s]);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotg constructs the plane rotation (c, s) that zeros the second entry of [a, b]
+
+        [  c  s ] * [ a ] = [ r ]
+        [ -s  c ]   [ b ]   [ 0 ] ,
+
+    a is overwritten by r and b by z, from which c and s can be recovered: c = 0 and s = 1 if
+    z = 1, s = z and c = sqrt(1 - s * s) if |z| < 1, c = 1 / z and s = sqrt(1 - c * c) if
+    |z| > 1.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[inout]
+    a         the scalar a, overwritten by r, on the host CPU or device GPU.
+    @param[inout]
+    b         the scalar b, overwritten by z, on the host CPU or device GPU.
+    @param[out]
+    c         the cosine of the rotation, on the host CPU or device GPU.
+    @param[out]
+    s         the sine of the rotation, on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rotg_template(rocblas_handle handle, T* a, T* b, T* c, T* s)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotg"),
+              (const void*&)a,
+              (const void*&)b,
+              (const void*&)c,
+              (const void*&)s);
+
+    log_bench(handle, "./rocblas-bench -f rotg -r", replaceX<T>("X"));
+
+    if(nullptr == a)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == b)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_rotg_launch<T>(handle, a, 0, b, 0, c, 0, s, 0, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotg_strided_batched constructs batch_count plane rotations, a_i, b_i, c_i and s_i start
+    stride_a, stride_b, stride_c and stride_s elements apart.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rotg_strided_batched_template(rocblas_handle handle,
+                                                     T* a,
+                                                     rocblas_int stride_a,
+                                                     T* b,
+                                                     rocblas_int stride_b,
+                                                     T* c,
+                                                     rocblas_int stride_c,
+                                                     T* s,
+                                                     rocblas_int stride_s,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotg_strided_batched"),
+              (const void*&)a,
+              stride_a,
+              (const void*&)b,
+              stride_b,
+              (const void*&)c,
+              stride_c,
+              (const void*&)s,
+              stride_s,
+              batch_count);
+
+    log_bench(
+        handle, "./rocblas-bench -f rotg_batched -r", replaceX<T>("X"), "--batch", batch_count);
+
+    if(nullptr == a)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == b)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == c)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == s)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_rotg_launch<T>(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status
+rocblas_srotg(rocblas_handle handle, float* a, float* b, float* c, float* s)
+{
+    return rocblas_rotg_template<float>(handle, a, b, c, s);
+}
+
+extern "C" rocblas_status
+rocblas_drotg(rocblas_handle handle, double* a, double* b, double* c, double* s)
+{
+    return rocblas_rotg_template<double>(handle, a, b, c, s);
+}
+
+extern "C" rocblas_status rocblas_srotg_strided_batched(rocblas_handle handle,
+                                                        float* a,
+                                                        rocblas_int stride_a,
+                                                        float* b,
+                                                        rocblas_int stride_b,
+                                                        float* c,
+                                                        rocblas_int stride_c,
+                                                        float* s,
+                                                        rocblas_int stride_s,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_rotg_strided_batched_template<float>(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
+
+extern "C" rocblas_status rocblas_drotg_strided_batched(rocblas_handle handle,
+                                                        double* a,
+                                                        rocblas_int stride_a,
+                                                        double* b,
+                                                        rocblas_int stride_b,
+                                                        double* c,
+                                                        rocblas_int stride_c,
+                                                        double* s,
+                                                        rocblas_int stride_s,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_rotg_strided_batched_template<double>(
+        handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batch_count);
+}
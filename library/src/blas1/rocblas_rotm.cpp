@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "definitions.h"
+#include "device_template.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define NB_X 256
+
+// the five values flag, h11, h21, h12, h22 of a host pointer mode param, passed by value
+template <typename T>
+struct rotm_param
+{
+    T p[5];
+};
+
+template <typename T>
+__device__ rotm_param<T> load_rotm_param(rotm_param<T> param, rocblas_int stride_param)
+{
+    return param;
+}
+
+// hipBlockIdx_y picks the param of the batch
+template <typename T>
+__device__ rotm_param<T> load_rotm_param(const T* param, rocblas_int stride_param)
+{
+    param += (size_t)hipBlockIdx_y * stride_param;
+
+    rotm_param<T> h;
+    for(rocblas_int k = 0; k < 5; k++)
+        h.p[k] = param[k];
+    return h;
+}
+
+/*
+    applies the modified Givens transformation H of param to the elements of x and y, the
+    entries of H implied by the flag param[0] are not read. hipBlockIdx_y picks the pair of the
+    batch. P is rotm_param<T> for host pointer mode or const T* for device pointer mode.
+*/
+template <typename T, typename P>
+__global__ void rotm_kernel(rocblas_int n,
+                            T* x,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            T* y,
+                            rocblas_int incy,
+                            rocblas_int bsy,
+                            P param,
+                            rocblas_int stride_param)
+{
+    x = load_batch_ptr(x, bsx);
+    y = load_batch_ptr(y, bsy);
+
+    rotm_param<T> h = load_rotm_param(param, stride_param);
+    T flag          = h.p[0];
+
+    // H is the identity
+    if(flag == -2)
+        return;
+
+    T h11 = flag == 0 ? 1 : h.p[1];
+    T h21 = flag == 1 ? -1 : h.p[2];
+    T h12 = flag == 1 ? 1 : h.p[3];
+    T h22 = flag == 0 ? 1 : h.p[4];
+
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    if(tid < n)
+    {
+        T tx          = x[tid * incx];
+        T ty          = y[tid * incy];
+        x[tid * incx] = h11 * tx + h12 * ty;
+        y[tid * incy] = h21 * tx + h22 * ty;
+    }
+}
+
+/*
+    rotm of batch_count pairs of vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID pairs. The params of a device pointer mode call are read by the
+    kernel, a host pointer mode call launches each pair with its param by value and skips the
+    identities.
+*/
+template <typename T>
+rocblas_status rocblas_rotm_launch(rocblas_handle handle,
+                                   rocblas_int n,
+                                   T* x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   T* y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   const T* param,
+                                   rocblas_int stride_param,
+                                   rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(n <= 0 || 0 == batch_count)
+        return rocblas_status_success;
+
+    rocblas_int blocks = (n - 1) / NB_X + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((rotm_kernel<T, const T*>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               x + (size_t)b0 * bsx,
+                               incx,
+                               bsx,
+                               y + (size_t)b0 * bsy,
+                               incy,
+                               bsy,
+                               param + (size_t)b0 * stride_param,
+                               stride_param);
+        }
+    }
+    else // param is on host
+    {
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            const T* param_b = param + (size_t)b * stride_param;
+            if(param_b[0] == -2)
+                continue;
+
+            rotm_param<T> h;
+            for(rocblas_int k = 0; k < 5; k++)
+                h.p[k] = param_b[k];
+
+            hipLaunchKernelGGL((rotm_kernel<T, rotm_param<T>>),
+                               dim3(blocks),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               x + (size_t)b * bsx,
+                               incx,
+                               0,
+                               y + (size_t)b * bsy,
+                               incy,
+                               0,
+                               h,
+                               0);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotm applies the modified Givens transformation H to the pairs of elements of x and y
+
+        [ x[i] ] := H * [ x[i] ] ,  for  i = 1 , … , n
+        [ y[i] ]        [ y[i] ]
+
+    H is given by param = (flag, h11, h21, h12, h22):
+
+        flag = -1: H = [ h11 h12 ]   flag = 0: H = [ 1   h12 ]
+                       [ h21 h22 ]                 [ h21 1   ]
+
+        flag =  1: H = [ h11 1   ]   flag = -2: H = identity
+                       [ -1  h22 ]
+
+    the entries of H implied by the flag are not read.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+    @param[in]
+    param     array of 5 values, on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rotm_template(rocblas_handle handle,
+                                     rocblas_int n,
+                                     T* x,
+                                     rocblas_int incx,
+                                     T* y,
+                                     rocblas_int incy,
+                                     const T* param)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotm"),
+              n,
+              (const void*&)x,
+              incx,
+              (const void*&)y,
+              incy,
+              (const void*&)param);
+
+    log_bench(handle,
+              "./rocblas-bench -f rotm -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == param)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_rotm_launch<T>(handle, n, x, incx, 0, y, incy, 0, param, 0, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotm_strided_batched applies the modified Givens transformation H_i of param_i to
+    batch_count pairs of vectors x_i and y_i, the vectors start bsx (bsy) elements apart and the
+    params stride_param elements apart.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rotm_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     const T* param,
+                                                     rocblas_int stride_param,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotm_strided_batched"),
+              n,
+              (const void*&)x,
+              incx,
+              bsx,
+              (const void*&)y,
+              incy,
+              bsy,
+              (const void*&)param,
+              stride_param,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f rotm_batched -r",
+              replaceX<T>("X"),
+              "-n",
+              n,
+              "--incx",
+              incx,
+              "--incy",
+              incy,
+              "--batch",
+              batch_count);
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == param)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_rotm_launch<T>(
+        handle, n, x, incx, bsx, y, incy, bsy, param, stride_param, batch_count);
+}
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_srotm(rocblas_handle handle,
+                                        rocblas_int n,
+                                        float* x,
+                                        rocblas_int incx,
+                                        float* y,
+                                        rocblas_int incy,
+                                        const float* param)
+{
+    return rocblas_rotm_template<float>(handle, n, x, incx, y, incy, param);
+}
+
+extern "C" rocblas_status rocblas_drotm(rocblas_handle handle,
+                                        rocblas_int n,
+                                        double* x,
+                                        rocblas_int incx,
+                                        double* y,
+                                        rocblas_int incy,
+                                        const double* param)
+{
+    return rocblas_rotm_template<double>(handle, n, x, incx, y, incy, param);
+}
+
+extern "C" rocblas_status rocblas_srotm_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        const float* param,
+                                                        rocblas_int stride_param,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_rotm_strided_batched_template<float>(
+        handle, n, x, incx, bsx, y, incy, bsy, param, stride_param, batch_count);
+}
+
+extern "C" rocblas_status rocblas_drotm_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        const double* param,
+                                                        rocblas_int stride_param,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_rotm_strided_batched_template<double>(
+        handle, n, x, incx, bsx, y, incy, bsy, param, stride_param, batch_count);
+}
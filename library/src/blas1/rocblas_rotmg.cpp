@@ -0,0 +1,461 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "definitions.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define NB_X 256
+
+/*
+    the modified Givens transformation H that zeros the second entry of
+    [sqrt(d1) * x1, sqrt(d2) * y1], as the reference BLAS: d1, d2 and x1 are overwritten by the
+    scaled factors and the rotated x1, param by the flag and the entries of H it does not imply.
+    d1 and d2 are kept within [1 / gamma^2, gamma^2], gamma = 4096, by rescaling H. Shared by
+    the host pointer mode and the kernel.
+*/
+template <typename T>
+__host__ __device__ void rocblas_rotmg_calc(T& d1, T& d2, T& x1, T y1, T* param)
+{
+    const T gam    = 4096;
+    const T gamsq  = gam * gam;
+    const T rgamsq = 1 / gamsq;
+
+    T flag = -1;
+    T h11  = 0, h21 = 0, h12 = 0, h22 = 0;
+
+    if(d1 < 0)
+    {
+        d1 = d2 = x1 = 0;
+    }
+    else
+    {
+        T p2 = d2 * y1;
+        if(p2 == 0)
+        {
+            param[0] = -2;
+            return;
+        }
+
+        T p1 = d1 * x1;
+        T q2 = p2 * y1;
+        T q1 = p1 * x1;
+
+        if((q1 < 0 ? -q1 : q1) > (q2 < 0 ? -q2 : q2))
+        {
+            h21 = -y1 / x1;
+            h12 = p2 / p1;
+
+            T u = 1 - h12 * h21;
+            if(u > 0)
+            {
+                flag = 0;
+                d1 /= u;
+                d2 /= u;
+                x1 *= u;
+            }
+            else
+            {
+                h21 = h12 = 0;
+                d1 = d2 = x1 = 0;
+            }
+        }
+        else if(q2 < 0)
+        {
+            d1 = d2 = x1 = 0;
+        }
+        else
+        {
+            flag = 1;
+            h11  = p1 / p2;
+            h22  = x1 / y1;
+
+            T u = 1 + h11 * h22;
+            T t = d2 / u;
+            d2  = d1 / u;
+            d1  = t;
+            x1  = y1 * u;
+        }
+
+        // rescale d1, H becomes a full matrix
+        if(d1 != 0)
+        {
+            while(d1 <= rgamsq || d1 >= gamsq)
+            {
+                if(flag == 0)
+                {
+                    h11 = 1;
+                    h22 = 1;
+                }
+                else if(flag == 1)
+                {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+
+                if(d1 <= rgamsq)
+                {
+                    d1 *= gamsq;
+                    x1 /= gam;
+                    h11 /= gam;
+                    h12 /= gam;
+                }
+                else
+                {
+                    d1 /= gamsq;
+                    x1 *= gam;
+                    h11 *= gam;
+                    h12 *= gam;
+                }
+            }
+        }
+
+        // rescale d2
+        if(d2 != 0)
+        {
+            while((d2 < 0 ? -d2 : d2) <= rgamsq || (d2 < 0 ? -d2 : d2) >= gamsq)
+            {
+                if(flag == 0)
+                {
+                    h11 = 1;
+                    h22 = 1;
+                }
+                else if(flag == 1)
+                {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+
+                if((d2 < 0 ? -d2 : d2) <= rgamsq)
+                {
+                    d2 *= gamsq;
+                    h21 /= gam;
+                    h22 /= gam;
+                }
+                else
+                {
+                    d2 /= gamsq;
+                    h21 *= gam;
+                    h22 *= gam;
+                }
+            }
+        }
+    }
+
+    if(flag < 0)
+    {
+        param[1] = h11;
+        param[2] = h21;
+        param[3] = h12;
+        param[4] = h22;
+    }
+    else if(flag == 0)
+    {
+        param[2] = h21;
+        param[3] = h12;
+    }
+    else
+    {
+        param[1] = h11;
+        param[4] = h22;
+    }
+    param[0] = flag;
+}
+
+// one thread per transformation of the batch
+template <typename T>
+__global__ void rotmg_kernel(T* d1,
+                             rocblas_int stride_d1,
+                             T* d2,
+                             rocblas_int stride_d2,
+                             T* x1,
+                             rocblas_int stride_x1,
+                             const T* y1,
+                             rocblas_int stride_y1,
+                             T* param,
+                             rocblas_int stride_param,
+                             rocblas_int batch_count)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < batch_count)
+    {
+        rocblas_rotmg_calc(d1[(size_t)tid * stride_d1],
+                           d2[(size_t)tid * stride_d2],
+                           x1[(size_t)tid * stride_x1],
+                           y1[(size_t)tid * stride_y1],
+                           param + (size_t)tid * stride_param);
+    }
+}
+
+/*
+    rotmg of batch_count transformations, computed by the host in host pointer mode and by one
+    thread per transformation in device pointer mode.
+*/
+template <typename T>
+rocblas_status rocblas_rotmg_launch(rocblas_handle handle,
+                                    T* d1,
+                                    rocblas_int stride_d1,
+                                    T* d2,
+                                    rocblas_int stride_d2,
+                                    T* x1,
+                                    rocblas_int stride_x1,
+                                    const T* y1,
+                                    rocblas_int stride_y1,
+                                    T* param,
+                                    rocblas_int stride_param,
+                                    rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(0 == batch_count)
+        return rocblas_status_success;
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        rocblas_int blocks = (batch_count - 1) / NB_X + 1;
+
+        hipStream_t rocblas_stream = handle->rocblas_stream;
+
+        hipLaunchKernelGGL((rotmg_kernel<T>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           d1,
+                           stride_d1,
+                           d2,
+                           stride_d2,
+                           x1,
+                           stride_x1,
+                           y1,
+                           stride_y1,
+                           param,
+                           stride_param,
+                           batch_count);
+    }
+    else // d1, d2, x1, y1 and param are on host
+    {
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            rocblas_rotmg_calc(d1[(size_t)i * stride_d1],
+                               d2[(size_t)i * stride_d2],
+                               x1[(size_t)i * stride_x1],
+                               y1[(size_t)i * stride_y1],
+                               param + (size_t)i * stride_param);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotmg constructs the modified Givens transformation H that zeros the second entry of
+    [sqrt(d1) * x1, sqrt(d2) * y1]
+
+        H * [ x1 ] = [ x1' ]
+            [ y1 ]   [ 0   ] ,
+
+    d1, d2 and x1 are overwritten by the scaled factors and x1', param by the flag and the
+    entries of H, see rotm.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[inout]
+    d1        the scaling factor d1, on the host CPU or device GPU.
+    @param[inout]
+    d2        the scaling factor d2, on the host CPU or device GPU.
+    @param[inout]
+    x1        the scalar x1, on the host CPU or device GPU.
+    @param[in]
+    y1        the scalar y1, on the host CPU or device GPU.
+    @param[out]
+    param     array of 5 values, on the host CPU or device GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status
+rocblas_rotmg_template(rocblas_handle handle, T* d1, T* d2, T* x1, const T* y1, T* param)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotmg"),
+              (const void*&)d1,
+              (const void*&)d2,
+              (const void*&)x1,
+              (const void*&)y1,
+              (const void*&)param);
+
+    log_bench(handle, "./rocblas-bench -f rotmg -r", replaceX<T>("X"));
+
+    if(nullptr == d1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == d2)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == param)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_rotmg_launch<T>(handle, d1, 0, d2, 0, x1, 0, y1, 0, param, 0, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    rotmg_strided_batched constructs batch_count modified Givens transformations, the scalars
+    and params of each start stride_d1, stride_d2, stride_x1, stride_y1 and stride_param
+    elements apart.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_rotmg_strided_batched_template(rocblas_handle handle,
+                                                      T* d1,
+                                                      rocblas_int stride_d1,
+                                                      T* d2,
+                                                      rocblas_int stride_d2,
+                                                      T* x1,
+                                                      rocblas_int stride_x1,
+                                                      const T* y1,
+                                                      rocblas_int stride_y1,
+                                                      T* param,
+                                                      rocblas_int stride_param,
+                                                      rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xrotmg_strided_batched"),
+              (const void*&)d1,
+              stride_d1,
+              (const void*&)d2,
+              stride_d2,
+              (const void*&)x1,
+              stride_x1,
+              (const void*&)y1,
+              stride_y1,
+              (const void*&)param,
+              stride_param,
+              batch_count);
+
+    log_bench(
+        handle, "./rocblas-bench -f rotmg_batched -r", replaceX<T>("X"), "--batch", batch_count);
+
+    if(nullptr == d1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == d2)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y1)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == param)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_rotmg_launch<T>(handle,
+                                   d1,
+                                   stride_d1,
+                                   d2,
+                                   stride_d2,
+                                   x1,
+                                   stride_x1,
+                                   y1,
+                                   stride_y1,
+                                   param,
+                                   stride_param,
+                                   batch_count);
+}
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_srotmg(
+    rocblas_handle handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+{
+    return rocblas_rotmg_template<float>(handle, d1, d2, x1, y1, param);
+}
+
+extern "C" rocblas_status rocblas_drotmg(
+    rocblas_handle handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+{
+    return rocblas_rotmg_template<double>(handle, d1, d2, x1, y1, param);
+}
+
+extern "C" rocblas_status rocblas_srotmg_strided_batched(rocblas_handle handle,
+                                                         float* d1,
+                                                         rocblas_int stride_d1,
+                                                         float* d2,
+                                                         rocblas_int stride_d2,
+                                                         float* x1,
+                                                         rocblas_int stride_x1,
+                                                         const float* y1,
+                                                         rocblas_int stride_y1,
+                                                         float* param,
+                                                         rocblas_int stride_param,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_rotmg_strided_batched_template<float>(handle,
+                                                         d1,
+                                                         stride_d1,
+                                                         d2,
+                                                         stride_d2,
+                                                         x1,
+                                                         stride_x1,
+                                                         y1,
+                                                         stride_y1,
+                                                         param,
+                                                         stride_param,
+                                                         batch_count);
+}
+
+extern "C" rocblas_status rocblas_drotmg_strided_batched(rocblas_handle handle,
+                                                         double* d1,
+                                                         rocblas_int stride_d1,
+                                                         double* d2,
+                                                         rocblas_int stride_d2,
+                                                         double* x1,
+                                                         rocblas_int stride_x1,
+                                                         const double* y1,
+                                                         rocblas_int stride_y1,
+                                                         double* param,
+                                                         rocblas_int stride_param,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_rotmg_strided_batched_template<double>(handle,
+                                                          d1,
+                                                          stride_d1,
+                                                          d2,
+                                                          stride_d2,
+                                                          x1,
+                                                          stride_x1,
+                                                          y1,
+                                                          stride_y1,
+                                                          param,
+                                                          stride_param,
+                                                          batch_count);
+}
@@ -7,15 +7,20 @@
 #include "rocblas.h"
 
 #include "definitions.h"
+#include "device_template.h"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
 
 #define NB_X 256
 
-template <typename T>
-__global__ void scal_kernel_host_scalar(rocblas_int n, const T alpha, T* x, rocblas_int incx)
+// hipBlockIdx_y picks the vector of the batch, alpha is shared by all of them
+template <typename T, typename U>
+__global__ void
+scal_kernel_host_scalar(rocblas_int n, const T alpha, U xa, rocblas_int incx, rocblas_int bsx)
 {
+    T* x = load_batch_ptr(xa, bsx);
+
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     // bound
     if(tid < n)
@@ -24,9 +29,12 @@ __global__ void scal_kernel_host_scalar(rocblas_int n, const T alpha, T* x, rocb
     }
 }
 
-template <typename T>
-__global__ void scal_kernel_device_scalar(rocblas_int n, const T* alpha, T* x, rocblas_int incx)
+template <typename T, typename U>
+__global__ void
+scal_kernel_device_scalar(rocblas_int n, const T* alpha, U xa, rocblas_int incx, rocblas_int bsx)
 {
+    T* x = load_batch_ptr(xa, bsx);
+
     rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     // bound
     if(tid < n)
@@ -35,6 +43,68 @@ __global__ void scal_kernel_device_scalar(rocblas_int n, const T* alpha, T* x, r
     }
 }
 
+/*
+    scal of batch_count vectors, the grid is blocks by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID vectors. U is T* for strided vectors (a single vector is a strided
+    batch of one) or T* const* for an array of pointers.
+*/
+template <typename T, typename U>
+rocblas_status rocblas_scal_launch(rocblas_handle handle,
+                                   rocblas_int n,
+                                   const T* alpha,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   rocblas_int batch_count)
+{
+    // Quick return if possible. Not Argument error
+    if(n <= 0 || incx <= 0 || 0 == batch_count)
+        return rocblas_status_success;
+
+    rocblas_int blocks = (n - 1) / NB_X + 1;
+
+    dim3 threads(NB_X, 1, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // alpha is on the host in host pointer mode
+    T scalar = rocblas_pointer_mode_host == handle->pointer_mode ? *alpha : T(0);
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            hipLaunchKernelGGL((scal_kernel_device_scalar<T, U>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx);
+        }
+        else
+        {
+            hipLaunchKernelGGL((scal_kernel_host_scalar<T, U>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
 /*! \brief BLAS Level 1 API
 
     \details
@@ -90,8 +160,239 @@ rocblas_scal_template(rocblas_handle handle, rocblas_int n, const T* alpha, T* x
     if(nullptr == alpha)
         return rocblas_status_invalid_pointer;
 
+    return rocblas_scal_launch<T>(handle, n, alpha, x, incx, 0, 1);
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    scal_strided_batched and scal_batched scale batch_count vectors x_i with the same scalar
+    alpha in one call
+
+        x_i := alpha * x_i ,
+
+    the vectors of scal_strided_batched start bsx elements apart, the vectors of scal_batched
+    are given by an array of batch_count device pointers on the GPU.
+
+    ********************************************************************/
+
+template <class T>
+rocblas_status rocblas_scal_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_int n,
+                                                     const T* alpha,
+                                                     T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_strided_batched"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocblas-bench -f scal_batched -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--incx",
+                  incx,
+                  "--alpha",
+                  *alpha,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_strided_batched"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  batch_count);
+    }
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_scal_launch<T>(handle, n, alpha, x, incx, bsx, batch_count);
+}
+
+template <class T>
+rocblas_status rocblas_scal_batched_template(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const T* alpha,
+                                             T* const* x,
+                                             rocblas_int incx,
+                                             rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_batched"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocblas-bench -f scal_batched -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--incx",
+                  incx,
+                  "--alpha",
+                  *alpha,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_batched"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  batch_count);
+    }
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    return rocblas_scal_launch<T>(handle, n, alpha, x, incx, 0, batch_count);
+}
+
+/*
+    fused copy and scal: y is written once from x, instead of copied from x and then read and
+    written again by scal. A is T for a host scalar or const T* for a device scalar.
+*/
+template <typename T, typename A>
+__global__ void scal_copy_kernel(
+    rocblas_int n, A alpha, const T* x, rocblas_int incx, T* y, rocblas_int incy)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    // bound
+    if(tid < n)
+    {
+        y[tid * incy] = load_scalar(alpha) * x[tid * incx];
+    }
+}
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    scal_copy writes the scaled vector x to y in one pass
+
+        y := alpha * x ,
+
+    the result of copy followed by scal on y, without reading y.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    n         rocblas_int.
+              quick return if n <= 0.
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[out]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+template <class T>
+rocblas_status rocblas_scal_copy_template(rocblas_handle handle,
+                                          rocblas_int n,
+                                          const T* alpha,
+                                          const T* x,
+                                          rocblas_int incx,
+                                          T* y,
+                                          rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_copy"),
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy);
+
+        log_bench(handle,
+                  "./rocblas-bench -f scal_copy -r",
+                  replaceX<T>("X"),
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xscal_copy"),
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy);
+    }
+
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+
     // Quick return if possible. Not Argument error
-    if(n <= 0 || incx <= 0)
+    if(n <= 0)
         return rocblas_status_success;
 
     rocblas_int blocks = (n - 1) / NB_X + 1;
@@ -103,39 +404,198 @@ rocblas_scal_template(rocblas_handle handle, rocblas_int n, const T* alpha, T* x
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        hipLaunchKernelGGL(scal_kernel_device_scalar,
-                           dim3(blocks),
+        hipLaunchKernelGGL((scal_copy_kernel<T, const T*>),
+                           dim3(grid),
                            dim3(threads),
                            0,
                            rocblas_stream,
                            n,
                            alpha,
                            x,
-                           incx);
+                           incx,
+                           y,
+                           incy);
     }
     else // alpha is on host
     {
         T scalar = *alpha;
-        hipLaunchKernelGGL(scal_kernel_host_scalar,
-                           dim3(blocks),
+        hipLaunchKernelGGL((scal_copy_kernel<T, T>),
+                           dim3(grid),
                            dim3(threads),
                            0,
                            rocblas_stream,
                            n,
                            scalar,
                            x,
-                           incx);
+                           incx,
+                           y,
+                           incy);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    hscal of a contiguous vector aligned to half8, as haxpy_mlt_8_*: each thread scales 8
+    elements with one half8 load and store and half2 arithmetic, hscal_mod_8_kernel scales the
+    n mod 8 elements left. A is __fp16 for a host scalar or const __fp16* for a device scalar.
+*/
+template <typename A>
+__global__ void hscal_mlt_8_kernel(rocblas_int n_mlt_8, A alpha, half8* x)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    half2 alpha_h2;
+    alpha_h2[0] = load_scalar(alpha);
+    alpha_h2[1] = load_scalar(alpha);
+
+    half2 x0, x1, x2, x3;
+
+    if(tid * 8 < n_mlt_8)
+    {
+        half8 x8 = x[tid];
+
+        x0[0] = x8[0];
+        x0[1] = x8[1];
+        x1[0] = x8[2];
+        x1[1] = x8[3];
+        x2[0] = x8[4];
+        x2[1] = x8[5];
+        x3[0] = x8[6];
+        x3[1] = x8[7];
+
+        x0 = alpha_h2 * x0;
+        x1 = alpha_h2 * x1;
+        x2 = alpha_h2 * x2;
+        x3 = alpha_h2 * x3;
+
+        x8[0] = x0[0];
+        x8[1] = x0[1];
+        x8[2] = x1[0];
+        x8[3] = x1[1];
+        x8[4] = x2[0];
+        x8[5] = x2[1];
+        x8[6] = x3[0];
+        x8[7] = x3[1];
+
+        x[tid] = x8;
+    }
+}
+
+template <typename A>
+__global__ void hscal_mod_8_kernel(rocblas_int n, A alpha, __fp16* x)
+{
+    rocblas_int index = ((n / 8) * 8) + hipThreadIdx_x;
+
+    if(index < n)
+        x[index] = load_scalar(alpha) * x[index];
+}
+
+// hscal of a non-empty contiguous vector aligned to half8
+template <typename A>
+rocblas_status rocblas_hscal_launch(rocblas_handle handle, rocblas_int n, A alpha, rocblas_half* x)
+{
+    rocblas_int n_mlt_8 = (n / 8) * 8; // multiple of 8
+    rocblas_int n_mod_8 = n - n_mlt_8; // n mod 8
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(0 != n_mlt_8)
+    {
+        rocblas_int blocks = ((n / 8) - 1) / NB_X + 1;
+
+        hipLaunchKernelGGL((hscal_mlt_8_kernel<A>),
+                           dim3(blocks),
+                           dim3(NB_X),
+                           0,
+                           rocblas_stream,
+                           n_mlt_8,
+                           alpha,
+                           (half8*)x);
+    }
+
+    if(0 != n_mod_8) // cleanup non-multiple of 8
+    {
+        hipLaunchKernelGGL((hscal_mod_8_kernel<A>),
+                           dim3(1),
+                           dim3(n_mod_8),
+                           0,
+                           rocblas_stream,
+                           n,
+                           alpha,
+                           (__fp16*)x);
     }
 
     return rocblas_status_success;
 }
 
+/*! \brief BLAS Level 1 API
+
+    \details
+    hscal scales the rocblas_half vector x with scalar alpha
+
+        x := alpha * x ,
+
+    in the half8 loads and stores and half2 arithmetic of haxpy if x is contiguous.
+
+    ********************************************************************/
+
+rocblas_status rocblas_scal_half(rocblas_handle handle,
+                                 rocblas_int n,
+                                 const rocblas_half* alpha,
+                                 rocblas_half* x,
+                                 rocblas_int incx)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        float h_alpha = *reinterpret_cast<const __fp16*>(alpha);
+
+        log_trace(handle, "rocblas_hscal", n, h_alpha, (const void*&)x, incx);
+
+        log_bench(
+            handle, "./rocblas-bench -f scal -r h", "-n", n, "--incx", incx, "--alpha", h_alpha);
+    }
+    else
+    {
+        log_trace(handle, "rocblas_hscal", n, (const void*&)alpha, (const void*&)x, incx);
+    }
+
+    if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+
+    // Quick return if possible. Not Argument error
+    if(n <= 0 || incx <= 0)
+        return rocblas_status_success;
+
+    if(1 != incx || 0 != (uintptr_t)x % sizeof(half8)) // no half8 or half2
+        return rocblas_scal_launch<__fp16>(handle, n, (const __fp16*)alpha, (__fp16*)x, incx, 0, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        return rocblas_hscal_launch(handle, n, (const __fp16*)alpha, x);
+    else
+        return rocblas_hscal_launch(handle, n, *reinterpret_cast<const __fp16*>(alpha), x);
+}
+
 /*
  * ===========================================================================
  *    C wrapper
  * ===========================================================================
  */
 
+extern "C" rocblas_status rocblas_hscal(rocblas_handle handle,
+                                        rocblas_int n,
+                                        const rocblas_half* alpha,
+                                        rocblas_half* x,
+                                        rocblas_int incx)
+{
+    return rocblas_scal_half(handle, n, alpha, x, incx);
+}
+
 extern "C" rocblas_status
 rocblas_sscal(rocblas_handle handle, rocblas_int n, const float* alpha, float* x, rocblas_int incx)
 {
@@ -165,3 +625,69 @@ extern "C" rocblas_status rocblas_zscal(rocblas_handle handle,
 {
     return rocblas_scal_template<rocblas_double_complex>(handle, n, alpha, x, incx);
 }
+
+extern "C" rocblas_status rocblas_sscal_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const float* alpha,
+                                                        float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_scal_strided_batched_template<float>(
+        handle, n, alpha, x, incx, bsx, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dscal_strided_batched(rocblas_handle handle,
+                                                        rocblas_int n,
+                                                        const double* alpha,
+                                                        double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_scal_strided_batched_template<double>(
+        handle, n, alpha, x, incx, bsx, batch_count);
+}
+
+extern "C" rocblas_status rocblas_sscal_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const float* alpha,
+                                                float* const x[],
+                                                rocblas_int incx,
+                                                rocblas_int batch_count)
+{
+    return rocblas_scal_batched_template<float>(handle, n, alpha, x, incx, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dscal_batched(rocblas_handle handle,
+                                                rocblas_int n,
+                                                const double* alpha,
+                                                double* const x[],
+                                                rocblas_int incx,
+                                                rocblas_int batch_count)
+{
+    return rocblas_scal_batched_template<double>(handle, n, alpha, x, incx, batch_count);
+}
+
+extern "C" rocblas_status rocblas_sscal_copy(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const float* alpha,
+                                             const float* x,
+                                             rocblas_int incx,
+                                             float* y,
+                                             rocblas_int incy)
+{
+    return rocblas_scal_copy_template<float>(handle, n, alpha, x, incx, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dscal_copy(rocblas_handle handle,
+                                             rocblas_int n,
+                                             const double* alpha,
+                                             const double* x,
+                                             rocblas_int incx,
+                                             double* y,
+                                             rocblas_int incy)
+{
+    return rocblas_scal_copy_template<double>(handle, n, alpha, x, incx, y, incy);
+}
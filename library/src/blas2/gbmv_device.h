@@ -0,0 +1,95 @@
+/*
+ * ===========================================================================
+ *    This file provide common device function for gbmv and sbmv routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+#include "../blas1/device_template.h"
+
+/*
+    sum over the band of one NB wide block of outputs, thread tx of block hipBlockIdx_x owns
+    output o = hipBlockIdx_x * NB + tx:
+        trans == false:  sum_j A(o, j) * x(j)   (row o of A * x)
+        trans == true:   sum_i A(i, o) * x(i)   (column o of A^T * x)
+
+    The band format stores A(i, j) at A[ku + i - j + j * lda], i.e. band row d = ku + i - j of
+    column j. Read directly, thread o would touch column o + ku - d (or o) of the band array, so
+    consecutive threads would be lda elements apart. Instead the band rows are taken DC at a time:
+    the block loads the DC x width tile of the band array it needs into shared memory with the
+    band row fastest, every column of the tile is DC consecutive elements of A, and then reads
+    the tile along its diagonals. The x reads x(o + ku - d) (or x(o + d - ku)) are consecutive
+    over the block as they are.
+
+    Band rows d == d_skip are left out of the sum, sbmv uses it for the diagonal of its second
+    pass. Elements of the band array that do not belong to the m by n matrix are never read.
+*/
+template <typename T, rocblas_int NB, rocblas_int DC>
+static __device__ T gbmv_band_sum(bool trans,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  rocblas_int kl,
+                                  rocblas_int ku,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  rocblas_int d_skip)
+{
+    // odd row length, the loads write down the columns of the tile
+    __shared__ T sA[DC][NB + DC + 1];
+
+    rocblas_int tx    = hipThreadIdx_x;
+    rocblas_int o     = hipBlockIdx_x * NB + tx;
+    rocblas_int width = trans ? NB : NB + DC - 1;
+
+    T sum = 0.0;
+
+    for(rocblas_int d0 = 0; d0 <= kl + ku; d0 += DC)
+    {
+        // first column of the band array used by the block for band rows d0 .. d0 + DC - 1
+        rocblas_int jbase = trans ? o - tx : o - tx + ku - d0 - (DC - 1);
+
+        for(rocblas_int e = tx; e < DC * width; e += NB)
+        {
+            rocblas_int dd = e % DC;
+            rocblas_int jj = e / DC;
+            rocblas_int d  = d0 + dd;
+            rocblas_int j  = jbase + jj;
+            rocblas_int i  = j + d - ku;
+
+            bool in_band = d <= kl + ku && j >= 0 && j < n && i >= 0 && i < m;
+
+            sA[dd][jj] = in_band ? A[d + j * lda] : 0.0;
+        }
+
+        __syncthreads();
+
+        for(rocblas_int dd = 0; dd < DC; dd++)
+        {
+            rocblas_int d = d0 + dd;
+            if(d > kl + ku)
+                break;
+            if(d == d_skip)
+                continue;
+
+            if(trans)
+            {
+                rocblas_int i = o + d - ku;
+                if(i >= 0 && i < m)
+                    sum += sA[dd][tx] * x[i * incx];
+            }
+            else
+            {
+                rocblas_int j = o + ku - d;
+                if(j >= 0 && j < n)
+                    sum += sA[dd][tx + DC - 1 - dd] * x[j * incx];
+            }
+        }
+
+        __syncthreads();
+    }
+
+    return sum;
+}
@@ -262,3 +262,86 @@ static __device__ void gemvc_device(rocblas_int m,
         }
     }
 }
+
+/*
+    y := alpha * A**T * x + beta * y for m <= MAX_M, a thread per column: the m elements of a
+    column are too few for the threads of a block, x is read once per block into shared memory.
+*/
+template <typename T, const rocblas_int NB_X, const rocblas_int MAX_M>
+static __device__ void gemvt_thread_column_device(rocblas_int m,
+                                                  rocblas_int n,
+                                                  T alpha,
+                                                  const T* __restrict__ A,
+                                                  rocblas_int lda,
+                                                  const T* __restrict__ x,
+                                                  rocblas_int incx,
+                                                  T beta,
+                                                  T* y,
+                                                  rocblas_int incy)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int col = hipBlockIdx_x * NB_X + tx;
+
+    __shared__ T sx[MAX_M];
+
+    for(rocblas_int i = tx; i < m; i += NB_X)
+    {
+        sx[i] = incx >= 0 ? x[i * incx] : x[(1 - m + i) * incx];
+    }
+
+    __syncthreads();
+
+    if(col < n)
+    {
+        A += (size_t)col * lda;
+
+        T res = 0.0;
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            res += A[i] * sx[i];
+        }
+
+        if(incy >= 0)
+        {
+            y[col * incy] = alpha * res + beta * y[col * incy];
+        }
+        else
+        {
+            y[(1 - n + col) * incy] = alpha * res + beta * y[(1 - n + col) * incy];
+        }
+    }
+}
+
+/*
+    y := alpha * (sum of the split partial results in W) + beta * y, W is len by split, a thread
+    per element of y
+*/
+template <typename T>
+static __device__ void gemv_sum_device(rocblas_int len,
+                                       rocblas_int split,
+                                       T alpha,
+                                       const T* __restrict__ W,
+                                       T beta,
+                                       T* y,
+                                       rocblas_int incy)
+{
+    rocblas_int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < len)
+    {
+        T res = 0.0;
+        for(rocblas_int b = 0; b < split; b++)
+        {
+            res += W[tid + (size_t)b * len];
+        }
+
+        if(incy >= 0)
+        {
+            y[tid * incy] = alpha * res + beta * y[tid * incy];
+        }
+        else
+        {
+            y[(1 - len + tid) * incy] = alpha * res + beta * y[(1 - len + tid) * incy];
+        }
+    }
+}
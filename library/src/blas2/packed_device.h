@@ -0,0 +1,120 @@
+/*
+ * ===========================================================================
+ *    This file provide common device function for packed (spmv, spr, spr2, tpmv,
+ *    tpsv, tpttr) routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+#include "../blas1/device_template.h"
+
+/*
+    closed form start of column j of a packed triangle, A(i, j) is at AP[i + packed_offset(j)]:
+        upper:  columns 0 .. j - 1 hold 1 + 2 + ... + j elements,
+        lower:  columns 0 .. j - 1 hold n + (n - 1) + ... + (n - j + 1) elements, less the j
+                rows above the diagonal that column j does not store.
+    Computed in size_t, j * (2n - j - 1) overflows rocblas_int long before the packed size does.
+*/
+static __device__ size_t packed_offset(bool upper, rocblas_int n, rocblas_int j)
+{
+    return upper ? (size_t)j * (j + 1) / 2 : (size_t)j * (2 * n - j - 1) / 2;
+}
+
+/*
+    loads the NB x NB tile sA[r][c] = B(i0 + r, j0 + c) of an n by n matrix B given by the packed
+    triangle AP, with hipBlockDim_x == NB:
+        sym == true:   B is the symmetric matrix of the stored triangle,
+        sym == false:  B = op(A) of the triangular matrix A, zero outside its triangle and one on
+                       its diagonal when unit.
+    Elements outside of B are zero.
+
+    B(i, j) is the stored element A(p, q) at AP[p + packed_offset(q)], consecutive in p. Off the
+    diagonal p is the row of the tile for all its elements or the column for all of them, and
+    thread tx walks that direction, so every load instruction of the block reads NB consecutive
+    elements of one column of the triangle. sA has an odd row length, writes and the row reads
+    of packed_tile_sum are free of bank conflicts either way.
+*/
+template <typename T, rocblas_int NB>
+static __device__ void packed_load_tile(bool upper,
+                                        bool sym,
+                                        bool trans,
+                                        bool unit,
+                                        rocblas_int n,
+                                        const T* AP,
+                                        rocblas_int i0,
+                                        rocblas_int j0,
+                                        T sA[][NB + 1])
+{
+    rocblas_int tx = hipThreadIdx_x;
+
+    // p is the row of B unless B is transposed, or it is symmetric and the tile lies in the
+    // triangle that is not stored
+    bool row_fast = sym ? i0 == j0 || (upper ? i0 < j0 : i0 > j0) : !trans;
+
+    for(rocblas_int k = 0; k < NB; k++)
+    {
+        rocblas_int r = row_fast ? tx : k;
+        rocblas_int c = row_fast ? k : tx;
+        rocblas_int i = i0 + r;
+        rocblas_int j = j0 + c;
+
+        T a = 0.0;
+        if(i < n && j < n)
+        {
+            rocblas_int p = trans ? j : i;
+            rocblas_int q = trans ? i : j;
+            bool stored   = upper ? p <= q : p >= q;
+            if(sym && !stored)
+            {
+                p      = j;
+                q      = i;
+                stored = true;
+            }
+
+            if(stored)
+                a = (p == q && unit) ? 1.0 : AP[p + packed_offset(upper, n, q)];
+        }
+        sA[r][c] = a;
+    }
+}
+
+/*
+    sum over the tiles j0 = jbegin, jbegin + NB, ... < jend of B(i0 + tx, j) * x(j), B as in
+    packed_load_tile. The x used by a tile is staged in shared memory next to it.
+*/
+template <typename T, rocblas_int NB>
+static __device__ T packed_tile_sum(bool upper,
+                                    bool sym,
+                                    bool trans,
+                                    bool unit,
+                                    rocblas_int n,
+                                    const T* AP,
+                                    const T* x,
+                                    rocblas_int incx,
+                                    rocblas_int i0,
+                                    rocblas_int jbegin,
+                                    rocblas_int jend)
+{
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sx[NB];
+
+    rocblas_int tx = hipThreadIdx_x;
+
+    T sum = 0.0;
+
+    for(rocblas_int j0 = jbegin; j0 < jend; j0 += NB)
+    {
+        packed_load_tile<T, NB>(upper, sym, trans, unit, n, AP, i0, j0, sA);
+        sx[tx] = j0 + tx < n ? x[(j0 + tx) * incx] : 0.0;
+
+        __syncthreads();
+
+        for(rocblas_int c = 0; c < NB; c++)
+            sum += sA[tx][c] * sx[c];
+
+        __syncthreads();
+    }
+
+    return sum;
+}
@@ -0,0 +1,824 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "gbmv_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define GBMV_NB 128
+
+/*
+    hipBlockIdx_y picks the problem of the batch. U and V are const T* and T* for strided
+    batches or const T* const* and T* const* for arrays of pointers, S is T for scalars passed
+    by value from the host or const T* for scalars on the device.
+*/
+template <typename T, rocblas_int NB, rocblas_int DC, typename U, typename V, typename S>
+__global__ void gbmv_kernel(rocblas_operation transA,
+                            rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int kl,
+                            rocblas_int ku,
+                            S alpha_s,
+                            U Aa,
+                            rocblas_int lda,
+                            rocblas_int bsa,
+                            U xa,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            S beta_s,
+                            V ya,
+                            rocblas_int incy,
+                            rocblas_int bsy)
+{
+    const T* A = load_batch_ptr(Aa, bsa);
+    const T* x = load_batch_ptr(xa, bsx);
+    T* y       = load_batch_ptr(ya, bsy);
+    T alpha    = load_scalar(alpha_s);
+    T beta     = load_scalar(beta_s);
+
+    bool trans       = transA != rocblas_operation_none;
+    rocblas_int lenx = trans ? m : n;
+    rocblas_int leny = trans ? n : m;
+
+    if(incx < 0)
+        x -= (lenx - 1) * incx;
+    if(incy < 0)
+        y -= (leny - 1) * incy;
+
+    // A and x are not referenced when alpha == 0, alpha is the same for the whole block
+    T sum = 0.0;
+    if(alpha != 0.0)
+        sum = gbmv_band_sum<T, NB, DC>(trans, m, n, kl, ku, A, lda, x, incx, -1);
+
+    rocblas_int o = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(o < leny)
+    {
+        // y is not read when beta == 0
+        if(beta == 0.0)
+            y[o * incy] = alpha * sum;
+        else
+            y[o * incy] = alpha * sum + beta * y[o * incy];
+    }
+}
+
+// the grid is blocks of outputs by batch_count, in chunks of at most ROCBLAS_MAX_BATCH_GRID
+// problems
+template <typename T, rocblas_int DC, typename U, typename V, typename S>
+void gbmv_launch_kernel(hipStream_t rocblas_stream,
+                        rocblas_int blocks,
+                        rocblas_operation transA,
+                        rocblas_int m,
+                        rocblas_int n,
+                        rocblas_int kl,
+                        rocblas_int ku,
+                        S alpha,
+                        U A,
+                        rocblas_int lda,
+                        rocblas_int bsa,
+                        U x,
+                        rocblas_int incx,
+                        rocblas_int bsx,
+                        S beta,
+                        V y,
+                        rocblas_int incy,
+                        rocblas_int bsy,
+                        rocblas_int batch_count)
+{
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((gbmv_kernel<T, GBMV_NB, DC, U, V, S>),
+                           grid,
+                           dim3(GBMV_NB),
+                           0,
+                           rocblas_stream,
+                           transA,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           alpha,
+                           batch_offset(A, bsa, b0),
+                           lda,
+                           bsa,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           beta,
+                           batch_offset(y, bsy, b0),
+                           incy,
+                           bsy);
+    }
+}
+
+/*
+    gbmv of batch_count problems, the grid is blocks of outputs by batch_count in chunks of at
+    most ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
+template <typename T, typename U, typename V>
+rocblas_status rocblas_gbmv_launch(rocblas_handle handle,
+                                   rocblas_operation transA,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int kl,
+                                   rocblas_int ku,
+                                   const T* alpha,
+                                   U A,
+                                   rocblas_int lda,
+                                   rocblas_int bsa,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   const T* beta,
+                                   V y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   rocblas_int batch_count)
+{
+    if(m < 0 || n < 0 || kl < 0 || ku < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < kl + ku + 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx || 0 == incy)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == m || 0 == n || 0 == batch_count)
+    {
+        return rocblas_status_success;
+    }
+
+    rocblas_int leny   = transA == rocblas_operation_none ? m : n;
+    rocblas_int blocks = (leny - 1) / GBMV_NB + 1;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // a narrow band takes all its band rows in one step of a short tile
+    bool narrow = kl + ku + 1 <= 4;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(narrow)
+            gbmv_launch_kernel<T, 4>(rocblas_stream,
+                                     blocks,
+                                     transA,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     bsa,
+                                     x,
+                                     incx,
+                                     bsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     bsy,
+                                     batch_count);
+        else
+            gbmv_launch_kernel<T, 16>(rocblas_stream,
+                                      blocks,
+                                      transA,
+                                      m,
+                                      n,
+                                      kl,
+                                      ku,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      x,
+                                      incx,
+                                      bsx,
+                                      beta,
+                                      y,
+                                      incy,
+                                      bsy,
+                                      batch_count);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+
+        if(0.0 == h_alpha && 1.0 == h_beta)
+        {
+            return rocblas_status_success;
+        }
+
+        if(narrow)
+            gbmv_launch_kernel<T, 4>(rocblas_stream,
+                                     blocks,
+                                     transA,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     h_alpha,
+                                     A,
+                                     lda,
+                                     bsa,
+                                     x,
+                                     incx,
+                                     bsx,
+                                     h_beta,
+                                     y,
+                                     incy,
+                                     bsy,
+                                     batch_count);
+        else
+            gbmv_launch_kernel<T, 16>(rocblas_stream,
+                                      blocks,
+                                      transA,
+                                      m,
+                                      n,
+                                      kl,
+                                      ku,
+                                      h_alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      x,
+                                      incx,
+                                      bsx,
+                                      h_beta,
+                                      y,
+                                      incy,
+                                      bsy,
+                                      batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xGBMV performs the matrix-vector operation
+
+        y := alpha*op(A)*x + beta*y,
+
+    where alpha and beta are scalars, x and y are vectors and A is an m by n band matrix with
+    kl sub-diagonals and ku super-diagonals, op(A) = A or op(A) = A^T.
+
+    A is given in band storage, A(i, j) is at A[ku + i - j + j * lda]. Each block of GBMV_NB
+    outputs stages the band rows it needs in shared memory, so every load of A is a run of
+    consecutive elements of one column of the band array.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    m         rocblas_int
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    kl        rocblas_int
+              number of sub-diagonals of A.
+    @param[in]
+    ku        rocblas_int
+              number of super-diagonals of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= kl + ku + 1.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_gbmv_template(rocblas_handle handle,
+                                     rocblas_operation transA,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* beta,
+                                     T* y,
+                                     rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy);
+
+        std::string transA_letter = rocblas_transpose_letter(transA);
+
+        log_bench(handle,
+                  "./rocblas-bench -f gbmv -r",
+                  replaceX<T>("X"),
+                  "--transposeA",
+                  transA_letter,
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--kl",
+                  kl,
+                  "--ku",
+                  ku,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy);
+    }
+
+    if(transA != rocblas_operation_none && transA != rocblas_operation_transpose &&
+       transA != rocblas_operation_conjugate_transpose)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_gbmv_launch<T>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    gbmv_strided_batched and gbmv_batched compute batch_count band matrix-vector products with
+    the same scalars alpha and beta in one call
+
+        y_i := alpha*op(A_i)*x_i + beta*y_i
+
+    the band matrices (vectors) of gbmv_strided_batched start bsa (bsx, bsy) elements apart, the
+    ones of gbmv_batched are given by arrays of batch_count device pointers on the GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_gbmv_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_operation transA,
+                                                     rocblas_int m,
+                                                     rocblas_int n,
+                                                     rocblas_int kl,
+                                                     rocblas_int ku,
+                                                     const T* alpha,
+                                                     const T* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     const T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     const T* beta,
+                                                     T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv_strided_batched"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  *beta,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
+
+        std::string transA_letter = rocblas_transpose_letter(transA);
+
+        log_bench(handle,
+                  "./rocblas-bench -f gbmv_batched -r",
+                  replaceX<T>("X"),
+                  "--transposeA",
+                  transA_letter,
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--kl",
+                  kl,
+                  "--ku",
+                  ku,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv_strided_batched"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
+    }
+
+    if(transA != rocblas_operation_none && transA != rocblas_operation_transpose &&
+       transA != rocblas_operation_conjugate_transpose)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_gbmv_launch<T>(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  kl,
+                                  ku,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  bsa,
+                                  x,
+                                  incx,
+                                  bsx,
+                                  beta,
+                                  y,
+                                  incy,
+                                  bsy,
+                                  batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_gbmv_batched_template(rocblas_handle handle,
+                                             rocblas_operation transA,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int kl,
+                                             rocblas_int ku,
+                                             const T* alpha,
+                                             const T* const* A,
+                                             rocblas_int lda,
+                                             const T* const* x,
+                                             rocblas_int incx,
+                                             const T* beta,
+                                             T* const* y,
+                                             rocblas_int incy,
+                                             rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv_batched"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
+
+        std::string transA_letter = rocblas_transpose_letter(transA);
+
+        log_bench(handle,
+                  "./rocblas-bench -f gbmv_batched -r",
+                  replaceX<T>("X"),
+                  "--transposeA",
+                  transA_letter,
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--kl",
+                  kl,
+                  "--ku",
+                  ku,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xgbmv_batched"),
+                  transA,
+                  m,
+                  n,
+                  kl,
+                  ku,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
+    }
+
+    if(transA != rocblas_operation_none && transA != rocblas_operation_transpose &&
+       transA != rocblas_operation_conjugate_transpose)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_gbmv_launch<T>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, 0, x, incx, 0, beta, y, incy, 0, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_sgbmv(rocblas_handle handle,
+                                        rocblas_operation transA,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int kl,
+                                        rocblas_int ku,
+                                        const float* alpha,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* beta,
+                                        float* y,
+                                        rocblas_int incy)
+{
+    return rocblas_gbmv_template<float>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dgbmv(rocblas_handle handle,
+                                        rocblas_operation transA,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int kl,
+                                        rocblas_int ku,
+                                        const double* alpha,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* beta,
+                                        double* y,
+                                        rocblas_int incy)
+{
+    return rocblas_gbmv_template<double>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_sgbmv_strided_batched(rocblas_handle handle,
+                                                        rocblas_operation transA,
+                                                        rocblas_int m,
+                                                        rocblas_int n,
+                                                        rocblas_int kl,
+                                                        rocblas_int ku,
+                                                        const float* alpha,
+                                                        const float* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const float* beta,
+                                                        float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_gbmv_strided_batched_template<float>(handle,
+                                                        transA,
+                                                        m,
+                                                        n,
+                                                        kl,
+                                                        ku,
+                                                        alpha,
+                                                        A,
+                                                        lda,
+                                                        bsa,
+                                                        x,
+                                                        incx,
+                                                        bsx,
+                                                        beta,
+                                                        y,
+                                                        incy,
+                                                        bsy,
+                                                        batch_count);
+}
+
+extern "C" rocblas_status rocblas_dgbmv_strided_batched(rocblas_handle handle,
+                                                        rocblas_operation transA,
+                                                        rocblas_int m,
+                                                        rocblas_int n,
+                                                        rocblas_int kl,
+                                                        rocblas_int ku,
+                                                        const double* alpha,
+                                                        const double* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const double* beta,
+                                                        double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_gbmv_strided_batched_template<double>(handle,
+                                                         transA,
+                                                         m,
+                                                         n,
+                                                         kl,
+                                                         ku,
+                                                         alpha,
+                                                         A,
+                                                         lda,
+                                                         bsa,
+                                                         x,
+                                                         incx,
+                                                         bsx,
+                                                         beta,
+                                                         y,
+                                                         incy,
+                                                         bsy,
+                                                         batch_count);
+}
+
+extern "C" rocblas_status rocblas_sgbmv_batched(rocblas_handle handle,
+                                                rocblas_operation transA,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int kl,
+                                                rocblas_int ku,
+                                                const float* alpha,
+                                                const float* const A[],
+                                                rocblas_int lda,
+                                                const float* const x[],
+                                                rocblas_int incx,
+                                                const float* beta,
+                                                float* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_gbmv_batched_template<float>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dgbmv_batched(rocblas_handle handle,
+                                                rocblas_operation transA,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int kl,
+                                                rocblas_int ku,
+                                                const double* alpha,
+                                                const double* const A[],
+                                                rocblas_int lda,
+                                                const double* const x[],
+                                                rocblas_int incx,
+                                                const double* beta,
+                                                double* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_gbmv_batched_template<double>(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
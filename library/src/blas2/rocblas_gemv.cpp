@@ -8,10 +8,14 @@
 #include "status.h"
 #include "definitions.h"
 #include "gemv_device.h"
+#include "gemv_select.h"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
 
+#define GEMVC_NB 256
+#define GEMV_SUM_NB 256
+
 template <typename T, const rocblas_int NB_X, const rocblas_int NB_Y>
 __global__ void gemvn_kernel_host_pointer(rocblas_int m,
                                           rocblas_int n,
@@ -74,6 +78,243 @@ __global__ void gemvc_kernel_device_pointer(rocblas_operation transA,
     gemvc_device<T, NB_X>(m, n, *alpha, A, lda, x, incx, *beta, y, incy);
 }
 
+template <typename T, const rocblas_int NB_X, const rocblas_int MAX_M>
+__global__ void gemvt_thread_column_kernel_host_pointer(rocblas_int m,
+                                                        rocblas_int n,
+                                                        const T alpha,
+                                                        const T* __restrict__ A,
+                                                        rocblas_int lda,
+                                                        const T* __restrict__ x,
+                                                        rocblas_int incx,
+                                                        const T beta,
+                                                        T* y,
+                                                        rocblas_int incy)
+{
+    gemvt_thread_column_device<T, NB_X, MAX_M>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <typename T, const rocblas_int NB_X, const rocblas_int MAX_M>
+__global__ void gemvt_thread_column_kernel_device_pointer(rocblas_int m,
+                                                          rocblas_int n,
+                                                          const T* alpha,
+                                                          const T* __restrict__ A,
+                                                          rocblas_int lda,
+                                                          const T* __restrict__ x,
+                                                          rocblas_int incx,
+                                                          const T* beta,
+                                                          T* y,
+                                                          rocblas_int incy)
+{
+    gemvt_thread_column_device<T, NB_X, MAX_M>(m, n, *alpha, A, lda, x, incx, *beta, y, incy);
+}
+
+/*
+    the partial result A x over the columns [hipBlockIdx_y * cols, (hipBlockIdx_y + 1) * cols)
+    goes to column hipBlockIdx_y of W, which rocblas_gemv_split clears before the launch.
+    gemvn_device expects x at the lowest address of its elements for a negative incx, so x is
+    offset to the lowest address of the nc elements of this block of columns.
+*/
+template <typename T, const rocblas_int NB_X, const rocblas_int NB_Y>
+__global__ void gemvn_split_kernel(rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int cols,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   const T* __restrict__ x,
+                                   rocblas_int incx,
+                                   T* W)
+{
+    rocblas_int col = hipBlockIdx_y * cols;
+    rocblas_int nc  = n - col < cols ? n - col : cols;
+
+    x += incx >= 0 ? col * incx : (col + nc - n) * incx;
+
+    gemvn_device<T, NB_X, NB_Y>(
+        m, nc, T(1), A + (size_t)col * lda, lda, x, incx, T(0), W + (size_t)hipBlockIdx_y * m, 1);
+}
+
+/*
+    the partial result A**T x over the rows [hipBlockIdx_y * rows, (hipBlockIdx_y + 1) * rows)
+    goes to column hipBlockIdx_y of W, which rocblas_gemv_split clears before the launch.
+    gemvc_device expects x at the lowest address of its elements for a negative incx, so x is
+    offset to the lowest address of the mr elements of this block of rows.
+*/
+template <typename T, const rocblas_int NB_X>
+__global__ void gemvc_split_kernel(rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int rows,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   const T* __restrict__ x,
+                                   rocblas_int incx,
+                                   T* W)
+{
+    rocblas_int row = hipBlockIdx_y * rows;
+    rocblas_int mr  = m - row < rows ? m - row : rows;
+
+    x += incx >= 0 ? row * incx : (row + mr - m) * incx;
+
+    gemvc_device<T, NB_X>(
+        mr, n, T(1), A + row, lda, x, incx, T(0), W + (size_t)hipBlockIdx_y * n, 1);
+}
+
+template <typename T>
+__global__ void gemv_sum_kernel_host_pointer(rocblas_int len,
+                                             rocblas_int split,
+                                             const T alpha,
+                                             const T* __restrict__ W,
+                                             const T beta,
+                                             T* y,
+                                             rocblas_int incy)
+{
+    gemv_sum_device<T>(len, split, alpha, W, beta, y, incy);
+}
+
+template <typename T>
+__global__ void gemv_sum_kernel_device_pointer(rocblas_int len,
+                                               rocblas_int split,
+                                               const T* alpha,
+                                               const T* __restrict__ W,
+                                               const T* beta,
+                                               T* y,
+                                               rocblas_int incy)
+{
+    gemv_sum_device<T>(len, split, *alpha, W, *beta, y, incy);
+}
+
+/*
+    gemv by a split kernel: the thread blocks write the partial results of their blocks of
+    columns (split_n) or rows (split_m) to the workspace W of the handle, gemv_sum_kernel adds
+    them up into y. W is cleared first as the partial kernels compute beta * W with beta = 0.
+*/
+template <typename T>
+rocblas_status rocblas_gemv_split(rocblas_handle handle,
+                                  rocblas_gemv_kernel kernel,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  const T* beta,
+                                  T* y,
+                                  rocblas_int incy)
+{
+    bool host = handle->pointer_mode == rocblas_pointer_mode_host;
+
+    if(host && 0.0 == *alpha && 1.0 == *beta)
+    {
+        return rocblas_status_success;
+    }
+
+    bool split_n = kernel == rocblas_gemv_kernel_split_n;
+
+    // thread blocks of the single pass kernel, length of the split dimension and of y
+    rocblas_int blocks = split_n ? (m - 1) / (GEMVN_DIM_X * 4) + 1 : n;
+    rocblas_int length = split_n ? n : m;
+    rocblas_int len_y  = split_n ? m : n;
+
+    // about GEMV_SPLIT_BLOCKS thread blocks, at least GEMV_SPLIT_MIN_LENGTH long
+    rocblas_int split     = (GEMV_SPLIT_BLOCKS - 1) / blocks + 1;
+    rocblas_int max_split = length / GEMV_SPLIT_MIN_LENGTH;
+    if(split > max_split)
+        split = max_split;
+
+    rocblas_int chunk = (length - 1) / split + 1;
+    split             = (length - 1) / chunk + 1;
+
+    size_t W_size = sizeof(T) * len_y * split;
+
+    unsigned int* tickets;
+    void* results;
+    void* W;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(0, 0, W_size, &tickets, &results, &W));
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(W, 0, W_size, rocblas_stream));
+
+    // A and x are not referenced when alpha == 0
+    if(!host || 0.0 != *alpha)
+    {
+        if(split_n)
+        {
+            dim3 split_grid(blocks, split, 1);
+            dim3 split_threads(GEMVN_DIM_X, GEMVN_DIM_Y, 1);
+
+            hipLaunchKernelGGL((gemvn_split_kernel<T, GEMVN_DIM_X, GEMVN_DIM_Y>),
+                               dim3(split_grid),
+                               dim3(split_threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               chunk,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               (T*)W);
+        }
+        else
+        {
+            dim3 split_grid(n, split, 1);
+            dim3 split_threads(GEMVC_NB, 1, 1);
+
+            hipLaunchKernelGGL((gemvc_split_kernel<T, GEMVC_NB>),
+                               dim3(split_grid),
+                               dim3(split_threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               chunk,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               (T*)W);
+        }
+    }
+
+    dim3 sum_grid((len_y - 1) / GEMV_SUM_NB + 1, 1, 1);
+    dim3 sum_threads(GEMV_SUM_NB, 1, 1);
+
+    if(host)
+    {
+        hipLaunchKernelGGL((gemv_sum_kernel_host_pointer<T>),
+                           dim3(sum_grid),
+                           dim3(sum_threads),
+                           0,
+                           rocblas_stream,
+                           len_y,
+                           split,
+                           *alpha,
+                           (const T*)W,
+                           *beta,
+                           y,
+                           incy);
+    }
+    else
+    {
+        hipLaunchKernelGGL((gemv_sum_kernel_device_pointer<T>),
+                           dim3(sum_grid),
+                           dim3(sum_threads),
+                           0,
+                           rocblas_stream,
+                           len_y,
+                           split,
+                           alpha,
+                           (const T*)W,
+                           beta,
+                           y,
+                           incy);
+    }
+
+    return rocblas_status_success;
+}
+
 /*! \brief BLAS Level 2 API
 
     \details
@@ -218,12 +459,17 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    rocblas_gemv_kernel kernel = rocblas_gemv_select(transA, m, n);
+
+    if(kernel == rocblas_gemv_kernel_split_n || kernel == rocblas_gemv_kernel_split_m)
+    {
+        return rocblas_gemv_split<T>(handle, kernel, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    }
+
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
-    if(transA == rocblas_operation_none)
+    if(kernel == rocblas_gemv_kernel_tiled)
     {
-#define GEMVN_DIM_X 64 //
-#define GEMVN_DIM_Y 16 // GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
         rocblas_int blocks = (m - 1) / (GEMVN_DIM_X * 4) + 1;
 
         dim3 gemvn_grid(blocks, 1, 1);
@@ -273,19 +519,71 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
                                y,
                                incy);
         }
-#undef GEMVN_DIM_X
-#undef GEMVN_DIM_Y
+    }
+    else if(kernel == rocblas_gemv_kernel_thread_column)
+    {
+        rocblas_int blocks = (n - 1) / GEMVC_NB + 1;
+
+        dim3 gemvt_grid(blocks, 1, 1);
+        dim3 gemvt_threads(GEMVC_NB, 1, 1);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            hipLaunchKernelGGL(
+                (gemvt_thread_column_kernel_device_pointer<T, GEMVC_NB, GEMVT_THREAD_COLUMN_M>),
+                dim3(gemvt_grid),
+                dim3(gemvt_threads),
+                0,
+                rocblas_stream,
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                x,
+                incx,
+                beta,
+                y,
+                incy);
+        }
+        else
+        {
+            if(0.0 == *alpha && 1.0 == *beta)
+            {
+                return rocblas_status_success;
+            }
+
+            T h_alpha_scalar = *alpha;
+            T h_beta_scalar  = *beta;
+
+            hipLaunchKernelGGL(
+                (gemvt_thread_column_kernel_host_pointer<T, GEMVC_NB, GEMVT_THREAD_COLUMN_M>),
+                dim3(gemvt_grid),
+                dim3(gemvt_threads),
+                0,
+                rocblas_stream,
+                m,
+                n,
+                h_alpha_scalar,
+                A,
+                lda,
+                x,
+                incx,
+                h_beta_scalar,
+                y,
+                incy);
+        }
     }
     else
     {
         // number of columns on the y-dim of the grid, using gemvc because gemvt(transpose) is a
         // instance of gemvc (conjugate)
         dim3 gemvc_grid(n, 1, 1);
-        dim3 gemvc_threads(256, 1, 1);
+        dim3 gemvc_threads(GEMVC_NB, 1, 1);
 
         if(handle->pointer_mode == rocblas_pointer_mode_device)
         {
-            hipLaunchKernelGGL((gemvc_kernel_device_pointer<T, 256>),
+            hipLaunchKernelGGL((gemvc_kernel_device_pointer<T, GEMVC_NB>),
                                dim3(gemvc_grid),
                                dim3(gemvc_threads),
                                0,
@@ -312,7 +610,7 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
             T h_alpha_scalar = *alpha;
             T h_beta_scalar  = *beta;
 
-            hipLaunchKernelGGL((gemvc_kernel_host_pointer<T, 256>),
+            hipLaunchKernelGGL((gemvc_kernel_host_pointer<T, GEMVC_NB>),
                                dim3(gemvc_grid),
                                dim3(gemvc_threads),
                                0,
@@ -333,6 +631,43 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/*! \brief BLAS Level 2 API
+
+    \details
+    gemv_order performs gemv on a matrix A stored in order. The row-major m by n matrix A, with
+    lda >= n, is the column-major n by m matrix A**T, so the row-major gemv is the column-major
+    gemv of the other operation on n by m.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_gemv_order_template(rocblas_handle handle,
+                                           rocblas_order order,
+                                           rocblas_operation transA,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           const T* A,
+                                           rocblas_int lda,
+                                           const T* x,
+                                           rocblas_int incx,
+                                           const T* beta,
+                                           T* y,
+                                           rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(order == rocblas_order_column_major)
+        return rocblas_gemv_template<T>(
+            handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    else if(order == rocblas_order_row_major)
+        return rocblas_gemv_template<T>(
+            handle, rocblas_transpose_flip(transA), n, m, alpha, A, lda, x, incx, beta, y, incy);
+
+    return rocblas_status_not_implemented;
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -372,3 +707,39 @@ extern "C" rocblas_status rocblas_dgemv(rocblas_handle handle,
     return rocblas_gemv_template<double>(
         handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
+
+extern "C" rocblas_status rocblas_sgemv_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_operation transA,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const float* alpha,
+                                              const float* A,
+                                              rocblas_int lda,
+                                              const float* x,
+                                              rocblas_int incx,
+                                              const float* beta,
+                                              float* y,
+                                              rocblas_int incy)
+{
+    return rocblas_gemv_order_template<float>(
+        handle, order, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dgemv_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_operation transA,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const double* alpha,
+                                              const double* A,
+                                              rocblas_int lda,
+                                              const double* x,
+                                              rocblas_int incx,
+                                              const double* beta,
+                                              double* y,
+                                              rocblas_int incy)
+{
+    return rocblas_gemv_order_template<double>(
+        handle, order, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
@@ -11,32 +11,148 @@
 #include "logging.h"
 #include "utility.h"
 
-template <typename T>
-__global__ void ger_kernel_host_pointer(rocblas_int m,
-                                        rocblas_int n,
-                                        const T alpha,
-                                        const T* __restrict__ x,
-                                        rocblas_int incx,
-                                        const T* __restrict__ y,
-                                        rocblas_int incy,
-                                        T* A,
-                                        rocblas_int lda)
+/*
+    hipBlockIdx_z picks the problem of the batch, x and y of ger_device cover the columns and
+    rows of A. S is T for scalars passed by value from the host or const T* for scalars on
+    the device.
+*/
+template <typename T, typename S>
+__global__ void ger_kernel(rocblas_int m,
+                           rocblas_int n,
+                           S alpha_s,
+                           const T* __restrict__ x,
+                           rocblas_int incx,
+                           rocblas_int bsx,
+                           const T* __restrict__ y,
+                           rocblas_int incy,
+                           rocblas_int bsy,
+                           T* A,
+                           rocblas_int lda,
+                           rocblas_int bsa)
 {
-    ger_device<T>(m, n, alpha, x, incx, y, incy, A, lda);
+    size_t batch = hipBlockIdx_z;
+
+    ger_device<T>(m,
+                  n,
+                  load_scalar(alpha_s),
+                  x + batch * bsx,
+                  incx,
+                  y + batch * bsy,
+                  incy,
+                  A + batch * bsa,
+                  lda);
 }
 
+/*
+    ger of batch_count problems, the grid is the tiles of A by batch_count in chunks of at most
+    ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
 template <typename T>
-__global__ void ger_kernel_device_pointer(rocblas_int m,
-                                          rocblas_int n,
-                                          const T* alpha,
-                                          const T* __restrict__ x,
-                                          rocblas_int incx,
-                                          const T* __restrict__ y,
-                                          rocblas_int incy,
-                                          T* A,
-                                          rocblas_int lda)
+rocblas_status rocblas_ger_launch(rocblas_handle handle,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  const T* y,
+                                  rocblas_int incy,
+                                  rocblas_int bsy,
+                                  T* A,
+                                  rocblas_int lda,
+                                  rocblas_int bsa,
+                                  rocblas_int batch_count)
 {
-    ger_device<T>(m, n, *alpha, x, incx, y, incy, A, lda);
+    if(m < 0)
+        return rocblas_status_invalid_size;
+    else if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+    else if(lda < m || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+#define GEMV_DIM_X 128
+#define GEMV_DIM_Y 8
+    rocblas_int blocksX = ((m - 1) / GEMV_DIM_X) + 1;
+    rocblas_int blocksY = ((n - 1) / GEMV_DIM_Y) + 1;
+
+    dim3 ger_threads(GEMV_DIM_X, GEMV_DIM_Y, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 ger_grid(blocksX, blocksY, batch_chunk(batch_count, b0));
+
+            hipLaunchKernelGGL((ger_kernel<T>),
+                               dim3(ger_grid),
+                               dim3(ger_threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+    else
+    {
+        T h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 ger_grid(blocksX, blocksY, batch_chunk(batch_count, b0));
+
+            hipLaunchKernelGGL((ger_kernel<T>),
+                               dim3(ger_grid),
+                               dim3(ger_threads),
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               h_alpha_scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+#undef GEMV_DIM_X
+#undef GEMV_DIM_Y
+
+    return rocblas_status_success;
 }
 
 /*! \brief BLAS Level 2 API
@@ -151,74 +267,140 @@ rocblas_status rocblas_ger_template(rocblas_handle handle,
     else if(nullptr == A)
         return rocblas_status_invalid_pointer;
 
-    if(m < 0)
-        return rocblas_status_invalid_size;
-    else if(n < 0)
-        return rocblas_status_invalid_size;
-    else if(0 == incx)
-        return rocblas_status_invalid_size;
-    else if(0 == incy)
-        return rocblas_status_invalid_size;
-    else if(lda < m || lda < 1)
-        return rocblas_status_invalid_size;
+    return rocblas_ger_launch<T>(handle, m, n, alpha, x, incx, 0, y, incy, 0, A, lda, 0, 1);
+}
 
-    /*
-     * Quick return if possible. Not Argument error
-     */
-    if(m == 0 || n == 0 || alpha == 0)
-    {
-        return rocblas_status_success;
-    }
+/*! \brief BLAS Level 2 API
 
-    hipStream_t rocblas_stream = handle->rocblas_stream;
+    \details
+    xGER_STRIDED_BATCHED performs batch_count xGER operations with the same m, n and alpha in
+    one launch
 
-#define GEMV_DIM_X 128
-#define GEMV_DIM_Y 8
-    rocblas_int blocksX = ((m - 1) / GEMV_DIM_X) + 1;
-    rocblas_int blocksY = ((n - 1) / GEMV_DIM_Y) + 1;
+        A_i := A_i + alpha*x_i*y_i**T
 
-    dim3 ger_grid(blocksX, blocksY, 1);
-    dim3 ger_threads(GEMV_DIM_X, GEMV_DIM_Y, 1);
+    the vectors x_i start bsx elements apart, the vectors y_i bsy elements apart and the
+    matrices A_i bsa elements apart.
 
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_ger_strided_batched_template(rocblas_handle handle,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    const T* alpha,
+                                                    const T* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    const T* y,
+                                                    rocblas_int incy,
+                                                    rocblas_int bsy,
+                                                    T* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
     {
-        hipLaunchKernelGGL((ger_kernel_device_pointer<T>),
-                           dim3(ger_grid),
-                           dim3(ger_threads),
-                           0,
-                           rocblas_stream,
-                           m,
-                           n,
-                           alpha,
-                           x,
-                           incx,
-                           y,
-                           incy,
-                           A,
-                           lda);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xger_strided_batched"),
+                  m,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocblas-bench -f ger_strided_batched -r",
+                  replaceX<T>("X"),
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--lda",
+                  lda,
+                  "--batch",
+                  batch_count);
     }
     else
     {
-        T h_alpha_scalar = *alpha;
-        hipLaunchKernelGGL((ger_kernel_host_pointer<T>),
-                           dim3(ger_grid),
-                           dim3(ger_threads),
-                           0,
-                           rocblas_stream,
-                           m,
-                           n,
-                           h_alpha_scalar,
-                           x,
-                           incx,
-                           y,
-                           incy,
-                           A,
-                           lda);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xger_strided_batched"),
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
     }
-#undef GEMV_DIM_X
-#undef GEMV_DIM_Y
 
-    return rocblas_status_success;
+    if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_ger_launch<T>(
+        handle, m, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    ger_order performs ger on a matrix A stored in order. The row-major m by n matrix A, with
+    lda >= n, is the column-major n by m matrix A**T, and A**T := alpha * y * x**T + A**T is
+    the column-major ger with x and y exchanged.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_ger_order_template(rocblas_handle handle,
+                                          rocblas_order order,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          const T* alpha,
+                                          const T* x,
+                                          rocblas_int incx,
+                                          const T* y,
+                                          rocblas_int incy,
+                                          T* A,
+                                          rocblas_int lda)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(order == rocblas_order_column_major)
+        return rocblas_ger_template<T>(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    else if(order == rocblas_order_row_major)
+        return rocblas_ger_template<T>(handle, n, m, alpha, y, incy, x, incx, A, lda);
+
+    return rocblas_status_not_implemented;
 }
 
 /*
@@ -254,3 +436,71 @@ extern "C" rocblas_status rocblas_dger(rocblas_handle handle,
 {
     return rocblas_ger_template<double>(handle, m, n, alpha, x, incx, y, incy, A, lda);
 }
+
+extern "C" rocblas_status rocblas_sger_order(rocblas_handle handle,
+                                             rocblas_order order,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             const float* alpha,
+                                             const float* x,
+                                             rocblas_int incx,
+                                             const float* y,
+                                             rocblas_int incy,
+                                             float* A,
+                                             rocblas_int lda)
+{
+    return rocblas_ger_order_template<float>(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+extern "C" rocblas_status rocblas_dger_order(rocblas_handle handle,
+                                             rocblas_order order,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             const double* alpha,
+                                             const double* x,
+                                             rocblas_int incx,
+                                             const double* y,
+                                             rocblas_int incy,
+                                             double* A,
+                                             rocblas_int lda)
+{
+    return rocblas_ger_order_template<double>(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+extern "C" rocblas_status rocblas_sger_strided_batched(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       const float* alpha,
+                                                       const float* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       const float* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       float* A,
+                                                       rocblas_int lda,
+                                                       rocblas_int bsa,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_ger_strided_batched_template<float>(
+        handle, m, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dger_strided_batched(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       const double* alpha,
+                                                       const double* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       const double* y,
+                                                       rocblas_int incy,
+                                                       rocblas_int bsy,
+                                                       double* A,
+                                                       rocblas_int lda,
+                                                       rocblas_int bsa,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_ger_strided_batched_template<double>(
+        handle, m, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
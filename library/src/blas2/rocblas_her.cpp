@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "syr_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+/*
+    hipBlockIdx_y picks the problem of the batch, S is the real type of T for alpha passed by
+    value from the host or a pointer to it for alpha on the device.
+*/
+template <typename T, typename S>
+__global__ void her_kernel(rocblas_fill uplo,
+                           rocblas_int n,
+                           S alpha_s,
+                           const T* __restrict__ xa,
+                           rocblas_int incx,
+                           rocblas_int bsx,
+                           T* Aa,
+                           rocblas_int lda,
+                           rocblas_int bsa)
+{
+    const T* x = load_batch_ptr(xa, bsx);
+    T* A       = load_batch_ptr(Aa, bsa);
+
+    // alpha is real, the update takes it as alpha + 0i
+    T alpha;
+    alpha.x = load_scalar(alpha_s);
+    alpha.y = 0;
+
+    syr_tile_device<T, SYR_NB, SYR_DIM_Y, false, true>(uplo, n, alpha, x, incx, x, incx, A, lda);
+}
+
+/*
+    her of batch_count problems, the grid is the tiles of the triangle by batch_count in chunks
+    of at most ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
+template <typename T, typename R>
+rocblas_status rocblas_her_launch(rocblas_handle handle,
+                                  rocblas_fill uplo,
+                                  rocblas_int n,
+                                  const R* alpha,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  T* A,
+                                  rocblas_int lda,
+                                  rocblas_int bsa,
+                                  rocblas_int batch_count)
+{
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n || 0 == batch_count)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 her_threads(SYR_NB, SYR_DIM_Y, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 her_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((her_kernel<T>),
+                               her_grid,
+                               her_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+    else
+    {
+        R h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 her_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((her_kernel<T>),
+                               her_grid,
+                               her_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               h_alpha_scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xHER performs the matrix-vector operations
+
+        A := A + alpha*x*x**H
+
+    where alpha is a real scalar, x is an n element vector, and A is a
+    hermitian n by n matrix.
+
+    The update runs on the triangle of tiles of xSYR in complex arithmetic. The imaginary
+    parts of the diagonal elements are set to zero.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    n         rocblas_int
+              n >= 0
+    @param[in]
+    alpha
+              specifies the real scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+              incx != 0
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+              lda >= n && lda >= 1
+
+    ********************************************************************/
+
+template <typename T, typename R>
+rocblas_status rocblas_her_template(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const R* alpha,
+                                    const T* x,
+                                    rocblas_int incx,
+                                    T* A,
+                                    rocblas_int lda)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xher"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)A,
+                  lda);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f her -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--lda",
+                  lda);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xher"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)A,
+                  lda);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_her_launch<T>(handle, uplo, n, alpha, x, incx, 0, A, lda, 0, 1);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_cher(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       const float* alpha,
+                                       const rocblas_float_complex* x,
+                                       rocblas_int incx,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda)
+{
+    return rocblas_her_template<rocblas_float_complex>(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+extern "C" rocblas_status rocblas_zher(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       const double* alpha,
+                                       const rocblas_double_complex* x,
+                                       rocblas_int incx,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda)
+{
+    return rocblas_her_template<rocblas_double_complex>(handle, uplo, n, alpha, x, incx, A, lda);
+}
@@ -0,0 +1,710 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "gbmv_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define SBMV_NB 128
+
+/*
+    the stored triangle of the symmetric band matrix is a band matrix with (kl, ku) = (0, k)
+    (upper) or (k, 0) (lower) in gbmv storage. y(o) is the row o of the stored triangle times x
+    plus the column o without its diagonal, band row ku. U, V and S are as in gbmv_kernel.
+*/
+template <typename T, rocblas_int NB, rocblas_int DC, typename U, typename V, typename S>
+__global__ void sbmv_kernel(rocblas_fill uplo,
+                            rocblas_int n,
+                            rocblas_int k,
+                            S alpha_s,
+                            U Aa,
+                            rocblas_int lda,
+                            rocblas_int bsa,
+                            U xa,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            S beta_s,
+                            V ya,
+                            rocblas_int incy,
+                            rocblas_int bsy)
+{
+    const T* A = load_batch_ptr(Aa, bsa);
+    const T* x = load_batch_ptr(xa, bsx);
+    T* y       = load_batch_ptr(ya, bsy);
+    T alpha    = load_scalar(alpha_s);
+    T beta     = load_scalar(beta_s);
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    rocblas_int kl = uplo == rocblas_fill_upper ? 0 : k;
+    rocblas_int ku = uplo == rocblas_fill_upper ? k : 0;
+
+    // A and x are not referenced when alpha == 0, alpha is the same for the whole block
+    T sum = 0.0;
+    if(alpha != 0.0)
+    {
+        sum = gbmv_band_sum<T, NB, DC>(false, n, n, kl, ku, A, lda, x, incx, -1);
+        sum += gbmv_band_sum<T, NB, DC>(true, n, n, kl, ku, A, lda, x, incx, ku);
+    }
+
+    rocblas_int o = hipBlockIdx_x * NB + hipThreadIdx_x;
+    if(o < n)
+    {
+        // y is not read when beta == 0
+        if(beta == 0.0)
+            y[o * incy] = alpha * sum;
+        else
+            y[o * incy] = alpha * sum + beta * y[o * incy];
+    }
+}
+
+// the grid is blocks of outputs by batch_count, in chunks of at most ROCBLAS_MAX_BATCH_GRID
+// problems
+template <typename T, rocblas_int DC, typename U, typename V, typename S>
+void sbmv_launch_kernel(hipStream_t rocblas_stream,
+                        rocblas_int blocks,
+                        rocblas_fill uplo,
+                        rocblas_int n,
+                        rocblas_int k,
+                        S alpha,
+                        U A,
+                        rocblas_int lda,
+                        rocblas_int bsa,
+                        U x,
+                        rocblas_int incx,
+                        rocblas_int bsx,
+                        S beta,
+                        V y,
+                        rocblas_int incy,
+                        rocblas_int bsy,
+                        rocblas_int batch_count)
+{
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        dim3 grid(blocks, batch_chunk(batch_count, b0), 1);
+
+        hipLaunchKernelGGL((sbmv_kernel<T, SBMV_NB, DC, U, V, S>),
+                           grid,
+                           dim3(SBMV_NB),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           k,
+                           alpha,
+                           batch_offset(A, bsa, b0),
+                           lda,
+                           bsa,
+                           batch_offset(x, bsx, b0),
+                           incx,
+                           bsx,
+                           beta,
+                           batch_offset(y, bsy, b0),
+                           incy,
+                           bsy);
+    }
+}
+
+/*
+    sbmv of batch_count problems, the grid is blocks of outputs by batch_count in chunks of at
+    most ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
+template <typename T, typename U, typename V>
+rocblas_status rocblas_sbmv_launch(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const T* alpha,
+                                   U A,
+                                   rocblas_int lda,
+                                   rocblas_int bsa,
+                                   U x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   const T* beta,
+                                   V y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   rocblas_int batch_count)
+{
+    if(n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < k + 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx || 0 == incy)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n || 0 == batch_count)
+    {
+        return rocblas_status_success;
+    }
+
+    rocblas_int blocks = (n - 1) / SBMV_NB + 1;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // a narrow band takes all its band rows in one step of a short tile
+    bool narrow = k + 1 <= 4;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(narrow)
+            sbmv_launch_kernel<T, 4>(rocblas_stream,
+                                     blocks,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     bsa,
+                                     x,
+                                     incx,
+                                     bsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     bsy,
+                                     batch_count);
+        else
+            sbmv_launch_kernel<T, 16>(rocblas_stream,
+                                      blocks,
+                                      uplo,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      x,
+                                      incx,
+                                      bsx,
+                                      beta,
+                                      y,
+                                      incy,
+                                      bsy,
+                                      batch_count);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+
+        if(0.0 == h_alpha && 1.0 == h_beta)
+        {
+            return rocblas_status_success;
+        }
+
+        if(narrow)
+            sbmv_launch_kernel<T, 4>(rocblas_stream,
+                                     blocks,
+                                     uplo,
+                                     n,
+                                     k,
+                                     h_alpha,
+                                     A,
+                                     lda,
+                                     bsa,
+                                     x,
+                                     incx,
+                                     bsx,
+                                     h_beta,
+                                     y,
+                                     incy,
+                                     bsy,
+                                     batch_count);
+        else
+            sbmv_launch_kernel<T, 16>(rocblas_stream,
+                                      blocks,
+                                      uplo,
+                                      n,
+                                      k,
+                                      h_alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      x,
+                                      incx,
+                                      bsx,
+                                      h_beta,
+                                      y,
+                                      incy,
+                                      bsy,
+                                      batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSBMV performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an n by n
+    symmetric band matrix with k super-diagonals, of which only the uplo triangle is stored.
+
+    A is given in band storage, A(i, j) is at A[k + i - j + j * lda] (upper) or
+    A[i - j + j * lda] (lower). The stored triangle is read twice, once along its rows and once
+    along its columns, both times through the shared memory tiles of gbmv.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  the upper triangle of A is stored.
+              rocblas_fill_lower:  the lower triangle of A is stored.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    k         rocblas_int
+              number of super-diagonals (sub-diagonals) of A.
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= k + 1.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_sbmv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* beta,
+                                     T* y,
+                                     rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv"),
+                  uplo,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f sbmv -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv"),
+                  uplo,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_sbmv_launch<T>(
+        handle, uplo, n, k, alpha, A, lda, 0, x, incx, 0, beta, y, incy, 0, 1);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    sbmv_strided_batched and sbmv_batched compute batch_count symmetric band matrix-vector
+    products with the same scalars alpha and beta in one call
+
+        y_i := alpha*A_i*x_i + beta*y_i
+
+    the band matrices (vectors) of sbmv_strided_batched start bsa (bsx, bsy) elements apart, the
+    ones of sbmv_batched are given by arrays of batch_count device pointers on the GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_sbmv_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_int k,
+                                                     const T* alpha,
+                                                     const T* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     const T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     const T* beta,
+                                                     T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv_strided_batched"),
+                  uplo,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  *beta,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f sbmv_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv_strided_batched"),
+                  uplo,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  batch_count);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_sbmv_launch<T>(
+        handle, uplo, n, k, alpha, A, lda, bsa, x, incx, bsx, beta, y, incy, bsy, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_sbmv_batched_template(rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const T* alpha,
+                                             const T* const* A,
+                                             rocblas_int lda,
+                                             const T* const* x,
+                                             rocblas_int incx,
+                                             const T* beta,
+                                             T* const* y,
+                                             rocblas_int incy,
+                                             rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv_batched"),
+                  uplo,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f sbmv_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsbmv_batched"),
+                  uplo,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy,
+                  batch_count);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_sbmv_launch<T>(
+        handle, uplo, n, k, alpha, A, lda, 0, x, incx, 0, beta, y, incy, 0, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssbmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const float* alpha,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* beta,
+                                        float* y,
+                                        rocblas_int incy)
+{
+    return rocblas_sbmv_template<float>(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dsbmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const double* alpha,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* beta,
+                                        double* y,
+                                        rocblas_int incy)
+{
+    return rocblas_sbmv_template<double>(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_ssbmv_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_int n,
+                                                        rocblas_int k,
+                                                        const float* alpha,
+                                                        const float* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const float* beta,
+                                                        float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_sbmv_strided_batched_template<float>(
+        handle, uplo, n, k, alpha, A, lda, bsa, x, incx, bsx, beta, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsbmv_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_int n,
+                                                        rocblas_int k,
+                                                        const double* alpha,
+                                                        const double* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const double* beta,
+                                                        double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_sbmv_strided_batched_template<double>(
+        handle, uplo, n, k, alpha, A, lda, bsa, x, incx, bsx, beta, y, incy, bsy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_ssbmv_batched(rocblas_handle handle,
+                                                rocblas_fill uplo,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                const float* alpha,
+                                                const float* const A[],
+                                                rocblas_int lda,
+                                                const float* const x[],
+                                                rocblas_int incx,
+                                                const float* beta,
+                                                float* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_sbmv_batched_template<float>(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsbmv_batched(rocblas_handle handle,
+                                                rocblas_fill uplo,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                const double* alpha,
+                                                const double* const A[],
+                                                rocblas_int lda,
+                                                const double* const x[],
+                                                rocblas_int incx,
+                                                const double* beta,
+                                                double* const y[],
+                                                rocblas_int incy,
+                                                rocblas_int batch_count)
+{
+    return rocblas_sbmv_batched_template<double>(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define SPMV_NB 64
+
+// S is T for scalars passed by value from the host or const T* for scalars on the device
+template <typename T, rocblas_int NB, typename S>
+__global__ void spmv_kernel(rocblas_fill uplo,
+                            rocblas_int n,
+                            S alpha_s,
+                            const T* __restrict__ AP,
+                            const T* __restrict__ x,
+                            rocblas_int incx,
+                            S beta_s,
+                            T* y,
+                            rocblas_int incy)
+{
+    T alpha = load_scalar(alpha_s);
+    T beta  = load_scalar(beta_s);
+
+    rocblas_int i0 = hipBlockIdx_x * NB;
+    bool upper     = uplo == rocblas_fill_upper;
+
+    // AP and x are not referenced when alpha == 0, alpha is the same for the whole block
+    T sum = 0.0;
+    if(alpha != 0.0)
+        sum = packed_tile_sum<T, NB>(upper, true, false, false, n, AP, x, incx, i0, 0, n);
+
+    rocblas_int i = i0 + hipThreadIdx_x;
+    if(i < n)
+    {
+        // y is not read when beta == 0
+        if(beta == 0.0)
+            y[i * incy] = alpha * sum;
+        else
+            y[i * incy] = alpha * sum + beta * y[i * incy];
+    }
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPMV performs the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and A is an n by n
+    symmetric matrix of which the uplo triangle is given in packed storage, n * (n + 1) / 2
+    elements column by column.
+
+    A block of SPMV_NB rows walks its row of SPMV_NB x SPMV_NB tiles, each tile is loaded from
+    the packed triangle with the closed form column offsets into shared memory, one column
+    segment of the triangle per load, so there is neither an unpack pass nor an n^2 buffer.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  AP holds the upper triangle of A, A(i, j) at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  AP holds the lower triangle of A,
+                                   A(i, j) at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[inout]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_spmv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* AP,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* beta,
+                                     T* y,
+                                     rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspmv"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)AP,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f spmv -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspmv"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)AP,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // the kernels index x and y from their first element in memory
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    rocblas_int blocks = (n - 1) / SPMV_NB + 1;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((spmv_kernel<T, SPMV_NB>),
+                           dim3(blocks),
+                           dim3(SPMV_NB),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           alpha,
+                           AP,
+                           x,
+                           incx,
+                           beta,
+                           y,
+                           incy);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+
+        if(0.0 == h_alpha && 1.0 == h_beta)
+        {
+            return rocblas_status_success;
+        }
+
+        hipLaunchKernelGGL((spmv_kernel<T, SPMV_NB>),
+                           dim3(blocks),
+                           dim3(SPMV_NB),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           h_alpha,
+                           AP,
+                           x,
+                           incx,
+                           h_beta,
+                           y,
+                           incy);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_sspmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* AP,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* beta,
+                                        float* y,
+                                        rocblas_int incy)
+{
+    return rocblas_spmv_template<float>(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dspmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* AP,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* beta,
+                                        double* y,
+                                        rocblas_int incy)
+{
+    return rocblas_spmv_template<double>(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define SPR_NB 128
+
+// block (bx, j) updates rows bx * NB ... of column j of the packed triangle, consecutive threads
+// write consecutive elements of the column
+template <typename T, rocblas_int NB, typename S>
+__global__ void spr_kernel(rocblas_fill uplo,
+                           rocblas_int n,
+                           S alpha_s,
+                           const T* __restrict__ x,
+                           rocblas_int incx,
+                           T* AP)
+{
+    T alpha = load_scalar(alpha_s);
+    if(alpha == 0.0)
+        return;
+
+    bool upper    = uplo == rocblas_fill_upper;
+    rocblas_int i = hipBlockIdx_x * NB + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y;
+
+    if(i < n && (upper ? i <= j : i >= j))
+        AP[i + packed_offset(upper, n, j)] += alpha * x[i * incx] * x[j * incx];
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPR performs the matrix-vector operation
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is an n element vector and A is an n by n symmetric matrix of
+    which the uplo triangle is given in packed storage, n * (n + 1) / 2 elements column by
+    column.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  AP holds the upper triangle of A, A(i, j) at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  AP holds the lower triangle of A,
+                                   A(i, j) at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    n         rocblas_int
+              n >= 0
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+              incx != 0
+    @param[inout]
+    AP        pointer storing the packed triangle of A on the GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_spr_template(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_int n,
+                                    const T* alpha,
+                                    const T* x,
+                                    rocblas_int incx,
+                                    T* AP)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspr"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)AP);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f spr -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspr"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)AP);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+
+    dim3 spr_grid((n - 1) / SPR_NB + 1, n);
+    dim3 spr_threads(SPR_NB);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((spr_kernel<T, SPR_NB>),
+                           spr_grid,
+                           spr_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           alpha,
+                           x,
+                           incx,
+                           AP);
+    }
+    else
+    {
+        T h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        hipLaunchKernelGGL((spr_kernel<T, SPR_NB>),
+                           spr_grid,
+                           spr_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           h_alpha_scalar,
+                           x,
+                           incx,
+                           AP);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_sspr(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       const float* alpha,
+                                       const float* x,
+                                       rocblas_int incx,
+                                       float* AP)
+{
+    return rocblas_spr_template<float>(handle, uplo, n, alpha, x, incx, AP);
+}
+
+extern "C" rocblas_status rocblas_dspr(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       const double* alpha,
+                                       const double* x,
+                                       rocblas_int incx,
+                                       double* AP)
+{
+    return rocblas_spr_template<double>(handle, uplo, n, alpha, x, incx, AP);
+}
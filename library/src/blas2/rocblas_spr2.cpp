@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define SPR2_NB 128
+
+// block (bx, j) updates rows bx * NB ... of column j of the packed triangle, consecutive threads
+// write consecutive elements of the column
+template <typename T, rocblas_int NB, typename S>
+__global__ void spr2_kernel(rocblas_fill uplo,
+                            rocblas_int n,
+                            S alpha_s,
+                            const T* __restrict__ x,
+                            rocblas_int incx,
+                            const T* __restrict__ y,
+                            rocblas_int incy,
+                            T* AP)
+{
+    T alpha = load_scalar(alpha_s);
+    if(alpha == 0.0)
+        return;
+
+    bool upper    = uplo == rocblas_fill_upper;
+    rocblas_int i = hipBlockIdx_x * NB + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y;
+
+    if(i < n && (upper ? i <= j : i >= j))
+        AP[i + packed_offset(upper, n, j)] +=
+            alpha * (x[i * incx] * y[j * incy] + y[i * incy] * x[j * incx]);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSPR2 performs the matrix-vector operation
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are n element vectors and A is an n by n symmetric matrix of
+    which the uplo triangle is given in packed storage, n * (n + 1) / 2 elements column by
+    column.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  AP holds the upper triangle of A, A(i, j) at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  AP holds the lower triangle of A,
+                                   A(i, j) at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    n         rocblas_int
+              n >= 0
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+              incx != 0
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+              incy != 0
+    @param[inout]
+    AP        pointer storing the packed triangle of A on the GPU.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_spr2_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* y,
+                                     rocblas_int incy,
+                                     T* AP)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspr2"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)AP);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f spr2 -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xspr2"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)AP);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(incy < 0)
+        y -= (n - 1) * incy;
+
+    dim3 spr2_grid((n - 1) / SPR2_NB + 1, n);
+    dim3 spr2_threads(SPR2_NB);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((spr2_kernel<T, SPR2_NB>),
+                           spr2_grid,
+                           spr2_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           alpha,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           AP);
+    }
+    else
+    {
+        T h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        hipLaunchKernelGGL((spr2_kernel<T, SPR2_NB>),
+                           spr2_grid,
+                           spr2_threads,
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           h_alpha_scalar,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           AP);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_sspr2(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* y,
+                                        rocblas_int incy,
+                                        float* AP)
+{
+    return rocblas_spr2_template<float>(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+extern "C" rocblas_status rocblas_dspr2(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* y,
+                                        rocblas_int incy,
+                                        double* AP)
+{
+    return rocblas_spr2_template<double>(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
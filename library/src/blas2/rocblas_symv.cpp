@@ -0,0 +1,411 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "symv_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// block columns of the symv kernel, halved for rocblas_double_complex
+#define SYMV_NB 64
+#define SYMV_NB_Y 4
+#define SYMV_SUM_NB 256
+
+// block columns of a pass, the workspace is n by at most SYMV_PASS_BLOCKS elements
+#define SYMV_PASS_BLOCKS 128
+
+// 1 of the real and complex types, T(1) would set both parts of a complex
+template <typename T>
+static T symv_one()
+{
+    return T(1);
+}
+
+template <>
+rocblas_float_complex symv_one()
+{
+    return make_float2(1, 0);
+}
+
+template <>
+rocblas_double_complex symv_one()
+{
+    return make_double2(1, 0);
+}
+
+template <typename T, const rocblas_int NB, const rocblas_int NB_Y>
+__global__ void symv_blocks_kernel(rocblas_fill uplo,
+                                   rocblas_int n,
+                                   rocblas_int J0,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   const T* __restrict__ x,
+                                   rocblas_int incx,
+                                   T* W)
+{
+    symv_blocks_device<T, NB, NB_Y>(uplo, n, J0, A, lda, x, incx, W);
+}
+
+template <typename T, const rocblas_int NB>
+__global__ void symv_sum_kernel_host_pointer(rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int J0,
+                                             rocblas_int nj,
+                                             const T alpha,
+                                             const T* __restrict__ W,
+                                             const T beta,
+                                             T* y,
+                                             rocblas_int incy)
+{
+    symv_sum_device<T, NB>(uplo, n, J0, nj, alpha, W, beta, y, incy);
+}
+
+template <typename T, const rocblas_int NB>
+__global__ void symv_sum_kernel_device_pointer(rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_int J0,
+                                               rocblas_int nj,
+                                               const T* alpha,
+                                               const T* __restrict__ W,
+                                               const T* beta,
+                                               T* y,
+                                               rocblas_int incy)
+{
+    symv_sum_device<T, NB>(uplo, n, J0, nj, *alpha, W, *beta, y, incy);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYMV (real types) and xHEMV (complex types) perform the matrix-vector operation
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and
+    A is an n by n symmetric or hermitian matrix of which only the uplo triangle is referenced.
+    The imaginary parts of the diagonal of a hermitian A are not referenced.
+
+    Each element of the referenced triangle is read once and used for both its row and
+    its column, so symv moves about half the bytes of a gemv on the same n. The block columns
+    go in passes of at most SYMV_PASS_BLOCKS, whose partial sums take n * SYMV_PASS_BLOCKS
+    elements of the persistent buffer of the handle; the call does not synchronize.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  the upper triangle of A is referenced.
+              rocblas_fill_lower:  the lower triangle of A is referenced.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      specifies the increment for the elements of x.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[out]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_symv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* beta,
+                                     T* y,
+                                     rocblas_int incy)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    constexpr bool herm = std::is_same<T, rocblas_float_complex>::value ||
+                          std::is_same<T, rocblas_double_complex>::value;
+
+    const char* name = herm ? "rocblas_Xhemv" : "rocblas_Xsymv";
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>(name),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  *beta,
+                  (const void*&)y,
+                  incy);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  herm ? "./rocblas-bench -f hemv -r" : "./rocblas-bench -f symv -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--incx",
+                  incx,
+                  "--beta",
+                  *beta,
+                  "--incy",
+                  incy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>(name),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  incy);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    bool host = handle->pointer_mode == rocblas_pointer_mode_host;
+
+    if(host && rank_equal(*alpha, 0) && rank_equal(*beta, 1))
+    {
+        return rocblas_status_success;
+    }
+
+    // the shared memory of the column sums is NB * NB elements
+    constexpr rocblas_int NB = sizeof(T) > sizeof(double) ? SYMV_NB / 2 : SYMV_NB;
+
+    dim3 symv_threads(NB, SYMV_NB_Y, 1);
+    dim3 sum_grid((n - 1) / SYMV_SUM_NB + 1, 1, 1);
+    dim3 sum_threads(SYMV_SUM_NB, 1, 1);
+
+    // A, x and W are not referenced when alpha == 0
+    if(host && rank_equal(*alpha, 0))
+    {
+        T h_alpha_scalar = *alpha;
+        T h_beta_scalar  = *beta;
+
+        hipLaunchKernelGGL((symv_sum_kernel_host_pointer<T, NB>),
+                           dim3(sum_grid),
+                           dim3(sum_threads),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           0,
+                           0,
+                           h_alpha_scalar,
+                           (const T*)nullptr,
+                           h_beta_scalar,
+                           y,
+                           incy);
+
+        return rocblas_status_success;
+    }
+
+    // at most SYMV_PASS_BLOCKS block columns per pass, their partial sums are n by pass
+    rocblas_int blocks = (n - 1) / NB + 1;
+    rocblas_int pass   = blocks < SYMV_PASS_BLOCKS ? blocks : SYMV_PASS_BLOCKS;
+
+    unsigned int* tickets;
+    void* results;
+    void* W;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        0, 0, sizeof(T) * n * pass, &tickets, &results, &W));
+
+    // the passes after the first add to y
+    const T h_one = symv_one<T>();
+    const T* one  = &h_one;
+    if(!host && pass < blocks)
+        RETURN_IF_ROCBLAS_ERROR(handle->get_device_one(&one));
+
+    for(rocblas_int J0 = 0; J0 < blocks; J0 += pass)
+    {
+        rocblas_int nj = blocks - J0 < pass ? blocks - J0 : pass;
+
+        hipLaunchKernelGGL((symv_blocks_kernel<T, NB, SYMV_NB_Y>),
+                           dim3(nj),
+                           dim3(symv_threads),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           n,
+                           J0,
+                           A,
+                           lda,
+                           x,
+                           incx,
+                           (T*)W);
+
+        if(!host)
+        {
+            hipLaunchKernelGGL((symv_sum_kernel_device_pointer<T, NB>),
+                               dim3(sum_grid),
+                               dim3(sum_threads),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               J0,
+                               nj,
+                               alpha,
+                               (const T*)W,
+                               J0 == 0 ? beta : one,
+                               y,
+                               incy);
+        }
+        else
+        {
+            hipLaunchKernelGGL((symv_sum_kernel_host_pointer<T, NB>),
+                               dim3(sum_grid),
+                               dim3(sum_threads),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               J0,
+                               nj,
+                               *alpha,
+                               (const T*)W,
+                               J0 == 0 ? *beta : h_one,
+                               y,
+                               incy);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssymv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* beta,
+                                        float* y,
+                                        rocblas_int incy)
+{
+    return rocblas_symv_template<float>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_dsymv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* beta,
+                                        double* y,
+                                        rocblas_int incy)
+{
+    return rocblas_symv_template<double>(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_chemv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const rocblas_float_complex* alpha,
+                                        const rocblas_float_complex* A,
+                                        rocblas_int lda,
+                                        const rocblas_float_complex* x,
+                                        rocblas_int incx,
+                                        const rocblas_float_complex* beta,
+                                        rocblas_float_complex* y,
+                                        rocblas_int incy)
+{
+    return rocblas_symv_template<rocblas_float_complex>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+extern "C" rocblas_status rocblas_zhemv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const rocblas_double_complex* alpha,
+                                        const rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        const rocblas_double_complex* x,
+                                        rocblas_int incx,
+                                        const rocblas_double_complex* beta,
+                                        rocblas_double_complex* y,
+                                        rocblas_int incy)
+{
+    return rocblas_symv_template<rocblas_double_complex>(
+        handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
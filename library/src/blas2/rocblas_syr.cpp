@@ -11,28 +11,118 @@
 #include "logging.h"
 #include "utility.h"
 
-template <typename T>
-__global__ void syr_kernel_host_pointer(rocblas_fill uplo,
-                                        rocblas_int n,
-                                        const T alpha,
-                                        const T* __restrict__ x,
-                                        rocblas_int incx,
-                                        T* A,
-                                        rocblas_int lda)
+/*
+    hipBlockIdx_y picks the problem of the batch, S is T for scalars passed by value from the
+    host or const T* for scalars on the device.
+*/
+template <typename T, typename S>
+__global__ void syr_kernel(rocblas_fill uplo,
+                           rocblas_int n,
+                           S alpha_s,
+                           const T* __restrict__ xa,
+                           rocblas_int incx,
+                           rocblas_int bsx,
+                           T* Aa,
+                           rocblas_int lda,
+                           rocblas_int bsa)
 {
-    syr_device<T>(uplo, n, alpha, x, incx, A, lda);
+    const T* x = load_batch_ptr(xa, bsx);
+    T* A       = load_batch_ptr(Aa, bsa);
+
+    syr_tile_device<T, SYR_NB, SYR_DIM_Y, false, false>(
+        uplo, n, load_scalar(alpha_s), x, incx, x, incx, A, lda);
 }
 
+/*
+    syr of batch_count problems, the grid is the tiles of the triangle by batch_count in chunks
+    of at most ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
 template <typename T>
-__global__ void syr_kernel_device_pointer(rocblas_fill uplo,
-                                          rocblas_int n,
-                                          const T* alpha,
-                                          const T* __restrict__ x,
-                                          rocblas_int incx,
-                                          T* A,
-                                          rocblas_int lda)
+rocblas_status rocblas_syr_launch(rocblas_handle handle,
+                                  rocblas_fill uplo,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* x,
+                                  rocblas_int incx,
+                                  rocblas_int bsx,
+                                  T* A,
+                                  rocblas_int lda,
+                                  rocblas_int bsa,
+                                  rocblas_int batch_count)
 {
-    syr_device<T>(uplo, n, *alpha, x, incx, A, lda);
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n || 0 == batch_count)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 syr_threads(SYR_NB, SYR_DIM_Y, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 syr_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((syr_kernel<T>),
+                               syr_grid,
+                               syr_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+    else
+    {
+        T h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 syr_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((syr_kernel<T>),
+                               syr_grid,
+                               syr_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               h_alpha_scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+
+    return rocblas_status_success;
 }
 
 /*! \brief BLAS Level 2 API
@@ -45,6 +135,9 @@ __global__ void syr_kernel_device_pointer(rocblas_fill uplo,
     where alpha is a scalars, x and y are vectors, and A is a
     symmetric n by n matrix.
 
+    Only the tiles of SYR_NB x SYR_NB elements that hold part of the uplo triangle are launched
+    and the other triangle of A is never read or written.
+
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -136,66 +229,96 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
     else if(nullptr == A)
         return rocblas_status_invalid_pointer;
 
-    if(n < 0)
-        return rocblas_status_invalid_size;
-    else if(0 == incx)
-        return rocblas_status_invalid_size;
-    else if(lda < n || lda < 1)
-        return rocblas_status_invalid_size;
+    return rocblas_syr_launch<T>(handle, uplo, n, alpha, x, incx, 0, A, lda, 0, 1);
+}
 
-    /*
-     * Quick return if possible. Not Argument error
-     */
-    if(n == 0 || alpha == 0)
-    {
-        return rocblas_status_success;
-    }
+/*! \brief BLAS Level 2 API
 
-    hipStream_t rocblas_stream = handle->rocblas_stream;
+    \details
+    syr_strided_batched performs batch_count symmetric rank one updates with the same scalar
+    alpha in one call
 
-#define GEMV_DIM_X 128
-#define GEMV_DIM_Y 8
-    rocblas_int blocksX = ((n - 1) / GEMV_DIM_X) + 1;
-    rocblas_int blocksY = ((n - 1) / GEMV_DIM_Y) + 1;
+        A_i := A_i + alpha*x_i*x_i**T
 
-    dim3 syr_grid(blocksX, blocksY, 1);
-    dim3 syr_threads(GEMV_DIM_X, GEMV_DIM_Y, 1);
+    the vectors x_i start bsx elements apart and the matrices A_i bsa elements apart.
 
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_syr_strided_batched_template(rocblas_handle handle,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    const T* alpha,
+                                                    const T* x,
+                                                    rocblas_int incx,
+                                                    rocblas_int bsx,
+                                                    T* A,
+                                                    rocblas_int lda,
+                                                    rocblas_int bsa,
+                                                    rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
     {
-        hipLaunchKernelGGL((syr_kernel_device_pointer<T>),
-                           dim3(syr_grid),
-                           dim3(syr_threads),
-                           0,
-                           rocblas_stream,
-                           uplo,
-                           n,
-                           alpha,
-                           x,
-                           incx,
-                           A,
-                           lda);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr_strided_batched"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syr_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--lda",
+                  lda,
+                  "--batch",
+                  batch_count);
     }
     else
     {
-        T h_alpha_scalar = *alpha;
-        hipLaunchKernelGGL((syr_kernel_host_pointer<T>),
-                           dim3(syr_grid),
-                           dim3(syr_threads),
-                           0,
-                           rocblas_stream,
-                           uplo,
-                           n,
-                           h_alpha_scalar,
-                           x,
-                           incx,
-                           A,
-                           lda);
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr_strided_batched"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
     }
-#undef GEMV_DIM_X
-#undef GEMV_DIM_Y
 
-    return rocblas_status_success;
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_syr_launch<T>(handle, uplo, n, alpha, x, incx, bsx, A, lda, bsa, batch_count);
 }
 
 /*
@@ -227,3 +350,35 @@ extern "C" rocblas_status rocblas_dsyr(rocblas_handle handle,
 {
     return rocblas_syr_template<double>(handle, uplo, n, alpha, x, incx, A, lda);
 }
+
+extern "C" rocblas_status rocblas_ssyr_strided_batched(rocblas_handle handle,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       const float* alpha,
+                                                       const float* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       float* A,
+                                                       rocblas_int lda,
+                                                       rocblas_int bsa,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_syr_strided_batched_template<float>(
+        handle, uplo, n, alpha, x, incx, bsx, A, lda, bsa, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsyr_strided_batched(rocblas_handle handle,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       const double* alpha,
+                                                       const double* x,
+                                                       rocblas_int incx,
+                                                       rocblas_int bsx,
+                                                       double* A,
+                                                       rocblas_int lda,
+                                                       rocblas_int bsa,
+                                                       rocblas_int batch_count)
+{
+    return rocblas_syr_strided_batched_template<double>(
+        handle, uplo, n, alpha, x, incx, bsx, A, lda, bsa, batch_count);
+}
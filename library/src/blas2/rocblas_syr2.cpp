@@ -0,0 +1,440 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "syr_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+/*
+    hipBlockIdx_y picks the problem of the batch, S is T for scalars passed by value from the
+    host or const T* for scalars on the device.
+*/
+template <typename T, typename S>
+__global__ void syr2_kernel(rocblas_fill uplo,
+                            rocblas_int n,
+                            S alpha_s,
+                            const T* __restrict__ xa,
+                            rocblas_int incx,
+                            rocblas_int bsx,
+                            const T* __restrict__ ya,
+                            rocblas_int incy,
+                            rocblas_int bsy,
+                            T* Aa,
+                            rocblas_int lda,
+                            rocblas_int bsa)
+{
+    const T* x = load_batch_ptr(xa, bsx);
+    const T* y = load_batch_ptr(ya, bsy);
+    T* A       = load_batch_ptr(Aa, bsa);
+
+    syr_tile_device<T, SYR_NB, SYR_DIM_Y, true, false>(
+        uplo, n, load_scalar(alpha_s), x, incx, y, incy, A, lda);
+}
+
+/*
+    syr2 of batch_count problems, the grid is the tiles of the triangle by batch_count in chunks
+    of at most ROCBLAS_MAX_BATCH_GRID problems. A single problem is a strided batch of one.
+*/
+template <typename T>
+rocblas_status rocblas_syr2_launch(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   const T* alpha,
+                                   const T* x,
+                                   rocblas_int incx,
+                                   rocblas_int bsx,
+                                   const T* y,
+                                   rocblas_int incy,
+                                   rocblas_int bsy,
+                                   T* A,
+                                   rocblas_int lda,
+                                   rocblas_int bsa,
+                                   rocblas_int batch_count)
+{
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+    else if(0 == incy)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(0 == n || 0 == batch_count)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 syr2_threads(SYR_NB, SYR_DIM_Y, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 syr2_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((syr2_kernel<T>),
+                               syr2_grid,
+                               syr2_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               alpha,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+    else
+    {
+        T h_alpha_scalar = *alpha;
+        if(0.0 == h_alpha_scalar)
+        {
+            return rocblas_status_success;
+        }
+
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 syr2_grid(syr_tile_count(n), batch_chunk(batch_count, b0), 1);
+
+            hipLaunchKernelGGL((syr2_kernel<T>),
+                               syr2_grid,
+                               syr2_threads,
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               n,
+                               h_alpha_scalar,
+                               batch_offset(x, bsx, b0),
+                               incx,
+                               bsx,
+                               batch_offset(y, bsy, b0),
+                               incy,
+                               bsy,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xSYR2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are n element vectors, and A is a
+    symmetric n by n matrix.
+
+    The update runs on the triangle of tiles of xSYR, one pass over A for both rank one
+    terms.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo    rocblas_fill.
+            rocblas_fill_upper:  A is an upper triangular matrix.
+            rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    n         rocblas_int
+              n >= 0
+    @param[in]
+    alpha
+              specifies the scalar alpha.
+    @param[in]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+              incx != 0
+    @param[in]
+    y         pointer storing vector y on the GPU.
+    @param[in]
+    incy      rocblas_int
+              specifies the increment for the elements of y.
+              incy != 0
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+              lda >= n && lda >= 1
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_syr2_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* x,
+                                     rocblas_int incx,
+                                     const T* y,
+                                     rocblas_int incy,
+                                     T* A,
+                                     rocblas_int lda)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)A,
+                  lda);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syr2 -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--lda",
+                  lda);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  (const void*&)y,
+                  incy,
+                  (const void*&)A,
+                  lda);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_syr2_launch<T>(handle, uplo, n, alpha, x, incx, 0, y, incy, 0, A, lda, 0, 1);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syr2_strided_batched performs batch_count symmetric rank two updates with the same scalar
+    alpha in one call
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+
+    the vectors x_i (y_i) start bsx (bsy) elements apart and the matrices A_i bsa elements
+    apart.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_syr2_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     const T* alpha,
+                                                     const T* x,
+                                                     rocblas_int incx,
+                                                     rocblas_int bsx,
+                                                     const T* y,
+                                                     rocblas_int incy,
+                                                     rocblas_int bsy,
+                                                     T* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2_strided_batched"),
+                  uplo,
+                  n,
+                  *alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
+
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syr2_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--incx",
+                  incx,
+                  "--incy",
+                  incy,
+                  "--lda",
+                  lda,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2_strided_batched"),
+                  uplo,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)x,
+                  incx,
+                  bsx,
+                  (const void*&)y,
+                  incy,
+                  bsy,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  batch_count);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == y)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_syr2_launch<T>(
+        handle, uplo, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssyr2(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* x,
+                                        rocblas_int incx,
+                                        const float* y,
+                                        rocblas_int incy,
+                                        float* A,
+                                        rocblas_int lda)
+{
+    return rocblas_syr2_template<float>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+extern "C" rocblas_status rocblas_dsyr2(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* x,
+                                        rocblas_int incx,
+                                        const double* y,
+                                        rocblas_int incy,
+                                        double* A,
+                                        rocblas_int lda)
+{
+    return rocblas_syr2_template<double>(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+extern "C" rocblas_status rocblas_ssyr2_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_int n,
+                                                        const float* alpha,
+                                                        const float* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const float* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        float* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_syr2_strided_batched_template<float>(
+        handle, uplo, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsyr2_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_int n,
+                                                        const double* alpha,
+                                                        const double* x,
+                                                        rocblas_int incx,
+                                                        rocblas_int bsx,
+                                                        const double* y,
+                                                        rocblas_int incy,
+                                                        rocblas_int bsy,
+                                                        double* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_syr2_strided_batched_template<double>(
+        handle, uplo, n, alpha, x, incx, bsx, y, incy, bsy, A, lda, bsa, batch_count);
+}
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "tbsv_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// order of the diagonal blocks, the same as trsv
+#define TBSV_BLOCK 64
+
+// threads of the band update, one per row
+#define TBSV_UPDATE_NB 256
+
+template <typename T, const rocblas_int NB>
+__global__ void tbsv_invert_kernel(rocblas_fill uplo,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   T* invA)
+{
+    tbsv_invert_device<T, NB>(uplo, diag, n, k, A, lda, invA);
+}
+
+template <typename T, const rocblas_int NB>
+__global__ void tbsv_block_solve_kernel(rocblas_operation transA,
+                                        rocblas_int jb,
+                                        const T* __restrict__ invA,
+                                        T* x,
+                                        rocblas_int incx)
+{
+    trsv_block_solve_device<T, NB>(transA, jb, invA, x, incx);
+}
+
+template <typename T>
+__global__ void tbsv_update_kernel(rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_int k,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   rocblas_int i,
+                                   rocblas_int jb,
+                                   rocblas_int r0,
+                                   rocblas_int nr,
+                                   T* x,
+                                   rocblas_int incx)
+{
+    tbsv_update_device<T>(uplo, transA, k, A, lda, i, jb, r0, nr, x, incx);
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTBSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit,
+    upper or lower triangular band matrix with k super-diagonals (upper) or
+    k sub-diagonals (lower), op(A) = A or op(A) = A^T.
+
+    The solve is blocked like trsv: the TBSV_BLOCK by TBSV_BLOCK diagonal blocks are expanded
+    from the band and inverted in one launch, then the blocks are walked in substitution order
+
+        x_i  = op(invA_ii) * x_i                      (one thread block, in place)
+        x_r -= op(A)_ri * x_i  for the at most k rows r coupled to block i
+
+    where the update reads only the band. x is solved in place, the inverted blocks take
+    TBSV_BLOCK^2 * blocks elements of the persistent buffer of the handle and the call does
+    not synchronize.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular band matrix.
+              rocblas_fill_lower:  A is a  lower triangular band matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    k         rocblas_int
+              number of super-diagonals (upper) or sub-diagonals (lower) of A.
+    @param[in]
+    A         pointer storing the band matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= k + 1.
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_tbsv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal diag,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     T* x,
+                                     rocblas_int incx)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xtbsv"),
+              uplo,
+              transA,
+              diag,
+              n,
+              k,
+              (const void*&)A,
+              lda,
+              (const void*&)x,
+              incx);
+
+    std::string uplo_letter   = rocblas_fill_letter(uplo);
+    std::string transA_letter = rocblas_transpose_letter(transA);
+    std::string diag_letter   = rocblas_diag_letter(diag);
+
+    log_bench(handle,
+              "./rocblas-bench -f tbsv -r",
+              replaceX<T>("X"),
+              "--uplo",
+              uplo_letter,
+              "--transposeA",
+              transA_letter,
+              "--diag",
+              diag_letter,
+              "-n",
+              n,
+              "-k",
+              k,
+              "--lda",
+              lda,
+              "--incx",
+              incx);
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(k < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < k + 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    rocblas_int blocks = (n - 1) / TBSV_BLOCK + 1;
+
+    unsigned int* tickets;
+    void* results;
+    void* invA;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        0, 0, sizeof(T) * TBSV_BLOCK * TBSV_BLOCK * blocks, &tickets, &results, &invA));
+
+    hipLaunchKernelGGL((tbsv_invert_kernel<T, TBSV_BLOCK>),
+                       dim3(blocks),
+                       dim3(TBSV_BLOCK),
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       diag,
+                       n,
+                       k,
+                       A,
+                       lda,
+                       (T*)invA);
+
+    // the kernels index x from its first element in memory order
+    T* xp = incx < 0 ? x - (ptrdiff_t)(n - 1) * incx : x;
+
+    // op(A) is lower triangular when A is lower and not transposed or upper and transposed
+    bool forward = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+
+    for(rocblas_int b = 0; b < blocks; b++)
+    {
+        rocblas_int i  = (forward ? b : blocks - 1 - b) * TBSV_BLOCK;
+        rocblas_int jb = min(TBSV_BLOCK, n - i);
+
+        hipLaunchKernelGGL((tbsv_block_solve_kernel<T, TBSV_BLOCK>),
+                           dim3(1),
+                           dim3(TBSV_BLOCK),
+                           0,
+                           rocblas_stream,
+                           transA,
+                           jb,
+                           (const T*)invA + (size_t)i * TBSV_BLOCK,
+                           xp + (ptrdiff_t)i * incx,
+                           incx);
+
+        // the at most k rows still to be solved that the band couples to block i
+        rocblas_int r0 = forward ? i + jb : i - min(k, i);
+        rocblas_int nr = forward ? min(k, n - i - jb) : i - r0;
+
+        if(nr > 0)
+        {
+            hipLaunchKernelGGL((tbsv_update_kernel<T>),
+                               dim3((nr - 1) / TBSV_UPDATE_NB + 1),
+                               dim3(TBSV_UPDATE_NB),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               transA,
+                               k,
+                               A,
+                               lda,
+                               i,
+                               jb,
+                               r0,
+                               nr,
+                               xp,
+                               incx);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_stbsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        float* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tbsv_template<float>(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+extern "C" rocblas_status rocblas_dtbsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        double* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tbsv_template<double>(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
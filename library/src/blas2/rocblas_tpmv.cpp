@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define TPMV_NB 64
+
+// W = op(A) * x, a block of NB rows only visits the tiles of the op(A) triangle
+template <typename T, rocblas_int NB>
+__global__ void tpmv_kernel(rocblas_fill uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal diag,
+                            rocblas_int n,
+                            const T* __restrict__ AP,
+                            const T* __restrict__ x,
+                            rocblas_int incx,
+                            T* W)
+{
+    bool upper = uplo == rocblas_fill_upper;
+    bool trans = transA != rocblas_operation_none;
+    bool unit  = diag == rocblas_diagonal_unit;
+
+    rocblas_int i0 = hipBlockIdx_x * NB;
+
+    // op(A) is lower triangular for a lower A or a transposed upper A
+    rocblas_int jbegin = upper == trans ? 0 : i0;
+    rocblas_int jend   = upper == trans ? i0 + NB : n;
+
+    T sum = packed_tile_sum<T, NB>(upper, false, trans, unit, n, AP, x, incx, i0, jbegin, jend);
+
+    rocblas_int i = i0 + hipThreadIdx_x;
+    if(i < n)
+        W[i] = sum;
+}
+
+// every block reads x before any writes it in tpmv_kernel, the result is copied back after
+template <typename T>
+__global__ void tpmv_copy_kernel(rocblas_int n, const T* __restrict__ W, T* x, rocblas_int incx)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(i < n)
+        x[i * incx] = W[i];
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPMV performs the matrix-vector operation
+
+        x := op(A)*x,
+
+    where x is an n element vector and A is an n by n unit or non-unit, upper or lower
+    triangular matrix given in packed storage, n * (n + 1) / 2 elements column by column,
+    op(A) = A or op(A) = A^T.
+
+    The product is formed tile by tile as in xSPMV, only the tiles of the op(A) triangle are
+    loaded. It needs n elements of device workspace since x is overwritten, they are taken
+    from the persistent buffer of the handle and the call does not synchronize.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is upper triangular, A(i, j) at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  A is lower triangular, A(i, j) at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[inout]
+    x         pointer storing vector x on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_tpmv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal diag,
+                                     rocblas_int n,
+                                     const T* AP,
+                                     T* x,
+                                     rocblas_int incx)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xtpmv"),
+              uplo,
+              transA,
+              diag,
+              n,
+              (const void*&)AP,
+              (const void*&)x,
+              incx);
+
+    std::string uplo_letter   = rocblas_fill_letter(uplo);
+    std::string transA_letter = rocblas_transpose_letter(transA);
+    std::string diag_letter   = rocblas_diag_letter(diag);
+
+    log_bench(handle,
+              "./rocblas-bench -f tpmv -r",
+              replaceX<T>("X"),
+              "--uplo",
+              uplo_letter,
+              "--transposeA",
+              transA_letter,
+              "--diag",
+              diag_letter,
+              "-n",
+              n,
+              "--incx",
+              incx);
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(incx < 0)
+        x -= (ptrdiff_t)(n - 1) * incx;
+
+    // the products in the device buffer of the handle, the kernels of the stream are ordered
+    unsigned int* tickets;
+    void* results;
+    void* W;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        0, 0, sizeof(T) * n, &tickets, &results, &W));
+
+    rocblas_int blocks = (n - 1) / TPMV_NB + 1;
+
+    hipLaunchKernelGGL((tpmv_kernel<T, TPMV_NB>),
+                       dim3(blocks),
+                       dim3(TPMV_NB),
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       transA,
+                       diag,
+                       n,
+                       AP,
+                       x,
+                       incx,
+                       (T*)W);
+
+    hipLaunchKernelGGL((tpmv_copy_kernel<T>),
+                       dim3(blocks),
+                       dim3(TPMV_NB),
+                       0,
+                       rocblas_stream,
+                       n,
+                       (const T*)W,
+                       x,
+                       incx);
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_stpmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const float* AP,
+                                        float* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tpmv_template<float>(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+extern "C" rocblas_status rocblas_dtpmv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const double* AP,
+                                        double* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tpmv_template<double>(handle, uplo, transA, diag, n, AP, x, incx);
+}
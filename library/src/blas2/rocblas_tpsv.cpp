@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define TPSV_NB 64
+
+// solves the diagonal block of op(A) at rows and columns b0 ... b0 + NB - 1 in one thread block,
+// forward substitution when op(A) is lower triangular and backward substitution otherwise
+template <typename T, rocblas_int NB>
+__global__ void tpsv_diag_kernel(rocblas_fill uplo,
+                                 rocblas_operation transA,
+                                 rocblas_diagonal diag,
+                                 rocblas_int n,
+                                 const T* __restrict__ AP,
+                                 T* x,
+                                 rocblas_int incx,
+                                 rocblas_int b0)
+{
+    __shared__ T sA[NB][NB + 1];
+    __shared__ T sx[NB];
+
+    bool upper   = uplo == rocblas_fill_upper;
+    bool trans   = transA != rocblas_operation_none;
+    bool forward = upper == trans;
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int i  = b0 + tx;
+
+    packed_load_tile<T, NB>(upper, false, trans, diag == rocblas_diagonal_unit, n, AP, b0, b0, sA);
+    sx[tx] = i < n ? x[i * incx] : 0.0;
+
+    __syncthreads();
+
+    // rows past n are zero in sA and sx and take no part in the substitution
+    for(rocblas_int k = 0; k < NB; k++)
+    {
+        rocblas_int s = forward ? k : NB - 1 - k;
+
+        if(tx == s && i < n)
+            sx[s] /= sA[s][s];
+
+        __syncthreads();
+
+        if(forward ? tx > s : tx < s)
+            sx[tx] -= sA[tx][s] * sx[s];
+
+        __syncthreads();
+    }
+
+    if(i < n)
+        x[i * incx] = sx[tx];
+}
+
+// x(I) -= op(A)(I, J) * x(J) for the just solved block J = b0 ... b0 + NB - 1 and every block I
+// of rows still to be solved, one thread block per block of rows
+template <typename T, rocblas_int NB>
+__global__ void tpsv_update_kernel(rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   rocblas_diagonal diag,
+                                   rocblas_int n,
+                                   const T* __restrict__ AP,
+                                   T* x,
+                                   rocblas_int incx,
+                                   rocblas_int b0)
+{
+    bool upper   = uplo == rocblas_fill_upper;
+    bool trans   = transA != rocblas_operation_none;
+    bool forward = upper == trans;
+    bool unit    = diag == rocblas_diagonal_unit;
+
+    rocblas_int i0 = forward ? b0 + NB * (hipBlockIdx_x + 1) : NB * hipBlockIdx_x;
+
+    T sum = packed_tile_sum<T, NB>(upper, false, trans, unit, n, AP, x, incx, i0, b0, b0 + NB);
+
+    rocblas_int i = i0 + hipThreadIdx_x;
+    if(i < n)
+        x[i * incx] -= sum;
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTPSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit, upper or lower
+    triangular matrix given in packed storage, n * (n + 1) / 2 elements column by column,
+    op(A) = A or op(A) = A^T.
+
+    The solve walks the diagonal blocks of TPSV_NB rows in the order of the substitution. Each
+    block is solved in shared memory by one thread block, then the unknowns still to be solved
+    are updated with the tiles below (forward) or above (backward) it in parallel. Every
+    element of AP is read once and no workspace is used.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is upper triangular, A(i, j) at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  A is lower triangular, A(i, j) at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle of A on the GPU.
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_tpsv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal diag,
+                                     rocblas_int n,
+                                     const T* AP,
+                                     T* x,
+                                     rocblas_int incx)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xtpsv"),
+              uplo,
+              transA,
+              diag,
+              n,
+              (const void*&)AP,
+              (const void*&)x,
+              incx);
+
+    std::string uplo_letter   = rocblas_fill_letter(uplo);
+    std::string transA_letter = rocblas_transpose_letter(transA);
+    std::string diag_letter   = rocblas_diag_letter(diag);
+
+    log_bench(handle,
+              "./rocblas-bench -f tpsv -r",
+              replaceX<T>("X"),
+              "--uplo",
+              uplo_letter,
+              "--transposeA",
+              transA_letter,
+              "--diag",
+              diag_letter,
+              "-n",
+              n,
+              "--incx",
+              incx);
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+
+    rocblas_int blocks = (n - 1) / TPSV_NB + 1;
+    bool forward       = (uplo == rocblas_fill_upper) == (transA != rocblas_operation_none);
+
+    for(rocblas_int k = 0; k < blocks; k++)
+    {
+        rocblas_int b  = forward ? k : blocks - 1 - k;
+        rocblas_int b0 = b * TPSV_NB;
+
+        hipLaunchKernelGGL((tpsv_diag_kernel<T, TPSV_NB>),
+                           dim3(1),
+                           dim3(TPSV_NB),
+                           0,
+                           rocblas_stream,
+                           uplo,
+                           transA,
+                           diag,
+                           n,
+                           AP,
+                           x,
+                           incx,
+                           b0);
+
+        // the blocks after b in the substitution order
+        rocblas_int rest = forward ? blocks - 1 - b : b;
+        if(rest > 0)
+        {
+            hipLaunchKernelGGL((tpsv_update_kernel<T, TPSV_NB>),
+                               dim3(rest),
+                               dim3(TPSV_NB),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               transA,
+                               diag,
+                               n,
+                               AP,
+                               x,
+                               incx,
+                               b0);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_stpsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const float* AP,
+                                        float* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tpsv_template<float>(handle, uplo, transA, diag, n, AP, x, incx);
+}
+
+extern "C" rocblas_status rocblas_dtpsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const double* AP,
+                                        double* x,
+                                        rocblas_int incx)
+{
+    return rocblas_tpsv_template<double>(handle, uplo, transA, diag, n, AP, x, incx);
+}
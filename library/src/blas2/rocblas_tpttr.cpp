@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "packed_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define TPTTR_NB 128
+
+// block (bx, j) copies rows bx * NB ... of column j, both sides are contiguous in the rows
+template <typename T, rocblas_int NB>
+__global__ void tpttr_kernel(
+    rocblas_fill uplo, rocblas_int n, const T* __restrict__ AP, T* A, rocblas_int lda)
+{
+    bool upper    = uplo == rocblas_fill_upper;
+    rocblas_int i = hipBlockIdx_x * NB + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y;
+
+    if(i < n && (upper ? i <= j : i >= j))
+        A[i + (size_t)j * lda] = AP[i + packed_offset(upper, n, j)];
+}
+
+/*! \brief BLAS Level 2 auxiliary API
+
+    \details
+    xTPTTR copies the uplo triangle of an n by n matrix from packed storage AP, n * (n + 1) / 2
+    elements column by column, to full storage A. The other triangle of A is not referenced.
+
+    It is the unpack step of the packed routines done through their full storage counterparts,
+    rocblas-bench times it to compare that path with the packed kernels.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A(i, j) of the upper triangle is at AP[i + j*(j+1)/2].
+              rocblas_fill_lower:  A(i, j) of the lower triangle is at AP[i + j*(2*n-j-1)/2].
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    AP        pointer storing the packed triangle on the GPU.
+    @param[out]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda >= max(1, n).
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_tpttr_template(
+    rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* AP, T* A, rocblas_int lda)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(
+        handle, replaceX<T>("rocblas_Xtpttr"), uplo, n, (const void*&)AP, (const void*&)A, lda);
+
+    std::string uplo_letter = rocblas_fill_letter(uplo);
+
+    log_bench(handle,
+              "./rocblas-bench -f tpttr -r",
+              replaceX<T>("X"),
+              "--uplo",
+              uplo_letter,
+              "-n",
+              n,
+              "--lda",
+              lda);
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == AP)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 tpttr_grid((n - 1) / TPTTR_NB + 1, n);
+    dim3 tpttr_threads(TPTTR_NB);
+
+    hipLaunchKernelGGL((tpttr_kernel<T, TPTTR_NB>),
+                       tpttr_grid,
+                       tpttr_threads,
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       n,
+                       AP,
+                       A,
+                       lda);
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_stpttr(rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         const float* AP,
+                                         float* A,
+                                         rocblas_int lda)
+{
+    return rocblas_tpttr_template<float>(handle, uplo, n, AP, A, lda);
+}
+
+extern "C" rocblas_status rocblas_dtpttr(rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_int n,
+                                         const double* AP,
+                                         double* A,
+                                         rocblas_int lda)
+{
+    return rocblas_tpttr_template<double>(handle, uplo, n, AP, A, lda);
+}
@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+
+#include "status.h"
+#include "definitions.h"
+#include "trsv_device.h"
+#include "gemv_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// order of the diagonal blocks inverted by trtri_device, its shared memory is TRSV_BLOCK^2
+#define TRSV_BLOCK 64
+
+template <typename T, const rocblas_int NB>
+__global__ void trsv_invert_kernel(
+    rocblas_fill uplo, rocblas_diagonal diag, rocblas_int n, T* A, rocblas_int lda, T* invA)
+{
+    trsv_invert_device<T, NB>(uplo, diag, n, A, lda, invA);
+}
+
+template <typename T, const rocblas_int NB>
+__global__ void trsv_block_solve_kernel(rocblas_operation transA,
+                                        rocblas_int jb,
+                                        const T* __restrict__ invA,
+                                        T* x,
+                                        rocblas_int incx)
+{
+    trsv_block_solve_device<T, NB>(transA, jb, invA, x, incx);
+}
+
+template <typename T>
+__global__ void trsv_gather_kernel(rocblas_int n, const T* x, rocblas_int incx, T* w)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+
+    if(i < n)
+        w[i] = x[i * incx];
+}
+
+template <typename T>
+__global__ void trsv_scatter_kernel(rocblas_int n, const T* w, T* x, rocblas_int incx)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(incx < 0)
+        x -= (n - 1) * incx;
+
+    if(i < n)
+        x[i * incx] = w[i];
+}
+
+template <typename T, const rocblas_int DIM_X, const rocblas_int DIM_Y>
+__global__ void trsv_gemvn_kernel(rocblas_int m,
+                                  rocblas_int n,
+                                  const T alpha,
+                                  const T* __restrict__ A,
+                                  rocblas_int lda,
+                                  const T* __restrict__ x,
+                                  const T beta,
+                                  T* y)
+{
+    gemvn_device<T, DIM_X, DIM_Y>(m, n, alpha, A, lda, x, 1, beta, y, 1);
+}
+
+template <typename T, const rocblas_int NB_X>
+__global__ void trsv_gemvt_kernel(rocblas_int m,
+                                  rocblas_int n,
+                                  const T alpha,
+                                  const T* __restrict__ A,
+                                  rocblas_int lda,
+                                  const T* __restrict__ x,
+                                  const T beta,
+                                  T* y)
+{
+    gemvc_device<T, NB_X>(m, n, alpha, A, lda, x, 1, beta, y, 1);
+}
+
+/*
+    y = alpha * op(A) * x + beta * y on the contiguous workspaces of trsv. The scalars are
+    constants of the algorithm, not user arguments, so they are always passed by value.
+*/
+template <typename T>
+void rocblas_trsv_gemv(hipStream_t rocblas_stream,
+                       rocblas_operation transA,
+                       rocblas_int m,
+                       rocblas_int n,
+                       T alpha,
+                       const T* A,
+                       rocblas_int lda,
+                       const T* x,
+                       T beta,
+                       T* y)
+{
+    if(transA == rocblas_operation_none)
+    {
+#define GEMVN_DIM_X 64
+#define GEMVN_DIM_Y 16
+        rocblas_int blocks = (m - 1) / (GEMVN_DIM_X * 4) + 1;
+
+        dim3 gemvn_grid(blocks, 1, 1);
+        dim3 gemvn_threads(GEMVN_DIM_X, GEMVN_DIM_Y, 1);
+
+        hipLaunchKernelGGL((trsv_gemvn_kernel<T, GEMVN_DIM_X, GEMVN_DIM_Y>),
+                           dim3(gemvn_grid),
+                           dim3(gemvn_threads),
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           lda,
+                           x,
+                           beta,
+                           y);
+#undef GEMVN_DIM_X
+#undef GEMVN_DIM_Y
+    }
+    else
+    {
+        dim3 gemvt_grid(n, 1, 1);
+        dim3 gemvt_threads(256, 1, 1);
+
+        hipLaunchKernelGGL((trsv_gemvt_kernel<T, 256>),
+                           dim3(gemvt_grid),
+                           dim3(gemvt_threads),
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           lda,
+                           x,
+                           beta,
+                           y);
+    }
+}
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    xTRSV solves
+
+        op(A)*x = b,
+
+    where x and b are n element vectors and A is an n by n unit or non-unit,
+    upper or lower triangular matrix, op(A) = A or op(A) = A^T.
+
+    The TRSV_BLOCK by TRSV_BLOCK diagonal blocks of A are inverted in one launch, a thread
+    block each, with the trtri device function. The solve then walks the blocks in substitution
+    order on a contiguous copy w of x:
+
+        w_i  = op(invA_ii) * w_i                     (one thread block, in place)
+        w_r -= op(A)_ri * w_i  for the blocks r left  (gemv over the rest of the column)
+
+    invA and w take TRSV_BLOCK^2 * blocks + n elements of the persistent buffer of the handle.
+    The scalars of the gemv are constants passed by value, so the pointer mode of the handle
+    is neither read nor changed, and the call does not synchronize.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a  lower triangular matrix.
+    @param[in]
+    transA    rocblas_operation.
+              specifies the form of op(A).
+    @param[in]
+    diag      rocblas_diagonal.
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    n         rocblas_int
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+    @param[inout]
+    x         pointer storing vector b on entry and the solution x on exit, on the GPU.
+    @param[in]
+    incx      rocblas_int
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_trsv_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation transA,
+                                     rocblas_diagonal diag,
+                                     rocblas_int n,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     T* x,
+                                     rocblas_int incx)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xtrsv"),
+              uplo,
+              transA,
+              diag,
+              n,
+              (const void*&)A,
+              lda,
+              (const void*&)x,
+              incx);
+
+    std::string uplo_letter   = rocblas_fill_letter(uplo);
+    std::string transA_letter = rocblas_transpose_letter(transA);
+    std::string diag_letter   = rocblas_diag_letter(diag);
+
+    log_bench(handle,
+              "./rocblas-bench -f trsv -r",
+              replaceX<T>("X"),
+              "--uplo",
+              uplo_letter,
+              "--transposeA",
+              transA_letter,
+              "--diag",
+              diag_letter,
+              "-n",
+              n,
+              "--lda",
+              lda,
+              "--incx",
+              incx);
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == x)
+        return rocblas_status_invalid_pointer;
+
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < n || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(0 == incx)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+
+    if(0 == n)
+    {
+        return rocblas_status_success;
+    }
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    rocblas_int blocks = (n - 1) / TRSV_BLOCK + 1;
+
+    // invA holds the inverted diagonal blocks one after the other, w the right hand side that
+    // is solved in place
+    size_t invA_size = (size_t)TRSV_BLOCK * TRSV_BLOCK * blocks;
+
+    unsigned int* tickets;
+    void* results;
+    void* workspace;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        0, 0, sizeof(T) * (invA_size + n), &tickets, &results, &workspace));
+
+    T* d_invA = (T*)workspace;
+    T* d_W    = d_invA + invA_size;
+
+    hipLaunchKernelGGL((trsv_invert_kernel<T, TRSV_BLOCK>),
+                       dim3(blocks),
+                       dim3(TRSV_BLOCK),
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       diag,
+                       n,
+                       (T*)A,
+                       lda,
+                       d_invA);
+
+    rocblas_int copy_blocks = (n - 1) / 256 + 1;
+
+    hipLaunchKernelGGL((trsv_gather_kernel<T>),
+                       dim3(copy_blocks),
+                       dim3(256),
+                       0,
+                       rocblas_stream,
+                       n,
+                       (const T*)x,
+                       incx,
+                       d_W);
+
+    // op(A) is lower triangular when A is lower and not transposed or upper and transposed
+    bool forward = (uplo == rocblas_fill_lower) == (transA == rocblas_operation_none);
+
+    for(rocblas_int b = 0; b < blocks; b++)
+    {
+        rocblas_int i  = (forward ? b : blocks - 1 - b) * TRSV_BLOCK;
+        rocblas_int jb = min(TRSV_BLOCK, n - i);
+
+        hipLaunchKernelGGL((trsv_block_solve_kernel<T, TRSV_BLOCK>),
+                           dim3(1),
+                           dim3(TRSV_BLOCK),
+                           0,
+                           rocblas_stream,
+                           transA,
+                           jb,
+                           (const T*)(d_invA + (size_t)i * TRSV_BLOCK),
+                           d_W + i,
+                           1);
+
+        // rows of op(A) that are still to be solved, below the block (forward) or above it
+        rocblas_int r0 = forward ? i + jb : 0;
+        rocblas_int nr = forward ? n - i - jb : i;
+
+        if(nr > 0)
+        {
+            // op(A)_ri is A(r0:r0+nr, i:i+jb) or A(i:i+jb, r0:r0+nr)^T
+            const T* A_ri = transA == rocblas_operation_none ? A + r0 + (size_t)i * lda
+                                                             : A + i + (size_t)r0 * lda;
+
+            rocblas_trsv_gemv<T>(rocblas_stream,
+                                 transA,
+                                 transA == rocblas_operation_none ? nr : jb,
+                                 transA == rocblas_operation_none ? jb : nr,
+                                 -1,
+                                 A_ri,
+                                 lda,
+                                 d_W + i,
+                                 1,
+                                 d_W + r0);
+        }
+    }
+
+    hipLaunchKernelGGL((trsv_scatter_kernel<T>),
+                       dim3(copy_blocks),
+                       dim3(256),
+                       0,
+                       rocblas_stream,
+                       n,
+                       (const T*)d_W,
+                       x,
+                       incx);
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_strsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        float* x,
+                                        rocblas_int incx)
+{
+    return rocblas_trsv_template<float>(handle, uplo, transA, diag, n, A, lda, x, incx);
+}
+
+extern "C" rocblas_status rocblas_dtrsv(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal diag,
+                                        rocblas_int n,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        double* x,
+                                        rocblas_int incx)
+{
+    return rocblas_trsv_template<double>(handle, uplo, transA, diag, n, A, lda, x, incx);
+}
@@ -0,0 +1,171 @@
+/*
+ * ===========================================================================
+ *    This file provide common device function for symv routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+#include "../blas1/device_template.h"
+
+/*
+    one thread block per NB wide block column J = J0 + hipBlockIdx_x of A, walking down (lower)
+    or up (upper) the stored blocks A_IJ of that column.
+
+    Every stored element a = A(r, c) is read from global memory once and used twice:
+        a * x(c)       goes to y(r)   (row contribution,    partial sum over the NB columns of J)
+        conj(a) * x(r) goes to y(c)   (column contribution, accumulated over all blocks I of J)
+    On the diagonal block only the stored triangle is read and the diagonal element is used once,
+    by its real part. For the real types this is symv, for the complex types hemv.
+
+    The partial results are written to the workspace W (n by the block columns of the pass):
+        W(r, J - J0) for r in block I != J  holds the row contribution of A_IJ,
+        W(c, J - J0) for c in block J       holds the diagonal block plus all column contributions.
+    symv_sum_device then adds them up, so no atomics are needed.
+
+    hipBlockDim_x == NB and hipBlockDim_y == NB_Y, each thread owns one row of the tile and
+    NB / NB_Y of its columns; consecutive threads read consecutive elements of a column of A.
+*/
+template <typename T, rocblas_int NB, rocblas_int NB_Y>
+static __device__ void symv_blocks_device(rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int J0,
+                                          const T* __restrict__ A,
+                                          rocblas_int lda,
+                                          const T* __restrict__ x,
+                                          rocblas_int incx,
+                                          T* W)
+{
+    rocblas_int tx  = hipThreadIdx_x;
+    rocblas_int ty  = hipThreadIdx_y;
+    rocblas_int tid = tx + ty * NB;
+
+    rocblas_int J  = J0 + hipBlockIdx_x;
+    rocblas_int nb = (n - 1) / NB + 1;
+    rocblas_int c0 = J * NB;
+
+    T* w = W + (size_t)hipBlockIdx_x * n;
+
+    if(incx < 0)
+        x -= (ptrdiff_t)(n - 1) * incx;
+
+    __shared__ T sx[NB];
+    __shared__ T srow[NB_Y * NB];
+    __shared__ T scol[NB * NB];
+    __shared__ T sdiag[NB];
+
+    if(tid < NB)
+        sx[tid] = (c0 + tid < n) ? x[(c0 + tid) * incx] : T();
+
+    __syncthreads();
+
+    T col_acc[NB / NB_Y];
+    for(rocblas_int k = 0; k < NB / NB_Y; k++)
+        col_acc[k] = T();
+
+    rocblas_int I_begin = uplo == rocblas_fill_lower ? J : 0;
+    rocblas_int I_end   = uplo == rocblas_fill_lower ? nb : J + 1;
+
+    for(rocblas_int I = I_begin; I < I_end; I++)
+    {
+        rocblas_int r  = I * NB + tx;
+        T xr           = (r < n) ? x[r * incx] : T();
+        T row_acc      = T();
+        bool diag_tile = I == J;
+
+        for(rocblas_int k = 0; k < NB / NB_Y; k++)
+        {
+            rocblas_int c = c0 + ty + k * NB_Y;
+
+            T a = T();
+            if(r < n && c < n && (!diag_tile || (uplo == rocblas_fill_lower ? r >= c : r <= c)))
+                a = A[r + (size_t)c * lda];
+
+            if(diag_tile && r == c)
+                row_acc += rank_mul(rank_real(a), sx[ty + k * NB_Y]);
+            else
+            {
+                row_acc += rank_mul(a, sx[ty + k * NB_Y]);
+                col_acc[k] += rank_mul(rank_conj(a), xr);
+            }
+        }
+
+        srow[tid] = row_acc;
+
+        __syncthreads();
+
+        if(ty == 0)
+        {
+            T sum = T();
+            for(rocblas_int j = 0; j < NB_Y; j++)
+                sum += srow[tx + j * NB];
+
+            if(!diag_tile)
+            {
+                if(r < n)
+                    w[r] = sum;
+            }
+            else
+            {
+                sdiag[tx] = sum;
+            }
+        }
+
+        __syncthreads();
+    }
+
+    // column contributions: reduce the NB partial sums of every column over tx
+    for(rocblas_int k = 0; k < NB / NB_Y; k++)
+        scol[(ty + k * NB_Y) * NB + tx] = col_acc[k];
+
+    for(rocblas_int k = 0; k < NB / NB_Y; k++)
+        rocblas_sum_reduce<NB>(tx, scol + (ty + k * NB_Y) * NB);
+
+    if(tid < NB && c0 + tid < n)
+        w[c0 + tid] = scol[tid * NB] + sdiag[tid];
+}
+
+/*
+    y(i) = alpha * sum_J W(i, J - J0) + beta * y(i) over the block columns J of the pass
+    [J0, J0 + nj) that wrote row i: J <= I for lower, J >= I for upper, where I is the block row
+    of i. The passes after the first add to y with beta = 1.
+*/
+template <typename T, rocblas_int NB>
+static __device__ void symv_sum_device(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int J0,
+                                       rocblas_int nj,
+                                       T alpha,
+                                       const T* __restrict__ W,
+                                       T beta,
+                                       T* y,
+                                       rocblas_int incy)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i >= n)
+        return;
+
+    if(incy < 0)
+        y -= (ptrdiff_t)(n - 1) * incy;
+
+    T sum = T();
+
+    // W is not written when alpha == 0 in host pointer mode
+    if(!rank_equal(alpha, 0))
+    {
+        rocblas_int I       = i / NB;
+        rocblas_int J_begin = uplo == rocblas_fill_lower ? J0 : (I > J0 ? I : J0);
+        rocblas_int J_end   = uplo == rocblas_fill_lower ? (I + 1 < J0 + nj ? I + 1 : J0 + nj)
+                                                         : J0 + nj;
+
+        for(rocblas_int J = J_begin; J < J_end; J++)
+            sum += W[i + (size_t)(J - J0) * n];
+    }
+
+    // beta == 0 must not read y, it may hold NaN on entry
+    if(rank_equal(beta, 0))
+        y[i * incy] = rank_mul(alpha, sum);
+    else
+        y[i * incy] = rank_mul(alpha, sum) + rank_mul(beta, y[i * incy]);
+}
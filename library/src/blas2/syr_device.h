@@ -4,7 +4,8 @@
 
 /*
  * ===========================================================================
- *    This file provide common device function for ger routines
+ *    This file provide common device function for the symmetric and hermitian rank
+ *    update routines (syr, syr2, her, her2)
  * ===========================================================================
  */
 
@@ -12,49 +13,108 @@
 
 #include "../blas1/device_template.h"
 
-template <typename T>
-static __device__ void syr_device(rocblas_fill uplo,
-                                  rocblas_int n,
-                                  T alpha,
-                                  const T* __restrict__ x,
-                                  rocblas_int incx,
-                                  T* A,
-                                  rocblas_int lda)
+// tiles of SYR_NB x SYR_NB elements of A, SYR_DIM_Y columns of a tile are updated at a time
+#define SYR_NB 64
+#define SYR_DIM_Y 4
+
+/*
+    number of thread blocks of syr_tile_device for an n by n triangle: only the tiles that
+    hold part of the uplo triangle are launched.
+*/
+inline rocblas_int syr_tile_count(rocblas_int n)
 {
-    if(n <= 0)
-        return;
+    rocblas_int tiles = (n - 1) / SYR_NB + 1;
+    return tiles * (tiles + 1) / 2;
+}
+
+/*
+    the uplo triangle of the update of one tile of A with hipBlockDim_x == NB and
+    hipBlockDim_y == DIM_Y
 
-    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+        TWO == false:  A := A + alpha*x*x**H
+        TWO == true:   A := A + alpha*x*y**H + conj(alpha)*y*x**H
 
-    if(uplo == rocblas_fill_lower)
+    x**H is x**T for the real types. HERM keeps the diagonal real as the hermitian updates
+    have to.
+
+    Block hipBlockIdx_x takes tile k = ti * (ti + 1) / 2 + tj, ti >= tj, of the lower triangle
+    of tiles, mirrored for upper, so no block is launched for the tiles of the other triangle.
+    The elements are not read or written outside of the uplo triangle of A. Thread tx walks
+    the rows, every access to A is a run of NB consecutive elements of one column.
+*/
+template <typename T, rocblas_int NB, rocblas_int DIM_Y, bool TWO, bool HERM>
+static __device__ void syr_tile_device(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       T alpha,
+                                       const T* x,
+                                       rocblas_int incx,
+                                       const T* y,
+                                       rocblas_int incy,
+                                       T* A,
+                                       rocblas_int lda)
+{
+    __shared__ T sx[NB];
+    __shared__ T sy[NB];
+
+    // the square root is exact to well within one for any tile count a grid can hold
+    rocblas_int k  = hipBlockIdx_x;
+    rocblas_int ti = (rocblas_int)((sqrt(8.0 * k + 1.0) - 1.0) / 2.0);
+    while(ti * (ti + 1) / 2 > k)
+        ti--;
+    while((ti + 1) * (ti + 2) / 2 <= k)
+        ti++;
+    rocblas_int tj = k - ti * (ti + 1) / 2;
+
+    bool upper = uplo == rocblas_fill_upper;
+    if(upper)
     {
-        if(tx < n && ty <= tx)
-        {
-            if(incx > 0)
-            {
-                A[tx + lda * ty] += alpha * x[tx * incx] * x[ty * incx];
-            }
-            else
-            {
+        rocblas_int t = ti;
+        ti            = tj;
+        tj            = t;
+    }
 
-                A[tx + lda * ty] += alpha * x[(1 - n + tx) * incx] * x[(1 - n + ty) * incx];
-            }
-        }
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    if(TWO && incy < 0)
+        y -= (n - 1) * incy;
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+    rocblas_int i  = ti * NB + tx;
+    rocblas_int j0 = tj * NB;
+
+    // conj(x(j)) and conj(y(j)) of the columns of the tile
+    if(ty == 0 && j0 + tx < n)
+    {
+        sx[tx] = rank_conj(x[(j0 + tx) * incx]);
+        if(TWO)
+            sy[tx] = rank_conj(y[(j0 + tx) * incy]);
     }
-    else if(uplo == rocblas_fill_upper)
+
+    __syncthreads();
+
+    if(i >= n)
+        return;
+
+    T ax = rank_mul(alpha, x[i * incx]);
+    T ay;
+    if(TWO)
+        ay = rank_mul(rank_conj(alpha), y[i * incy]);
+
+    for(rocblas_int c = ty; c < NB; c += DIM_Y)
     {
-        if(ty < n && tx <= ty)
+        rocblas_int j = j0 + c;
+        if(j < n && (upper ? i <= j : i >= j))
         {
-            if(incx > 0)
-            {
-                A[tx + lda * ty] += alpha * x[tx * incx] * x[ty * incx];
-            }
+            T v;
+            if(TWO)
+                v = rank_mul(ax, sy[c]) + rank_mul(ay, sx[c]);
             else
-            {
+                v = rank_mul(ax, sx[c]);
+
+            T a = A[i + (size_t)j * lda] + v;
 
-                A[tx + lda * ty] += alpha * x[(1 - n + tx) * incx] * x[(1 - n + ty) * incx];
-            }
+            A[i + (size_t)j * lda] = HERM && i == j ? rank_real(a) : a;
         }
     }
 }
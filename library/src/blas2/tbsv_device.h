@@ -0,0 +1,99 @@
+/*
+ * ===========================================================================
+ *    This file provide common device function for tbsv routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+#include "trsv_device.h"
+
+/*
+    The band format stores A(i, j) at A[k + i - j + j * lda] (upper) or A[i - j + j * lda]
+    (lower), only the elements with |i - j| <= k on the stored side exist.
+*/
+template <typename T>
+static __device__ inline T
+    tbsv_band(bool upper, rocblas_int k, const T* A, rocblas_int lda, rocblas_int i, rocblas_int j)
+{
+    return A[(upper ? k + i - j : i - j) + (size_t)j * lda];
+}
+
+/*
+    inverts the NB by NB diagonal block hipBlockIdx_x of the band matrix A into
+    invA + hipBlockIdx_x * NB * NB: the block is expanded from the band into the dense tile,
+    with zeros outside the band, the stored triangle and the order of the last block, and
+    trtri inverts the tile in place. NB threads, one per row.
+*/
+template <typename T, rocblas_int NB>
+static __device__ void tbsv_invert_device(rocblas_fill uplo,
+                                          rocblas_diagonal diag,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          const T* A,
+                                          rocblas_int lda,
+                                          T* invA)
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int i  = hipBlockIdx_x * NB;
+    rocblas_int jb = min(NB, n - i);
+
+    bool upper = uplo == rocblas_fill_upper;
+
+    T* tile = invA + (size_t)hipBlockIdx_x * NB * NB;
+
+    for(rocblas_int c = 0; c < NB; c++)
+    {
+        rocblas_int d      = upper ? c - tx : tx - c;
+        bool        stored = tx < jb && c < jb && d >= 0 && d <= k;
+
+        tile[tx + c * NB] = stored ? tbsv_band(upper, k, A, lda, i + tx, i + c) : T(0);
+    }
+
+    __syncthreads();
+
+    // flag 0: the tile is read into shared memory and overwritten by its inverse
+    trtri_device<T, NB, 0>(uplo, diag, jb, tile, NB, nullptr, NB);
+}
+
+/*
+    x(r) -= sum over c in [i, i + jb) of op(A)(r, c) * x(c) for the nr rows r = r0 + t that are
+    coupled to the solved block i, one thread per row. Only the elements within the band are
+    read, with op(A)(r, c) = A(c, r) in the transposed case. x is not shifted for incx < 0.
+*/
+template <typename T>
+static __device__ void tbsv_update_device(rocblas_fill uplo,
+                                          rocblas_operation transA,
+                                          rocblas_int k,
+                                          const T* A,
+                                          rocblas_int lda,
+                                          rocblas_int i,
+                                          rocblas_int jb,
+                                          rocblas_int r0,
+                                          rocblas_int nr,
+                                          T* x,
+                                          rocblas_int incx)
+{
+    rocblas_int t = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(t >= nr)
+        return;
+
+    bool upper = uplo == rocblas_fill_upper;
+    bool trans = transA != rocblas_operation_none;
+
+    rocblas_int r = r0 + t;
+
+    // columns of the block within k of row r, r + k may not fit in rocblas_int
+    rocblas_int c0 = max(i, r - k);
+    rocblas_int c1 = k < i + jb - 1 - r ? r + k + 1 : i + jb;
+
+    T sum = 0;
+    for(rocblas_int c = c0; c < c1; c++)
+    {
+        T a = trans ? tbsv_band(upper, k, A, lda, c, r) : tbsv_band(upper, k, A, lda, r, c);
+        sum += a * x[(ptrdiff_t)c * incx];
+    }
+
+    x[(ptrdiff_t)r * incx] -= sum;
+}
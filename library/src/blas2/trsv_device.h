@@ -0,0 +1,75 @@
+/*
+ * ===========================================================================
+ *    This file provide common device function for trsv and tbsv routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+#pragma once
+#ifndef _TRSV_DEVICE_H_
+#define _TRSV_DEVICE_H_
+
+#include "../blas3/trtri_device.h"
+
+/*
+    inverts the NB by NB diagonal block hipBlockIdx_x of the n by n triangular A into
+    invA + hipBlockIdx_x * NB * NB, with leading dimension NB. The elements of the block that
+    trtri does not write, the other triangle and the padding of the last block, are zero so
+    the block can be used by a full NB by NB gemv. NB threads, one per row.
+*/
+template <typename T, rocblas_int NB>
+static __device__ void trsv_invert_device(
+    rocblas_fill uplo, rocblas_diagonal diag, rocblas_int n, T* A, rocblas_int lda, T* invA)
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int i  = hipBlockIdx_x * NB;
+    rocblas_int jb = min(NB, n - i);
+
+    T* tile = invA + (size_t)hipBlockIdx_x * NB * NB;
+
+    // trtri_device writes row tx of the triangle from thread tx, so no barrier is needed here
+    for(rocblas_int c = 0; c < NB; c++)
+        tile[tx + c * NB] = 0;
+
+    trtri_device<T, NB, 1>(uplo, diag, jb, A + i + (size_t)i * lda, lda, tile, NB);
+}
+
+/*
+    x(0:jb) := op(invA) * x(0:jb) in place for one NB by NB inverted diagonal block, x is read
+    into shared memory first. One thread block of NB threads, x is not shifted for incx < 0,
+    the caller passes the first element of the block.
+*/
+template <typename T, rocblas_int NB>
+static __device__ void trsv_block_solve_device(
+    rocblas_operation transA, rocblas_int jb, const T* invA, T* x, rocblas_int incx)
+{
+    rocblas_int tx = hipThreadIdx_x;
+
+    __shared__ T sx[NB];
+
+    sx[tx] = tx < jb ? x[(ptrdiff_t)tx * incx] : T(0);
+
+    __syncthreads();
+
+    if(tx < jb)
+    {
+        T sum = 0;
+
+        // inv(A_ii^T) = invA_ii^T
+        if(transA == rocblas_operation_none)
+        {
+            for(rocblas_int c = 0; c < jb; c++)
+                sum += invA[tx + c * NB] * sx[c];
+        }
+        else
+        {
+            for(rocblas_int c = 0; c < jb; c++)
+                sum += invA[c + tx * NB] * sx[c];
+        }
+
+        x[(ptrdiff_t)tx * incx] = sum;
+    }
+}
+
+#endif // _TRSV_DEVICE_H_
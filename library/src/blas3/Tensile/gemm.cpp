@@ -7,6 +7,8 @@
 #include "rocblas.h"
 #include "Tensile.h"
 #include "gemm.h"
+#include "../gemm_degenerate.hpp"
+#include "../gemm_small_batched.hpp"
 #include "definitions.h"
 #include "handle.h"
 #include "logging.h"
@@ -26,6 +28,12 @@
         rocblas_int bs_a, const TYPE *B, rocblas_int ld_b, rocblas_int bs_b, const TYPE *beta,  \
         TYPE *C, rocblas_int ld_c, rocblas_int bs_c, rocblas_int b_c
 
+#define ARGS_ORDER(TYPE)                                                                     \
+    rocblas_handle handle, rocblas_order order, rocblas_operation trans_a,                   \
+        rocblas_operation trans_b, rocblas_int m, rocblas_int n, rocblas_int k,              \
+        const TYPE *alpha, const TYPE *A, rocblas_int ld_a, const TYPE *B, rocblas_int ld_b, \
+        const TYPE *beta, TYPE *C, rocblas_int ld_c
+
 /*******************************************************************************
  * Preamble Code
  ******************************************************************************/
@@ -407,6 +415,34 @@
     }                                                 \
     return get_rocblas_status_for_hip_status(status);
 
+/*******************************************************************************
+ * Degenerate Shapes
+ ******************************************************************************/
+// gemm with m, n or k of one, k of zero or alpha of zero is a level 1 or 2 operation, see
+// rocblas_gemm_classify
+#define GEMM_DEGENERATE(TYPE)                                                              \
+    rocblas_gemm_shape shape = rocblas_gemm_degenerate_shape(handle, m, n, k, alpha, b_c); \
+    if(shape != rocblas_gemm_shape_general)                                                \
+        return rocblas_gemm_degenerate_template<TYPE>(shape,                               \
+                                                      handle,                              \
+                                                      trans_a,                             \
+                                                      trans_b,                             \
+                                                      m,                                   \
+                                                      n,                                   \
+                                                      k,                                   \
+                                                      alpha,                               \
+                                                      A,                                   \
+                                                      ld_a,                                \
+                                                      bs_a,                                \
+                                                      B,                                   \
+                                                      ld_b,                                \
+                                                      bs_b,                                \
+                                                      beta,                                \
+                                                      C,                                   \
+                                                      ld_c,                                \
+                                                      bs_c,                                \
+                                                      b_c);
+
 /*******************************************************************************
  * Batched vs Non
  ******************************************************************************/
@@ -414,14 +450,41 @@
     rocblas_status rocblas_##prec##gemm(ARGS(TYPE)) \
     {                                               \
         PREAMBLE(TYPE)                              \
+        GEMM_DEGENERATE(TYPE)                       \
         TENSILE_TRANSPOSES(PREC, TYPE)              \
     }
 
-#define GEMM_API_BATCHED(prec, PREC, TYPE)                                  \
-    rocblas_status rocblas_##prec##gemm_strided_batched(ARGS_BATCHED(TYPE)) \
-    {                                                                       \
-        PREAMBLE_BATCHED(TYPE)                                              \
-        TENSILE_TRANSPOSES(PREC, TYPE)                                      \
+// the strided batched sgemm and dgemm of small matrices in large batches that are not degenerate
+// run on the kernels of gemm_small_batched.hpp, see rocblas_gemm_small_batched_select
+#define GEMM_API_BATCHED(prec, PREC, TYPE)                                         \
+    rocblas_status rocblas_##prec##gemm_strided_batched(ARGS_BATCHED(TYPE))        \
+    {                                                                              \
+        PREAMBLE_BATCHED(TYPE)                                                     \
+        GEMM_DEGENERATE(TYPE)                                                      \
+                                                                                   \
+        rocblas_int small_class = rocblas_gemm_small_batched_select(m, n, k, b_c); \
+        if(small_class >= 0)                                                       \
+            return rocblas_gemm_small_batched_template<TYPE>(small_class,          \
+                                                             handle,               \
+                                                             trans_a,              \
+                                                             trans_b,              \
+                                                             m,                    \
+                                                             n,                    \
+                                                             k,                    \
+                                                             alpha,                \
+                                                             A,                    \
+                                                             ld_a,                 \
+                                                             bs_a,                 \
+                                                             B,                    \
+                                                             ld_b,                 \
+                                                             bs_b,                 \
+                                                             beta,                 \
+                                                             C,                    \
+                                                             ld_c,                 \
+                                                             bs_c,                 \
+                                                             b_c);                 \
+                                                                                   \
+        TENSILE_TRANSPOSES(PREC, TYPE)                                             \
     }
 #define HGEMM_API(prec, PREC, TYPE)                 \
     rocblas_status rocblas_##prec##gemm(ARGS(TYPE)) \
@@ -437,6 +500,27 @@
         HTENSILE_TRANSPOSES(PREC, TYPE)                                     \
     }
 
+/*******************************************************************************
+ * Row-major vs Column-major
+ ******************************************************************************/
+// the row-major C := alpha*op( A )*op( B ) + beta*C is the column-major
+// C**T := alpha*op( B )**T*op( A )**T + beta*C**T on n by m, with A and B exchanged
+#define GEMM_API_ORDER(prec, TYPE)                                                          \
+    rocblas_status rocblas_##prec##gemm_order(ARGS_ORDER(TYPE))                             \
+    {                                                                                       \
+        if(nullptr == handle)                                                               \
+            return rocblas_status_invalid_handle;                                           \
+                                                                                            \
+        if(order == rocblas_order_column_major)                                             \
+            return rocblas_##prec##gemm(                                                    \
+                handle, trans_a, trans_b, m, n, k, alpha, A, ld_a, B, ld_b, beta, C, ld_c); \
+        else if(order == rocblas_order_row_major)                                           \
+            return rocblas_##prec##gemm(                                                    \
+                handle, trans_b, trans_a, n, m, k, alpha, B, ld_b, A, ld_a, beta, C, ld_c); \
+                                                                                            \
+        return rocblas_status_not_implemented;                                              \
+    }
+
 /*******************************************************************************
  * GEMM APIs
  ******************************************************************************/
@@ -446,3 +530,6 @@ GEMM_API(d, D, double)
 HGEMM_API_BATCHED(h, H, rocblas_half)
 GEMM_API_BATCHED(s, S, float)
 GEMM_API_BATCHED(d, D, double)
+GEMM_API_ORDER(h, rocblas_half)
+GEMM_API_ORDER(s, float)
+GEMM_API_ORDER(d, double)
@@ -177,3 +177,105 @@ static __device__ void geam_inplace_device(rocblas_operation transB,
         }
     }
 }
+
+// the element of op(X) for X**H, the identity for the real types
+template <typename T>
+static __device__ T geam_conj(T x)
+{
+    return x;
+}
+
+static __device__ rocblas_float_complex geam_conj(rocblas_float_complex x)
+{
+    x.y = -x.y;
+    return x;
+}
+
+static __device__ rocblas_double_complex geam_conj(rocblas_double_complex x)
+{
+    x.y = -x.y;
+    return x;
+}
+
+/*
+    C = alpha * op(A) + beta * op(B) by TILE x TILE tiles of C, a thread block of TILE x ROWS
+    threads per tile. A transposed operand is read along its columns, coalesced, into a tile in
+    shared memory, padded by a column so that reading it back along the rows of C hits
+    distinct banks. A (B) is not read when alpha (beta) is zero.
+*/
+template <typename T, const rocblas_int TILE, const rocblas_int ROWS>
+static __device__ void geam_tiled_device(rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         T alpha,
+                                         const T* __restrict__ A,
+                                         rocblas_int lda,
+                                         T beta,
+                                         const T* __restrict__ B,
+                                         rocblas_int ldb,
+                                         T* C,
+                                         rocblas_int ldc)
+{
+    __shared__ T sA[TILE][TILE + 1];
+    __shared__ T sB[TILE][TILE + 1];
+
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row0 = hipBlockIdx_x * TILE;
+    rocblas_int col0 = hipBlockIdx_y * TILE;
+
+    bool read_A = alpha != 0;
+    bool read_B = beta != 0;
+
+    bool tile_A = read_A && transA != rocblas_operation_none;
+    bool tile_B = read_B && transB != rocblas_operation_none;
+
+    // op(X)(row0 + k, col0 + tx) = X[col0 + tx + (row0 + k) * ldx] into sX[k][tx]
+    if(tile_A || tile_B)
+    {
+        for(rocblas_int k = ty; k < TILE; k += ROWS)
+        {
+            if(row0 + k < m && col0 + tx < n)
+            {
+                if(tile_A)
+                {
+                    T a       = A[col0 + tx + (size_t)(row0 + k) * lda];
+                    sA[k][tx] = transA == rocblas_operation_conjugate_transpose ? geam_conj(a) : a;
+                }
+                if(tile_B)
+                {
+                    T b       = B[col0 + tx + (size_t)(row0 + k) * ldb];
+                    sB[k][tx] = transB == rocblas_operation_conjugate_transpose ? geam_conj(b) : b;
+                }
+            }
+        }
+
+        __syncthreads();
+    }
+
+    rocblas_int row = row0 + tx;
+    if(row >= m)
+        return;
+
+    for(rocblas_int k = ty; k < TILE && col0 + k < n; k += ROWS)
+    {
+        rocblas_int col = col0 + k;
+
+        T a = 0;
+        if(read_A)
+        {
+            a = tile_A ? sA[tx][k] : A[row + (size_t)col * lda];
+        }
+
+        if(read_B)
+        {
+            T b                        = tile_B ? sB[tx][k] : B[row + (size_t)col * ldb];
+            C[row + (size_t)col * ldc] = fma(beta, b, alpha * a);
+        }
+        else
+        {
+            C[row + (size_t)col * ldc] = alpha * a;
+        }
+    }
+}
@@ -110,58 +110,58 @@ rocblas_status rocblas_gemm_strided_batched_template(rocblas_handle handle,
     ********************************************************************/
 
 template <>
-rocblas_status rocblas_gemm_template<rocblas_half>(rocblas_handle handle,
+inline rocblas_status rocblas_gemm_template<rocblas_half>(rocblas_handle handle,
+                                                          rocblas_operation transA,
+                                                          rocblas_operation transB,
+                                                          rocblas_int M,
+                                                          rocblas_int N,
+                                                          rocblas_int K,
+                                                          const rocblas_half* alpha,
+                                                          const rocblas_half* A,
+                                                          rocblas_int lda,
+                                                          const rocblas_half* B,
+                                                          rocblas_int ldb,
+                                                          const rocblas_half* beta,
+                                                          rocblas_half* C,
+                                                          rocblas_int ldc)
+{
+    return rocblas_hgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+inline rocblas_status rocblas_gemm_template<float>(rocblas_handle handle,
                                                    rocblas_operation transA,
                                                    rocblas_operation transB,
                                                    rocblas_int M,
                                                    rocblas_int N,
                                                    rocblas_int K,
-                                                   const rocblas_half* alpha,
-                                                   const rocblas_half* A,
+                                                   const float* alpha,
+                                                   const float* A,
                                                    rocblas_int lda,
-                                                   const rocblas_half* B,
+                                                   const float* B,
                                                    rocblas_int ldb,
-                                                   const rocblas_half* beta,
-                                                   rocblas_half* C,
+                                                   const float* beta,
+                                                   float* C,
                                                    rocblas_int ldc)
-{
-    return rocblas_hgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
-
-template <>
-rocblas_status rocblas_gemm_template<float>(rocblas_handle handle,
-                                            rocblas_operation transA,
-                                            rocblas_operation transB,
-                                            rocblas_int M,
-                                            rocblas_int N,
-                                            rocblas_int K,
-                                            const float* alpha,
-                                            const float* A,
-                                            rocblas_int lda,
-                                            const float* B,
-                                            rocblas_int ldb,
-                                            const float* beta,
-                                            float* C,
-                                            rocblas_int ldc)
 {
     return rocblas_sgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
-rocblas_status rocblas_gemm_template<double>(rocblas_handle handle,
-                                             rocblas_operation transA,
-                                             rocblas_operation transB,
-                                             rocblas_int M,
-                                             rocblas_int N,
-                                             rocblas_int K,
-                                             const double* alpha,
-                                             const double* A,
-                                             rocblas_int lda,
-                                             const double* B,
-                                             rocblas_int ldb,
-                                             const double* beta,
-                                             double* C,
-                                             rocblas_int ldc)
+inline rocblas_status rocblas_gemm_template<double>(rocblas_handle handle,
+                                                    rocblas_operation transA,
+                                                    rocblas_operation transB,
+                                                    rocblas_int M,
+                                                    rocblas_int N,
+                                                    rocblas_int K,
+                                                    const double* alpha,
+                                                    const double* A,
+                                                    rocblas_int lda,
+                                                    const double* B,
+                                                    rocblas_int ldb,
+                                                    const double* beta,
+                                                    double* C,
+                                                    rocblas_int ldc)
 {
     return rocblas_dgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
@@ -169,58 +169,60 @@ rocblas_status rocblas_gemm_template<double>(rocblas_handle handle,
 #if COMPLEX
 
 template <>
-rocblas_status rocblas_gemm_template<rocblas_half_complex>(rocblas_handle handle,
-                                                           rocblas_operation transA,
-                                                           rocblas_operation transB,
-                                                           rocblas_int M,
-                                                           rocblas_int N,
-                                                           rocblas_int K,
-                                                           const rocblas_half_complex* alpha,
-                                                           const rocblas_half_complex* A,
-                                                           rocblas_int lda,
-                                                           const rocblas_half_complex* B,
-                                                           rocblas_int ldb,
-                                                           const rocblas_half_complex* beta,
-                                                           rocblas_half_complex* C,
-                                                           rocblas_int ldc)
+inline rocblas_status rocblas_gemm_template<rocblas_half_complex>(rocblas_handle handle,
+                                                                  rocblas_operation transA,
+                                                                  rocblas_operation transB,
+                                                                  rocblas_int M,
+                                                                  rocblas_int N,
+                                                                  rocblas_int K,
+                                                                  const rocblas_half_complex* alpha,
+                                                                  const rocblas_half_complex* A,
+                                                                  rocblas_int lda,
+                                                                  const rocblas_half_complex* B,
+                                                                  rocblas_int ldb,
+                                                                  const rocblas_half_complex* beta,
+                                                                  rocblas_half_complex* C,
+                                                                  rocblas_int ldc)
 {
     return rocblas_qgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
-rocblas_status rocblas_gemm_template<rocblas_float_complex>(rocblas_handle handle,
-                                                            rocblas_operation transA,
-                                                            rocblas_operation transB,
-                                                            rocblas_int M,
-                                                            rocblas_int N,
-                                                            rocblas_int K,
-                                                            const rocblas_float_complex* alpha,
-                                                            const rocblas_float_complex* A,
-                                                            rocblas_int lda,
-                                                            const rocblas_float_complex* B,
-                                                            rocblas_int ldb,
-                                                            const rocblas_float_complex* beta,
-                                                            rocblas_float_complex* C,
-                                                            rocblas_int ldc)
+inline rocblas_status
+rocblas_gemm_template<rocblas_float_complex>(rocblas_handle handle,
+                                             rocblas_operation transA,
+                                             rocblas_operation transB,
+                                             rocblas_int M,
+                                             rocblas_int N,
+                                             rocblas_int K,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             const rocblas_float_complex* B,
+                                             rocblas_int ldb,
+                                             const rocblas_float_complex* beta,
+                                             rocblas_float_complex* C,
+                                             rocblas_int ldc)
 {
     return rocblas_cgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
-rocblas_status rocblas_gemm_template<rocblas_double_complex>(rocblas_handle handle,
-                                                             rocblas_operation transA,
-                                                             rocblas_operation transB,
-                                                             rocblas_int M,
-                                                             rocblas_int N,
-                                                             rocblas_int K,
-                                                             const rocblas_double_complex* alpha,
-                                                             const rocblas_double_complex* A,
-                                                             rocblas_int lda,
-                                                             const rocblas_double_complex* B,
-                                                             rocblas_int ldb,
-                                                             const rocblas_double_complex* beta,
-                                                             rocblas_double_complex* C,
-                                                             rocblas_int ldc)
+inline rocblas_status
+rocblas_gemm_template<rocblas_double_complex>(rocblas_handle handle,
+                                              rocblas_operation transA,
+                                              rocblas_operation transB,
+                                              rocblas_int M,
+                                              rocblas_int N,
+                                              rocblas_int K,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* A,
+                                              rocblas_int lda,
+                                              const rocblas_double_complex* B,
+                                              rocblas_int ldb,
+                                              const rocblas_double_complex* beta,
+                                              rocblas_double_complex* C,
+                                              rocblas_int ldc)
 {
     return rocblas_zgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
@@ -299,24 +301,24 @@ rocblas_status rocblas_gemm_template<rocblas_double_complex>(rocblas_handle hand
     ********************************************************************/
 
 template <>
-rocblas_status rocblas_gemm_strided_batched_template<rocblas_half>(rocblas_handle handle,
-                                                                   rocblas_operation transA,
-                                                                   rocblas_operation transB,
-                                                                   rocblas_int M,
-                                                                   rocblas_int N,
-                                                                   rocblas_int K,
-                                                                   const rocblas_half* alpha,
-                                                                   const rocblas_half* A,
-                                                                   rocblas_int lda,
-                                                                   rocblas_int bsa,
-                                                                   const rocblas_half* B,
-                                                                   rocblas_int ldb,
-                                                                   rocblas_int bsb,
-                                                                   const rocblas_half* beta,
-                                                                   rocblas_half* C,
-                                                                   rocblas_int ldc,
-                                                                   rocblas_int bsc,
-                                                                   rocblas_int batch_count)
+inline rocblas_status rocblas_gemm_strided_batched_template<rocblas_half>(rocblas_handle handle,
+                                                                          rocblas_operation transA,
+                                                                          rocblas_operation transB,
+                                                                          rocblas_int M,
+                                                                          rocblas_int N,
+                                                                          rocblas_int K,
+                                                                          const rocblas_half* alpha,
+                                                                          const rocblas_half* A,
+                                                                          rocblas_int lda,
+                                                                          rocblas_int bsa,
+                                                                          const rocblas_half* B,
+                                                                          rocblas_int ldb,
+                                                                          rocblas_int bsb,
+                                                                          const rocblas_half* beta,
+                                                                          rocblas_half* C,
+                                                                          rocblas_int ldc,
+                                                                          rocblas_int bsc,
+                                                                          rocblas_int batch_count)
 {
     return rocblas_hgemm_strided_batched(handle,
                                          transA,
@@ -339,24 +341,24 @@ rocblas_status rocblas_gemm_strided_batched_template<rocblas_half>(rocblas_handl
 }
 
 template <>
-rocblas_status rocblas_gemm_strided_batched_template<float>(rocblas_handle handle,
-                                                            rocblas_operation transA,
-                                                            rocblas_operation transB,
-                                                            rocblas_int M,
-                                                            rocblas_int N,
-                                                            rocblas_int K,
-                                                            const float* alpha,
-                                                            const float* A,
-                                                            rocblas_int lda,
-                                                            rocblas_int bsa,
-                                                            const float* B,
-                                                            rocblas_int ldb,
-                                                            rocblas_int bsb,
-                                                            const float* beta,
-                                                            float* C,
-                                                            rocblas_int ldc,
-                                                            rocblas_int bsc,
-                                                            rocblas_int batch_count)
+inline rocblas_status rocblas_gemm_strided_batched_template<float>(rocblas_handle handle,
+                                                                   rocblas_operation transA,
+                                                                   rocblas_operation transB,
+                                                                   rocblas_int M,
+                                                                   rocblas_int N,
+                                                                   rocblas_int K,
+                                                                   const float* alpha,
+                                                                   const float* A,
+                                                                   rocblas_int lda,
+                                                                   rocblas_int bsa,
+                                                                   const float* B,
+                                                                   rocblas_int ldb,
+                                                                   rocblas_int bsb,
+                                                                   const float* beta,
+                                                                   float* C,
+                                                                   rocblas_int ldc,
+                                                                   rocblas_int bsc,
+                                                                   rocblas_int batch_count)
 {
     return rocblas_sgemm_strided_batched(handle,
                                          transA,
@@ -379,24 +381,24 @@ rocblas_status rocblas_gemm_strided_batched_template<float>(rocblas_handle handl
 }
 
 template <>
-rocblas_status rocblas_gemm_strided_batched_template<double>(rocblas_handle handle,
-                                                             rocblas_operation transA,
-                                                             rocblas_operation transB,
-                                                             rocblas_int M,
-                                                             rocblas_int N,
-                                                             rocblas_int K,
-                                                             const double* alpha,
-                                                             const double* A,
-                                                             rocblas_int lda,
-                                                             rocblas_int bsa,
-                                                             const double* B,
-                                                             rocblas_int ldb,
-                                                             rocblas_int bsb,
-                                                             const double* beta,
-                                                             double* C,
-                                                             rocblas_int ldc,
-                                                             rocblas_int bsc,
-                                                             rocblas_int batch_count)
+inline rocblas_status rocblas_gemm_strided_batched_template<double>(rocblas_handle handle,
+                                                                    rocblas_operation transA,
+                                                                    rocblas_operation transB,
+                                                                    rocblas_int M,
+                                                                    rocblas_int N,
+                                                                    rocblas_int K,
+                                                                    const double* alpha,
+                                                                    const double* A,
+                                                                    rocblas_int lda,
+                                                                    rocblas_int bsa,
+                                                                    const double* B,
+                                                                    rocblas_int ldb,
+                                                                    rocblas_int bsb,
+                                                                    const double* beta,
+                                                                    double* C,
+                                                                    rocblas_int ldc,
+                                                                    rocblas_int bsc,
+                                                                    rocblas_int batch_count)
 {
     return rocblas_dgemm_strided_batched(handle,
                                          transA,
@@ -421,7 +423,7 @@ rocblas_status rocblas_gemm_strided_batched_template<double>(rocblas_handle hand
 #if COMPLEX
 
 template <>
-rocblas_status
+inline rocblas_status
 rocblas_gemm_strided_batched_template<rocblas_half_complex>(rocblas_handle handle,
                                                             rocblas_operation transA,
                                                             rocblas_operation transB,
@@ -462,7 +464,7 @@ rocblas_gemm_strided_batched_template<rocblas_half_complex>(rocblas_handle handl
 }
 
 template <>
-rocblas_status
+inline rocblas_status
 rocblas_gemm_strided_batched_template<rocblas_float_complex>(rocblas_handle handle,
                                                              rocblas_operation transA,
                                                              rocblas_operation transB,
@@ -503,7 +505,7 @@ rocblas_gemm_strided_batched_template<rocblas_float_complex>(rocblas_handle hand
 }
 
 template <>
-rocblas_status
+inline rocblas_status
 rocblas_gemm_strided_batched_template<rocblas_double_complex>(rocblas_handle handle,
                                                               rocblas_operation transA,
                                                               rocblas_operation transB,
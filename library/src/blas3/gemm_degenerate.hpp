@@ -0,0 +1,557 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _GEMM_DEGENERATE_HPP_
+#define _GEMM_DEGENERATE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "../blas1/device_template.h"
+#include "gemm_degenerate.h"
+#include "handle.h"
+
+// threads of the dot and gemv kernels, tile of the scale and ger kernel
+#define GEMM_DEGENERATE_NB 256
+#define GEMM_RANK1_DIM_X 64
+#define GEMM_RANK1_DIM_Y 4
+
+/*
+    the kernels below compute gemm on the shapes of rocblas_gemm_classify for the strided batch
+    picked by hipBlockIdx_y, a single gemm is a batch of one. C is not read when beta == 0.
+
+    S is T for scalars passed by value from the host or const T* for scalars on the device.
+*/
+
+/*
+    RANK1 == false:  C := beta*C
+    RANK1 == true:   C := alpha*u*v**T + beta*C,  u(i) = u[i*incu], v(j) = v[j*incv]
+
+    one element of C per thread, hipBlockIdx_x walks the DIM_X by DIM_Y tiles of C
+*/
+template <typename T, rocblas_int DIM_X, rocblas_int DIM_Y, bool RANK1, typename S>
+__global__ void gemm_rank1_kernel(rocblas_int m,
+                                  rocblas_int n,
+                                  S alpha_s,
+                                  const T* u,
+                                  rocblas_int incu,
+                                  rocblas_int bsu,
+                                  const T* v,
+                                  rocblas_int incv,
+                                  rocblas_int bsv,
+                                  S beta_s,
+                                  T* C,
+                                  rocblas_int ldc,
+                                  rocblas_int bsc)
+{
+    rocblas_int blocks_m = (m - 1) / DIM_X + 1;
+    rocblas_int i        = (hipBlockIdx_x % blocks_m) * DIM_X + hipThreadIdx_x;
+    rocblas_int j        = (hipBlockIdx_x / blocks_m) * DIM_Y + hipThreadIdx_y;
+
+    if(i >= m || j >= n)
+        return;
+
+    T beta = load_scalar(beta_s);
+    T* c   = load_batch_ptr(C, bsc) + i + (size_t)j * ldc;
+    T r    = beta == 0.0 ? 0.0 : beta * *c;
+
+    if(RANK1)
+    {
+        T alpha = load_scalar(alpha_s);
+        r += alpha * load_batch_ptr(u, bsu)[(size_t)i * incu] *
+             load_batch_ptr(v, bsv)[(size_t)j * incv];
+    }
+
+    *c = r;
+}
+
+/*
+    c(o) := alpha * sum_l P[o + l*ldp] * v[l*incv] + beta*c(o),  c(o) = c[o*incc], o < len
+
+    for P with consecutive outputs along its columns: one output per thread, so the block
+    reads P a column at a time. The runs of v every thread needs go through shared memory.
+*/
+template <typename T, rocblas_int NB, typename S>
+__global__ void gemm_gemv_kernel(rocblas_int len,
+                                 rocblas_int k,
+                                 S alpha_s,
+                                 const T* P,
+                                 rocblas_int ldp,
+                                 rocblas_int bsp,
+                                 const T* v,
+                                 rocblas_int incv,
+                                 rocblas_int bsv,
+                                 S beta_s,
+                                 T* c,
+                                 rocblas_int incc,
+                                 rocblas_int bsc)
+{
+    __shared__ T sv[NB];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int o  = hipBlockIdx_x * NB + tx;
+
+    const T* p = load_batch_ptr(P, bsp);
+    const T* x = load_batch_ptr(v, bsv);
+
+    T sum = 0.0;
+
+    for(rocblas_int l0 = 0; l0 < k; l0 += NB)
+    {
+        __syncthreads();
+        if(l0 + tx < k)
+            sv[tx] = x[(size_t)(l0 + tx) * incv];
+        __syncthreads();
+
+        if(o < len)
+            for(rocblas_int l = 0; l < NB && l0 + l < k; l++)
+                sum += p[o + (size_t)(l0 + l) * ldp] * sv[l];
+    }
+
+    if(o >= len)
+        return;
+
+    T alpha = load_scalar(alpha_s);
+    T beta  = load_scalar(beta_s);
+    T* y    = load_batch_ptr(c, bsc) + (size_t)o * incc;
+
+    *y = beta == 0.0 ? alpha * sum : alpha * sum + beta * *y;
+}
+
+/*
+    c(o) := alpha * sum_l P[o*ldp + l*incp] * v[l*incv] + beta*c(o),  c(o) = c[o*incc]
+
+    one dot product of length k per block, output o = hipBlockIdx_x. For P with the sum along
+    its columns, and for m == n == 1 where there is a single output.
+*/
+template <typename T, rocblas_int NB, typename S>
+__global__ void gemm_dot_kernel(rocblas_int k,
+                                S alpha_s,
+                                const T* P,
+                                rocblas_int ldp,
+                                rocblas_int incp,
+                                rocblas_int bsp,
+                                const T* v,
+                                rocblas_int incv,
+                                rocblas_int bsv,
+                                S beta_s,
+                                T* c,
+                                rocblas_int incc,
+                                rocblas_int bsc)
+{
+    __shared__ T sdot[NB];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int o  = hipBlockIdx_x;
+
+    const T* p = load_batch_ptr(P, bsp) + (size_t)o * ldp;
+    const T* x = load_batch_ptr(v, bsv);
+
+    T sum = 0.0;
+    for(rocblas_int l = tx; l < k; l += NB)
+        sum += p[(size_t)l * incp] * x[(size_t)l * incv];
+
+    sdot[tx] = sum;
+
+    rocblas_sum_reduce<NB, T>(tx, sdot);
+
+    if(tx == 0)
+    {
+        T alpha = load_scalar(alpha_s);
+        T beta  = load_scalar(beta_s);
+        T* y    = load_batch_ptr(c, bsc) + (size_t)o * incc;
+
+        *y = beta == 0.0 ? alpha * sdot[0] : alpha * sdot[0] + beta * *y;
+    }
+}
+
+/*
+    op( A )(i, l) is A[i*inc_i + l*inc_l] with (inc_i, inc_l) = (1, lda) for
+    rocblas_operation_none and (lda, 1) otherwise, op( B )(l, j) likewise. The gemv shapes take
+    gemm_gemv_kernel when their outputs are contiguous in memory and gemm_dot_kernel when their
+    sums are. batch_count is at most ROCBLAS_MAX_BATCH_GRID, it is grid.y of every launch.
+*/
+template <typename T, typename S>
+rocblas_status gemm_degenerate_launch_chunk(rocblas_gemm_shape shape,
+                                            hipStream_t rocblas_stream,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            S alpha,
+                                            const T* A,
+                                            rocblas_int lda,
+                                            rocblas_int bsa,
+                                            const T* B,
+                                            rocblas_int ldb,
+                                            rocblas_int bsb,
+                                            S beta,
+                                            T* C,
+                                            rocblas_int ldc,
+                                            rocblas_int bsc,
+                                            rocblas_int batch_count)
+{
+    bool a_none = trans_a == rocblas_operation_none;
+    bool b_none = trans_b == rocblas_operation_none;
+
+    // strides of op( A ) along its rows and columns, and of op( B )
+    rocblas_int a_inc_i = a_none ? 1 : lda;
+    rocblas_int a_inc_l = a_none ? lda : 1;
+    rocblas_int b_inc_l = b_none ? 1 : ldb;
+    rocblas_int b_inc_j = b_none ? ldb : 1;
+
+    dim3 threads(GEMM_DEGENERATE_NB);
+
+    switch(shape)
+    {
+    case rocblas_gemm_shape_scale:
+    case rocblas_gemm_shape_ger:
+    {
+        rocblas_int blocks_m = (m - 1) / GEMM_RANK1_DIM_X + 1;
+        rocblas_int blocks_n = (n - 1) / GEMM_RANK1_DIM_Y + 1;
+
+        dim3 grid(blocks_m * blocks_n, batch_count);
+        dim3 rank1_threads(GEMM_RANK1_DIM_X, GEMM_RANK1_DIM_Y);
+
+        if(shape == rocblas_gemm_shape_scale)
+        {
+            hipLaunchKernelGGL((gemm_rank1_kernel<T, GEMM_RANK1_DIM_X, GEMM_RANK1_DIM_Y, false>),
+                               grid,
+                               rank1_threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               a_inc_i,
+                               bsa,
+                               B,
+                               b_inc_j,
+                               bsb,
+                               beta,
+                               C,
+                               ldc,
+                               bsc);
+        }
+        else
+        {
+            hipLaunchKernelGGL((gemm_rank1_kernel<T, GEMM_RANK1_DIM_X, GEMM_RANK1_DIM_Y, true>),
+                               grid,
+                               rank1_threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               a_inc_i,
+                               bsa,
+                               B,
+                               b_inc_j,
+                               bsb,
+                               beta,
+                               C,
+                               ldc,
+                               bsc);
+        }
+        break;
+    }
+    case rocblas_gemm_shape_dot:
+    {
+        dim3 grid(1, batch_count);
+
+        hipLaunchKernelGGL((gemm_dot_kernel<T, GEMM_DEGENERATE_NB>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           k,
+                           alpha,
+                           A,
+                           0,
+                           a_inc_l,
+                           bsa,
+                           B,
+                           b_inc_l,
+                           bsb,
+                           beta,
+                           C,
+                           0,
+                           bsc);
+        break;
+    }
+    case rocblas_gemm_shape_gemv_n:
+    {
+        // C(i, 0) = alpha * sum_l op( A )(i, l) * op( B )(l, 0) + beta*C(i, 0)
+        if(a_none)
+        {
+            dim3 grid((m - 1) / GEMM_DEGENERATE_NB + 1, batch_count);
+
+            hipLaunchKernelGGL((gemm_gemv_kernel<T, GEMM_DEGENERATE_NB>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               m,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               bsa,
+                               B,
+                               b_inc_l,
+                               bsb,
+                               beta,
+                               C,
+                               1,
+                               bsc);
+        }
+        else
+        {
+            dim3 grid(m, batch_count);
+
+            hipLaunchKernelGGL((gemm_dot_kernel<T, GEMM_DEGENERATE_NB>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               1,
+                               bsa,
+                               B,
+                               b_inc_l,
+                               bsb,
+                               beta,
+                               C,
+                               1,
+                               bsc);
+        }
+        break;
+    }
+    case rocblas_gemm_shape_gemv_m:
+    {
+        // C(0, j) = alpha * sum_l op( B )(l, j) * op( A )(0, l) + beta*C(0, j)
+        if(!b_none)
+        {
+            dim3 grid((n - 1) / GEMM_DEGENERATE_NB + 1, batch_count);
+
+            hipLaunchKernelGGL((gemm_gemv_kernel<T, GEMM_DEGENERATE_NB>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               n,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               bsb,
+                               A,
+                               a_inc_l,
+                               bsa,
+                               beta,
+                               C,
+                               ldc,
+                               bsc);
+        }
+        else
+        {
+            dim3 grid(n, batch_count);
+
+            hipLaunchKernelGGL((gemm_dot_kernel<T, GEMM_DEGENERATE_NB>),
+                               grid,
+                               threads,
+                               0,
+                               rocblas_stream,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               1,
+                               bsb,
+                               A,
+                               a_inc_l,
+                               bsa,
+                               beta,
+                               C,
+                               ldc,
+                               bsc);
+        }
+        break;
+    }
+    default: return rocblas_status_not_implemented;
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    gemm_degenerate_launch_chunk over the batch in chunks of at most ROCBLAS_MAX_BATCH_GRID
+    problems, the launch errors are returned
+*/
+template <typename T, typename S>
+rocblas_status gemm_degenerate_launch(rocblas_gemm_shape shape,
+                                      hipStream_t rocblas_stream,
+                                      rocblas_operation trans_a,
+                                      rocblas_operation trans_b,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      S alpha,
+                                      const T* A,
+                                      rocblas_int lda,
+                                      rocblas_int bsa,
+                                      const T* B,
+                                      rocblas_int ldb,
+                                      rocblas_int bsb,
+                                      S beta,
+                                      T* C,
+                                      rocblas_int ldc,
+                                      rocblas_int bsc,
+                                      rocblas_int batch_count)
+{
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+    {
+        RETURN_IF_ROCBLAS_ERROR(gemm_degenerate_launch_chunk(shape,
+                                                             rocblas_stream,
+                                                             trans_a,
+                                                             trans_b,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             batch_offset(A, bsa, b0),
+                                                             lda,
+                                                             bsa,
+                                                             batch_offset(B, bsb, b0),
+                                                             ldb,
+                                                             bsb,
+                                                             beta,
+                                                             batch_offset(C, bsc, b0),
+                                                             ldc,
+                                                             bsc,
+                                                             batch_chunk(batch_count, b0)));
+    }
+
+    return get_rocblas_status_for_hip_status(hipGetLastError());
+}
+
+/*
+    the shape of a gemm that passed validateArgs. alpha is only read for the problems it was
+    validated for, validateArgs returns before its handle and pointer checks when m, n, k or
+    the batch count is 0.
+*/
+template <typename T>
+rocblas_gemm_shape rocblas_gemm_degenerate_shape(rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 const T* alpha,
+                                                 rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_gemm_shape_general;
+
+    bool alpha_zero = handle->pointer_mode == rocblas_pointer_mode_host && m > 0 && n > 0 &&
+                      k > 0 && batch_count > 0 && *alpha == 0.0;
+
+    return rocblas_gemm_classify(m, n, k, batch_count, alpha_zero);
+}
+
+/*
+    strided batched gemm of a shape other than rocblas_gemm_shape_general, with the arguments
+    validated by validateArgs
+*/
+template <typename T>
+rocblas_status rocblas_gemm_degenerate_template(rocblas_gemm_shape shape,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans_a,
+                                                rocblas_operation trans_b,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                const T* alpha,
+                                                const T* A,
+                                                rocblas_int lda,
+                                                rocblas_int bsa,
+                                                const T* B,
+                                                rocblas_int ldb,
+                                                rocblas_int bsb,
+                                                const T* beta,
+                                                T* C,
+                                                rocblas_int ldc,
+                                                rocblas_int bsc,
+                                                rocblas_int batch_count)
+{
+    // for k == 0 these were not checked, and only beta and C are used
+    if(nullptr == beta || nullptr == C)
+        return rocblas_status_invalid_pointer;
+    if(ldc < m)
+        return rocblas_status_invalid_size;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        return gemm_degenerate_launch(shape,
+                                      rocblas_stream,
+                                      trans_a,
+                                      trans_b,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      B,
+                                      ldb,
+                                      bsb,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      bsc,
+                                      batch_count);
+    }
+    else
+    {
+        T h_alpha = shape == rocblas_gemm_shape_scale ? 0.0 : *alpha;
+        T h_beta  = *beta;
+
+        if(shape == rocblas_gemm_shape_scale && 1.0 == h_beta)
+        {
+            return rocblas_status_success;
+        }
+
+        return gemm_degenerate_launch(shape,
+                                      rocblas_stream,
+                                      trans_a,
+                                      trans_b,
+                                      m,
+                                      n,
+                                      k,
+                                      h_alpha,
+                                      A,
+                                      lda,
+                                      bsa,
+                                      B,
+                                      ldb,
+                                      bsb,
+                                      h_beta,
+                                      C,
+                                      ldc,
+                                      bsc,
+                                      batch_count);
+    }
+}
+
+#endif
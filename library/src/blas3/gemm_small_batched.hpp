@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _GEMM_SMALL_BATCHED_HPP_
+#define _GEMM_SMALL_BATCHED_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "../blas1/device_template.h"
+#include "gemm_small_batched.h"
+#include "handle.h"
+
+/*
+    C_b := alpha * op(A_b) * op(B_b) + beta * C_b for the BATCHES problems of a block, problem
+    b = hipBlockIdx_x * BATCHES + hipThreadIdx_z, with m, n, k <= DIM.
+
+    op(A) and op(B) go to shared memory as DIM x DIM tiles, zero beyond m, n and k, so the
+    product runs the full DIM unrolled without bounds checks. A and B are read along the
+    columns of their storage whatever the operation, consecutive tx reading consecutive
+    elements, and the transposes happen on the store to shared memory. Thread (tx, ty) keeps
+    C(tx, ty + r * DIM_Y), r < DIM / DIM_Y, in registers.
+
+    S is T for scalars passed by value from the host or const T* for scalars on the device.
+*/
+template <typename T, rocblas_int DIM, rocblas_int DIM_Y, rocblas_int BATCHES, typename S>
+__global__ void gemm_small_batched_kernel(rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          S alpha_s,
+                                          const T* __restrict__ A,
+                                          rocblas_int lda,
+                                          rocblas_int bsa,
+                                          const T* __restrict__ B,
+                                          rocblas_int ldb,
+                                          rocblas_int bsb,
+                                          S beta_s,
+                                          T* C,
+                                          rocblas_int ldc,
+                                          rocblas_int bsc,
+                                          rocblas_int batch_count)
+{
+    __shared__ T sA[BATCHES][DIM][DIM + 1];
+    __shared__ T sB[BATCHES][DIM][DIM + 1];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+    rocblas_int tz = hipThreadIdx_z;
+
+    // the threads of a problem past the end of the batch still reach the barrier
+    rocblas_int batch = hipBlockIdx_x * BATCHES + tz;
+    bool active       = batch < batch_count;
+
+    bool a_none = trans_a == rocblas_operation_none;
+    bool b_none = trans_b == rocblas_operation_none;
+
+    rocblas_int rows_a = a_none ? m : k;
+    rocblas_int cols_a = a_none ? k : m;
+    rocblas_int rows_b = b_none ? k : n;
+    rocblas_int cols_b = b_none ? n : k;
+
+    // sA[i][l] = op(A)(i, l) and sB[l][j] = op(B)(l, j)
+    for(rocblas_int q = ty; q < DIM; q += DIM_Y)
+    {
+        T a = 0.0;
+        T b = 0.0;
+        if(active && tx < rows_a && q < cols_a)
+            a = A[(size_t)batch * bsa + tx + (size_t)q * lda];
+        if(active && tx < rows_b && q < cols_b)
+            b = B[(size_t)batch * bsb + tx + (size_t)q * ldb];
+
+        if(a_none)
+            sA[tz][tx][q] = a;
+        else
+            sA[tz][q][tx] = a;
+
+        if(b_none)
+            sB[tz][tx][q] = b;
+        else
+            sB[tz][q][tx] = b;
+    }
+
+    __syncthreads();
+
+    T sum[DIM / DIM_Y];
+    for(rocblas_int r = 0; r < DIM / DIM_Y; r++)
+        sum[r] = 0.0;
+
+#pragma unroll
+    for(rocblas_int l = 0; l < DIM; l++)
+    {
+        T a = sA[tz][tx][l];
+        for(rocblas_int r = 0; r < DIM / DIM_Y; r++)
+            sum[r] += a * sB[tz][l][ty + r * DIM_Y];
+    }
+
+    if(!active || tx >= m)
+        return;
+
+    T alpha = load_scalar(alpha_s);
+    T beta  = load_scalar(beta_s);
+
+    T* Cb = C + (size_t)batch * bsc;
+    for(rocblas_int r = 0; r < DIM / DIM_Y; r++)
+    {
+        rocblas_int j = ty + r * DIM_Y;
+        if(j < n)
+        {
+            // C is not read when beta == 0
+            size_t c = tx + (size_t)j * ldc;
+            Cb[c]    = beta == 0.0 ? alpha * sum[r] : alpha * sum[r] + beta * Cb[c];
+        }
+    }
+}
+
+template <typename T, rocblas_int CLASS>
+rocblas_status gemm_small_batched_launch(rocblas_handle handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const T* alpha,
+                                         const T* A,
+                                         rocblas_int lda,
+                                         rocblas_int bsa,
+                                         const T* B,
+                                         rocblas_int ldb,
+                                         rocblas_int bsb,
+                                         const T* beta,
+                                         T* C,
+                                         rocblas_int ldc,
+                                         rocblas_int bsc,
+                                         rocblas_int batch_count)
+{
+    constexpr rocblas_int DIM     = rocblas_gemm_small_batched_classes[CLASS].dim;
+    constexpr rocblas_int DIM_Y   = rocblas_gemm_small_batched_classes[CLASS].dim_y;
+    constexpr rocblas_int BATCHES = rocblas_gemm_small_batched_classes[CLASS].batches;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    dim3 grid((batch_count - 1) / BATCHES + 1);
+    dim3 threads(DIM, DIM_Y, BATCHES);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((gemm_small_batched_kernel<T, DIM, DIM_Y, BATCHES>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batch_count);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+
+        if(0.0 == h_alpha && 1.0 == h_beta)
+        {
+            return rocblas_status_success;
+        }
+
+        hipLaunchKernelGGL((gemm_small_batched_kernel<T, DIM, DIM_Y, BATCHES>),
+                           grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           h_alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           h_beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    strided batched gemm on the size class sbc of rocblas_gemm_small_batched_select, with the
+    arguments already validated
+*/
+template <typename T>
+rocblas_status rocblas_gemm_small_batched_template(rocblas_int sbc,
+                                                   rocblas_handle handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   rocblas_int k,
+                                                   const T* alpha,
+                                                   const T* A,
+                                                   rocblas_int lda,
+                                                   rocblas_int bsa,
+                                                   const T* B,
+                                                   rocblas_int ldb,
+                                                   rocblas_int bsb,
+                                                   const T* beta,
+                                                   T* C,
+                                                   rocblas_int ldc,
+                                                   rocblas_int bsc,
+                                                   rocblas_int batch_count)
+{
+    static_assert(GEMM_SMALL_BATCHED_CLASSES == 4, "one case per size class");
+
+#define GEMM_SMALL_BATCHED_CASE(CLASS)                                                        \
+    case CLASS:                                                                               \
+        return gemm_small_batched_launch<T, CLASS>(                                           \
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, \
+            bsc, batch_count);
+
+    switch(sbc)
+    {
+        GEMM_SMALL_BATCHED_CASE(0)
+        GEMM_SMALL_BATCHED_CASE(1)
+        GEMM_SMALL_BATCHED_CASE(2)
+        GEMM_SMALL_BATCHED_CASE(3)
+    }
+#undef GEMM_SMALL_BATCHED_CASE
+
+    return rocblas_status_not_implemented;
+}
+
+#endif
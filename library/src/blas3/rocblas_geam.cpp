@@ -149,6 +149,118 @@ __global__ void geam_inplace_kernel_device_pointer(rocblas_operation transB,
     geam_inplace_device(transB, m, n, *alpha, *beta, B, ldb, C, ldc);
 }
 
+// transposed operands, staged through shared memory by tiles
+template <typename T, const rocblas_int TILE, const rocblas_int ROWS>
+__global__ void geam_tiled_kernel_host_pointer(rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               const T alpha,
+                                               const T* __restrict__ A,
+                                               rocblas_int lda,
+                                               const T beta,
+                                               const T* __restrict__ B,
+                                               rocblas_int ldb,
+                                               T* C,
+                                               rocblas_int ldc)
+{
+    geam_tiled_device<T, TILE, ROWS>(transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+template <typename T, const rocblas_int TILE, const rocblas_int ROWS>
+__global__ void geam_tiled_kernel_device_pointer(rocblas_operation transA,
+                                                 rocblas_operation transB,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 const T* alpha,
+                                                 const T* __restrict__ A,
+                                                 rocblas_int lda,
+                                                 const T* beta,
+                                                 const T* __restrict__ B,
+                                                 rocblas_int ldb,
+                                                 T* C,
+                                                 rocblas_int ldc)
+{
+    geam_tiled_device<T, TILE, ROWS>(transA, transB, m, n, *alpha, A, lda, *beta, B, ldb, C, ldc);
+}
+
+#define GEAM_TILE 32
+#define GEAM_TILE_ROWS 8
+
+/*
+    C = alpha * op(A) + beta * op(B) with a transposed A or B by the tiled kernel, A (B) is not
+    read when alpha (beta) is zero. C must not alias a transposed operand.
+*/
+template <typename T>
+void rocblas_geam_tiled(rocblas_handle handle,
+                        rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_int m,
+                        rocblas_int n,
+                        const T* alpha,
+                        const T* A,
+                        rocblas_int lda,
+                        const T* beta,
+                        const T* B,
+                        rocblas_int ldb,
+                        T* C,
+                        rocblas_int ldc)
+{
+    rocblas_int blocksX = ((m - 1) / GEAM_TILE) + 1;
+    rocblas_int blocksY = ((n - 1) / GEAM_TILE) + 1;
+
+    dim3 geam_grid(blocksX, blocksY, 1);
+    dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS, 1);
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        T h_alpha_scalar = *alpha;
+        T h_beta_scalar  = *beta;
+        hipLaunchKernelGGL((geam_tiled_kernel_host_pointer<T, GEAM_TILE, GEAM_TILE_ROWS>),
+                           dim3(geam_grid),
+                           dim3(geam_threads),
+                           0,
+                           rocblas_stream,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           h_alpha_scalar,
+                           A,
+                           lda,
+                           h_beta_scalar,
+                           B,
+                           ldb,
+                           C,
+                           ldc);
+    }
+    else
+    {
+        hipLaunchKernelGGL((geam_tiled_kernel_device_pointer<T, GEAM_TILE, GEAM_TILE_ROWS>),
+                           dim3(geam_grid),
+                           dim3(geam_threads),
+                           0,
+                           rocblas_stream,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           lda,
+                           beta,
+                           B,
+                           ldb,
+                           C,
+                           ldc);
+    }
+}
+
+#undef GEAM_TILE
+#undef GEAM_TILE_ROWS
+
 /* ============================================================================================ */
 
 /*
@@ -490,10 +602,17 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
 
 #undef GEAM_DIM
         }
+        else if(transA != rocblas_operation_none)
+        {
+            // beta == 0
+            // transpose of A, B is not read
+            rocblas_geam_tiled<T>(
+                handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+        }
         else
         {
 // beta == 0
-// general case for any transA, lda, ldc
+// general case for any lda, ldc
 
 #define GEAM_DIM_X 16
 #define GEAM_DIM_Y 16
@@ -552,10 +671,17 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
 
 #undef GEAM_DIM
         }
+        else if(transB != rocblas_operation_none)
+        {
+            // alpha == 0
+            // transpose of B, A is not read
+            rocblas_geam_tiled<T>(
+                handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+        }
         else
         {
 // alpha == 0
-// general case for any transB, ldb, ldc
+// general case for any ldb, ldc
 
 #define GEAM_DIM_X 16
 #define GEAM_DIM_Y 16
@@ -631,9 +757,14 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
         }
 #undef GEAM_DIM
     }
+    else if(transA != rocblas_operation_none || transB != rocblas_operation_none)
+    {
+        // transposed A or B, coalesced through tiles in shared memory
+        rocblas_geam_tiled<T>(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    }
     else
     {
-// general case, any transA, transB, lda, ldb, ldc
+// general case, any lda, ldb, ldc
 
 #define GEAM_DIM_X 16
 #define GEAM_DIM_Y 16
@@ -692,6 +823,44 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/*! \brief BLAS Level 3 API
+
+    \details
+    geam_order performs geam on matrices stored in order. The row-major m by n matrices are the
+    column-major n by m transposes, and C**T := alpha * op( A )**T + beta * op( B )**T is the
+    column-major geam on n by m with the same operations.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_geam_order_template(rocblas_handle handle,
+                                           rocblas_order order,
+                                           rocblas_operation transA,
+                                           rocblas_operation transB,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           const T* A,
+                                           rocblas_int lda,
+                                           const T* beta,
+                                           const T* B,
+                                           rocblas_int ldb,
+                                           T* C,
+                                           rocblas_int ldc)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(order == rocblas_order_column_major)
+        return rocblas_geam_template<T>(
+            handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    else if(order == rocblas_order_row_major)
+        return rocblas_geam_template<T>(
+            handle, transA, transB, n, m, alpha, A, lda, beta, B, ldb, C, ldc);
+
+    return rocblas_status_not_implemented;
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -733,3 +902,41 @@ extern "C" rocblas_status rocblas_dgeam(rocblas_handle handle,
     return rocblas_geam_template<double>(
         handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
 }
+
+extern "C" rocblas_status rocblas_sgeam_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_operation transA,
+                                              rocblas_operation transB,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const float* alpha,
+                                              const float* A,
+                                              rocblas_int lda,
+                                              const float* beta,
+                                              const float* B,
+                                              rocblas_int ldb,
+                                              float* C,
+                                              rocblas_int ldc)
+{
+    return rocblas_geam_order_template<float>(
+        handle, order, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_dgeam_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_operation transA,
+                                              rocblas_operation transB,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const double* alpha,
+                                              const double* A,
+                                              rocblas_int lda,
+                                              const double* beta,
+                                              const double* B,
+                                              rocblas_int ldb,
+                                              double* C,
+                                              rocblas_int ldc)
+{
+    return rocblas_geam_order_template<double>(
+        handle, order, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
@@ -0,0 +1,435 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "gemm.hpp"
+#include "symm_device.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+// diagonal block size; the off-diagonal part of A is handed to GEMM in multiples of SYMM_BLOCK
+#define SYMM_BLOCK 64
+#define SYMM_DIM_XY 16
+
+template <typename T, rocblas_int DIM_XY, rocblas_int NB>
+__global__ void symm_diag_kernel_host_pointer(rocblas_side side,
+                                              rocblas_fill uplo,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const T alpha,
+                                              const T* A,
+                                              rocblas_int lda,
+                                              const T* B,
+                                              rocblas_int ldb,
+                                              const T beta,
+                                              T* C,
+                                              rocblas_int ldc)
+{
+    symm_diag_device<T, DIM_XY, NB>(side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <typename T, rocblas_int DIM_XY, rocblas_int NB>
+__global__ void symm_diag_kernel_device_pointer(rocblas_side side,
+                                                rocblas_fill uplo,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                const T* alpha,
+                                                const T* A,
+                                                rocblas_int lda,
+                                                const T* B,
+                                                rocblas_int ldb,
+                                                const T* beta,
+                                                T* C,
+                                                rocblas_int ldc)
+{
+    symm_diag_device<T, DIM_XY, NB>(side, uplo, m, n, *alpha, A, lda, B, ldb, *beta, C, ldc);
+}
+
+/*
+    Accumulates the off-diagonal blocks of sym(A)[j0:j0+nn, j0:j0+nn] into C.
+
+    The stored triangle is split recursively at a multiple of NB,
+
+        lower:  | A11     |     upper:  | A11 A12 |
+                | A21 A22 |             |     A22 |
+
+    and the stored off-diagonal rectangle Aoff (A21 or A12) is used twice by GEMM, once as is
+    and once transposed for its mirror image, so the full symmetric matrix is never formed.
+    C already holds beta * C plus the diagonal blocks, so every GEMM here uses beta = one.
+*/
+template <typename T, rocblas_int NB>
+rocblas_status rocblas_symm_offdiag(rocblas_handle handle,
+                                    rocblas_side side,
+                                    rocblas_fill uplo,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    rocblas_int j0,
+                                    rocblas_int nn,
+                                    const T* alpha,
+                                    const T* A,
+                                    rocblas_int lda,
+                                    const T* B,
+                                    rocblas_int ldb,
+                                    const T* one,
+                                    T* C,
+                                    rocblas_int ldc)
+{
+    if(nn <= NB)
+        return rocblas_status_success;
+
+    rocblas_int n1 = ((nn / 2 + NB - 1) / NB) * NB;
+    rocblas_int n2 = nn - n1;
+
+    // Aoff is ro by co, starting at (r0, c0) of A
+    rocblas_int r0 = uplo == rocblas_fill_lower ? j0 + n1 : j0;
+    rocblas_int c0 = uplo == rocblas_fill_lower ? j0 : j0 + n1;
+    rocblas_int ro = uplo == rocblas_fill_lower ? n2 : n1;
+    rocblas_int co = uplo == rocblas_fill_lower ? n1 : n2;
+
+    const T* Aoff = A + r0 + c0 * lda;
+
+    if(side == rocblas_side_left)
+    {
+        // C[r0, :] += Aoff * B[c0, :],  C[c0, :] += Aoff^T * B[r0, :]
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_template<T>(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         ro,
+                                                         n,
+                                                         co,
+                                                         alpha,
+                                                         Aoff,
+                                                         lda,
+                                                         B + c0,
+                                                         ldb,
+                                                         one,
+                                                         C + r0,
+                                                         ldc));
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_template<T>(handle,
+                                                         rocblas_operation_transpose,
+                                                         rocblas_operation_none,
+                                                         co,
+                                                         n,
+                                                         ro,
+                                                         alpha,
+                                                         Aoff,
+                                                         lda,
+                                                         B + r0,
+                                                         ldb,
+                                                         one,
+                                                         C + c0,
+                                                         ldc));
+    }
+    else
+    {
+        // C[:, c0] += B[:, r0] * Aoff,  C[:, r0] += B[:, c0] * Aoff^T
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_template<T>(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         m,
+                                                         co,
+                                                         ro,
+                                                         alpha,
+                                                         B + r0 * ldb,
+                                                         ldb,
+                                                         Aoff,
+                                                         lda,
+                                                         one,
+                                                         C + c0 * ldc,
+                                                         ldc));
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_template<T>(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_transpose,
+                                                         m,
+                                                         ro,
+                                                         co,
+                                                         alpha,
+                                                         B + c0 * ldb,
+                                                         ldb,
+                                                         Aoff,
+                                                         lda,
+                                                         one,
+                                                         C + r0 * ldc,
+                                                         ldc));
+    }
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_symm_offdiag<T, NB>(
+        handle, side, uplo, m, n, j0, n1, alpha, A, lda, B, ldb, one, C, ldc)));
+
+    return rocblas_symm_offdiag<T, NB>(
+        handle, side, uplo, m, n, j0 + n1, n2, alpha, A, lda, B, ldb, one, C, ldc);
+}
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYMM performs one of the matrix-matrix operations
+
+        C := alpha*A*B + beta*C   if side == rocblas_side_left,
+        C := alpha*B*A + beta*C   if side == rocblas_side_right,
+
+    where alpha and beta are scalars, A is a symmetric matrix of which only the uplo triangle
+    is stored, and B and C are m by n matrices.
+    The other triangle of A is never read, it is mirrored on the fly.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    side      rocblas_side.
+              rocblas_side_left:  C := alpha*A*B + beta*C, A is m by m.
+              rocblas_side_right: C := alpha*B*A + beta*C, A is n by n.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  the upper triangle of A is stored.
+              rocblas_fill_lower:  the lower triangle of A is stored.
+    @param[in]
+    m         rocblas_int. m >= 0
+    @param[in]
+    n         rocblas_int. n >= 0
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+              lda >= m if side == rocblas_side_left, lda >= n otherwise.
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B. ldb >= m.
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C. ldc >= m.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_symm_template(rocblas_handle handle,
+                                     rocblas_side side,
+                                     rocblas_fill uplo,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     const T* B,
+                                     rocblas_int ldb,
+                                     const T* beta,
+                                     T* C,
+                                     rocblas_int ldc)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsymm"),
+                  side,
+                  uplo,
+                  m,
+                  n,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+
+        std::string side_letter = rocblas_side_letter(side);
+        std::string uplo_letter = rocblas_fill_letter(uplo);
+
+        log_bench(handle,
+                  "./rocblas-bench -f symm -r",
+                  replaceX<T>("X"),
+                  "--side",
+                  side_letter,
+                  "--uplo",
+                  uplo_letter,
+                  "-m",
+                  m,
+                  "-n",
+                  n,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--ldb",
+                  ldb,
+                  "--beta",
+                  *beta,
+                  "--ldc",
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsymm"),
+                  side,
+                  uplo,
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // A is ka by ka
+    rocblas_int ka = side == rocblas_side_left ? m : n;
+
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_not_implemented;
+    else if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A || nullptr == B || nullptr == C)
+        return rocblas_status_invalid_pointer;
+    else if(m < 0 || n < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < ka || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(ldb < m || ldb < 1)
+        return rocblas_status_invalid_size;
+    else if(ldc < m || ldc < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode && 0 == *alpha && 1 == *beta)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    // diagonal blocks of A, also applies beta to all of C
+    dim3 grid((m - 1) / SYMM_DIM_XY + 1, (n - 1) / SYMM_DIM_XY + 1, 1);
+    dim3 threads(SYMM_DIM_XY, SYMM_DIM_XY, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((symm_diag_kernel_device_pointer<T, SYMM_DIM_XY, SYMM_BLOCK>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           side,
+                           uplo,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+        hipLaunchKernelGGL((symm_diag_kernel_host_pointer<T, SYMM_DIM_XY, SYMM_BLOCK>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           side,
+                           uplo,
+                           m,
+                           n,
+                           h_alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           h_beta,
+                           C,
+                           ldc);
+
+        if(0 == h_alpha)
+            return rocblas_status_success;
+    }
+
+    if(ka <= SYMM_BLOCK)
+        return rocblas_status_success;
+
+    // GEMM reads beta through the handle pointer mode, so in device mode one comes from the handle
+    const T h_one = 1;
+    const T* one  = &h_one;
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        RETURN_IF_ROCBLAS_ERROR(handle->get_device_one(&one));
+
+    return rocblas_symm_offdiag<T, SYMM_BLOCK>(
+        handle, side, uplo, m, n, 0, ka, alpha, A, lda, B, ldb, one, C, ldc);
+}
+
+#undef SYMM_BLOCK
+#undef SYMM_DIM_XY
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssymm(rocblas_handle handle,
+                                        rocblas_side side,
+                                        rocblas_fill uplo,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        const float* alpha,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        const float* B,
+                                        rocblas_int ldb,
+                                        const float* beta,
+                                        float* C,
+                                        rocblas_int ldc)
+{
+    return rocblas_symm_template<float>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_dsymm(rocblas_handle handle,
+                                        rocblas_side side,
+                                        rocblas_fill uplo,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        const double* alpha,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        const double* B,
+                                        rocblas_int ldb,
+                                        const double* beta,
+                                        double* C,
+                                        rocblas_int ldc)
+{
+    return rocblas_symm_template<double>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
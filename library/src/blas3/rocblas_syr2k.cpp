@@ -0,0 +1,397 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "syrk.hpp"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYR2K performs one of the symmetric rank 2k operations
+
+        C := alpha*op( A )*op( B )**T + alpha*op( B )*op( A )**T + beta*C,
+
+    where op( X ) = X or op( X ) = X**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix and op( A ), op( B ) are n by k matrices.
+    Only the uplo triangle of C is referenced and updated.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  C is an upper triangular matrix.
+              rocblas_fill_lower:  C is a  lower triangular matrix.
+    @param[in]
+    trans     rocblas_operation.
+              rocblas_operation_none:      op( X ) = X, A and B are n by k.
+              rocblas_operation_transpose: op( X ) = X**T, A and B are k by n.
+    @param[in]
+    n         rocblas_int. n >= 0
+    @param[in]
+    k         rocblas_int. k >= 0
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+              lda >= n if trans == rocblas_operation_none, lda >= k otherwise.
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one A matrix to the next (strided_batched only).
+    @param[in]
+    B         pointer storing matrix B on the GPU.
+    @param[in]
+    ldb       rocblas_int
+              specifies the leading dimension of B, same constraint as lda.
+    @param[in]
+    bsb       rocblas_int
+              stride from the start of one B matrix to the next (strided_batched only).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C. ldc >= n.
+    @param[in]
+    bsc       rocblas_int
+              stride from the start of one C matrix to the next (strided_batched only).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of syr2k's in the batch (strided_batched only).
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_syr2k_strided_batched_template(rocblas_handle handle,
+                                                      rocblas_fill uplo,
+                                                      rocblas_operation trans,
+                                                      rocblas_int n,
+                                                      rocblas_int k,
+                                                      const T* alpha,
+                                                      const T* A,
+                                                      rocblas_int lda,
+                                                      rocblas_int bsa,
+                                                      const T* B,
+                                                      rocblas_int ldb,
+                                                      rocblas_int bsb,
+                                                      const T* beta,
+                                                      T* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_int bsc,
+                                                      rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2k_strided_batched"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)B,
+                  ldb,
+                  bsb,
+                  *beta,
+                  (const void*&)C,
+                  ldc,
+                  bsc,
+                  batch_count);
+
+        std::string uplo_letter  = rocblas_fill_letter(uplo);
+        std::string trans_letter = rocblas_transpose_letter(trans);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syr2k_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "--transposeA",
+                  trans_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--bsa",
+                  bsa,
+                  "--ldb",
+                  ldb,
+                  "--bsb",
+                  bsb,
+                  "--beta",
+                  *beta,
+                  "--ldc",
+                  ldc,
+                  "--bsc",
+                  bsc,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2k_strided_batched"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)B,
+                  ldb,
+                  bsb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc,
+                  bsc,
+                  batch_count);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A || nullptr == B)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == C)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? n : k;
+
+    if(n < 0 || k < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < A_row || lda < 1 || ldb < A_row || ldb < 1)
+        return rocblas_status_invalid_size;
+    else if(ldc < n || ldc < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    return rocblas_syrkx_template<T, true>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_syr2k_template(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      const T* alpha,
+                                      const T* A,
+                                      rocblas_int lda,
+                                      const T* B,
+                                      rocblas_int ldb,
+                                      const T* beta,
+                                      T* C,
+                                      rocblas_int ldc)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2k"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+
+        std::string uplo_letter  = rocblas_fill_letter(uplo);
+        std::string trans_letter = rocblas_transpose_letter(trans);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syr2k -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "--transposeA",
+                  trans_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--ldb",
+                  ldb,
+                  "--beta",
+                  *beta,
+                  "--ldc",
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyr2k"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A || nullptr == B)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == C)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? n : k;
+    rocblas_int A_col = trans == rocblas_operation_none ? k : n;
+
+    if(n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < A_row || lda < 1 || ldb < A_row || ldb < 1)
+        return rocblas_status_invalid_size;
+    else if(ldc < n || ldc < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(n == 0)
+        return rocblas_status_success;
+
+    rocblas_int bsa = lda * A_col;
+    rocblas_int bsb = ldb * A_col;
+    rocblas_int bsc = ldc * n;
+
+    return rocblas_syrkx_template<T, true>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, 1);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssyr2k(rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_operation trans,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const float* alpha,
+                                         const float* A,
+                                         rocblas_int lda,
+                                         const float* B,
+                                         rocblas_int ldb,
+                                         const float* beta,
+                                         float* C,
+                                         rocblas_int ldc)
+{
+    return rocblas_syr2k_template<float>(
+        handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_dsyr2k(rocblas_handle handle,
+                                         rocblas_fill uplo,
+                                         rocblas_operation trans,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const double* alpha,
+                                         const double* A,
+                                         rocblas_int lda,
+                                         const double* B,
+                                         rocblas_int ldb,
+                                         const double* beta,
+                                         double* C,
+                                         rocblas_int ldc)
+{
+    return rocblas_syr2k_template<double>(
+        handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_ssyr2k_strided_batched(rocblas_handle handle,
+                                                         rocblas_fill uplo,
+                                                         rocblas_operation trans,
+                                                         rocblas_int n,
+                                                         rocblas_int k,
+                                                         const float* alpha,
+                                                         const float* A,
+                                                         rocblas_int lda,
+                                                         rocblas_int bsa,
+                                                         const float* B,
+                                                         rocblas_int ldb,
+                                                         rocblas_int bsb,
+                                                         const float* beta,
+                                                         float* C,
+                                                         rocblas_int ldc,
+                                                         rocblas_int bsc,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_syr2k_strided_batched_template<float>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsyr2k_strided_batched(rocblas_handle handle,
+                                                         rocblas_fill uplo,
+                                                         rocblas_operation trans,
+                                                         rocblas_int n,
+                                                         rocblas_int k,
+                                                         const double* alpha,
+                                                         const double* A,
+                                                         rocblas_int lda,
+                                                         rocblas_int bsa,
+                                                         const double* B,
+                                                         rocblas_int ldb,
+                                                         rocblas_int bsb,
+                                                         const double* beta,
+                                                         double* C,
+                                                         rocblas_int ldc,
+                                                         rocblas_int bsc,
+                                                         rocblas_int batch_count)
+{
+    return rocblas_syr2k_strided_batched_template<double>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
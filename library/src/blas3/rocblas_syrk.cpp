@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "syrk.hpp"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    xSYRK performs one of the symmetric rank k operations
+
+        C := alpha*op( A )*op( A )**T + beta*C,
+
+    where op( A ) = A or op( A ) = A**T, alpha and beta are scalars,
+    C is an n by n symmetric matrix and op( A ) is an n by k matrix.
+    Only the uplo triangle of C is referenced and updated.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      rocblas_fill.
+              rocblas_fill_upper:  C is an upper triangular matrix.
+              rocblas_fill_lower:  C is a  lower triangular matrix.
+    @param[in]
+    trans     rocblas_operation.
+              rocblas_operation_none:      op( A ) = A, A is n by k.
+              rocblas_operation_transpose: op( A ) = A**T, A is k by n.
+    @param[in]
+    n         rocblas_int. n >= 0
+    @param[in]
+    k         rocblas_int. k >= 0
+    @param[in]
+    alpha     specifies the scalar alpha.
+    @param[in]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A.
+              lda >= n if trans == rocblas_operation_none, lda >= k otherwise.
+    @param[in]
+    bsa       rocblas_int
+              stride from the start of one A matrix to the next (strided_batched only).
+    @param[in]
+    beta      specifies the scalar beta.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       rocblas_int
+              specifies the leading dimension of C. ldc >= n.
+    @param[in]
+    bsc       rocblas_int
+              stride from the start of one C matrix to the next (strided_batched only).
+    @param[in]
+    batch_count
+              rocblas_int
+              number of syrk's in the batch (strided_batched only).
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_syrk_strided_batched_template(rocblas_handle handle,
+                                                     rocblas_fill uplo,
+                                                     rocblas_operation trans,
+                                                     rocblas_int n,
+                                                     rocblas_int k,
+                                                     const T* alpha,
+                                                     const T* A,
+                                                     rocblas_int lda,
+                                                     rocblas_int bsa,
+                                                     const T* beta,
+                                                     T* C,
+                                                     rocblas_int ldc,
+                                                     rocblas_int bsc,
+                                                     rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyrk_strided_batched"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  *beta,
+                  (const void*&)C,
+                  ldc,
+                  bsc,
+                  batch_count);
+
+        std::string uplo_letter  = rocblas_fill_letter(uplo);
+        std::string trans_letter = rocblas_transpose_letter(trans);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syrk_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "--transposeA",
+                  trans_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--bsa",
+                  bsa,
+                  "--beta",
+                  *beta,
+                  "--ldc",
+                  ldc,
+                  "--bsc",
+                  bsc,
+                  "--batch",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyrk_strided_batched"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  bsa,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc,
+                  bsc,
+                  batch_count);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == C)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? n : k;
+
+    if(n < 0 || k < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < A_row || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(ldc < n || ldc < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    return rocblas_syrkx_template<T, false>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, A, lda, bsa, beta, C, ldc, bsc, batch_count);
+}
+
+template <typename T>
+rocblas_status rocblas_syrk_template(rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_operation trans,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int lda,
+                                     const T* beta,
+                                     T* C,
+                                     rocblas_int ldc)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyrk"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+
+        std::string uplo_letter  = rocblas_fill_letter(uplo);
+        std::string trans_letter = rocblas_transpose_letter(trans);
+
+        log_bench(handle,
+                  "./rocblas-bench -f syrk -r",
+                  replaceX<T>("X"),
+                  "--uplo",
+                  uplo_letter,
+                  "--transposeA",
+                  trans_letter,
+                  "-n",
+                  n,
+                  "-k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--lda",
+                  lda,
+                  "--beta",
+                  *beta,
+                  "--ldc",
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocblas_Xsyrk"),
+                  uplo,
+                  trans,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_not_implemented;
+    else if(nullptr == alpha || nullptr == beta)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(nullptr == C)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_int A_row = trans == rocblas_operation_none ? n : k;
+    rocblas_int A_col = trans == rocblas_operation_none ? k : n;
+
+    if(n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < A_row || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(ldc < n || ldc < 1)
+        return rocblas_status_invalid_size;
+
+    /*
+     * Quick return if possible. Not Argument error
+     */
+    if(n == 0)
+        return rocblas_status_success;
+
+    rocblas_int bsa = lda * A_col;
+    rocblas_int bsc = ldc * n;
+
+    return rocblas_syrkx_template<T, false>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, A, lda, bsa, beta, C, ldc, bsc, 1);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_ssyrk(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation trans,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const float* alpha,
+                                        const float* A,
+                                        rocblas_int lda,
+                                        const float* beta,
+                                        float* C,
+                                        rocblas_int ldc)
+{
+    return rocblas_syrk_template<float>(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_dsyrk(rocblas_handle handle,
+                                        rocblas_fill uplo,
+                                        rocblas_operation trans,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        const double* alpha,
+                                        const double* A,
+                                        rocblas_int lda,
+                                        const double* beta,
+                                        double* C,
+                                        rocblas_int ldc)
+{
+    return rocblas_syrk_template<double>(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+extern "C" rocblas_status rocblas_ssyrk_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_operation trans,
+                                                        rocblas_int n,
+                                                        rocblas_int k,
+                                                        const float* alpha,
+                                                        const float* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const float* beta,
+                                                        float* C,
+                                                        rocblas_int ldc,
+                                                        rocblas_int bsc,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_syrk_strided_batched_template<float>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, beta, C, ldc, bsc, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dsyrk_strided_batched(rocblas_handle handle,
+                                                        rocblas_fill uplo,
+                                                        rocblas_operation trans,
+                                                        rocblas_int n,
+                                                        rocblas_int k,
+                                                        const double* alpha,
+                                                        const double* A,
+                                                        rocblas_int lda,
+                                                        rocblas_int bsa,
+                                                        const double* beta,
+                                                        double* C,
+                                                        rocblas_int ldc,
+                                                        rocblas_int bsc,
+                                                        rocblas_int batch_count)
+{
+    return rocblas_syrk_strided_batched_template<double>(
+        handle, uplo, trans, n, k, alpha, A, lda, bsa, beta, C, ldc, bsc, batch_count);
+}
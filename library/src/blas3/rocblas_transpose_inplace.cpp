@@ -0,0 +1,410 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <limits>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "handle.h"
+#include "logging.h"
+#include "utility.h"
+
+#define TRANSPOSE_TILE 32
+#define TRANSPOSE_TILE_ROWS 8
+#define TRANSPOSE_NB 256
+
+// matrices of a launch, the limit of the y and z dimensions of the grid
+#define TRANSPOSE_MAX_BATCH 65535
+
+// bytes of carry workspace a rectangular transpose asks the handle for, the matrices of a launch
+// are cut down to fit it. A single matrix whose carry is larger still gets its own.
+#define TRANSPOSE_MAX_CARRY_BYTES (64 << 20)
+
+/*
+    in-place transpose of a square n by n matrix by pairs of TILE x TILE tiles, a thread block of
+    TILE x ROWS threads per pair: the tiles (bx, by) and (by, bx), bx < by, are read into shared
+    memory and written back swapped and transposed, a diagonal tile is transposed on its own.
+    The blocks below the diagonal of the grid have no work. hipBlockIdx_z picks the matrix of
+    the batch.
+*/
+template <typename T, const rocblas_int TILE, const rocblas_int ROWS>
+__global__ void transpose_square_kernel(rocblas_int n, T* A, rocblas_int lda, rocblas_int stride_a)
+{
+    rocblas_int bx = hipBlockIdx_x;
+    rocblas_int by = hipBlockIdx_y;
+
+    if(bx > by)
+        return;
+
+    A += (size_t)hipBlockIdx_z * stride_a;
+
+    // padded by a column so that reading a tile across its rows hits distinct banks
+    __shared__ T s1[TILE][TILE + 1];
+    __shared__ T s2[TILE][TILE + 1];
+
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+
+    // s1[k][tx] = A(bx * TILE + tx, by * TILE + k), s2[k][tx] = A(by * TILE + tx, bx * TILE + k)
+    for(rocblas_int k = ty; k < TILE; k += ROWS)
+    {
+        rocblas_int row = bx * TILE + tx;
+        rocblas_int col = by * TILE + k;
+        if(row < n && col < n)
+            s1[k][tx] = A[row + (size_t)col * lda];
+
+        row = by * TILE + tx;
+        col = bx * TILE + k;
+        if(bx != by && row < n && col < n)
+            s2[k][tx] = A[row + (size_t)col * lda];
+    }
+
+    __syncthreads();
+
+    for(rocblas_int k = ty; k < TILE; k += ROWS)
+    {
+        rocblas_int row = by * TILE + tx;
+        rocblas_int col = bx * TILE + k;
+        if(row < n && col < n)
+            A[row + (size_t)col * lda] = s1[tx][k];
+
+        row = bx * TILE + tx;
+        col = by * TILE + k;
+        if(bx != by && row < n && col < n)
+            A[row + (size_t)col * lda] = s2[tx][k];
+    }
+}
+
+// saves the value at the start of every segment of the plan, see rocblas_transpose_plans
+template <typename T>
+__global__ void transpose_carry_kernel(rocblas_int segments,
+                                       const rocblas_int* __restrict__ starts,
+                                       const T* A,
+                                       rocblas_int stride_a,
+                                       T* carry)
+{
+    rocblas_int s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    A += (size_t)hipBlockIdx_y * stride_a;
+
+    if(s < segments)
+    {
+        carry[s + (size_t)hipBlockIdx_y * segments] = A[starts[s]];
+    }
+}
+
+/*
+    in-place transpose of a contiguous m by n matrix, a thread per segment of the cycles of
+    P(k) = k * n mod (m * n - 1): the value saved at the start of the segment is moved to P of
+    the start, the value found there to the next position, and so on for lengths[s] moves.
+*/
+template <typename T>
+__global__ void transpose_cycles_kernel(rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int segments,
+                                        const rocblas_int* __restrict__ starts,
+                                        const rocblas_int* __restrict__ lengths,
+                                        T* A,
+                                        rocblas_int stride_a,
+                                        const T* __restrict__ carry)
+{
+    rocblas_int s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    A += (size_t)hipBlockIdx_y * stride_a;
+
+    if(s < segments)
+    {
+        size_t last = (size_t)m * n - 1;
+        size_t k    = starts[s];
+        T v         = carry[s + (size_t)hipBlockIdx_y * segments];
+
+        for(rocblas_int t = lengths[s]; t > 0; t--)
+        {
+            k     = k * n % last;
+            T tmp = A[k];
+            A[k]  = v;
+            v     = tmp;
+        }
+    }
+}
+
+/*
+    the transposes of batch_count m by n matrices stride_a elements apart: square ones by tiles,
+    contiguous rectangular ones along the cycles of the plan of the handle. The batch goes to the
+    grid in launches of at most TRANSPOSE_MAX_BATCH matrices, and of at most the matrices whose
+    carries fit in TRANSPOSE_MAX_CARRY_BYTES, which share the carry workspace.
+*/
+template <typename T>
+rocblas_status rocblas_transpose_inplace_launch(rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                T* A,
+                                                rocblas_int lda,
+                                                rocblas_int stride_a,
+                                                rocblas_int batch_count)
+{
+    /*
+     * Quick return if possible.
+     */
+    if(0 == m || 0 == n || 0 == batch_count)
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    rocblas_int max_batch = batch_count < TRANSPOSE_MAX_BATCH ? batch_count : TRANSPOSE_MAX_BATCH;
+
+    if(m == n)
+    {
+        rocblas_int tiles = (n - 1) / TRANSPOSE_TILE + 1;
+
+        dim3 threads(TRANSPOSE_TILE, TRANSPOSE_TILE_ROWS, 1);
+
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += max_batch)
+        {
+            rocblas_int batch = batch_count - b0 < max_batch ? batch_count - b0 : max_batch;
+
+            dim3 grid(tiles, tiles, batch);
+
+            hipLaunchKernelGGL((transpose_square_kernel<T, TRANSPOSE_TILE, TRANSPOSE_TILE_ROWS>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               n,
+                               A + (size_t)b0 * stride_a,
+                               lda,
+                               stride_a);
+        }
+
+        return rocblas_status_success;
+    }
+
+    const rocblas_transpose_plans::plan* p;
+    RETURN_IF_ROCBLAS_ERROR(handle->transpose_plans.get(m, n, &p));
+
+    rocblas_int segments = p->starts.size();
+    if(0 == segments)
+        return rocblas_status_success;
+
+    size_t carry_size  = sizeof(T) * segments;
+    size_t carry_batch = TRANSPOSE_MAX_CARRY_BYTES / carry_size;
+    if(carry_batch < 1)
+        carry_batch = 1;
+    if(carry_batch < (size_t)max_batch)
+        max_batch = (rocblas_int)carry_batch;
+
+    // the values at the starts of the segments, in the device buffer of the handle
+    unsigned int* tickets;
+    void* results;
+    void* carry;
+    RETURN_IF_ROCBLAS_ERROR(handle->get_reduction_buffer(
+        0, 0, carry_size * max_batch, &tickets, &results, &carry));
+
+    const rocblas_int* starts  = p->device_segments;
+    const rocblas_int* lengths = p->device_segments + segments;
+
+    rocblas_int blocks = (segments - 1) / TRANSPOSE_NB + 1;
+
+    dim3 threads(TRANSPOSE_NB, 1, 1);
+
+    for(rocblas_int b0 = 0; b0 < batch_count; b0 += max_batch)
+    {
+        rocblas_int batch = batch_count - b0 < max_batch ? batch_count - b0 : max_batch;
+        T* A_batch        = A + (size_t)b0 * stride_a;
+
+        dim3 grid(blocks, batch, 1);
+
+        hipLaunchKernelGGL((transpose_carry_kernel<T>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           segments,
+                           starts,
+                           A_batch,
+                           stride_a,
+                           (T*)carry);
+
+        hipLaunchKernelGGL((transpose_cycles_kernel<T>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           rocblas_stream,
+                           m,
+                           n,
+                           segments,
+                           starts,
+                           lengths,
+                           A_batch,
+                           stride_a,
+                           (const T*)carry);
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+    the sizes of the in-place transposes: a square matrix may have any lda >= n, a rectangular
+    one must be contiguous, lda == m, and its m * n elements addressable by rocblas_int
+*/
+static rocblas_status rocblas_transpose_inplace_check_size(rocblas_int m,
+                                                           rocblas_int n,
+                                                           rocblas_int lda)
+{
+    if(m < 0 || n < 0)
+        return rocblas_status_invalid_size;
+    else if(lda < m || lda < 1)
+        return rocblas_status_invalid_size;
+    else if(m != n && lda != (m > 1 ? m : 1))
+        return rocblas_status_invalid_size;
+    else if((size_t)m * n > std::numeric_limits<rocblas_int>::max())
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_success;
+}
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    transpose_inplace overwrites the m by n matrix A by its n by m transpose A**T, without a
+    second matrix. A square matrix keeps its leading dimension lda. A rectangular matrix must
+    be contiguous, lda == m, and its transpose is contiguous too, with leading dimension n.
+
+    @param[in]
+    handle    rocblas_handle.
+              handle to the rocblas library context queue.
+    @param[in]
+    m         rocblas_int.
+    @param[in]
+    n         rocblas_int.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocblas_int
+              specifies the leading dimension of A, lda == max(1, m) if m != n.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_transpose_inplace_template(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, T* A, rocblas_int lda)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle, replaceX<T>("rocblas_Xtranspose_inplace"), m, n, (const void*&)A, lda);
+
+    log_bench(handle,
+              "./rocblas-bench -f transpose_inplace -r",
+              replaceX<T>("X"),
+              "-m",
+              m,
+              "-n",
+              n,
+              "--lda",
+              lda);
+
+    if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+
+    RETURN_IF_ROCBLAS_ERROR(rocblas_transpose_inplace_check_size(m, n, lda));
+
+    return rocblas_transpose_inplace_launch<T>(handle, m, n, A, lda, 0, 1);
+}
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    transpose_inplace_strided_batched transposes batch_count m by n matrices A_i in place, A_i
+    start stride_a elements apart. The matrices are as in transpose_inplace.
+
+    ********************************************************************/
+
+template <typename T>
+rocblas_status rocblas_transpose_inplace_strided_batched_template(rocblas_handle handle,
+                                                                  rocblas_int m,
+                                                                  rocblas_int n,
+                                                                  T* A,
+                                                                  rocblas_int lda,
+                                                                  rocblas_int stride_a,
+                                                                  rocblas_int batch_count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    log_trace(handle,
+              replaceX<T>("rocblas_Xtranspose_inplace_strided_batched"),
+              m,
+              n,
+              (const void*&)A,
+              lda,
+              stride_a,
+              batch_count);
+
+    log_bench(handle,
+              "./rocblas-bench -f transpose_inplace_batched -r",
+              replaceX<T>("X"),
+              "-m",
+              m,
+              "-n",
+              n,
+              "--lda",
+              lda,
+              "--batch",
+              batch_count);
+
+    if(nullptr == A)
+        return rocblas_status_invalid_pointer;
+    else if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    RETURN_IF_ROCBLAS_ERROR(rocblas_transpose_inplace_check_size(m, n, lda));
+
+    return rocblas_transpose_inplace_launch<T>(handle, m, n, A, lda, stride_a, batch_count);
+}
+
+/* ============================================================================================ */
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_stranspose_inplace(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda)
+{
+    return rocblas_transpose_inplace_template<float>(handle, m, n, A, lda);
+}
+
+extern "C" rocblas_status rocblas_dtranspose_inplace(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda)
+{
+    return rocblas_transpose_inplace_template<double>(handle, m, n, A, lda);
+}
+
+extern "C" rocblas_status rocblas_stranspose_inplace_strided_batched(rocblas_handle handle,
+                                                                     rocblas_int m,
+                                                                     rocblas_int n,
+                                                                     float* A,
+                                                                     rocblas_int lda,
+                                                                     rocblas_int stride_a,
+                                                                     rocblas_int batch_count)
+{
+    return rocblas_transpose_inplace_strided_batched_template<float>(
+        handle, m, n, A, lda, stride_a, batch_count);
+}
+
+extern "C" rocblas_status rocblas_dtranspose_inplace_strided_batched(rocblas_handle handle,
+                                                                     rocblas_int m,
+                                                                     rocblas_int n,
+                                                                     double* A,
+                                                                     rocblas_int lda,
+                                                                     rocblas_int stride_a,
+                                                                     rocblas_int batch_count)
+{
+    return rocblas_transpose_inplace_strided_batched_template<double>(
+        handle, m, n, A, lda, stride_a, batch_count);
+}
@@ -9,6 +9,7 @@
 #include "definitions.h"
 #include "gemm.hpp"
 #include "trtri_trsm.hpp"
+#include "trsm_small_device.h"
 #include "rocblas_unique_ptr.hpp"
 #include "handle.h"
 #include "logging.h"
@@ -638,6 +639,138 @@ rocblas_status rocblas_trsm_right(rocblas_handle handle,
 
 /* ============================================================================================ */
 
+/* ===============small==================================================== */
+
+template <typename T, rocblas_int DIM_K, rocblas_int NRHS>
+__global__ void trsm_small_kernel_host_pointer(rocblas_side side,
+                                               rocblas_fill uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal diag,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               const T alpha,
+                                               const T* A,
+                                               rocblas_int lda,
+                                               T* B,
+                                               rocblas_int ldb)
+{
+    trsm_small_device<T, DIM_K, NRHS>(side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <typename T, rocblas_int DIM_K, rocblas_int NRHS>
+__global__ void trsm_small_kernel_device_pointer(rocblas_side side,
+                                                 rocblas_fill uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_diagonal diag,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 const T* alpha,
+                                                 const T* A,
+                                                 rocblas_int lda,
+                                                 T* B,
+                                                 rocblas_int ldb)
+{
+    trsm_small_device<T, DIM_K, NRHS>(side, uplo, transA, diag, m, n, *alpha, A, lda, B, ldb);
+}
+
+template <typename T, rocblas_int DIM_K>
+void rocblas_trsm_small_launch(rocblas_handle handle,
+                               rocblas_side side,
+                               rocblas_fill uplo,
+                               rocblas_operation transA,
+                               rocblas_diagonal diag,
+                               rocblas_int m,
+                               rocblas_int n,
+                               const T* alpha,
+                               const T* A,
+                               rocblas_int lda,
+                               T* B,
+                               rocblas_int ldb)
+{
+    // 256 threads per block, DIM_K of them along one right hand side
+    static constexpr rocblas_int NRHS = 256 / DIM_K;
+
+    rocblas_int nrhs   = side == rocblas_side_left ? n : m;
+    rocblas_int blocks = (nrhs - 1) / NRHS + 1;
+
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(DIM_K, NRHS, 1);
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((trsm_small_kernel_device_pointer<T, DIM_K, NRHS>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           handle->rocblas_stream,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb);
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        hipLaunchKernelGGL((trsm_small_kernel_host_pointer<T, DIM_K, NRHS>),
+                           dim3(grid),
+                           dim3(threads),
+                           0,
+                           handle->rocblas_stream,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           h_alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb);
+    }
+}
+
+/*
+    single kernel trsm for k <= TRSM_SMALL_MAX_K: no invA / X workspace, no trtri, no gemm.
+    The triangle stays in shared memory and the solve is a substitution over registers,
+    the thread block shape follows k so small triangles do not leave most threads idle.
+*/
+template <typename T>
+rocblas_status rocblas_trsm_small(rocblas_handle handle,
+                                  rocblas_side side,
+                                  rocblas_fill uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal diag,
+                                  rocblas_int m,
+                                  rocblas_int n,
+                                  const T* alpha,
+                                  const T* A,
+                                  rocblas_int lda,
+                                  T* B,
+                                  rocblas_int ldb)
+{
+    rocblas_int k = (side == rocblas_side_left ? m : n);
+
+    if(k <= 16)
+        rocblas_trsm_small_launch<T, 16>(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    else if(k <= 32)
+        rocblas_trsm_small_launch<T, 32>(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    else
+        rocblas_trsm_small_launch<T, TRSM_SMALL_MAX_K>(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+
+    return rocblas_status_success;
+}
+
 /*! \brief BLAS Level 3 API
 
     \details
@@ -653,6 +786,9 @@ rocblas_status rocblas_trsm_right(rocblas_handle handle,
 
     The matrix X is overwritten on B.
 
+    When the order k of A is at most the handle threshold (ROCBLAS_TRSM_SMALL_K, default and
+    maximum 64) the solve runs as a single substitution kernel without the invA and X workspace.
+
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -815,6 +951,10 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
     if(m == 0 || n == 0)
         return rocblas_status_success;
 
+    // small triangles are solved by a single kernel, the crossover is tunable per handle
+    if(k <= handle->trsm_small_k && k <= TRSM_SMALL_MAX_K)
+        return rocblas_trsm_small<T>(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+
     // invA is of size BLOCK*k, BLOCK is the blocking size
     // used unique_ptr to avoid memory leak
     auto invA =
@@ -867,6 +1007,54 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
     return status;
 }
 
+/*! \brief BLAS Level 3 API
+
+    \details
+    trsm_order performs trsm on matrices stored in order. The row-major matrices are the
+    column-major transposes, and op( A )*X = alpha*B transposed is X**T*op( A )**T = alpha*B**T:
+    the column-major trsm on n by m from the other side, with the upper triangle of A stored as
+    the lower triangle of A**T and the same operation.
+
+    ********************************************************************/
+
+template <typename T, rocblas_int BLOCK>
+rocblas_status rocblas_trsm_order_template(rocblas_handle handle,
+                                           rocblas_order order,
+                                           rocblas_side side,
+                                           rocblas_fill uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal diag,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           const T* alpha,
+                                           T* A,
+                                           rocblas_int lda,
+                                           T* B,
+                                           rocblas_int ldb)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(order == rocblas_order_column_major)
+        return rocblas_trsm_template<T, BLOCK>(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    else if(order == rocblas_order_row_major)
+        return rocblas_trsm_template<T, BLOCK>(handle,
+                                               rocblas_side_flip(side),
+                                               rocblas_fill_flip(uplo),
+                                               transA,
+                                               diag,
+                                               n,
+                                               m,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb);
+
+    return rocblas_status_not_implemented;
+}
+
 /* ============================================================================================ */
 
 /*
@@ -914,3 +1102,39 @@ extern "C" rocblas_status rocblas_dtrsm(rocblas_handle handle,
     return rocblas_trsm_template<double, DTRSM_BLOCK>(
         handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
+
+extern "C" rocblas_status rocblas_strsm_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_side side,
+                                              rocblas_fill uplo,
+                                              rocblas_operation transA,
+                                              rocblas_diagonal diag,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const float* alpha,
+                                              float* A,
+                                              rocblas_int lda,
+                                              float* B,
+                                              rocblas_int ldb)
+{
+    return rocblas_trsm_order_template<float, 128>(
+        handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+extern "C" rocblas_status rocblas_dtrsm_order(rocblas_handle handle,
+                                              rocblas_order order,
+                                              rocblas_side side,
+                                              rocblas_fill uplo,
+                                              rocblas_operation transA,
+                                              rocblas_diagonal diag,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              const double* alpha,
+                                              double* A,
+                                              rocblas_int lda,
+                                              double* B,
+                                              rocblas_int ldb)
+{
+    return rocblas_trsm_order_template<double, DTRSM_BLOCK>(
+        handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
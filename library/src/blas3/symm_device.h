@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _SYMM_DEVICE_H_
+#define _SYMM_DEVICE_H_
+
+/*
+ * ===========================================================================
+ *    This file provide common device function for symm routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+/*
+    load s[i][j] = sym(A)(r0 + i, c0 + j) where only the uplo triangle of A is stored.
+    Elements with row >= r_lim or col >= c_lim are padded with zero.
+
+    r0 and c0 are multiples of DIM_XY, so a tile is either the diagonal tile (r0 == c0),
+    entirely in the stored triangle, or entirely in the mirrored triangle.
+    The mirrored tile is read as the transpose of a stored tile with the thread mapping swapped,
+    which keeps consecutive threads on consecutive addresses.
+*/
+template <typename T, rocblas_int DIM_XY>
+static __device__ void symm_load_sym_tile(rocblas_fill uplo,
+                                          const T* A,
+                                          rocblas_int lda,
+                                          rocblas_int r0,
+                                          rocblas_int c0,
+                                          rocblas_int r_lim,
+                                          rocblas_int c_lim,
+                                          T s[DIM_XY][DIM_XY + 1])
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+
+    bool mirrored = uplo == rocblas_fill_lower ? c0 > r0 : c0 < r0;
+
+    if(r0 == c0)
+    {
+        rocblas_int i = r0 + tx;
+        rocblas_int j = c0 + ty;
+        bool stored   = uplo == rocblas_fill_lower ? i >= j : i <= j;
+
+        if(i < r_lim && j < c_lim)
+            s[tx][ty] = stored ? A[i + j * lda] : A[j + i * lda];
+        else
+            s[tx][ty] = 0;
+    }
+    else if(mirrored)
+    {
+        // sym(A)(i, j) = A(j, i), tx walks down column i of A
+        rocblas_int i = r0 + ty;
+        rocblas_int j = c0 + tx;
+        s[ty][tx]     = (i < r_lim && j < c_lim) ? A[j + i * lda] : 0;
+    }
+    else
+    {
+        rocblas_int i = r0 + tx;
+        rocblas_int j = c0 + ty;
+        s[tx][ty]     = (i < r_lim && j < c_lim) ? A[i + j * lda] : 0;
+    }
+}
+
+// load s[i][j] = B(r0 + i, c0 + j) of a general matrix, zero padded
+template <typename T, rocblas_int DIM_XY>
+static __device__ void symm_load_tile(const T* B,
+                                      rocblas_int ldb,
+                                      rocblas_int r0,
+                                      rocblas_int c0,
+                                      rocblas_int r_lim,
+                                      rocblas_int c_lim,
+                                      T s[DIM_XY][DIM_XY + 1])
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+    rocblas_int i  = r0 + tx;
+    rocblas_int j  = c0 + ty;
+
+    s[tx][ty] = (i < r_lim && j < c_lim) ? B[i + j * ldb] : 0;
+}
+
+/*
+    computes the contribution of the NB * NB diagonal blocks of sym(A)
+
+        side == left:  C = alpha * sym(A)_diag * B + beta * C,   A is m by m
+        side == right: C = alpha * B * sym(A)_diag + beta * C,   A is n by n
+
+    grid is (ceil(m / DIM_XY), ceil(n / DIM_XY)), every element of C is written exactly once,
+    so beta is applied here and the off-diagonal blocks are accumulated by GEMM afterwards.
+*/
+template <typename T, rocblas_int DIM_XY, rocblas_int NB>
+static __device__ void symm_diag_device(rocblas_side side,
+                                        rocblas_fill uplo,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        T alpha,
+                                        const T* A,
+                                        rocblas_int lda,
+                                        const T* B,
+                                        rocblas_int ldb,
+                                        T beta,
+                                        T* C,
+                                        rocblas_int ldc)
+{
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row0 = hipBlockIdx_x * DIM_XY;
+    rocblas_int col0 = hipBlockIdx_y * DIM_XY;
+
+    __shared__ T sA[DIM_XY][DIM_XY + 1];
+    __shared__ T sB[DIM_XY][DIM_XY + 1];
+
+    T sum = 0;
+
+    // alpha is uniform across the block, A and B are not referenced when it is zero
+    if(alpha != 0)
+    {
+        if(side == rocblas_side_left)
+        {
+            rocblas_int b0 = (row0 / NB) * NB;
+            rocblas_int b1 = min(b0 + NB, m);
+
+            for(rocblas_int l0 = b0; l0 < b1; l0 += DIM_XY)
+            {
+                symm_load_sym_tile<T, DIM_XY>(uplo, A, lda, row0, l0, m, b1, sA);
+                symm_load_tile<T, DIM_XY>(B, ldb, l0, col0, b1, n, sB);
+
+                __syncthreads();
+
+                for(rocblas_int l = 0; l < DIM_XY; l++)
+                    sum += sA[tx][l] * sB[l][ty];
+
+                __syncthreads();
+            }
+        }
+        else
+        {
+            rocblas_int b0 = (col0 / NB) * NB;
+            rocblas_int b1 = min(b0 + NB, n);
+
+            for(rocblas_int l0 = b0; l0 < b1; l0 += DIM_XY)
+            {
+                symm_load_tile<T, DIM_XY>(B, ldb, row0, l0, m, b1, sB);
+                symm_load_sym_tile<T, DIM_XY>(uplo, A, lda, l0, col0, b1, n, sA);
+
+                __syncthreads();
+
+                for(rocblas_int l = 0; l < DIM_XY; l++)
+                    sum += sB[tx][l] * sA[l][ty];
+
+                __syncthreads();
+            }
+        }
+    }
+
+    rocblas_int row = row0 + tx;
+    rocblas_int col = col0 + ty;
+
+    if(row < m && col < n)
+    {
+        // beta == 0 must not read C, it may hold NaN on entry
+        if(beta == 0)
+            C[row + col * ldc] = alpha * sum;
+        else
+            C[row + col * ldc] = alpha * sum + beta * C[row + col * ldc];
+    }
+}
+
+#endif // _SYMM_DEVICE_H_
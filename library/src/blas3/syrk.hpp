@@ -0,0 +1,400 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _SYRK_HPP_
+#define _SYRK_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "status.h"
+#include "definitions.h"
+#include "gemm.hpp"
+#include "../blas1/device_template.h"
+#include "syrk_device.h"
+#include "handle.h"
+
+// diagonal block size; the off-diagonal part of C is handed to GEMM in multiples of SYRK_BLOCK
+#define SYRK_BLOCK 64
+#define SYRK_DIM_XY 16
+
+template <typename T, rocblas_int DIM_XY, rocblas_int NB, bool TWOK>
+__global__ void syrk_diag_kernel_host_pointer(rocblas_fill uplo,
+                                              rocblas_operation trans,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              const T alpha,
+                                              const T* A,
+                                              rocblas_int lda,
+                                              rocblas_int bsa,
+                                              const T* B,
+                                              rocblas_int ldb,
+                                              rocblas_int bsb,
+                                              const T beta,
+                                              T* C,
+                                              rocblas_int ldc,
+                                              rocblas_int bsc)
+{
+    syrk_diag_device<T, DIM_XY, NB, TWOK>(
+        uplo, trans, n, k, alpha, A, lda, bsa, B, ldb, bsb, beta, C, ldc, bsc);
+}
+
+template <typename T, rocblas_int DIM_XY, rocblas_int NB, bool TWOK>
+__global__ void syrk_diag_kernel_device_pointer(rocblas_fill uplo,
+                                                rocblas_operation trans,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                const T* alpha,
+                                                const T* A,
+                                                rocblas_int lda,
+                                                rocblas_int bsa,
+                                                const T* B,
+                                                rocblas_int ldb,
+                                                rocblas_int bsb,
+                                                const T* beta,
+                                                T* C,
+                                                rocblas_int ldc,
+                                                rocblas_int bsc)
+{
+    syrk_diag_device<T, DIM_XY, NB, TWOK>(
+        uplo, trans, n, k, *alpha, A, lda, bsa, B, ldb, bsb, *beta, C, ldc, bsc);
+}
+
+template <typename T>
+__global__ void syrk_scale_kernel_host_pointer(
+    rocblas_fill uplo, rocblas_int n, const T beta, T* C, rocblas_int ldc, rocblas_int bsc)
+{
+    syrk_scale_device<T>(uplo, n, beta, C, ldc, bsc);
+}
+
+template <typename T>
+__global__ void syrk_scale_kernel_device_pointer(
+    rocblas_fill uplo, rocblas_int n, const T* beta, T* C, rocblas_int ldc, rocblas_int bsc)
+{
+    syrk_scale_device<T>(uplo, n, *beta, C, ldc, bsc);
+}
+
+// pointer to row i of op(A)
+template <typename T>
+static const T* syrk_op_row(rocblas_operation trans, const T* A, rocblas_int lda, rocblas_int i)
+{
+    return trans == rocblas_operation_none ? A + i : A + (size_t)i * lda;
+}
+
+/*
+    Off-diagonal part of the referenced triangle of C[j0:j0+nn, j0:j0+nn].
+
+    The triangle is split recursively at a multiple of NB,
+
+        lower:  | C11     |     upper:  | C11 C12 |
+                | C21 C22 |             |     C22 |
+
+    C21 (or C12) is a full rectangle and goes to Tensile GEMM, C11 and C22 recurse.
+    Halving keeps the GEMMs large and square-ish instead of a sequence of NB wide panels,
+    and the unreferenced triangle is never visited.
+*/
+template <typename T, rocblas_int NB, bool TWOK>
+rocblas_status rocblas_syrk_offdiag(rocblas_handle handle,
+                                    rocblas_fill uplo,
+                                    rocblas_operation trans,
+                                    rocblas_int j0,
+                                    rocblas_int nn,
+                                    rocblas_int k,
+                                    const T* alpha,
+                                    const T* A,
+                                    rocblas_int lda,
+                                    rocblas_int bsa,
+                                    const T* B,
+                                    rocblas_int ldb,
+                                    rocblas_int bsb,
+                                    const T* beta,
+                                    const T* one,
+                                    T* C,
+                                    rocblas_int ldc,
+                                    rocblas_int bsc,
+                                    rocblas_int batch_count)
+{
+    if(nn <= NB)
+        return rocblas_status_success;
+
+    rocblas_int n1 = ((nn / 2 + NB - 1) / NB) * NB;
+    rocblas_int n2 = nn - n1;
+
+    // rows and columns of the rectangular block
+    rocblas_int r0 = uplo == rocblas_fill_lower ? j0 + n1 : j0;
+    rocblas_int c0 = uplo == rocblas_fill_lower ? j0 : j0 + n1;
+    rocblas_int mr = uplo == rocblas_fill_lower ? n2 : n1;
+    rocblas_int nc = uplo == rocblas_fill_lower ? n1 : n2;
+
+    // op(A) * op(B)^T expressed on the stored A and B
+    rocblas_operation transA =
+        trans == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose;
+    rocblas_operation transB =
+        trans == rocblas_operation_none ? rocblas_operation_transpose : rocblas_operation_none;
+
+    const T* A_row = syrk_op_row(trans, A, lda, r0);
+    const T* B_col = syrk_op_row(trans, B, ldb, c0);
+    T* C_block     = C + r0 + c0 * ldc;
+
+    RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_strided_batched_template<T>(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     mr,
+                                                                     nc,
+                                                                     k,
+                                                                     alpha,
+                                                                     A_row,
+                                                                     lda,
+                                                                     bsa,
+                                                                     B_col,
+                                                                     ldb,
+                                                                     bsb,
+                                                                     beta,
+                                                                     C_block,
+                                                                     ldc,
+                                                                     bsc,
+                                                                     batch_count));
+    if(TWOK)
+    {
+        const T* B_row = syrk_op_row(trans, B, ldb, r0);
+        const T* A_col = syrk_op_row(trans, A, lda, c0);
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_strided_batched_template<T>(handle,
+                                                                         transA,
+                                                                         transB,
+                                                                         mr,
+                                                                         nc,
+                                                                         k,
+                                                                         alpha,
+                                                                         B_row,
+                                                                         ldb,
+                                                                         bsb,
+                                                                         A_col,
+                                                                         lda,
+                                                                         bsa,
+                                                                         one,
+                                                                         C_block,
+                                                                         ldc,
+                                                                         bsc,
+                                                                         batch_count));
+    }
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_syrk_offdiag<T, NB, TWOK>(handle,
+                                                               uplo,
+                                                               trans,
+                                                               j0,
+                                                               n1,
+                                                               k,
+                                                               alpha,
+                                                               A,
+                                                               lda,
+                                                               bsa,
+                                                               B,
+                                                               ldb,
+                                                               bsb,
+                                                               beta,
+                                                               one,
+                                                               C,
+                                                               ldc,
+                                                               bsc,
+                                                               batch_count)));
+
+    return rocblas_syrk_offdiag<T, NB, TWOK>(handle,
+                                             uplo,
+                                             trans,
+                                             j0 + n1,
+                                             n2,
+                                             k,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             bsa,
+                                             B,
+                                             ldb,
+                                             bsb,
+                                             beta,
+                                             one,
+                                             C,
+                                             ldc,
+                                             bsc,
+                                             batch_count);
+}
+
+/*
+    Shared engine of syrk (TWOK == false, B == A) and syr2k (TWOK == true),
+    arguments are assumed to be validated by the caller.
+    Only the uplo triangle of C is read or written.
+*/
+template <typename T, bool TWOK>
+rocblas_status rocblas_syrkx_template(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      const T* alpha,
+                                      const T* A,
+                                      rocblas_int lda,
+                                      rocblas_int bsa,
+                                      const T* B,
+                                      rocblas_int ldb,
+                                      rocblas_int bsb,
+                                      const T* beta,
+                                      T* C,
+                                      rocblas_int ldc,
+                                      rocblas_int bsc,
+                                      rocblas_int batch_count)
+{
+    hipStream_t rocblas_stream = handle->rocblas_stream;
+
+    if(k == 0 || (rocblas_pointer_mode_host == handle->pointer_mode && 0 == *alpha))
+    {
+        // C = beta * C on the triangle
+        if(rocblas_pointer_mode_host == handle->pointer_mode && 1 == *beta)
+            return rocblas_status_success;
+
+        // one workgroup per tile of the triangle
+        rocblas_int blocks = (n - 1) / SYRK_DIM_XY + 1;
+        dim3 threads(SYRK_DIM_XY, SYRK_DIM_XY, 1);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+            {
+                dim3 grid(blocks * (blocks + 1) / 2, 1, batch_chunk(batch_count, b0));
+
+                hipLaunchKernelGGL((syrk_scale_kernel_device_pointer<T>),
+                                   dim3(grid),
+                                   dim3(threads),
+                                   0,
+                                   rocblas_stream,
+                                   uplo,
+                                   n,
+                                   beta,
+                                   batch_offset(C, bsc, b0),
+                                   ldc,
+                                   bsc);
+            }
+        }
+        else
+        {
+            T h_beta = *beta;
+            for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+            {
+                dim3 grid(blocks * (blocks + 1) / 2, 1, batch_chunk(batch_count, b0));
+
+                hipLaunchKernelGGL((syrk_scale_kernel_host_pointer<T>),
+                                   dim3(grid),
+                                   dim3(threads),
+                                   0,
+                                   rocblas_stream,
+                                   uplo,
+                                   n,
+                                   h_beta,
+                                   batch_offset(C, bsc, b0),
+                                   ldc,
+                                   bsc);
+            }
+        }
+        return rocblas_status_success;
+    }
+
+    // diagonal blocks
+    rocblas_int row_tiles = (n - 1) / SYRK_DIM_XY + 1;
+    dim3 threads(SYRK_DIM_XY, SYRK_DIM_XY, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 grid(row_tiles, SYRK_BLOCK / SYRK_DIM_XY, batch_chunk(batch_count, b0));
+
+            hipLaunchKernelGGL((syrk_diag_kernel_device_pointer<T, SYRK_DIM_XY, SYRK_BLOCK, TWOK>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               trans,
+                               n,
+                               k,
+                               alpha,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa,
+                               batch_offset(B, bsb, b0),
+                               ldb,
+                               bsb,
+                               beta,
+                               batch_offset(C, bsc, b0),
+                               ldc,
+                               bsc);
+        }
+    }
+    else
+    {
+        T h_alpha = *alpha;
+        T h_beta  = *beta;
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += ROCBLAS_MAX_BATCH_GRID)
+        {
+            dim3 grid(row_tiles, SYRK_BLOCK / SYRK_DIM_XY, batch_chunk(batch_count, b0));
+
+            hipLaunchKernelGGL((syrk_diag_kernel_host_pointer<T, SYRK_DIM_XY, SYRK_BLOCK, TWOK>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               rocblas_stream,
+                               uplo,
+                               trans,
+                               n,
+                               k,
+                               h_alpha,
+                               batch_offset(A, bsa, b0),
+                               lda,
+                               bsa,
+                               batch_offset(B, bsb, b0),
+                               ldb,
+                               bsb,
+                               h_beta,
+                               batch_offset(C, bsc, b0),
+                               ldc,
+                               bsc);
+        }
+    }
+
+    if(n <= SYRK_BLOCK)
+        return rocblas_status_success;
+
+    // syr2k accumulates its second product onto the first, GEMM reads beta = 1 through the
+    // handle pointer mode so in device mode the constant comes from the handle
+    const T h_one = 1;
+    const T* one  = &h_one;
+    if(TWOK && rocblas_pointer_mode_device == handle->pointer_mode)
+        RETURN_IF_ROCBLAS_ERROR(handle->get_device_one(&one));
+
+    return rocblas_syrk_offdiag<T, SYRK_BLOCK, TWOK>(handle,
+                                                     uplo,
+                                                     trans,
+                                                     0,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     lda,
+                                                     bsa,
+                                                     B,
+                                                     ldb,
+                                                     bsb,
+                                                     beta,
+                                                     one,
+                                                     C,
+                                                     ldc,
+                                                     bsc,
+                                                     batch_count);
+}
+
+#undef SYRK_BLOCK
+#undef SYRK_DIM_XY
+
+#endif // _SYRK_HPP_
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _SYRK_DEVICE_H_
+#define _SYRK_DEVICE_H_
+
+/*
+ * ===========================================================================
+ *    This file provide common device function for syrk / syr2k routines
+ * ===========================================================================
+ */
+
+/* ============================================================================================ */
+
+// load a DIM_XY * DIM_XY tile of op(A) starting at (i0, l0) into shared memory as s[i][l],
+// out of range elements are padded with zero so the inner product loop needs no bound check
+template <typename T, rocblas_int DIM_XY>
+static __device__ void syrk_load_tile(rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int k,
+                                      const T* A,
+                                      rocblas_int lda,
+                                      rocblas_int i0,
+                                      rocblas_int l0,
+                                      T s[DIM_XY][DIM_XY + 1])
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+
+    if(trans == rocblas_operation_none)
+    {
+        // op(A) = A, consecutive threads read down a column of A
+        rocblas_int i = i0 + tx;
+        rocblas_int l = l0 + ty;
+        s[tx][ty]     = (i < n && l < k) ? A[i + (size_t)l * lda] : 0;
+    }
+    else
+    {
+        // op(A) = A^T, consecutive threads read down a column of A, which is a row of op(A)
+        rocblas_int i = i0 + ty;
+        rocblas_int l = l0 + tx;
+        s[ty][tx]     = (i < n && l < k) ? A[l + (size_t)i * lda] : 0;
+    }
+}
+
+/*
+    computes the referenced triangle of the NB * NB diagonal blocks of
+
+        C = alpha * op(A) * op(B)^T + beta * C                      (TWOK == false)
+        C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C  (TWOK == true)
+
+    grid is (ceil(n / DIM_XY), NB / DIM_XY, batch chunk): hipBlockIdx_x picks a row tile,
+    hipBlockIdx_y picks a column tile inside the same diagonal block.
+    Tiles lying entirely in the unreferenced triangle return before touching memory;
+    the off-diagonal blocks are left to GEMM.
+*/
+template <typename T, rocblas_int DIM_XY, rocblas_int NB, bool TWOK>
+static __device__ void syrk_diag_device(rocblas_fill uplo,
+                                        rocblas_operation trans,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        T alpha,
+                                        const T* A,
+                                        rocblas_int lda,
+                                        rocblas_int bsa,
+                                        const T* B,
+                                        rocblas_int ldb,
+                                        rocblas_int bsb,
+                                        T beta,
+                                        T* C,
+                                        rocblas_int ldc,
+                                        rocblas_int bsc)
+{
+    rocblas_int tiles_per_block = NB / DIM_XY;
+    rocblas_int row_tile        = hipBlockIdx_x;
+    rocblas_int col_tile        = (row_tile / tiles_per_block) * tiles_per_block + hipBlockIdx_y;
+
+    if(col_tile * DIM_XY >= n)
+        return;
+    if(uplo == rocblas_fill_lower ? col_tile > row_tile : col_tile < row_tile)
+        return;
+
+    A += (size_t)hipBlockIdx_z * bsa;
+    B += (size_t)hipBlockIdx_z * bsb;
+    C += (size_t)hipBlockIdx_z * bsc;
+
+    rocblas_int tx   = hipThreadIdx_x;
+    rocblas_int ty   = hipThreadIdx_y;
+    rocblas_int row0 = row_tile * DIM_XY;
+    rocblas_int col0 = col_tile * DIM_XY;
+
+    __shared__ T sA_row[DIM_XY][DIM_XY + 1];
+    __shared__ T sB_col[DIM_XY][DIM_XY + 1];
+    // only referenced by syr2k for the transposed product op(B) * op(A)^T
+    __shared__ T sB_row[TWOK ? DIM_XY : 1][DIM_XY + 1];
+    __shared__ T sA_col[TWOK ? DIM_XY : 1][DIM_XY + 1];
+
+    T sum = 0;
+
+    for(rocblas_int l0 = 0; l0 < k; l0 += DIM_XY)
+    {
+        syrk_load_tile<T, DIM_XY>(trans, n, k, A, lda, row0, l0, sA_row);
+        syrk_load_tile<T, DIM_XY>(trans, n, k, B, ldb, col0, l0, sB_col);
+        if(TWOK)
+        {
+            syrk_load_tile<T, DIM_XY>(trans, n, k, B, ldb, row0, l0, sB_row);
+            syrk_load_tile<T, DIM_XY>(trans, n, k, A, lda, col0, l0, sA_col);
+        }
+
+        __syncthreads();
+
+        for(rocblas_int l = 0; l < DIM_XY; l++)
+        {
+            sum += sA_row[tx][l] * sB_col[ty][l];
+            if(TWOK)
+                sum += sB_row[tx][l] * sA_col[ty][l];
+        }
+
+        __syncthreads();
+    }
+
+    rocblas_int row = row0 + tx;
+    rocblas_int col = col0 + ty;
+
+    if(row < n && col < n && (uplo == rocblas_fill_lower ? row >= col : row <= col))
+    {
+        // beta == 0 must not read C, it may hold NaN on entry
+        if(beta == 0)
+            C[row + (size_t)col * ldc] = alpha * sum;
+        else
+            C[row + (size_t)col * ldc] = alpha * sum + beta * C[row + (size_t)col * ldc];
+    }
+}
+
+// C = beta * C on the referenced triangle, used when k == 0 or alpha == 0.
+// hipBlockIdx_x numbers the tiles of the triangle row by row of the lower triangle, tile t is
+// (r, c) with r * (r + 1) / 2 <= t < (r + 1) * (r + 2) / 2, and mirrored for upper
+template <typename T>
+static __device__ void syrk_scale_device(
+    rocblas_fill uplo, rocblas_int n, T beta, T* C, rocblas_int ldc, rocblas_int bsc)
+{
+    rocblas_int t = hipBlockIdx_x;
+    rocblas_int r = (rocblas_int)((sqrt(8.0 * t + 1.0) - 1.0) / 2.0);
+
+    // the square root may be off by one in either direction
+    while((r + 1) * (r + 2) / 2 <= t)
+        r++;
+    while(r * (r + 1) / 2 > t)
+        r--;
+
+    rocblas_int c        = t - r * (r + 1) / 2;
+    rocblas_int row_tile = uplo == rocblas_fill_lower ? r : c;
+    rocblas_int col_tile = uplo == rocblas_fill_lower ? c : r;
+
+    rocblas_int row = row_tile * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int col = col_tile * hipBlockDim_y + hipThreadIdx_y;
+
+    C += (size_t)hipBlockIdx_z * bsc;
+
+    // only the diagonal tiles straddle the unreferenced triangle
+    if(row < n && col < n && (uplo == rocblas_fill_lower ? row >= col : row <= col))
+    {
+        if(beta == 0)
+            C[row + (size_t)col * ldc] = 0;
+        else
+            C[row + (size_t)col * ldc] *= beta;
+    }
+}
+
+#endif // _SYRK_DEVICE_H_
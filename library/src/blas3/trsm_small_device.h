@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _TRSM_SMALL_DEVICE_H_
+#define _TRSM_SMALL_DEVICE_H_
+
+/*
+ * ===========================================================================
+ *    This file provide the device function of the single kernel small trsm
+ * ===========================================================================
+ */
+
+// largest order of A the single kernel path can hold in shared memory
+#define TRSM_SMALL_MAX_K 64
+
+/* ============================================================================================ */
+
+/*
+    solves op(A) * X = alpha * B (left) or X * op(A) = alpha * B (right) in place for k <= DIM_K,
+    where k is the order of A.
+
+    The right side is solved as op(A)^T * X^T = alpha * B^T, so both sides reduce to a triangular
+    k by k matrix M applied to nrhs independent vectors:
+        left:   M = op(A),    vector j is column j of B, nrhs = n
+        right:  M = op(A)^T,  vector j is row j of B,    nrhs = m
+
+    M is kept in shared memory for the whole solve. hipThreadIdx_x is the position i inside a
+    vector and hipThreadIdx_y picks one of the NRHS vectors of this block; every thread keeps its
+    x(i) in a register and the pivot x(p) is broadcast through shared memory, one step per row.
+*/
+template <typename T, rocblas_int DIM_K, rocblas_int NRHS>
+static __device__ void trsm_small_device(rocblas_side side,
+                                         rocblas_fill uplo,
+                                         rocblas_operation transA,
+                                         rocblas_diagonal diag,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         T alpha,
+                                         const T* A,
+                                         rocblas_int lda,
+                                         T* B,
+                                         rocblas_int ldb)
+{
+    rocblas_int tx = hipThreadIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+
+    bool left      = side == rocblas_side_left;
+    rocblas_int k  = left ? m : n;
+    rocblas_int nr = left ? n : m;
+    rocblas_int j  = hipBlockIdx_x * NRHS + ty;
+
+    // M(i, c) is A(i, c) when left and not transposed or right and transposed, A(c, i) otherwise
+    bool direct = left == (transA == rocblas_operation_none);
+    bool lower  = direct ? uplo == rocblas_fill_lower : uplo == rocblas_fill_upper;
+
+    // element i of vector j
+    T* b = left ? B + tx + j * ldb : B + j + tx * ldb;
+
+    // alpha == 0 must not read B, it may hold NaN on entry; alpha is the same for the whole block
+    if(alpha == 0)
+    {
+        if(tx < k && j < nr)
+            *b = 0;
+        return;
+    }
+
+    __shared__ T sM[DIM_K][DIM_K + 1];
+    __shared__ T spiv[NRHS];
+
+    for(rocblas_int c = ty; c < k; c += NRHS)
+    {
+        if(tx < k)
+        {
+            bool in_triangle = lower ? tx >= c : tx <= c;
+
+            if(tx == c && diag == rocblas_diagonal_unit)
+                sM[tx][c] = 1;
+            else if(in_triangle)
+                sM[tx][c] = direct ? A[tx + c * lda] : A[c + tx * lda];
+            else
+                sM[tx][c] = 0;
+        }
+    }
+
+    T x = 0;
+    if(tx < k && j < nr)
+        x = alpha * (*b);
+
+    __syncthreads();
+
+    for(rocblas_int s = 0; s < k; s++)
+    {
+        rocblas_int p = lower ? s : k - 1 - s;
+
+        if(tx == p)
+        {
+            if(diag != rocblas_diagonal_unit)
+                x = x / sM[p][p];
+            spiv[ty] = x;
+        }
+
+        __syncthreads();
+
+        if(tx < k && (lower ? tx > p : tx < p))
+            x -= sM[tx][p] * spiv[ty];
+
+        __syncthreads();
+    }
+
+    if(tx < k && j < nr)
+        *b = x;
+}
+
+#endif // _TRSM_SMALL_DEVICE_H_
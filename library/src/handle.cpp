@@ -8,6 +8,10 @@
 #include <sys/param.h>
 #include "logging.h"
 
+// the regions of the reduction buffer start at multiples of this many bytes
+#define REDUCTION_ALIGN 256
+#define REDUCTION_ALIGN_UP(size) (((size) + REDUCTION_ALIGN - 1) / REDUCTION_ALIGN * REDUCTION_ALIGN)
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -30,6 +34,28 @@ _rocblas_handle::_rocblas_handle()
         layer_mode = (rocblas_layer_mode)(atoi(str_layer_mode));
     }
 
+    // override the trsm small path crossover, rocblas-bench -f trsm_small_sweep measures it
+    char* str_trsm_small_k;
+    if((str_trsm_small_k = getenv("ROCBLAS_TRSM_SMALL_K")) != NULL)
+    {
+        trsm_small_k = atoi(str_trsm_small_k);
+    }
+
+    // bitwise reproducible reductions without changes to the application, e.g. for regression
+    // runs across devices
+    char* str_reduction_mode;
+    if((str_reduction_mode = getenv("ROCBLAS_REDUCTION_MODE")) != NULL)
+    {
+        reduction_mode = (rocblas_reduction_mode)(atoi(str_reduction_mode));
+    }
+
+    // compensated or double accumulation of long single precision reductions
+    char* str_accumulation_mode;
+    if((str_accumulation_mode = getenv("ROCBLAS_ACCUMULATION_MODE")) != NULL)
+    {
+        accumulation_mode = (rocblas_accumulation_mode)(atoi(str_accumulation_mode));
+    }
+
     // open log file
     if(layer_mode & rocblas_layer_mode_log_trace)
     {
@@ -52,6 +78,19 @@ _rocblas_handle::~_rocblas_handle()
 {
     // rocblas by default take the system default stream which user cannot destroy
 
+    // the result pointers of the asynchronous reductions must still be valid here
+    PRINT_IF_ROCBLAS_ERROR(result_slots.synchronize());
+
+    if(reduction_buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(reduction_buffer));
+    }
+
+    if(device_ones != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(device_ones));
+    }
+
     // Close log files
     if(log_trace_ofs.is_open())
     {
@@ -76,6 +115,14 @@ rocblas_status _rocblas_handle::set_stream(hipStream_t user_stream)
 {
 
     // TODO: check the user_stream valid or not
+
+    // the reduction buffer is shared by all calls on this handle, a reduction still running on
+    // the old stream must finish before the next one starts on the new stream
+    if(reduction_buffer != nullptr && user_stream != rocblas_stream)
+    {
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+    }
+
     rocblas_stream = user_stream;
     return rocblas_status_success;
 }
@@ -88,3 +135,152 @@ rocblas_status _rocblas_handle::get_stream(hipStream_t* stream) const
     *stream = rocblas_stream;
     return rocblas_status_success;
 }
+
+/*******************************************************************************
+ * get reduction buffer:
+   Returns the device memory of the single pass reductions (dot, nrm2, asum,
+   iamax, iamin) of batch_count vectors:
+   tickets  - one block counter per vector for the last block done pattern,
+              zero between launches because the last block of every vector
+              resets its counter
+   results  - batch_count results of result_size bytes, written by the
+              reduction in host pointer mode and copied back, see
+              copy_results_to_host; pinned host slots in
+              rocblas_host_result_mode_async
+   partials - partials_size bytes for the partial results of the blocks
+   The tickets stay at the start of the buffer and the buffer is only grown,
+   never shrunk, so repeated calls do not allocate.
+ ******************************************************************************/
+rocblas_status _rocblas_handle::get_reduction_buffer(rocblas_int batch_count,
+                                                     size_t result_size,
+                                                     size_t partials_size,
+                                                     unsigned int** tickets,
+                                                     void** results,
+                                                     void** partials)
+{
+    rocblas_int ticket_count = batch_count > reduction_tickets ? batch_count : reduction_tickets;
+
+    size_t tickets_size = REDUCTION_ALIGN_UP(sizeof(unsigned int) * ticket_count);
+    size_t results_size = REDUCTION_ALIGN_UP(result_size * batch_count);
+    size_t size         = tickets_size + results_size + partials_size;
+
+    if(size > reduction_buffer_size || ticket_count > reduction_tickets)
+    {
+        // hipFree waits for the kernels that still use the old buffer
+        if(reduction_buffer != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(reduction_buffer));
+        }
+
+        reduction_buffer      = nullptr;
+        reduction_buffer_size = 0;
+        reduction_tickets     = 0;
+
+        if(hipMalloc(&reduction_buffer, size) != hipSuccess)
+        {
+            reduction_buffer = nullptr;
+            return rocblas_status_memory_error;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(reduction_buffer, 0, tickets_size, rocblas_stream));
+
+        reduction_buffer_size = size;
+        reduction_tickets     = tickets_size / sizeof(unsigned int);
+    }
+
+    *tickets  = (unsigned int*)reduction_buffer;
+    *results  = (char*)reduction_buffer + tickets_size;
+    *partials = (char*)reduction_buffer + tickets_size + results_size;
+
+    // the results go to pinned host slots that stay in flight after the call returns
+    if(rocblas_pointer_mode_host == pointer_mode &&
+       rocblas_host_result_mode_async == host_result_mode)
+    {
+        RETURN_IF_ROCBLAS_ERROR(result_slots.acquire(result_size * batch_count, results));
+    }
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * copy results to host:
+   Ends a reduction in host pointer mode, the launch has written size bytes of
+   results to the slots returned by get_reduction_buffer. In the blocking host
+   result mode they are copied to results before the call returns, in
+   rocblas_host_result_mode_async the slots are pinned host memory put in
+   flight: the results reach results when rocblas_query_host_results or
+   rocblas_sync_host_results delivers them, and results must stay valid until
+   then.
+ ******************************************************************************/
+rocblas_status _rocblas_handle::copy_results_to_host(void* results, const void* slots, size_t size)
+{
+    if(rocblas_host_result_mode_async == host_result_mode)
+        return result_slots.commit(results, slots, size, rocblas_stream);
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(results, slots, size, hipMemcpyDeviceToHost));
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * wait host results:
+   Quick returns in host pointer mode write results on the host at once, after
+   the results still in flight to the same memory.
+ ******************************************************************************/
+rocblas_status _rocblas_handle::wait_host_results(const void* results, size_t size)
+{
+    return result_slots.wait(results, size);
+}
+
+/*******************************************************************************
+ * get device one:
+   Returns 1 of the type of one in device memory. The constants are allocated
+   and copied on the first call only, so later calls on the handle neither
+   allocate nor synchronize.
+ ******************************************************************************/
+static rocblas_status get_device_ones(rocblas_device_ones** device_ones)
+{
+    static const rocblas_device_ones host_ones = {{1.0, 0.0}, 1.0, {1.0f, 0.0f}, 1.0f};
+
+    if(*device_ones == nullptr)
+    {
+        if(hipMalloc((void**)device_ones, sizeof(rocblas_device_ones)) != hipSuccess)
+        {
+            *device_ones = nullptr;
+            return rocblas_status_memory_error;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            *device_ones, &host_ones, sizeof(rocblas_device_ones), hipMemcpyHostToDevice));
+    }
+
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::get_device_one(const float** one)
+{
+    RETURN_IF_ROCBLAS_ERROR(get_device_ones(&device_ones));
+    *one = &device_ones->s;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::get_device_one(const double** one)
+{
+    RETURN_IF_ROCBLAS_ERROR(get_device_ones(&device_ones));
+    *one = &device_ones->d;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::get_device_one(const rocblas_float_complex** one)
+{
+    RETURN_IF_ROCBLAS_ERROR(get_device_ones(&device_ones));
+    *one = &device_ones->c;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::get_device_one(const rocblas_double_complex** one)
+{
+    RETURN_IF_ROCBLAS_ERROR(get_device_ones(&device_ones));
+    *one = &device_ones->z;
+    return rocblas_status_success;
+}
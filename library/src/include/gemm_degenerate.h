@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_DEGENERATE_H
+#define GEMM_DEGENERATE_H
+
+#include "rocblas.h"
+
+/*******************************************************************************
+ * \brief the shapes of gemm that do not need a matrix-matrix kernel.
+ *
+ * With one of m, n or k equal to one, or nothing to multiply, gemm is a level
+ * 1 or level 2 operation. The Tensile tiles would compute it with all but one
+ * row or column of their threads idle, so these shapes run on the kernels of
+ * gemm_degenerate.hpp instead:
+ *
+ *   scale   k == 0 or alpha == 0     C := beta*C
+ *   dot     m == 1 and n == 1        one dot product of length k
+ *   gemv_n  n == 1                   C(:, 0) := alpha*op( A )*op( B )(:, 0) + beta*C(:, 0)
+ *   gemv_m  m == 1                   C(0, :) := alpha*op( A )(0, :)*op( B ) + beta*C(0, :)
+ *   ger     k == 1                   C := alpha*op( A )(:, 0)*op( B )(0, :) + beta*C
+ *
+ * the first that applies in that order. alpha is only known on the host in
+ * rocblas_pointer_mode_host, in device mode alpha_zero is false.
+ ******************************************************************************/
+typedef enum rocblas_gemm_shape_ {
+    rocblas_gemm_shape_general,
+    rocblas_gemm_shape_scale,
+    rocblas_gemm_shape_dot,
+    rocblas_gemm_shape_gemv_n,
+    rocblas_gemm_shape_gemv_m,
+    rocblas_gemm_shape_ger
+} rocblas_gemm_shape;
+
+// empty and invalid problems are general, they keep the quick returns and errors of Tensile
+inline rocblas_gemm_shape rocblas_gemm_classify(rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                rocblas_int batch_count,
+                                                bool alpha_zero)
+{
+    if(m < 1 || n < 1 || k < 0 || batch_count < 1)
+        return rocblas_gemm_shape_general;
+
+    if(k == 0 || alpha_zero)
+        return rocblas_gemm_shape_scale;
+    if(m == 1 && n == 1)
+        return rocblas_gemm_shape_dot;
+    if(n == 1)
+        return rocblas_gemm_shape_gemv_n;
+    if(m == 1)
+        return rocblas_gemm_shape_gemv_m;
+    if(k == 1)
+        return rocblas_gemm_shape_ger;
+
+    return rocblas_gemm_shape_general;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_SMALL_BATCHED_H
+#define GEMM_SMALL_BATCHED_H
+
+#include "rocblas.h"
+
+/*******************************************************************************
+ * \brief the size classes of the small matrix strided batched gemm.
+ *
+ * The Tensile solutions are tuned for large tiles. For m, n and k of a few tens
+ * most of their lanes idle and the per problem overhead dominates a large batch.
+ * A size class of the small engine keeps op(A) and op(B) of a problem in shared
+ * memory as dim x dim tiles, computes C with dim x dim_y threads, dim / dim_y of
+ * its elements per thread in registers, and packs batches problems into one
+ * workgroup of dim * dim_y * batches threads.
+ *
+ * A problem runs on the first class with m, n, k <= dim once batch_count reaches
+ * the min_batch_count of that class, smaller batches stay on Tensile. The table has
+ * no device code so the selection can be tested on the host.
+ *
+ * The min_batch_count values are untuned placeholders, not measured crossovers:
+ * they keep a single or few small gemms on Tensile and only take batches large
+ * enough to fill the device with the packed workgroups. They are to be replaced
+ * by the crossovers rocblas-bench -f gemm_strided_batched shows per class.
+ ******************************************************************************/
+struct rocblas_gemm_small_batched_class
+{
+    rocblas_int dim;
+    rocblas_int dim_y;
+    rocblas_int batches;
+    rocblas_int min_batch_count;
+};
+
+#define GEMM_SMALL_BATCHED_CLASSES 4
+
+constexpr rocblas_gemm_small_batched_class
+    rocblas_gemm_small_batched_classes[GEMM_SMALL_BATCHED_CLASSES] = {
+        {4, 4, 16, 256}, {8, 8, 4, 256}, {16, 4, 4, 512}, {32, 4, 2, 1024},
+};
+
+// index of the class that runs an m x n x k problem batch_count times, -1 for Tensile
+inline rocblas_int rocblas_gemm_small_batched_select(rocblas_int m,
+                                                     rocblas_int n,
+                                                     rocblas_int k,
+                                                     rocblas_int batch_count)
+{
+    if(m < 1 || n < 1 || k < 1)
+        return -1;
+
+    for(rocblas_int c = 0; c < GEMM_SMALL_BATCHED_CLASSES; c++)
+    {
+        const rocblas_gemm_small_batched_class& sbc = rocblas_gemm_small_batched_classes[c];
+
+        if(m <= sbc.dim && n <= sbc.dim && k <= sbc.dim)
+            return batch_count >= sbc.min_batch_count ? c : -1;
+    }
+
+    return -1;
+}
+
+#endif
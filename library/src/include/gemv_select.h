@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMV_SELECT_H
+#define GEMV_SELECT_H
+
+#include "rocblas.h"
+
+#define GEMVN_DIM_X 64 //
+#define GEMVN_DIM_Y 16 // GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
+
+// a transposed gemv of m <= GEMVT_THREAD_COLUMN_M and n <= GEMVT_THREAD_COLUMN_N runs a thread
+// per column
+#define GEMVT_THREAD_COLUMN_M 64
+#define GEMVT_THREAD_COLUMN_N 4096
+
+// fewer thread blocks than GEMV_MIN_BLOCKS leave the device idle, the split kernels launch about
+// GEMV_SPLIT_BLOCKS thread blocks of at least GEMV_SPLIT_MIN_LENGTH columns (rows) each
+#define GEMV_MIN_BLOCKS 64
+#define GEMV_SPLIT_BLOCKS 512
+#define GEMV_SPLIT_MIN_LENGTH 1024
+
+/*******************************************************************************
+ * \brief the kernels of gemv.
+ *
+ * The single pass kernels launch a thread block per 256 rows (tiled) or per
+ * column (column), a short-wide or tall-skinny A would leave most of the device
+ * idle: the columns (rows) are split between thread blocks instead, whose
+ * partial results are summed by a second kernel.
+ *
+ * A transposed gemv of a few rows runs a thread per column with x in shared
+ * memory. Its threads read A with a stride of lda, so it is only used while
+ * the column kernel, coalesced but with most of its threads idle, would launch
+ * few thread blocks.
+ *
+ * The thresholds above are starting points, not measured crossovers:
+ * rocblas-bench -f gemv_sweep times both aspect ratios across them.
+ ******************************************************************************/
+typedef enum rocblas_gemv_kernel_ {
+    rocblas_gemv_kernel_tiled,        // A x, blocks of 256 rows
+    rocblas_gemv_kernel_split_n,      // A x, blocks of 256 rows by blocks of columns
+    rocblas_gemv_kernel_column,       // A**T x, a thread block per column
+    rocblas_gemv_kernel_split_m,      // A**T x, a thread block per block of a column
+    rocblas_gemv_kernel_thread_column // A**T x, a thread per column of a short A
+} rocblas_gemv_kernel;
+
+// the kernel of a gemv from its shape, m and n > 0
+inline rocblas_gemv_kernel rocblas_gemv_select(rocblas_operation transA,
+                                               rocblas_int m,
+                                               rocblas_int n)
+{
+    if(transA == rocblas_operation_none)
+    {
+        rocblas_int blocks = (m - 1) / (GEMVN_DIM_X * 4) + 1;
+
+        if(blocks < GEMV_MIN_BLOCKS && n >= 2 * GEMV_SPLIT_MIN_LENGTH)
+            return rocblas_gemv_kernel_split_n;
+        else
+            return rocblas_gemv_kernel_tiled;
+    }
+
+    if(m <= GEMVT_THREAD_COLUMN_M && n <= GEMVT_THREAD_COLUMN_N)
+        return rocblas_gemv_kernel_thread_column;
+    else if(n < GEMV_MIN_BLOCKS && m >= 2 * GEMV_SPLIT_MIN_LENGTH)
+        return rocblas_gemv_kernel_split_m;
+    else
+        return rocblas_gemv_kernel_column;
+}
+
+#endif
@@ -9,6 +9,17 @@
 #include <fstream>
 
 #include "rocblas.h"
+#include "result_slots.h"
+#include "transpose_plans.h"
+
+// the constant 1 of the real and complex types, see _rocblas_handle::get_device_one
+struct rocblas_device_ones
+{
+    rocblas_double_complex z;
+    double d;
+    rocblas_float_complex c;
+    float s;
+};
 
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
@@ -25,6 +36,30 @@ struct _rocblas_handle
     rocblas_status set_stream(hipStream_t stream);
     rocblas_status get_stream(hipStream_t* stream) const;
 
+    // device memory of the single pass Level 1 reductions and of the partial results of the
+    // split gemv kernels, see get_reduction_buffer
+    rocblas_status get_reduction_buffer(rocblas_int batch_count,
+                                        size_t result_size,
+                                        size_t partials_size,
+                                        unsigned int** tickets,
+                                        void** results,
+                                        void** partials);
+
+    // results of the reductions in host pointer mode, written by the launch to the slots of
+    // get_reduction_buffer: copied to results now, or in rocblas_host_result_mode_async
+    // delivered by result_slots later
+    rocblas_status copy_results_to_host(void* results, const void* slots, size_t size);
+
+    // before the host writes results directly, see rocblas_result_slots::wait
+    rocblas_status wait_host_results(const void* results, size_t size);
+
+    // 1 in device memory, for the routines that pass beta = 1 on to GEMM or to a later pass of
+    // their own in device pointer mode
+    rocblas_status get_device_one(const float** one);
+    rocblas_status get_device_one(const double** one);
+    rocblas_status get_device_one(const rocblas_float_complex** one);
+    rocblas_status get_device_one(const rocblas_double_complex** one);
+
     rocblas_int device;
     hipDeviceProp_t device_properties;
 
@@ -34,9 +69,44 @@ struct _rocblas_handle
     // default pointer_mode is on host
     rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
 
+    // default reduction_mode lets the Level 1 reductions sum in any order, set from
+    // environment variable ROCBLAS_REDUCTION_MODE
+    rocblas_reduction_mode reduction_mode = rocblas_reduction_mode_default;
+
+    // default accumulation_mode sums in the type of the result, set from environment variable
+    // ROCBLAS_ACCUMULATION_MODE
+    rocblas_accumulation_mode accumulation_mode = rocblas_accumulation_mode_native;
+
+    // default host_result_mode makes the reductions wait for their results in host pointer mode
+    rocblas_host_result_mode host_result_mode = rocblas_host_result_mode_blocking;
+
     // default logging_mode is no logging
     rocblas_layer_mode layer_mode;
 
+    // trsm with k = m (left) or n (right) at or below this size uses the single kernel
+    // small path, set from environment variable ROCBLAS_TRSM_SMALL_K, 0 disables it.
+    // 64 is an untuned placeholder, not a measured crossover: it is TRSM_SMALL_MAX_K, the largest
+    // k the small path is written for. It is to be replaced by the crossover rocblas-bench -f
+    // trsm_small_sweep shows.
+    rocblas_int trsm_small_k = 64;
+
+    // persistent buffer of the Level 1 reductions, allocated on first use and grown on demand
+    void* reduction_buffer        = nullptr;
+    size_t reduction_buffer_size  = 0;
+    rocblas_int reduction_tickets = 0;
+
+    // device copy of rocblas_device_ones, allocated on first use
+    rocblas_device_ones* device_ones = nullptr;
+
+    // HIP events and pinned host memory of result_slots, declared first to outlive them
+    rocblas_hip_result_events result_events;
+
+    // pinned host slots of the results in rocblas_host_result_mode_async
+    rocblas_result_slots result_slots{result_events};
+
+    // cycle decompositions of the rectangular in-place transposes
+    rocblas_transpose_plans transpose_plans;
+
     std::ofstream log_trace_ofs;
     std::ofstream log_bench_ofs;
     std::ostream* log_trace_os;
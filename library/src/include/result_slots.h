@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef RESULT_SLOTS_H
+#define RESULT_SLOTS_H
+#include <hip/hip_runtime_api.h>
+#include <deque>
+#include <vector>
+
+#include "rocblas.h"
+
+/*******************************************************************************
+ * \brief rocblas_result_events is what rocblas_result_slots needs of the device:
+ * pinned host memory that kernels write to and events that tell when the work
+ * enqueued on a stream before them has completed. rocblas_hip_result_events is
+ * the HIP implementation the handle uses; the state machine of the slots does
+ * not call HIP itself, so it is tested on the host with a model of the stream.
+ ******************************************************************************/
+typedef void* rocblas_result_event;
+
+class rocblas_result_events
+{
+    public:
+    virtual ~rocblas_result_events() {}
+
+    // size bytes of pinned host memory and the address the device writes it at
+    virtual rocblas_status host_alloc(size_t size, void** host, void** device) = 0;
+    virtual rocblas_status host_free(void* host) = 0;
+
+    virtual rocblas_status create(rocblas_result_event* event) = 0;
+    virtual rocblas_status destroy(rocblas_result_event event) = 0;
+
+    // the event completes once the work enqueued on stream so far has completed
+    virtual rocblas_status record(rocblas_result_event event, hipStream_t stream) = 0;
+
+    // whether the event has completed, never waits
+    virtual rocblas_status query(rocblas_result_event event, bool* complete) = 0;
+
+    // waits for the event
+    virtual rocblas_status synchronize(rocblas_result_event event) = 0;
+};
+
+class rocblas_hip_result_events : public rocblas_result_events
+{
+    public:
+    virtual rocblas_status host_alloc(size_t size, void** host, void** device);
+    virtual rocblas_status host_free(void* host);
+    virtual rocblas_status create(rocblas_result_event* event);
+    virtual rocblas_status destroy(rocblas_result_event event);
+    virtual rocblas_status record(rocblas_result_event event, hipStream_t stream);
+    virtual rocblas_status query(rocblas_result_event event, bool* complete);
+    virtual rocblas_status synchronize(rocblas_result_event event);
+};
+
+/*******************************************************************************
+ * \brief rocblas_result_slots is the ring of pinned host memory that the Level 1
+ * reductions write their results to in rocblas_host_result_mode_async.
+ *
+ * A range of slots goes through
+ *     free -> in flight -> delivered -> free
+ * acquire() hands out free slots for a launch; commit() puts them in flight with an
+ * event recorded after the launch and the host memory the results go to; the
+ * results are delivered, copied from the slots to that memory, once the event has
+ * completed, in the order of the commits, by query() without waiting or by
+ * synchronize(), wait() and acquire() with waiting. Slots in flight are never
+ * handed out again, so a result is never overwritten before it is delivered.
+ * The memory and the events come from events, which must outlive the slots.
+ ******************************************************************************/
+class rocblas_result_slots
+{
+    public:
+    explicit rocblas_result_slots(rocblas_result_events& events) : events(events) {}
+    ~rocblas_result_slots();
+
+    rocblas_result_slots(const rocblas_result_slots&) = delete;
+    rocblas_result_slots& operator=(const rocblas_result_slots&) = delete;
+
+    // device address of size bytes of free slots, delivers the oldest results while none
+    rocblas_status acquire(size_t size, void** slots);
+
+    // puts size bytes of acquired slots in flight, written by the work enqueued on stream so
+    // far and delivered to results
+    rocblas_status commit(void* results, const void* slots, size_t size, hipStream_t stream);
+
+    // delivers the results whose work has completed without waiting, pending is the number
+    // of commits still in flight
+    rocblas_status query(rocblas_int* pending);
+
+    // waits for and delivers all the results in flight
+    rocblas_status synchronize();
+
+    // waits for and delivers the results in flight up to the last one to host memory
+    // overlapping results[0, size), before the host writes it directly
+    rocblas_status wait(const void* results, size_t size);
+
+    private:
+    struct in_flight
+    {
+        rocblas_result_event event;
+        void* results;
+        size_t offset;
+        size_t size;
+    };
+
+    rocblas_status deliver_oldest(bool blocking, bool* delivered);
+    bool overlaps_in_flight(size_t offset, size_t size) const;
+
+    rocblas_result_events& events;
+
+    char* host_slots   = nullptr;
+    char* device_slots = nullptr;
+    size_t capacity    = 0;
+    size_t head        = 0;
+
+    std::deque<in_flight> commits;
+    std::vector<rocblas_result_event> free_events;
+};
+
+#endif
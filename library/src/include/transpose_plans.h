@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TRANSPOSE_PLANS_H
+#define TRANSPOSE_PLANS_H
+#include <hip/hip_runtime_api.h>
+#include <deque>
+#include <vector>
+
+#include "rocblas.h"
+
+/*******************************************************************************
+ * \brief rocblas_transpose_plans caches the cycle decompositions of the in-place
+ * transposes of contiguous m by n matrices.
+ *
+ * A plan holds the segments of the cycles of the transpose, see
+ * rocblas_transpose_segments. The segments move disjoint elements, so they run
+ * in parallel once the values at their starts are saved: the workspace of a
+ * transpose is one value per segment and matrix, the plan two rocblas_int per
+ * segment, both O(m * n / TRANSPOSE_SEGMENT + cycles) rather than bounded.
+ *
+ * The plans are computed on the host, copied to the device on first use and kept
+ * for the TRANSPOSE_PLANS shapes used last.
+ ******************************************************************************/
+class rocblas_transpose_plans
+{
+    public:
+    struct plan
+    {
+        rocblas_int m;
+        rocblas_int n;
+        std::vector<rocblas_int> starts;
+        std::vector<rocblas_int> lengths;
+
+        // starts followed by lengths, on the device
+        rocblas_int* device_segments = nullptr;
+    };
+
+    rocblas_transpose_plans() = default;
+    ~rocblas_transpose_plans();
+
+    rocblas_transpose_plans(const rocblas_transpose_plans&) = delete;
+    rocblas_transpose_plans& operator=(const rocblas_transpose_plans&) = delete;
+
+    // the plan of an m by n matrix, computed on first use, valid until the next call
+    rocblas_status get(rocblas_int m, rocblas_int n, const plan** p);
+
+    private:
+    // most recently used first
+    std::deque<plan> plans;
+};
+
+#endif
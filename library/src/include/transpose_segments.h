@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TRANSPOSE_SEGMENTS_H
+#define TRANSPOSE_SEGMENTS_H
+
+#include <vector>
+
+#include "rocblas.h"
+
+// moves per segment, the work of a thread of the transpose
+#define TRANSPOSE_SEGMENT 256
+
+/*******************************************************************************
+ * \brief the segments of the in-place transpose of a contiguous m by n matrix.
+ *
+ * The element at k = i + j * m moves to P(k) = k * n mod (m * n - 1) for
+ * 0 < k < m * n - 1. The cycles of P are walked from their smallest position,
+ * the leader, and a new segment starts every TRANSPOSE_SEGMENT moves: starts[s]
+ * is the first position of segment s and lengths[s] its number of moves, the
+ * last one to the start of the next segment of the cycle. The fixed points of P
+ * are left out.
+ *
+ * A cycle of c moves has ceil(c / TRANSPOSE_SEGMENT) segments, so there are at
+ * most (m * n) / TRANSPOSE_SEGMENT segments plus one per cycle. No device code,
+ * so the decomposition can be tested on the host.
+ ******************************************************************************/
+inline void rocblas_transpose_segments(rocblas_int m,
+                                       rocblas_int n,
+                                       std::vector<rocblas_int>& starts,
+                                       std::vector<rocblas_int>& lengths)
+{
+    starts.clear();
+    lengths.clear();
+
+    size_t size = (size_t)m * n;
+    if(size < 3)
+        return;
+
+    size_t last = size - 1;
+    std::vector<bool> visited(size, false);
+
+    for(size_t leader = 1; leader < last; leader++)
+    {
+        if(visited[leader])
+            continue;
+
+        size_t first = starts.size();
+        size_t k     = leader;
+        size_t moves = 0;
+        do
+        {
+            if(moves % TRANSPOSE_SEGMENT == 0)
+            {
+                starts.push_back((rocblas_int)k);
+                lengths.push_back(0);
+            }
+            lengths.back()++;
+            moves++;
+
+            visited[k] = true;
+            k          = k * n % last;
+        } while(k != leader);
+
+        if(moves == 1)
+        {
+            starts.resize(first);
+            lengths.resize(first);
+        }
+    }
+}
+
+#endif
@@ -57,6 +57,12 @@ std::string rocblas_side_letter(rocblas_side side);
 std::string rocblas_fill_letter(rocblas_fill fill);
 std::string rocblas_diag_letter(rocblas_diagonal diag);
 
+// the operation, side and fill of a call on the transposes of its matrices, with which a
+// row-major call is computed by the column-major routines; see rocblas_order
+rocblas_operation rocblas_transpose_flip(rocblas_operation trans);
+rocblas_side rocblas_side_flip(rocblas_side side);
+rocblas_fill rocblas_fill_flip(rocblas_fill fill);
+
 // replaces X in string with s, d, c, z or h depending on typename T
 template <typename T>
 std::string replaceX(std::string input_string)
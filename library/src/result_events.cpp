@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "definitions.h"
+#include "result_slots.h"
+#include <hip/hip_runtime_api.h>
+
+/*******************************************************************************
+ * host alloc:
+   Pinned host memory mapped into the address space of the device, the
+   reductions write their results to it directly.
+ ******************************************************************************/
+rocblas_status rocblas_hip_result_events::host_alloc(size_t size, void** host, void** device)
+{
+    if(hipHostMalloc(host, size, hipHostMallocMapped) != hipSuccess)
+    {
+        *host = nullptr;
+        return rocblas_status_memory_error;
+    }
+
+    hipError_t status = hipHostGetDevicePointer(device, *host, 0);
+    if(status != hipSuccess)
+    {
+        PRINT_IF_HIP_ERROR(hipHostFree(*host));
+        *host = nullptr;
+        return get_rocblas_status_for_hip_status(status);
+    }
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_hip_result_events::host_free(void* host)
+{
+    RETURN_IF_HIP_ERROR(hipHostFree(host));
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * create, destroy:
+   The events only order the results, they are not timed.
+ ******************************************************************************/
+rocblas_status rocblas_hip_result_events::create(rocblas_result_event* event)
+{
+    hipEvent_t hip_event;
+    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&hip_event, hipEventDisableTiming));
+
+    *event = hip_event;
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_hip_result_events::destroy(rocblas_result_event event)
+{
+    RETURN_IF_HIP_ERROR(hipEventDestroy((hipEvent_t)event));
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_hip_result_events::record(rocblas_result_event event, hipStream_t stream)
+{
+    RETURN_IF_HIP_ERROR(hipEventRecord((hipEvent_t)event, stream));
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * query:
+   hipErrorNotReady is the answer, not an error.
+ ******************************************************************************/
+rocblas_status rocblas_hip_result_events::query(rocblas_result_event event, bool* complete)
+{
+    hipError_t status = hipEventQuery((hipEvent_t)event);
+
+    *complete = status == hipSuccess;
+    if(status == hipErrorNotReady)
+        return rocblas_status_success;
+
+    RETURN_IF_HIP_ERROR(status);
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_hip_result_events::synchronize(rocblas_result_event event)
+{
+    RETURN_IF_HIP_ERROR(hipEventSynchronize((hipEvent_t)event));
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "result_slots.h"
+#include <string.h>
+
+// the slots call no HIP and include no device code, so that they build and are tested on the
+// host; the events return rocblas_status
+#define RETURN_IF_SLOTS_ERROR(INPUT_STATUS_FOR_CHECK)                 \
+    {                                                                 \
+        rocblas_status TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != rocblas_status_success)            \
+        {                                                             \
+            return TMP_STATUS_FOR_CHECK;                              \
+        }                                                             \
+    }
+
+// slots are handed out at multiples of this many bytes
+#define RESULT_SLOT_ALIGN 16
+#define RESULT_SLOT_ALIGN_UP(size) \
+    (((size) + RESULT_SLOT_ALIGN - 1) / RESULT_SLOT_ALIGN * RESULT_SLOT_ALIGN)
+
+// first size of the ring, thousands of scalar results in flight
+#define RESULT_SLOTS_MIN_CAPACITY 65536
+
+/*******************************************************************************
+ * destructor:
+   The handle delivers the results in flight before, the events of results
+   that could not be delivered are destroyed with the others.
+ ******************************************************************************/
+rocblas_result_slots::~rocblas_result_slots()
+{
+    for(const in_flight& c : commits)
+    {
+        events.destroy(c.event);
+    }
+    for(rocblas_result_event event : free_events)
+    {
+        events.destroy(event);
+    }
+    if(host_slots != nullptr)
+    {
+        events.host_free(host_slots);
+    }
+}
+
+/*******************************************************************************
+ * acquire:
+   Returns the device address of size bytes of free slots, after head or at the
+   start of the ring. While they would overlap slots in flight, the oldest
+   results are waited for and delivered. The ring is grown, never shrunk, when
+   nothing is in flight.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::acquire(size_t size, void** slots)
+{
+    size = RESULT_SLOT_ALIGN_UP(size);
+
+    if(size > capacity)
+    {
+        RETURN_IF_SLOTS_ERROR(synchronize());
+
+        if(host_slots != nullptr)
+        {
+            RETURN_IF_SLOTS_ERROR(events.host_free(host_slots));
+        }
+
+        host_slots   = nullptr;
+        device_slots = nullptr;
+        capacity     = 0;
+        head         = 0;
+
+        size_t new_capacity = RESULT_SLOTS_MIN_CAPACITY;
+        while(new_capacity < size)
+            new_capacity *= 2;
+
+        void* host;
+        void* device;
+        RETURN_IF_SLOTS_ERROR(events.host_alloc(new_capacity, &host, &device));
+
+        host_slots   = (char*)host;
+        device_slots = (char*)device;
+        capacity     = new_capacity;
+    }
+
+    size_t offset = head + size <= capacity ? head : 0;
+
+    while(overlaps_in_flight(offset, size))
+    {
+        bool delivered;
+        RETURN_IF_SLOTS_ERROR(deliver_oldest(true, &delivered));
+
+        // head goes back to the start of the ring when nothing is in flight
+        offset = head + size <= capacity ? head : 0;
+    }
+
+    *slots = device_slots + offset;
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * commit:
+   Records an event on stream after the launch that writes size bytes of
+   acquired slots and puts the slots in flight until the results are delivered
+   to results. The events are reused.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::commit(void* results,
+                                            const void* slots,
+                                            size_t size,
+                                            hipStream_t stream)
+{
+    rocblas_result_event event;
+    if(free_events.empty())
+    {
+        RETURN_IF_SLOTS_ERROR(events.create(&event));
+    }
+    else
+    {
+        event = free_events.back();
+        free_events.pop_back();
+    }
+
+    rocblas_status status = events.record(event, stream);
+    if(status != rocblas_status_success)
+    {
+        free_events.push_back(event);
+        return status;
+    }
+
+    size_t offset = (const char*)slots - device_slots;
+
+    commits.push_back({event, results, offset, size});
+    head = RESULT_SLOT_ALIGN_UP(offset + size);
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * query:
+   Delivers the results in the order of the commits as long as their events
+   have completed, never waits.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::query(rocblas_int* pending)
+{
+    bool delivered = true;
+    while(delivered && !commits.empty())
+    {
+        RETURN_IF_SLOTS_ERROR(deliver_oldest(false, &delivered));
+    }
+
+    *pending = commits.size();
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * synchronize:
+   Waits for and delivers every result in flight.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::synchronize()
+{
+    bool delivered;
+    while(!commits.empty())
+    {
+        RETURN_IF_SLOTS_ERROR(deliver_oldest(true, &delivered));
+    }
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * wait:
+   A quick return writes its results on the host at once. The results in
+   flight to the same memory are older and must not overwrite them later, so
+   they and all the results before them are waited for and delivered first.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::wait(const void* results, size_t size)
+{
+    const char* begin = (const char*)results;
+    const char* end   = begin + size;
+
+    size_t count = 0;
+    for(size_t i = 0; i < commits.size(); i++)
+    {
+        const char* c_begin = (const char*)commits[i].results;
+        const char* c_end   = c_begin + commits[i].size;
+
+        if(c_begin < end && begin < c_end)
+            count = i + 1;
+    }
+
+    bool delivered;
+    for(size_t i = 0; i < count; i++)
+    {
+        RETURN_IF_SLOTS_ERROR(deliver_oldest(true, &delivered));
+    }
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * deliver oldest:
+   Copies the oldest results in flight from the slots to the memory of the
+   caller and frees the slots, if blocking after waiting for the event,
+   otherwise only if the event has completed; delivered tells which.
+ ******************************************************************************/
+rocblas_status rocblas_result_slots::deliver_oldest(bool blocking, bool* delivered)
+{
+    in_flight& oldest = commits.front();
+
+    if(blocking)
+    {
+        RETURN_IF_SLOTS_ERROR(events.synchronize(oldest.event));
+    }
+    else
+    {
+        bool complete;
+        RETURN_IF_SLOTS_ERROR(events.query(oldest.event, &complete));
+        if(!complete)
+        {
+            *delivered = false;
+            return rocblas_status_success;
+        }
+    }
+
+    memcpy(oldest.results, host_slots + oldest.offset, oldest.size);
+
+    free_events.push_back(oldest.event);
+    commits.pop_front();
+
+    if(commits.empty())
+        head = 0;
+
+    *delivered = true;
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * overlaps in flight:
+   Whether slots [offset, offset + size) of the ring are in flight.
+ ******************************************************************************/
+bool rocblas_result_slots::overlaps_in_flight(size_t offset, size_t size) const
+{
+    for(const in_flight& c : commits)
+    {
+        if(c.offset < offset + size && offset < c.offset + c.size)
+            return true;
+    }
+
+    return false;
+}
@@ -68,6 +68,148 @@ extern "C" rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocbla
     }
 }
 
+/*******************************************************************************
+ * ! \brief get reduction mode, can be default or deterministic
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_reduction_mode(rocblas_handle handle,
+                                                     rocblas_reduction_mode* mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    *mode = handle->reduction_mode;
+    log_trace(handle, "rocblas_get_reduction_mode", *mode);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * ! \brief set reduction mode to default or deterministic
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_reduction_mode(rocblas_handle handle,
+                                                     rocblas_reduction_mode mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    else
+    {
+        log_trace(handle, "rocblas_set_reduction_mode", mode);
+        handle->reduction_mode = mode;
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * ! \brief get accumulation mode, can be native, compensated or double
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_accumulation_mode(rocblas_handle handle,
+                                                        rocblas_accumulation_mode* mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    *mode = handle->accumulation_mode;
+    log_trace(handle, "rocblas_get_accumulation_mode", *mode);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * ! \brief set accumulation mode to native, compensated or double
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_accumulation_mode(rocblas_handle handle,
+                                                        rocblas_accumulation_mode mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    else
+    {
+        log_trace(handle, "rocblas_set_accumulation_mode", mode);
+        handle->accumulation_mode = mode;
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * ! \brief get host result mode, can be blocking or async
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_host_result_mode(rocblas_handle handle,
+                                                       rocblas_host_result_mode* mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    *mode = handle->host_result_mode;
+    log_trace(handle, "rocblas_get_host_result_mode", *mode);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * ! \brief set host result mode to blocking or async, the results still in
+ * flight are delivered when it goes back to blocking
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_host_result_mode(rocblas_handle handle,
+                                                       rocblas_host_result_mode mode)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    else
+    {
+        log_trace(handle, "rocblas_set_host_result_mode", mode);
+        if(rocblas_host_result_mode_blocking == mode)
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->result_slots.synchronize());
+        }
+        handle->host_result_mode = mode;
+        return rocblas_status_success;
+    }
+}
+
+/*******************************************************************************
+ * ! \brief deliver the asynchronous host results that have completed
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_query_host_results(rocblas_handle handle, rocblas_int* pending)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    else if(pending == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    log_trace(handle, "rocblas_query_host_results");
+    return handle->result_slots.query(pending);
+}
+
+/*******************************************************************************
+ * ! \brief wait for and deliver all asynchronous host results
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_sync_host_results(rocblas_handle handle)
+{
+    // if handle not valid
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    log_trace(handle, "rocblas_sync_host_results");
+    return handle->result_slots.synchronize();
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright 2016 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "definitions.h"
+#include "transpose_plans.h"
+#include "transpose_segments.h"
+#include <hip/hip_runtime_api.h>
+#include <utility>
+
+// shapes whose plans are kept
+#define TRANSPOSE_PLANS 4
+
+/*******************************************************************************
+ * destructor:
+   hipFree waits for the transposes that still use the plans.
+ ******************************************************************************/
+rocblas_transpose_plans::~rocblas_transpose_plans()
+{
+    for(const plan& p : plans)
+    {
+        if(p.device_segments != nullptr)
+        {
+            PRINT_IF_HIP_ERROR(hipFree(p.device_segments));
+        }
+    }
+}
+
+/*******************************************************************************
+ * get:
+   Returns the cached plan of m by n, or computes it and copies its segments to
+   the device, dropping the plan used least recently beyond TRANSPOSE_PLANS.
+ ******************************************************************************/
+rocblas_status rocblas_transpose_plans::get(rocblas_int m, rocblas_int n, const plan** p)
+{
+    for(auto it = plans.begin(); it != plans.end(); ++it)
+    {
+        if(it->m == m && it->n == n)
+        {
+            if(it != plans.begin())
+            {
+                plan q = std::move(*it);
+                plans.erase(it);
+                plans.push_front(std::move(q));
+            }
+            *p = &plans.front();
+            return rocblas_status_success;
+        }
+    }
+
+    plan q;
+    q.m = m;
+    q.n = n;
+    rocblas_transpose_segments(m, n, q.starts, q.lengths);
+
+    size_t count = q.starts.size();
+    if(count > 0)
+    {
+        if(hipMalloc(&q.device_segments, sizeof(rocblas_int) * 2 * count) != hipSuccess)
+        {
+            return rocblas_status_memory_error;
+        }
+
+        if(hipMemcpy(q.device_segments,
+                     q.starts.data(),
+                     sizeof(rocblas_int) * count,
+                     hipMemcpyHostToDevice) != hipSuccess ||
+           hipMemcpy(q.device_segments + count,
+                     q.lengths.data(),
+                     sizeof(rocblas_int) * count,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            PRINT_IF_HIP_ERROR(hipFree(q.device_segments));
+            return rocblas_status_internal_error;
+        }
+    }
+
+    if(plans.size() == TRANSPOSE_PLANS)
+    {
+        if(plans.back().device_segments != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(plans.back().device_segments));
+        }
+        plans.pop_back();
+    }
+
+    plans.push_front(std::move(q));
+    *p = &plans.front();
+
+    return rocblas_status_success;
+}
@@ -84,3 +84,52 @@ std::string rocblas_diag_letter(rocblas_diagonal diag)
         return " ";
     }
 }
+// return the operation on the transpose of the matrix, the conjugate transpose of a real matrix
+// is its transpose
+rocblas_operation rocblas_transpose_flip(rocblas_operation trans)
+{
+    if(trans == rocblas_operation_none)
+    {
+        return rocblas_operation_transpose;
+    }
+    else if(trans == rocblas_operation_transpose || trans == rocblas_operation_conjugate_transpose)
+    {
+        return rocblas_operation_none;
+    }
+    else
+    {
+        return trans;
+    }
+}
+// return the side of the triangular matrix when the equation is transposed
+rocblas_side rocblas_side_flip(rocblas_side side)
+{
+    if(side == rocblas_side_left)
+    {
+        return rocblas_side_right;
+    }
+    else if(side == rocblas_side_right)
+    {
+        return rocblas_side_left;
+    }
+    else
+    {
+        return side;
+    }
+}
+// return the triangle of the transpose holding the referenced triangle of the matrix
+rocblas_fill rocblas_fill_flip(rocblas_fill fill)
+{
+    if(fill == rocblas_fill_upper)
+    {
+        return rocblas_fill_lower;
+    }
+    else if(fill == rocblas_fill_lower)
+    {
+        return rocblas_fill_upper;
+    }
+    else
+    {
+        return fill;
+    }
+}